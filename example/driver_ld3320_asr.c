@@ -58,36 +58,268 @@ uint8_t ld3320_asr_irq_handler(void)
 }
 
 /**
- * @brief     asr example init
+ * @brief  asr irq latch
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   only latches the irq, run ld3320_asr_service later
+ */
+uint8_t ld3320_asr_irq_latch(void)
+{
+    if (ld3320_irq_latch(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr set the irq edge time
+ * @param[in] edge_us edge time in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      call it before ld3320_asr_irq_handler or ld3320_asr_irq_latch
+ */
+uint8_t ld3320_asr_irq_timestamp(uint32_t edge_us)
+{
+    if (ld3320_irq_timestamp(&gs_handle, edge_us) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief  asr service
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   services the irq latched by ld3320_asr_irq_latch
+ */
+uint8_t ld3320_asr_service(void)
+{
+    if (ld3320_service(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the irq statistics
+ * @param[out] *stats pointer to an irq statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_irq_stats(ld3320_irq_stats_t *stats)
+{
+    if (ld3320_get_irq_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr example poll without the irq line
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       call it again after *interval_ms
+ */
+uint8_t ld3320_asr_poll(uint32_t *interval_ms)
+{
+    if (ld3320_poll(&gs_handle, interval_ms) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the poll statistics
+ * @param[out] *stats pointer to a poll statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_poll_stats(ld3320_poll_stats_t *stats)
+{
+    if (ld3320_get_poll_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr enable or disable the event queue
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      when enabled, events are read by ld3320_asr_poll_event instead of the receive callback
+ */
+uint8_t ld3320_asr_set_event_queue(ld3320_bool_t enable)
+{
+    if (ld3320_set_event_queue(&gs_handle, enable) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr poll one event
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t ld3320_asr_poll_event(ld3320_event_t *event)
+{
+    if (ld3320_poll_event(&gs_handle, event) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the event queue overflow count
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_event_overflow(uint32_t *count)
+{
+    if (ld3320_get_event_overflow(&gs_handle, count) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the event latency
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_event_latency(ld3320_status_t type, ld3320_event_latency_t *latency)
+{
+    if (ld3320_get_event_latency(&gs_handle, type, latency) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the lock statistics
+ * @param[out] *stats pointer to a lock statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_lock_stats(ld3320_lock_stats_t *stats)
+{
+    if (ld3320_get_lock_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr example init a handle
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *context pointer to the device context
  * @param[in] *receive_callback pointer to a receive callback address
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      every chip has its own handle and context, the context is passed to all device callbacks
  */
-uint8_t ld3320_asr_init(void (*receive_callback)(uint8_t type, uint8_t index, char *text))
+uint8_t ld3320_asr_init_handle(ld3320_handle_t *handle, void *context, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text))
 {
     uint8_t res;
     
     /* link driver */
-    DRIVER_LD3320_LINK_INIT(&gs_handle, ld3320_handle_t);
-    DRIVER_LD3320_LINK_SPI_INIT(&gs_handle, ld3320_interface_spi_init);
-    DRIVER_LD3320_LINK_SPI_DEINIT(&gs_handle, ld3320_interface_spi_deinit);
-    DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(&gs_handle, ld3320_interface_spi_read_address16);
-    DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(&gs_handle, ld3320_interface_spi_write_cmd);
-    DRIVER_LD3320_LINK_RESET_GPIO_INIT(&gs_handle, ld3320_interface_reset_gpio_init);
-    DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(&gs_handle, ld3320_interface_reset_gpio_deinit);
-    DRIVER_LD3320_LINK_RESET_GPIO_WRITE(&gs_handle, ld3320_interface_reset_gpio_write);
-    DRIVER_LD3320_LINK_DELAY_MS(&gs_handle, ld3320_interface_delay_ms);
-    DRIVER_LD3320_LINK_DELAY_US(&gs_handle, ld3320_interface_delay_us);
-    DRIVER_LD3320_LINK_DEBUG_PRINT(&gs_handle, ld3320_interface_debug_print);
-    DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(&gs_handle, receive_callback);
-    DRIVER_LD3320_LINK_MP3_READ_INT(&gs_handle, ld3320_interface_mp3_init);
-    DRIVER_LD3320_LINK_MP3_READ_DEINT(&gs_handle, ld3320_interface_mp3_deinit);
-    DRIVER_LD3320_LINK_MP3_READ(&gs_handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_INIT(handle, ld3320_handle_t);
+    DRIVER_LD3320_LINK_CONTEXT(handle, context);
+    DRIVER_LD3320_LINK_SPI_INIT(handle, ld3320_interface_spi_init);
+    DRIVER_LD3320_LINK_SPI_DEINIT(handle, ld3320_interface_spi_deinit);
+    DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(handle, ld3320_interface_spi_read_address16);
+    DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(handle, ld3320_interface_spi_write_cmd);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH(handle, ld3320_interface_spi_write_batch);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(handle, ld3320_interface_spi_write_batch_start);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(handle, ld3320_interface_spi_write_batch_wait);
+    DRIVER_LD3320_LINK_SPI_SET_CLOCK(handle, ld3320_interface_spi_set_clock);
+    DRIVER_LD3320_LINK_RESET_GPIO_INIT(handle, ld3320_interface_reset_gpio_init);
+    DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(handle, ld3320_interface_reset_gpio_deinit);
+    DRIVER_LD3320_LINK_RESET_GPIO_WRITE(handle, ld3320_interface_reset_gpio_write);
+    DRIVER_LD3320_LINK_DELAY_MS(handle, ld3320_interface_delay_ms);
+    DRIVER_LD3320_LINK_DELAY_US(handle, ld3320_interface_delay_us);
+    DRIVER_LD3320_LINK_DEBUG_PRINT(handle, ld3320_interface_debug_print);
+    DRIVER_LD3320_LINK_TIMESTAMP_US(handle, ld3320_interface_timestamp_us);
+    DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(handle, receive_callback);
+    DRIVER_LD3320_LINK_MP3_READ_INT(handle, ld3320_interface_mp3_init);
+    DRIVER_LD3320_LINK_MP3_READ_DEINT(handle, ld3320_interface_mp3_deinit);
+    DRIVER_LD3320_LINK_MP3_READ(handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_MP3_ACQUIRE(handle, ld3320_interface_mp3_acquire);
+    DRIVER_LD3320_LINK_MP3_RELEASE(handle, ld3320_interface_mp3_release);
+    DRIVER_LD3320_LINK_MUTEX_LOCK(handle, ld3320_interface_mutex_lock);
+    DRIVER_LD3320_LINK_MUTEX_TRYLOCK(handle, ld3320_interface_mutex_trylock);
+    DRIVER_LD3320_LINK_MUTEX_UNLOCK(handle, ld3320_interface_mutex_unlock);
     
     /* init chip */
-    res = ld3320_init(&gs_handle);
+    res = ld3320_init(handle);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: init failed.\n");
@@ -96,31 +328,31 @@ uint8_t ld3320_asr_init(void (*receive_callback)(uint8_t type, uint8_t index, ch
     }
     
     /* set asr mode */
-    res = ld3320_set_mode(&gs_handle, LD3320_MODE_ASR);
+    res = ld3320_set_mode(handle, LD3320_MODE_ASR);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: set mode failed.\n");
-        (void)ld3320_deinit(&gs_handle);
+        (void)ld3320_deinit(handle);
         
         return 1;
     }
     
     /* set default mic gain */
-    res = ld3320_set_mic_gain(&gs_handle, LD3320_ASR_DEFAULT_MIC_GAIN);
+    res = ld3320_set_mic_gain(handle, LD3320_ASR_DEFAULT_MIC_GAIN);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: set mic gain failed.\n");
-        (void)ld3320_deinit(&gs_handle);
+        (void)ld3320_deinit(handle);
         
         return 1;
     }
     
     /* set default vad */
-    res = ld3320_set_vad(&gs_handle, LD3320_ASR_DEFAULT_VAD);
+    res = ld3320_set_vad(handle, LD3320_ASR_DEFAULT_VAD);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: set vad failed.\n");
-        (void)ld3320_deinit(&gs_handle);
+        (void)ld3320_deinit(handle);
         
         return 1;
     }
@@ -128,6 +360,19 @@ uint8_t ld3320_asr_init(void (*receive_callback)(uint8_t type, uint8_t index, ch
     return 0;
 }
 
+/**
+ * @brief     asr example init
+ * @param[in] *receive_callback pointer to a receive callback address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_asr_init(void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text))
+{
+    return ld3320_asr_init_handle(&gs_handle, NULL, receive_callback);
+}
+
 /**
  * @brief     asr example set keys
  * @param[in] **text pointer to a text buffer
@@ -152,6 +397,57 @@ uint8_t ld3320_asr_set_keys(char (*text)[50], uint8_t len)
     }
 }
 
+/**
+ * @brief     asr example set keys from a pointer list
+ * @param[in] **text pointer to a key word pointer list
+ * @param[in] len text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set keys failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_key_list(const char *const *text, uint8_t len)
+{
+    uint8_t res;
+    
+    res = ld3320_set_key_word_list(&gs_handle, text, len);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr example set keys from utf-8 texts
+ * @param[in] **text pointer to a utf-8 text pointer list
+ * @param[in] len text length
+ * @param[in] *override pointer to a pinyin override list
+ * @param[in] override_len override list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set keys failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_keys_utf8(const char *const *text, uint8_t len, 
+                                 const ld3320_pinyin_override_t *override, uint16_t override_len)
+{
+    uint8_t res;
+    
+    res = ld3320_set_key_words_utf8(&gs_handle, text, len, override, override_len);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  asr example start
  * @return status code
@@ -175,6 +471,185 @@ uint8_t ld3320_asr_start(void)
     }
 }
 
+/**
+ * @brief  asr example start without blocking
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   run ld3320_asr_step until the delay is 0
+ */
+uint8_t ld3320_asr_start_async(void)
+{
+    if (ld3320_start_async(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr example run the async start
+ * @param[out] *delay_ms pointer to a next deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 step failed
+ * @note       call again after *delay_ms, 0 means the asr is running
+ */
+uint8_t ld3320_asr_step(uint32_t *delay_ms)
+{
+    if (ld3320_step(&gs_handle, delay_ms) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the start statistics
+ * @param[out] *stats pointer to a start statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_start_stats(ld3320_start_stats_t *stats)
+{
+    if (ld3320_get_start_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the asr ready statistics
+ * @param[out] *stats pointer to an asr ready statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_ready_stats(ld3320_asr_ready_stats_t *stats)
+{
+    if (ld3320_get_asr_ready_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr set the rearm mode
+ * @param[in] rearm asr rearm mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_rearm(ld3320_asr_rearm_t rearm)
+{
+    if (ld3320_set_asr_rearm(&gs_handle, rearm) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the rearm statistics
+ * @param[out] *stats pointer to a rearm statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_rearm_stats(ld3320_rearm_stats_t *stats)
+{
+    if (ld3320_get_rearm_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the key word upload statistics
+ * @param[out] *stats pointer to a key word statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_key_word_stats(ld3320_key_word_stats_t *stats)
+{
+    if (ld3320_get_key_word_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     asr set the grammar
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      NULL detaches the grammar
+ */
+uint8_t ld3320_asr_set_grammar(ld3320_grammar_t *grammar)
+{
+    if (ld3320_set_grammar(&gs_handle, grammar) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      asr get the grammar statistics
+ * @param[out] *stats pointer to a grammar statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_grammar_stats(ld3320_grammar_stats_t *stats)
+{
+    if (ld3320_get_grammar_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  asr example stop
  * @return status code
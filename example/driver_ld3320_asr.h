@@ -38,6 +38,7 @@
 #define DRIVER_LD3320_ASR_H
 
 #include "driver_ld3320_interface.h"
+#include "driver_ld3320_pinyin.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -65,6 +66,127 @@ extern "C"{
  */
 uint8_t ld3320_asr_irq_handler(void);
 
+/**
+ * @brief  asr irq latch
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   only latches the irq, run ld3320_asr_service later
+ */
+uint8_t ld3320_asr_irq_latch(void);
+
+/**
+ * @brief     asr set the irq edge time
+ * @param[in] edge_us edge time in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      call it before ld3320_asr_irq_handler or ld3320_asr_irq_latch
+ */
+uint8_t ld3320_asr_irq_timestamp(uint32_t edge_us);
+
+/**
+ * @brief  asr service
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   services the irq latched by ld3320_asr_irq_latch
+ */
+uint8_t ld3320_asr_service(void);
+
+/**
+ * @brief      asr get the irq statistics
+ * @param[out] *stats pointer to an irq statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_irq_stats(ld3320_irq_stats_t *stats);
+
+/**
+ * @brief      asr example poll without the irq line
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       call it again after *interval_ms
+ */
+uint8_t ld3320_asr_poll(uint32_t *interval_ms);
+
+/**
+ * @brief      asr get the poll statistics
+ * @param[out] *stats pointer to a poll statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_poll_stats(ld3320_poll_stats_t *stats);
+
+/**
+ * @brief     asr enable or disable the event queue
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      when enabled, events are read by ld3320_asr_poll_event instead of the receive callback
+ */
+uint8_t ld3320_asr_set_event_queue(ld3320_bool_t enable);
+
+/**
+ * @brief      asr poll one event
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t ld3320_asr_poll_event(ld3320_event_t *event);
+
+/**
+ * @brief      asr get the event queue overflow count
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_event_overflow(uint32_t *count);
+
+/**
+ * @brief      asr get the event latency
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_event_latency(ld3320_status_t type, ld3320_event_latency_t *latency);
+
+/**
+ * @brief      asr get the lock statistics
+ * @param[out] *stats pointer to a lock statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_lock_stats(ld3320_lock_stats_t *stats);
+
+/**
+ * @brief     asr example init a handle
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *context pointer to the device context
+ * @param[in] *receive_callback pointer to a receive callback address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every chip has its own handle and context, the context is passed to all device callbacks
+ */
+uint8_t ld3320_asr_init_handle(ld3320_handle_t *handle, void *context, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text));
+
 /**
  * @brief     asr example init
  * @param[in] *receive_callback pointer to a receive callback address
@@ -73,7 +195,7 @@ uint8_t ld3320_asr_irq_handler(void);
  *            - 1 init failed
  * @note      none
  */
-uint8_t ld3320_asr_init(void (*receive_callback)(uint8_t type, uint8_t index, char *text));
+uint8_t ld3320_asr_init(void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text));
 
 /**
  * @brief  asr example deinit
@@ -95,6 +217,31 @@ uint8_t ld3320_asr_deinit(void);
  */
 uint8_t ld3320_asr_set_keys(char (*text)[50], uint8_t len);
 
+/**
+ * @brief     asr example set keys from a pointer list
+ * @param[in] **text pointer to a key word pointer list
+ * @param[in] len text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set keys failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_key_list(const char *const *text, uint8_t len);
+
+/**
+ * @brief     asr example set keys from utf-8 texts
+ * @param[in] **text pointer to a utf-8 text pointer list
+ * @param[in] len text length
+ * @param[in] *override pointer to a pinyin override list
+ * @param[in] override_len override list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set keys failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_keys_utf8(const char *const *text, uint8_t len, 
+                                 const ld3320_pinyin_override_t *override, uint16_t override_len);
+
 /**
  * @brief  asr example start
  * @return status code
@@ -104,6 +251,95 @@ uint8_t ld3320_asr_set_keys(char (*text)[50], uint8_t len);
  */
 uint8_t ld3320_asr_start(void);
 
+/**
+ * @brief  asr example start without blocking
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   run ld3320_asr_step until the delay is 0
+ */
+uint8_t ld3320_asr_start_async(void);
+
+/**
+ * @brief      asr example run the async start
+ * @param[out] *delay_ms pointer to a next deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 step failed
+ * @note       call again after *delay_ms, 0 means the asr is running
+ */
+uint8_t ld3320_asr_step(uint32_t *delay_ms);
+
+/**
+ * @brief      asr get the start statistics
+ * @param[out] *stats pointer to a start statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_start_stats(ld3320_start_stats_t *stats);
+
+/**
+ * @brief      asr get the asr ready statistics
+ * @param[out] *stats pointer to an asr ready statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_ready_stats(ld3320_asr_ready_stats_t *stats);
+
+/**
+ * @brief     asr set the rearm mode
+ * @param[in] rearm asr rearm mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t ld3320_asr_set_rearm(ld3320_asr_rearm_t rearm);
+
+/**
+ * @brief      asr get the rearm statistics
+ * @param[out] *stats pointer to a rearm statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_rearm_stats(ld3320_rearm_stats_t *stats);
+
+/**
+ * @brief      asr get the key word upload statistics
+ * @param[out] *stats pointer to a key word statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_key_word_stats(ld3320_key_word_stats_t *stats);
+
+/**
+ * @brief     asr set the grammar
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      NULL detaches the grammar
+ */
+uint8_t ld3320_asr_set_grammar(ld3320_grammar_t *grammar);
+
+/**
+ * @brief      asr get the grammar statistics
+ * @param[out] *stats pointer to a grammar statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_asr_get_grammar_stats(ld3320_grammar_stats_t *stats);
+
 /**
  * @brief  asr example stop
  * @return status code
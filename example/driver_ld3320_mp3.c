@@ -58,37 +58,209 @@ uint8_t ld3320_mp3_irq_handler(void)
 }
 
 /**
- * @brief     mp3 example init
+ * @brief  mp3 irq latch
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   only latches the irq, run ld3320_mp3_service later
+ */
+uint8_t ld3320_mp3_irq_latch(void)
+{
+    if (ld3320_irq_latch(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     mp3 set the irq edge time
+ * @param[in] edge_us edge time in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      call it before ld3320_mp3_irq_handler or ld3320_mp3_irq_latch
+ */
+uint8_t ld3320_mp3_irq_timestamp(uint32_t edge_us)
+{
+    if (ld3320_irq_timestamp(&gs_handle, edge_us) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief  mp3 service
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   services the irq latched by ld3320_mp3_irq_latch
+ */
+uint8_t ld3320_mp3_service(void)
+{
+    if (ld3320_service(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      mp3 example poll without the irq line
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       call it again after *interval_ms
+ */
+uint8_t ld3320_mp3_poll(uint32_t *interval_ms)
+{
+    if (ld3320_poll(&gs_handle, interval_ms) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      mp3 get the poll statistics
+ * @param[out] *stats pointer to a poll statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_mp3_get_poll_stats(ld3320_poll_stats_t *stats)
+{
+    if (ld3320_get_poll_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     mp3 enable or disable the event queue
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      when enabled, events are read by ld3320_mp3_poll_event instead of the receive callback
+ */
+uint8_t ld3320_mp3_set_event_queue(ld3320_bool_t enable)
+{
+    if (ld3320_set_event_queue(&gs_handle, enable) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      mp3 poll one event
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t ld3320_mp3_poll_event(ld3320_event_t *event)
+{
+    if (ld3320_poll_event(&gs_handle, event) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      mp3 get the event latency
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_mp3_get_event_latency(ld3320_status_t type, ld3320_event_latency_t *latency)
+{
+    if (ld3320_get_event_latency(&gs_handle, type, latency) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     mp3 example init a handle
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *context pointer to the device context
  * @param[in] *name pointer to a mp3 file name buffer
  * @param[in] *receive_callback pointer to a receive callback address
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      every chip has its own handle and context, the context is passed to all device callbacks
  */
-uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(uint8_t type, uint8_t index, char *text))
+uint8_t ld3320_mp3_init_handle(ld3320_handle_t *handle, void *context, char *name, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text))
 {
     uint8_t res;
     
     /* link driver */
-    DRIVER_LD3320_LINK_INIT(&gs_handle, ld3320_handle_t);
-    DRIVER_LD3320_LINK_SPI_INIT(&gs_handle, ld3320_interface_spi_init);
-    DRIVER_LD3320_LINK_SPI_DEINIT(&gs_handle, ld3320_interface_spi_deinit);
-    DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(&gs_handle, ld3320_interface_spi_read_address16);
-    DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(&gs_handle, ld3320_interface_spi_write_cmd);
-    DRIVER_LD3320_LINK_RESET_GPIO_INIT(&gs_handle, ld3320_interface_reset_gpio_init);
-    DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(&gs_handle, ld3320_interface_reset_gpio_deinit);
-    DRIVER_LD3320_LINK_RESET_GPIO_WRITE(&gs_handle, ld3320_interface_reset_gpio_write);
-    DRIVER_LD3320_LINK_DELAY_MS(&gs_handle, ld3320_interface_delay_ms);
-    DRIVER_LD3320_LINK_DELAY_US(&gs_handle, ld3320_interface_delay_us);
-    DRIVER_LD3320_LINK_DEBUG_PRINT(&gs_handle, ld3320_interface_debug_print);
-    DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(&gs_handle, receive_callback);
-    DRIVER_LD3320_LINK_MP3_READ_INT(&gs_handle, ld3320_interface_mp3_init);
-    DRIVER_LD3320_LINK_MP3_READ_DEINT(&gs_handle, ld3320_interface_mp3_deinit);
-    DRIVER_LD3320_LINK_MP3_READ(&gs_handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_INIT(handle, ld3320_handle_t);
+    DRIVER_LD3320_LINK_CONTEXT(handle, context);
+    DRIVER_LD3320_LINK_SPI_INIT(handle, ld3320_interface_spi_init);
+    DRIVER_LD3320_LINK_SPI_DEINIT(handle, ld3320_interface_spi_deinit);
+    DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(handle, ld3320_interface_spi_read_address16);
+    DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(handle, ld3320_interface_spi_write_cmd);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH(handle, ld3320_interface_spi_write_batch);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(handle, ld3320_interface_spi_write_batch_start);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(handle, ld3320_interface_spi_write_batch_wait);
+    DRIVER_LD3320_LINK_SPI_SET_CLOCK(handle, ld3320_interface_spi_set_clock);
+    DRIVER_LD3320_LINK_RESET_GPIO_INIT(handle, ld3320_interface_reset_gpio_init);
+    DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(handle, ld3320_interface_reset_gpio_deinit);
+    DRIVER_LD3320_LINK_RESET_GPIO_WRITE(handle, ld3320_interface_reset_gpio_write);
+    DRIVER_LD3320_LINK_DELAY_MS(handle, ld3320_interface_delay_ms);
+    DRIVER_LD3320_LINK_DELAY_US(handle, ld3320_interface_delay_us);
+    DRIVER_LD3320_LINK_DEBUG_PRINT(handle, ld3320_interface_debug_print);
+    DRIVER_LD3320_LINK_TIMESTAMP_US(handle, ld3320_interface_timestamp_us);
+    DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(handle, receive_callback);
+    DRIVER_LD3320_LINK_MP3_READ_INT(handle, ld3320_interface_mp3_init);
+    DRIVER_LD3320_LINK_MP3_READ_DEINT(handle, ld3320_interface_mp3_deinit);
+    DRIVER_LD3320_LINK_MP3_READ(handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_MP3_ACQUIRE(handle, ld3320_interface_mp3_acquire);
+    DRIVER_LD3320_LINK_MP3_RELEASE(handle, ld3320_interface_mp3_release);
+    DRIVER_LD3320_LINK_MUTEX_LOCK(handle, ld3320_interface_mutex_lock);
+    DRIVER_LD3320_LINK_MUTEX_TRYLOCK(handle, ld3320_interface_mutex_trylock);
+    DRIVER_LD3320_LINK_MUTEX_UNLOCK(handle, ld3320_interface_mutex_unlock);
     
     /* init chip */
-    res = ld3320_init(&gs_handle);
+    res = ld3320_init(handle);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: init failed.\n");
@@ -97,21 +269,31 @@ uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(uint8_t type, uint8
     }
     
     /* set mp3 mode */
-    res = ld3320_set_mode(&gs_handle, LD3320_MODE_MP3);
+    res = ld3320_set_mode(handle, LD3320_MODE_MP3);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: set mode failed.\n");
-        (void)ld3320_deinit(&gs_handle);
+        (void)ld3320_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* set mp3 feed mode */
+    res = ld3320_set_mp3_feed_mode(handle, LD3320_MP3_DEFAULT_FEED_MODE);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set mp3 feed mode failed.\n");
+        (void)ld3320_deinit(handle);
         
         return 1;
     }
     
     /* configure the mp3 */
-    res = ld3320_configure_mp3(&gs_handle, name);
+    res = ld3320_configure_mp3(handle, name);
     if (res != 0)
     {
         ld3320_interface_debug_print("ld3320: configure mp3 failed.\n");
-        (void)ld3320_deinit(&gs_handle);
+        (void)ld3320_deinit(handle);
         
         return 1;
     }
@@ -119,6 +301,20 @@ uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(uint8_t type, uint8
     return 0;
 }
 
+/**
+ * @brief     mp3 example init
+ * @param[in] *name pointer to a mp3 file name buffer
+ * @param[in] *receive_callback pointer to a receive callback address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text))
+{
+    return ld3320_mp3_init_handle(&gs_handle, NULL, name, receive_callback);
+}
+
 /**
  * @brief  mp3 example start
  * @return status code
@@ -51,8 +51,9 @@ extern "C"{
 /**
  * @brief ld3320 mp3 example default definition
  */
-#define LD3320_MP3_DEFAULT_SPEAKER_VOLUME          1        /**< level 1 */
-#define LD3320_MP3_DEFAULT_HEADERSET_VOLUME        1        /**< level 1 */
+#define LD3320_MP3_DEFAULT_SPEAKER_VOLUME          1                                 /**< level 1 */
+#define LD3320_MP3_DEFAULT_HEADERSET_VOLUME        1                                 /**< level 1 */
+#define LD3320_MP3_DEFAULT_FEED_MODE               LD3320_MP3_FEED_MODE_BURST        /**< burst feed mode */
 
 /**
  * @brief  mp3 irq
@@ -63,6 +64,98 @@ extern "C"{
  */
 uint8_t ld3320_mp3_irq_handler(void);
 
+/**
+ * @brief  mp3 irq latch
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   only latches the irq, run ld3320_mp3_service later
+ */
+uint8_t ld3320_mp3_irq_latch(void);
+
+/**
+ * @brief     mp3 set the irq edge time
+ * @param[in] edge_us edge time in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      call it before ld3320_mp3_irq_handler or ld3320_mp3_irq_latch
+ */
+uint8_t ld3320_mp3_irq_timestamp(uint32_t edge_us);
+
+/**
+ * @brief  mp3 service
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   services the irq latched by ld3320_mp3_irq_latch
+ */
+uint8_t ld3320_mp3_service(void);
+
+/**
+ * @brief      mp3 example poll without the irq line
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       call it again after *interval_ms
+ */
+uint8_t ld3320_mp3_poll(uint32_t *interval_ms);
+
+/**
+ * @brief      mp3 get the poll statistics
+ * @param[out] *stats pointer to a poll statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_mp3_get_poll_stats(ld3320_poll_stats_t *stats);
+
+/**
+ * @brief     mp3 enable or disable the event queue
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      when enabled, events are read by ld3320_mp3_poll_event instead of the receive callback
+ */
+uint8_t ld3320_mp3_set_event_queue(ld3320_bool_t enable);
+
+/**
+ * @brief      mp3 poll one event
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t ld3320_mp3_poll_event(ld3320_event_t *event);
+
+/**
+ * @brief      mp3 get the event latency
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ld3320_mp3_get_event_latency(ld3320_status_t type, ld3320_event_latency_t *latency);
+
+/**
+ * @brief     mp3 example init a handle
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *context pointer to the device context
+ * @param[in] *name pointer to a mp3 file name buffer
+ * @param[in] *receive_callback pointer to a receive callback address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every chip has its own handle and context, the context is passed to all device callbacks
+ */
+uint8_t ld3320_mp3_init_handle(ld3320_handle_t *handle, void *context, char *name, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text));
+
 /**
  * @brief     mp3 example init
  * @param[in] *name pointer to a mp3 file name buffer
@@ -72,7 +165,7 @@ uint8_t ld3320_mp3_irq_handler(void);
  *            - 1 init failed
  * @note      none
  */
-uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(uint8_t type, uint8_t index, char *text));
+uint8_t ld3320_mp3_init(char *name, void (*receive_callback)(void *context, uint8_t type, uint8_t index, char *text));
 
 /**
  * @brief  mp3 example deinit
@@ -51,25 +51,28 @@ extern "C"{
  */
 
 /**
- * @brief  interface spi bus init
- * @return status code
- *         - 0 success
- *         - 1 spi init failed
- * @note   none
+ * @brief     interface spi bus init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      none
  */
-uint8_t ld3320_interface_spi_init(void);
+uint8_t ld3320_interface_spi_init(void *context);
 
 /**
- * @brief  interface spi bus deinit
- * @return status code
- *         - 0 success
- *         - 1 spi deinit failed
- * @note   none
+ * @brief     interface spi bus deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_spi_deinit(void);
+uint8_t ld3320_interface_spi_deinit(void *context);
 
 /**
  * @brief      interface spi bus read
+ * @param[in]  *context pointer to the device context
  * @param[in]  reg register address
  * @param[out] *buf pointer to a data buffer
  * @param[in]  len length of data buffer
@@ -78,10 +81,11 @@ uint8_t ld3320_interface_spi_deinit(void);
  *             - 1 read failed
  * @note       none
  */
-uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t len);
+uint8_t ld3320_interface_spi_read_address16(void *context, uint16_t reg, uint8_t *buf, uint16_t len);
 
 /**
  * @brief     interface spi bus write
+ * @param[in] *context pointer to the device context
  * @param[in] *buf pointer to a data buffer
  * @param[in] len length of data buffer
  * @return    status code
@@ -89,35 +93,83 @@ uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_spi_write_cmd(uint8_t *buf, uint16_t len);
+uint8_t ld3320_interface_spi_write_cmd(void *context, uint8_t *buf, uint16_t len);
 
 /**
- * @brief  interface reset gpio init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief     interface spi bus write batch
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      buf holds len / 3 write commands and every 3 bytes command has its own chip select frame
  */
-uint8_t ld3320_interface_reset_gpio_init(void);
+uint8_t ld3320_interface_spi_write_batch(void *context, uint8_t *buf, uint16_t len);
 
 /**
- * @brief  interface reset gpio deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     interface spi bus write batch start
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch start failed
+ * @note      buf must stay valid until ld3320_interface_spi_write_batch_wait returns
+ */
+uint8_t ld3320_interface_spi_write_batch_start(void *context, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     interface spi bus write batch wait
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      none
+ */
+uint8_t ld3320_interface_spi_write_batch_wait(void *context);
+
+/**
+ * @brief     interface spi bus set clock
+ * @param[in] *context pointer to the device context
+ * @param[in] hz spi clock in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 set clock failed
+ * @note      the nearest supported clock not over hz is used
+ */
+uint8_t ld3320_interface_spi_set_clock(void *context, uint32_t hz);
+
+/**
+ * @brief     interface reset gpio init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_interface_reset_gpio_init(void *context);
+
+/**
+ * @brief     interface reset gpio deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_deinit(void);
+uint8_t ld3320_interface_reset_gpio_deinit(void *context);
 
 /**
  * @brief     interface reset gpio write
+ * @param[in] *context pointer to the device context
  * @param[in] data written data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_write(uint8_t data);
+uint8_t ld3320_interface_reset_gpio_write(void *context, uint8_t data);
 
 /**
  * @brief     interface delay ms
@@ -133,6 +185,13 @@ void ld3320_interface_delay_ms(uint32_t ms);
  */
 void ld3320_interface_delay_us(uint32_t us);
 
+/**
+ * @brief  interface timestamp us
+ * @return current timestamp in us
+ * @note   none
+ */
+uint32_t ld3320_interface_timestamp_us(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -142,6 +201,7 @@ void ld3320_interface_debug_print(const char *const fmt, ...);
 
 /**
  * @brief      interface mp3 init
+ * @param[in]  *context pointer to the device context
  * @param[in]  *name pointer to a name buffer
  * @param[out] *size pointer to a file size buffer
  * @return     status code
@@ -149,19 +209,21 @@ void ld3320_interface_debug_print(const char *const fmt, ...);
  *             - 1 mp3 init failed
  * @note       none
  */
-uint8_t ld3320_interface_mp3_init(char *name, uint32_t *size);
+uint8_t ld3320_interface_mp3_init(void *context, char *name, uint32_t *size);
 
 /**
- * @brief  interface mp3 deinit
- * @return status code
- *         - 0 success
- *         - 1 mp3 deinit failed
- * @note   none
+ * @brief     interface mp3 deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_mp3_deinit(void);
+uint8_t ld3320_interface_mp3_deinit(void *context);
 
 /**
  * @brief      interface mp3 read
+ * @param[in]  *context pointer to the device context
  * @param[in]  addr mp3 file address
  * @param[in]  size read size
  * @param[out] *buffer pointer to a data buffer
@@ -170,16 +232,73 @@ uint8_t ld3320_interface_mp3_deinit(void);
  *             - 1 mp3 read failed
  * @note       none
  */
-uint8_t ld3320_interface_mp3_read(uint32_t addr, uint16_t size, uint8_t *buffer);
+uint8_t ld3320_interface_mp3_read(void *context, uint32_t addr, uint16_t size, uint8_t *buffer);
+
+/**
+ * @brief      interface mp3 acquire
+ * @param[in]  *context pointer to the device context
+ * @param[in]  addr mp3 file address
+ * @param[in]  size max acquired size
+ * @param[out] **buffer pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mp3 acquire failed
+ * @note       the lent data must stay valid until the mp3 release
+ */
+uint8_t ld3320_interface_mp3_acquire(void *context, uint32_t addr, uint32_t size, uint8_t **buffer, uint32_t *len);
+
+/**
+ * @brief     interface mp3 release
+ * @param[in] *context pointer to the device context
+ * @param[in] addr mp3 file address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 release failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mp3_release(void *context, uint32_t addr, uint32_t len);
+
+/**
+ * @brief     interface mutex lock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      must be recursive if receive_callback calls the driver api
+ */
+uint8_t ld3320_interface_mutex_lock(void *context);
+
+/**
+ * @brief     interface mutex trylock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mutex is busy
+ * @note      none
+ */
+uint8_t ld3320_interface_mutex_trylock(void *context);
+
+/**
+ * @brief     interface mutex unlock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mutex_unlock(void *context);
 
 /**
  * @brief     interface receive callback
+ * @param[in] *context pointer to the device context
  * @param[in] type receive callback type
  * @param[in] ind index
  * @param[in] *text pointer to a text buffer
  * @note      none
  */
-void ld3320_interface_receive_callback(uint8_t type, uint8_t ind, char *text);
+void ld3320_interface_receive_callback(void *context, uint8_t type, uint8_t ind, char *text);
 
 /**
  * @}
@@ -34,47 +34,104 @@
  * </table>
  */
 
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                     /**< recursive mutex initializer */
+#endif
+
 #include "driver_ld3320_interface.h"
 #include "spi.h"
 #include "wire.h"
+#include "read_ahead.h"
+#include "ld3320_device.h"
+#include "gpio.h"
 #include <stdarg.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
 
 /**
  * @brief spi device name definition
  */
 #define SPI_DEVICE_NAME "/dev/spidev0.0"    /**< spi device name */
+
 /**
- * @brief spi device handle definition
+ * @brief default device definition
  */
-static int gs_fd;                           /**< spi handle */
-static FILE *gs_fp = NULL;                  /**< fp handle */
+static ld3320_device_t gs_device =
+{
+    .spi_name = SPI_DEVICE_NAME,
+    .spi_fd = -1,
+    .irq_fd = -1,
+    .mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP,
+};                                          /**< device of the NULL context */
 
 /**
- * @brief  interface spi bus init
- * @return status code
- *         - 0 success
- *         - 1 spi init failed
- * @note   none
+ * @brief mp3 mmap reader definition
+ */
+#ifndef MP3_MMAP_ENABLE
+    #define MP3_MMAP_ENABLE 1               /**< use mmap for regular files */
+#endif
+#define MP3_PREFETCH_SIZE (64 * 1024)       /**< prefetch window ahead of the play point */
+#define MP3_STREAM_CHUNK (64 * 1024)        /**< first buffer of a non-seekable input, doubled when full */
+
+/**
+ * @brief mp3 read ahead definition
  */
-uint8_t ld3320_interface_spi_init(void)
+#ifndef MP3_READ_AHEAD_ENABLE
+    #define MP3_READ_AHEAD_ENABLE 0         /**< fill a ring from a producer thread, one ring for all devices */
+#endif
+
+/**
+ * @brief     get the device of a context
+ * @param[in] *context pointer to the device context
+ * @return    pointer to a device structure
+ * @note      the NULL context is the default device
+ */
+static ld3320_device_t *a_ld3320_device(void *context)
 {
-    return spi_init(SPI_DEVICE_NAME, &gs_fd, SPI_MODE_TYPE_2, 1000 * 1000);
+    return (context != NULL) ? (ld3320_device_t *)context : &gs_device;
 }
 
 /**
- * @brief  interface spi bus deinit
- * @return status code
- *         - 0 success
- *         - 1 spi deinit failed
- * @note   none
+ * @brief     interface spi bus init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      none
  */
-uint8_t ld3320_interface_spi_deinit(void)
+uint8_t ld3320_interface_spi_init(void *context)
 {
-    return spi_deinit(gs_fd);
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    if (spi_init(device->spi_name, &device->spi_fd, SPI_MODE_TYPE_2, 1000 * 1000) != 0)
+    {
+        return 1;
+    }
+    
+    return spi_queue_init(&device->queue, device->spi_fd);
+}
+
+/**
+ * @brief     interface spi bus deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      none
+ */
+uint8_t ld3320_interface_spi_deinit(void *context)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    return spi_deinit(device->spi_fd);
 }
 
 /**
  * @brief      interface spi bus read
+ * @param[in]  *context pointer to the device context
  * @param[in]  reg register address
  * @param[out] *buf pointer to a data buffer
  * @param[in]  len length of data buffer
@@ -83,13 +140,21 @@ uint8_t ld3320_interface_spi_deinit(void)
  *             - 1 read failed
  * @note       none
  */
-uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t len)
+uint8_t ld3320_interface_spi_read_address16(void *context, uint16_t reg, uint8_t *buf, uint16_t len)
 {
-    return spi_read_address16(gs_fd, reg, buf, len);
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    if (spi_queue_read_address16(&device->queue, reg, buf, len, 0) != 0)
+    {
+        return 1;
+    }
+    
+    return spi_queue_flush(&device->queue);
 }
 
 /**
  * @brief     interface spi bus write
+ * @param[in] *context pointer to the device context
  * @param[in] *buf pointer to a data buffer
  * @param[in] len length of data buffer
  * @return    status code
@@ -97,9 +162,85 @@ uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
+uint8_t ld3320_interface_spi_write_cmd(void *context, uint8_t *buf, uint16_t len)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    return spi_write_cmd(device->spi_fd, buf, len);
+}
+
+/**
+ * @brief     interface spi bus write batch
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      buf holds len / 3 write commands and every 3 bytes command has its own chip select frame,
+ *            all commands are queued and sent by one SPI_IOC_MESSAGE(n) ioctl
+ */
+uint8_t ld3320_interface_spi_write_batch(void *context, uint8_t *buf, uint16_t len)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    uint16_t i;
+    
+    for (i = 0; i + 3 <= len; i += 3)
+    {
+        if (spi_queue_write_cmd(&device->queue, buf + i, 3, 0) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return spi_queue_flush(&device->queue);
+}
+
+/**
+ * @brief     interface spi bus write batch start
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch start failed
+ * @note      spidev has no asynchronous transfer, the batch is sent before return
+ */
+uint8_t ld3320_interface_spi_write_batch_start(void *context, uint8_t *buf, uint16_t len)
+{
+    return ld3320_interface_spi_write_batch(context, buf, len);
+}
+
+/**
+ * @brief     interface spi bus write batch wait
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      none
+ */
+uint8_t ld3320_interface_spi_write_batch_wait(void *context)
 {
-    return spi_write_cmd(gs_fd, buf, len);
+    (void)context;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus set clock
+ * @param[in] *context pointer to the device context
+ * @param[in] hz spi clock in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 set clock failed
+ * @note      the nearest supported clock not over hz is used
+ */
+uint8_t ld3320_interface_spi_set_clock(void *context, uint32_t hz)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    return spi_set_freq(device->spi_fd, hz);
 }
 
 /**
@@ -122,33 +263,182 @@ void ld3320_interface_delay_us(uint32_t us)
     usleep(us);
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return current timestamp in us
+ * @note   none
+ */
+uint32_t ld3320_interface_timestamp_us(void)
+{
+    return gpio_now_us();
+}
+
+/**
+ * @brief      read a non-seekable mp3 input into memory
+ * @param[in]  *device pointer to a device structure
+ * @param[out] *size pointer to a file size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the size of a pipe is only known at its end, so the whole stream is buffered,
+ *             device->fp is closed in any case
+ */
+static uint8_t a_ld3320_mp3_read_stream(ld3320_device_t *device, uint32_t *size)
+{
+    uint8_t *buf = NULL;
+    uint8_t *grow;
+    size_t cap = 0;
+    size_t len = 0;
+    size_t n;
+    
+    /* read until the end */
+    while (1)
+    {
+        if (len == cap)
+        {
+            if (cap >= 0x80000000U)
+            {
+                free(buf);
+                (void)fclose(device->fp);
+                device->fp = NULL;
+                
+                return 1;
+            }
+            cap = (cap == 0) ? MP3_STREAM_CHUNK : cap * 2;
+            grow = (uint8_t *)realloc(buf, cap);
+            if (grow == NULL)
+            {
+                free(buf);
+                (void)fclose(device->fp);
+                device->fp = NULL;
+                
+                return 1;
+            }
+            buf = grow;
+        }
+        n = fread((void *)(buf + len), 1, cap - len, device->fp);
+        len += n;
+        if (n == 0)
+        {
+            break;
+        }
+    }
+    if ((ferror(device->fp) != 0) || (len == 0))
+    {
+        free(buf);
+        (void)fclose(device->fp);
+        device->fp = NULL;
+        
+        return 1;
+    }
+    (void)fclose(device->fp);
+    device->fp = NULL;
+    
+    /* serve it like a mapped file without prefetch */
+    device->map = buf;
+    device->map_size = (uint32_t)len;
+    device->map_heap = 1;
+    device->prefetch = device->map_size;
+    *size = device->map_size;
+    
+    return 0;
+}
+
 /**
  * @brief      interface mp3 init
+ * @param[in]  *context pointer to the device context
  * @param[in]  *name pointer to a name buffer
  * @param[out] *size pointer to a file size buffer
  * @return     status code
  *             - 0 success
  *             - 1 mp3 init failed
- * @note       none
+ * @note       regular files are mapped with mmap when MP3_MMAP_ENABLE is 1, other seekable files use the stdio reader,
+ *             pipes and other non-seekable inputs have no size until their end and are read into memory,
+ *             MP3_READ_AHEAD_ENABLE 1 reads the file from a producer thread instead
  */
-uint8_t ld3320_interface_mp3_init(char *name, uint32_t *size)
+uint8_t ld3320_interface_mp3_init(void *context, char *name, uint32_t *size)
 {
-    gs_fp = fopen(name, "r");
-    if (gs_fp == NULL)
+    ld3320_device_t *device = a_ld3320_device(context);
+    long l;
+    
+#if (MP3_READ_AHEAD_ENABLE == 1)
+    return read_ahead_init(name, size);
+#endif
+    
+    device->window_addr = 0;
+    device->window_len = 0;
+    device->map = NULL;
+    device->map_size = 0;
+    device->map_heap = 0;
+    device->prefetch = 0;
+    
+#if (MP3_MMAP_ENABLE == 1)
+    {
+        int fd;
+        struct stat st;
+        void *map;
+        
+        /* map regular files, others fall back to stdio on the same fd */
+        fd = open(name, O_RDONLY);
+        if (fd < 0)
+        {
+            return 1;
+        }
+        if ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0))
+        {
+            map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED)
+            {
+                (void)close(fd);
+                device->map = (uint8_t *)map;
+                device->map_size = (uint32_t)st.st_size;
+                
+                /* read sequentially and prefetch the first window */
+                (void)madvise(device->map, device->map_size, MADV_SEQUENTIAL);
+                device->prefetch = (device->map_size < MP3_PREFETCH_SIZE) ? device->map_size : MP3_PREFETCH_SIZE;
+                (void)madvise(device->map, device->prefetch, MADV_WILLNEED);
+                *size = device->map_size;
+                
+                return 0;
+            }
+        }
+        device->fp = fdopen(fd, "r");
+        if (device->fp == NULL)
+        {
+            (void)close(fd);
+            
+            return 1;
+        }
+    }
+#else
+    device->fp = fopen(name, "r");
+    if (device->fp == NULL)
     {
         return 1;
     }
-    if (fseek(gs_fp, 0, SEEK_END) != 0)
+#endif
+    
+    /* pipes can't seek */
+    if (fseek(device->fp, 0, SEEK_END) != 0)
     {
+        return a_ld3320_mp3_read_stream(device, size);
+    }
+    l = ftell(device->fp);
+    if ((l <= 0) || ((unsigned long)l > 0xFFFFFFFFUL))
+    {
+        (void)fclose(device->fp);
+        device->fp = NULL;
+        
         return 1;
     }
-    *size = ftell(gs_fp);
+    *size = (uint32_t)l;
     
     return 0;
 }
 
 /**
  * @brief      interface mp3 read
+ * @param[in]  *context pointer to the device context
  * @param[in]  addr mp3 file address
  * @param[in]  size read size
  * @param[out] *buffer pointer to a data buffer
@@ -157,13 +447,48 @@ uint8_t ld3320_interface_mp3_init(char *name, uint32_t *size)
  *             - 1 mp3 read failed
  * @note       none
  */
-uint8_t ld3320_interface_mp3_read(uint32_t addr, uint16_t size, uint8_t *buffer)
+uint8_t ld3320_interface_mp3_read(void *context, uint32_t addr, uint16_t size, uint8_t *buffer)
 {
-    if (fseek(gs_fp, addr, SEEK_SET) != 0)
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+#if (MP3_READ_AHEAD_ENABLE == 1)
+    {
+        uint8_t *buf;
+        uint32_t len;
+        
+        /* copy out of the ring */
+        while (size != 0)
+        {
+            if (read_ahead_acquire(addr, size, &buf, &len) != 0)
+            {
+                return 1;
+            }
+            memcpy(buffer, buf, len);
+            (void)read_ahead_release(addr, len);
+            addr += len;
+            buffer += len;
+            size -= (uint16_t)len;
+        }
+        
+        return 0;
+    }
+#endif
+    
+    if (device->map != NULL)
+    {
+        if (addr + size > device->map_size)
+        {
+            return 1;
+        }
+        memcpy(buffer, device->map + addr, size);
+        
+        return 0;
+    }
+    if (fseek(device->fp, addr, SEEK_SET) != 0)
     {
         return 1;
     }
-    if (fread((void *)buffer, 1, size, gs_fp) < 0)
+    if (fread((void *)buffer, 1, size, device->fp) < 0)
     {
         return 1;
     }
@@ -172,15 +497,198 @@ uint8_t ld3320_interface_mp3_read(uint32_t addr, uint16_t size, uint8_t *buffer)
 }
 
 /**
- * @brief  interface mp3 deinit
- * @return status code
- *         - 0 success
- *         - 1 mp3 deinit failed
- * @note   none
+ * @brief      interface mp3 acquire
+ * @param[in]  *context pointer to the device context
+ * @param[in]  addr mp3 file address
+ * @param[in]  size max acquired size
+ * @param[out] **buffer pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mp3 acquire failed
+ * @note       the lent data must stay valid until the mp3 release
  */
-uint8_t ld3320_interface_mp3_deinit(void)
+uint8_t ld3320_interface_mp3_acquire(void *context, uint32_t addr, uint32_t size, uint8_t **buffer, uint32_t *len)
 {
-    if (fclose(gs_fp) != 0)
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+#if (MP3_READ_AHEAD_ENABLE == 1)
+    return read_ahead_acquire(addr, size, buffer, len);
+#endif
+    
+    if (device->map != NULL)
+    {
+        uint32_t page;
+        uint32_t start;
+        
+        if (addr >= device->map_size)
+        {
+            return 1;
+        }
+        
+        /* keep the prefetch window ahead of the play point */
+        if ((device->prefetch < device->map_size) && (addr + MP3_PREFETCH_SIZE / 2 >= device->prefetch))
+        {
+            page = (uint32_t)sysconf(_SC_PAGESIZE);
+            start = device->prefetch & ~(page - 1);
+            device->prefetch = ((device->map_size - device->prefetch) < MP3_PREFETCH_SIZE) ? device->map_size : (device->prefetch + MP3_PREFETCH_SIZE);
+            (void)madvise(device->map + start, device->prefetch - start, MADV_WILLNEED);
+        }
+        
+        /* lend the mapped data */
+        *buffer = device->map + addr;
+        *len = device->map_size - addr;
+        if (*len > size)
+        {
+            *len = size;
+        }
+        
+        return 0;
+    }
+    
+    /* refill the window if addr is outside */
+    if ((addr < device->window_addr) || (addr >= device->window_addr + device->window_len))
+    {
+        if (fseek(device->fp, addr, SEEK_SET) != 0)
+        {
+            return 1;
+        }
+        device->window_addr = addr;
+        device->window_len = (uint32_t)fread((void *)device->window, 1, LD3320_DEVICE_WINDOW_SIZE, device->fp);
+        if (device->window_len == 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* lend the window */
+    *buffer = &device->window[addr - device->window_addr];
+    *len = device->window_addr + device->window_len - addr;
+    if (*len > size)
+    {
+        *len = size;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface mp3 release
+ * @param[in] *context pointer to the device context
+ * @param[in] addr mp3 file address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 release failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mp3_release(void *context, uint32_t addr, uint32_t len)
+{
+    (void)context;
+    
+#if (MP3_READ_AHEAD_ENABLE == 1)
+    return read_ahead_release(addr, len);
+#else
+    (void)addr;
+    (void)len;
+    
+    return 0;
+#endif
+}
+
+/**
+ * @brief     interface mutex lock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      the mutex is recursive, so receive_callback can call the driver api
+ */
+uint8_t ld3320_interface_mutex_lock(void *context)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    if (pthread_mutex_lock(&device->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface mutex trylock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mutex is busy
+ * @note      none
+ */
+uint8_t ld3320_interface_mutex_trylock(void *context)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    if (pthread_mutex_trylock(&device->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface mutex unlock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mutex_unlock(void *context)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+    if (pthread_mutex_unlock(&device->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface mp3 deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mp3_deinit(void *context)
+{
+    ld3320_device_t *device = a_ld3320_device(context);
+    
+#if (MP3_READ_AHEAD_ENABLE == 1)
+    return read_ahead_deinit();
+#endif
+    
+    if (device->map != NULL)
+    {
+        if (device->map_heap != 0)
+        {
+            free(device->map);
+        }
+        else if (munmap(device->map, device->map_size) != 0)
+        {
+            return 1;
+        }
+        device->map = NULL;
+        device->map_size = 0;
+        device->map_heap = 0;
+        
+        return 0;
+    }
+    if (fclose(device->fp) != 0)
     {
         return 1;
     }
@@ -190,13 +698,16 @@ uint8_t ld3320_interface_mp3_deinit(void)
 
 /**
  * @brief     interface receive callback
+ * @param[in] *context pointer to the device context
  * @param[in] type receive callback type
  * @param[in] ind index
  * @param[in] *text points to a text buffer
  * @note      none
  */
-void ld3320_interface_receive_callback(uint8_t type, uint8_t ind, char *text)
+void ld3320_interface_receive_callback(void *context, uint8_t type, uint8_t ind, char *text)
 {
+    (void)context;
+    
     if (type == LD3320_STATUS_ASR_FOUND_OK)
     {
         ld3320_interface_debug_print("ld3320: irq index %d %s.\n", ind, text);
@@ -224,39 +735,57 @@ void ld3320_interface_receive_callback(uint8_t type, uint8_t ind, char *text)
 }
 
 /**
- * @brief  interface reset gpio init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief     interface reset gpio init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the default device uses the wire clock line
  */
-uint8_t ld3320_interface_reset_gpio_init(void)
+uint8_t ld3320_interface_reset_gpio_init(void *context)
 {
+    if (context != NULL)
+    {
+        return ld3320_device_reset_init((ld3320_device_t *)context);
+    }
+    
     return wire_clock_init();
 }
 
 /**
- * @brief  interface reset gpio deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     interface reset gpio deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_deinit(void)
+uint8_t ld3320_interface_reset_gpio_deinit(void *context)
 {
+    if (context != NULL)
+    {
+        return ld3320_device_reset_deinit((ld3320_device_t *)context);
+    }
+    
     return wire_clock_deinit();
 }
 
 /**
  * @brief     interface reset gpio write
+ * @param[in] *context pointer to the device context
  * @param[in] data written data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_write(uint8_t data)
+uint8_t ld3320_interface_reset_gpio_write(void *context, uint8_t data)
 {
+    if (context != NULL)
+    {
+        return ld3320_device_reset_write((ld3320_device_t *)context, data);
+    }
+    
     return wire_clock_write(data);
 }
 
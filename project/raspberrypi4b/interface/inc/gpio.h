@@ -51,6 +51,48 @@
  * @{
  */
 
+/**
+ * @brief gpio latency limit definition
+ */
+#ifndef GPIO_LATENCY_LIMIT_US
+    #define GPIO_LATENCY_LIMIT_US    1000        /**< late edge to callback return limit in us */
+#endif
+
+/**
+ * @brief gpio edge age limit definition
+ */
+#ifndef GPIO_EDGE_AGE_LIMIT_US
+    #define GPIO_EDGE_AGE_LIMIT_US    1000000        /**< older edge timestamps are not in the monotonic base */
+#endif
+
+/**
+ * @brief gpiod handle declaration
+ */
+struct gpiod_chip;
+struct gpiod_line;
+
+/**
+ * @brief gpio real time configuration structure definition
+ */
+typedef struct gpio_rt_s
+{
+    int32_t priority;            /**< SCHED_FIFO priority, 0 keeps SCHED_OTHER */
+    int32_t cpu;                 /**< pinned cpu, -1 runs on all cpus */
+    uint8_t lock_memory;         /**< mlockall the current and future pages */
+    uint32_t stack_prefault;     /**< pre-faulted stack size in bytes */
+} gpio_rt_t;
+
+/**
+ * @brief gpio latency statistics structure definition
+ */
+typedef struct gpio_latency_s
+{
+    uint32_t count;              /**< measured edge count */
+    uint32_t avg_us;             /**< average edge to callback return in us */
+    uint32_t max_us;             /**< max edge to callback return in us */
+    uint32_t late;               /**< edges over GPIO_LATENCY_LIMIT_US */
+} gpio_latency_t;
+
 /**
  * @brief  gpio interrupt init
  * @return status code
@@ -69,6 +111,109 @@ uint8_t gpio_interrupt_init(void);
  */
 uint8_t gpio_interrupt_deinit(void);
 
+/**
+ * @brief     gpio interrupt set the real time configuration
+ * @param[in] *rt pointer to a real time configuration structure, NULL restores the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 set rt failed
+ * @note      call before gpio_interrupt_init, the pthread is created with the configuration
+ */
+uint8_t gpio_interrupt_set_rt(gpio_rt_t *rt);
+
+/**
+ * @brief      gpio interrupt get the latency statistics
+ * @param[out] *latency pointer to a latency statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get latency failed
+ * @note       the latency is the kernel edge timestamp to the return of the irq callback,
+ *             which covers the mp3 fifo refill when the irq handler runs directly
+ */
+uint8_t gpio_interrupt_get_latency(gpio_latency_t *latency);
+
+/**
+ * @brief  gpio apply the real time configuration to the calling thread
+ * @return status code
+ *         - 0 success
+ *         - 1 apply failed
+ * @note   used by loops that service the gpio event fd themselves
+ */
+uint8_t gpio_rt_apply(void);
+
+/**
+ * @brief  gpio get the monotonic time
+ * @return current time in us
+ * @note   same base as the gpio event timestamp
+ */
+uint32_t gpio_now_us(void);
+
+/**
+ * @brief      gpio line event init
+ * @param[in]  *chip_name pointer to a gpiochip name buffer
+ * @param[in]  line gpio line
+ * @param[in]  *consumer pointer to a consumer name buffer
+ * @param[out] **chip pointer to a gpio chip handle buffer
+ * @param[out] **handle pointer to a gpio line handle buffer
+ * @param[out] *fd pointer to an event fd buffer, NULL keeps the fd blocking
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       requests the falling edge events of the line, the fd is set non blocking,
+ *             close the chip with gpiod_chip_close
+ */
+uint8_t gpio_line_event_init(const char *chip_name, uint32_t line, const char *consumer,
+                             struct gpiod_chip **chip, struct gpiod_line **handle, int *fd);
+
+/**
+ * @brief      gpio line event read
+ * @param[in]  *handle pointer to a gpio line handle
+ * @param[out] *timestamp_us pointer to an edge timestamp buffer
+ * @param[out] *age_us pointer to an edge age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ *             - 2 not the falling edge
+ *             - 3 timestamp is not monotonic
+ * @note       the timestamp is the kernel event time in the CLOCK_MONOTONIC base used since linux 5.7,
+ *             older kernels stamp with the realtime clock, so an edge older than
+ *             GPIO_EDGE_AGE_LIMIT_US returns 3 and only the event is valid
+ */
+uint8_t gpio_line_event_read(struct gpiod_line *handle, uint32_t *timestamp_us, uint32_t *age_us);
+
+/**
+ * @brief      gpio event init
+ * @param[out] *fd pointer to an event fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       no pthread is created, the non blocking fd is
+ *             polled by the caller and drained with gpio_event_read
+ */
+uint8_t gpio_event_init(int *fd);
+
+/**
+ * @brief      gpio event read
+ * @param[out] *timestamp_us pointer to an edge timestamp buffer
+ * @param[out] *age_us pointer to an edge age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ *             - 2 not the falling edge
+ *             - 3 timestamp is not monotonic
+ * @note       same as gpio_line_event_read on the gpio_event_init line
+ */
+uint8_t gpio_event_read(uint32_t *timestamp_us, uint32_t *age_us);
+
+/**
+ * @brief  gpio event deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_event_deinit(void);
+
 /**
  * @}
  */
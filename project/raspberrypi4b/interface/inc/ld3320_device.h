@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ld3320_device.h
+ * @brief     ld3320 linux device header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LD3320_DEVICE_H
+#define LD3320_DEVICE_H
+
+#include "driver_ld3320.h"
+#include "spi.h"
+#include <pthread.h>
+#include <gpiod.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ld3320_device ld3320 linux device function
+ * @brief    ld3320 linux device function modules
+ * @{
+ */
+
+/**
+ * @brief ld3320 device max number definition
+ */
+#define LD3320_DEVICE_MAX 8                 /**< max devices in one dispatch loop */
+
+/**
+ * @brief ld3320 device mp3 window size definition
+ */
+#define LD3320_DEVICE_WINDOW_SIZE 4096      /**< 4096 bytes */
+
+/**
+ * @brief ld3320 device structure definition
+ */
+typedef struct ld3320_device_s
+{
+    char spi_name[32];                              /**< spidev name */
+    char chip_name[32];                             /**< gpiochip name */
+    uint32_t reset_line;                            /**< reset gpio line */
+    uint32_t irq_line;                              /**< irq gpio line */
+    int spi_fd;                                     /**< spi handle */
+    spi_queue_t queue;                              /**< spi queue */
+    struct gpiod_chip *reset_chip;                  /**< reset gpio chip handle */
+    struct gpiod_line *reset;                       /**< reset gpio line handle */
+    struct gpiod_chip *irq_chip;                    /**< irq gpio chip handle */
+    struct gpiod_line *irq;                         /**< irq gpio line handle */
+    int irq_fd;                                     /**< irq event fd */
+    uint32_t irq_count;                             /**< dispatched falling edge count */
+    FILE *fp;                                       /**< mp3 file handle */
+    uint8_t window[LD3320_DEVICE_WINDOW_SIZE];      /**< mp3 window buffer */
+    uint32_t window_addr;                           /**< mp3 window address */
+    uint32_t window_len;                            /**< mp3 window length */
+    uint8_t *map;                                   /**< mp3 mapped file */
+    uint32_t map_size;                              /**< mp3 mapped size */
+    uint32_t prefetch;                              /**< mp3 prefetched end */
+    uint8_t map_heap;                               /**< mp3 map is a heap copy of a stream */
+    pthread_mutex_t mutex;                          /**< handle mutex */
+    ld3320_handle_t *handle;                        /**< driver handle served by the dispatch loop */
+} ld3320_device_t;
+
+/**
+ * @brief     ld3320 device init
+ * @param[in] *device pointer to a device structure
+ * @param[in] *spi_name pointer to a spidev name buffer
+ * @param[in] *chip_name pointer to a gpiochip name buffer
+ * @param[in] reset_line reset gpio line
+ * @param[in] irq_line irq gpio line
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      only fills the device, the spidev and the reset line are opened by the driver callbacks,
+ *            link the device with DRIVER_LD3320_LINK_CONTEXT
+ */
+uint8_t ld3320_device_init(ld3320_device_t *device, char *spi_name, char *chip_name, uint32_t reset_line, uint32_t irq_line);
+
+/**
+ * @brief     ld3320 device deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_deinit(ld3320_device_t *device);
+
+/**
+ * @brief     ld3320 device reset gpio init
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_init(ld3320_device_t *device);
+
+/**
+ * @brief     ld3320 device reset gpio deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_deinit(ld3320_device_t *device);
+
+/**
+ * @brief     ld3320 device reset gpio write
+ * @param[in] *device pointer to a device structure
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_write(ld3320_device_t *device, uint8_t value);
+
+/**
+ * @brief     ld3320 device irq init
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      requests the falling edge events of the irq line with a non blocking event fd
+ */
+uint8_t ld3320_device_irq_init(ld3320_device_t *device);
+
+/**
+ * @brief     ld3320 device irq deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_irq_deinit(ld3320_device_t *device);
+
+/**
+ * @brief     ld3320 device dispatch init
+ * @param[in] *device pointer to a device array
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 num is invalid
+ * @note      adds the irq event fd of every device to one epoll fd,
+ *            the irq of every device must be inited and its handle linked
+ */
+uint8_t ld3320_device_dispatch_init(ld3320_device_t *device, uint8_t num);
+
+/**
+ * @brief  ld3320 device dispatch deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ld3320_device_dispatch_deinit(void);
+
+/**
+ * @brief     ld3320 device dispatch
+ * @param[in] ms max wait time in ms, -1 waits forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 dispatch failed
+ * @note      runs the irq handler of every device with a pending falling edge,
+ *            the kernel edge time is passed by ld3320_irq_timestamp first
+ */
+uint8_t ld3320_device_dispatch(int32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
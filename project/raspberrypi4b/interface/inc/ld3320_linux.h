@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ld3320_linux.h
+ * @brief     ld3320 linux dispatch header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef LD3320_LINUX_H
+#define LD3320_LINUX_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ld3320_linux ld3320 linux dispatch function
+ * @brief    ld3320 linux dispatch function modules
+ * @{
+ */
+
+/**
+ * @brief ld3320 linux dispatch statistics structure definition
+ */
+typedef struct ld3320_linux_stats_s
+{
+    uint32_t wakeup_count;         /**< epoll wakeup count */
+    uint32_t dispatch_count;       /**< dispatched falling edge count */
+    uint32_t timeout_count;        /**< expired timer count */
+    uint32_t latency_avg_us;       /**< average edge to dispatch latency in us */
+    uint32_t latency_max_us;       /**< max edge to dispatch latency in us */
+} ld3320_linux_stats_t;
+
+/**
+ * @brief  ld3320 linux dispatch init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   opens the gpio event fd and a timerfd and adds both to an own epoll fd,
+ *         no pthread is created, the caller runs the dispatch from its own loop
+ */
+uint8_t ld3320_linux_init(void);
+
+/**
+ * @brief  ld3320 linux dispatch deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ld3320_linux_deinit(void);
+
+/**
+ * @brief      ld3320 linux dispatch get the fds
+ * @param[out] *gpio_fd pointer to a gpio event fd buffer
+ * @param[out] *timer_fd pointer to a timerfd buffer
+ * @param[out] *epoll_fd pointer to an epoll fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not inited
+ * @note       add either the gpio and timer fds or the epoll fd alone with EPOLLIN
+ *             to the application loop and call ld3320_linux_dispatch when readable
+ */
+uint8_t ld3320_linux_get_fd(int *gpio_fd, int *timer_fd, int *epoll_fd);
+
+/**
+ * @brief     ld3320 linux dispatch set the timeout
+ * @param[in] ms timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set timeout failed
+ * @note      one shot, 0 disarms the timer
+ */
+uint8_t ld3320_linux_set_timeout(uint32_t ms);
+
+/**
+ * @brief  ld3320 linux dispatch
+ * @return status code
+ *         - 0 success
+ *         - 1 dispatch failed
+ *         - 2 timeout
+ * @note   never blocks, runs g_gpio_irq once for every pending falling edge
+ */
+uint8_t ld3320_linux_dispatch(void);
+
+/**
+ * @brief     ld3320 linux wait and dispatch
+ * @param[in] ms max wait time in ms, -1 waits forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      for applications without an own event loop
+ */
+uint8_t ld3320_linux_wait(int32_t ms);
+
+/**
+ * @brief      ld3320 linux dispatch get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the latency is the kernel edge timestamp to the start of g_gpio_irq
+ */
+uint8_t ld3320_linux_get_stats(ld3320_linux_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
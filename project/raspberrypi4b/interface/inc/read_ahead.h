@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      read_ahead.h
+ * @brief     read ahead header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef READ_AHEAD_H
+#define READ_AHEAD_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup read_ahead read ahead function
+ * @brief    read ahead function modules
+ * @{
+ */
+
+/**
+ * @brief read ahead ring size definition
+ */
+#ifndef READ_AHEAD_RING_SIZE
+    #define READ_AHEAD_RING_SIZE     (64 * 1024)        /**< 64 KB, must be a power of two */
+#endif
+
+/**
+ * @brief read ahead chunk size definition
+ */
+#ifndef READ_AHEAD_CHUNK_SIZE
+    #define READ_AHEAD_CHUNK_SIZE    4096               /**< producer read size */
+#endif
+
+/**
+ * @brief      read ahead init
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *size pointer to a file size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the producer thread starts filling the ring from address 0
+ */
+uint8_t read_ahead_init(char *name, uint32_t *size);
+
+/**
+ * @brief  read ahead deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t read_ahead_deinit(void);
+
+/**
+ * @brief      read ahead acquire
+ * @param[in]  addr file address
+ * @param[in]  size max acquired size
+ * @param[out] **buffer pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 acquire failed
+ * @note       consumer side, only waits when the ring is empty,
+ *             a non sequential address restarts the producer
+ */
+uint8_t read_ahead_acquire(uint32_t addr, uint32_t size, uint8_t **buffer, uint32_t *len);
+
+/**
+ * @brief     read ahead release
+ * @param[in] addr file address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 release failed
+ * @note      consumer side
+ */
+uint8_t read_ahead_release(uint32_t addr, uint32_t len);
+
+/**
+ * @brief      read ahead get the ring statistics
+ * @param[out] *high pointer to a high watermark buffer
+ * @param[out] *low pointer to a low watermark buffer
+ * @param[out] *empty pointer to an empty refill count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read ahead is not used
+ * @note       the statistics are kept after the deinit
+ */
+uint8_t read_ahead_get_stats(uint32_t *high, uint32_t *low, uint32_t *empty);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -38,6 +38,7 @@
 #define SPI_H
 
 #include <linux/spi/spi.h>
+#include <linux/spi/spidev.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -65,6 +66,46 @@ typedef enum
     SPI_MODE_TYPE_3 = SPI_MODE_3,        /**< mode 3 */
 } spi_mode_type_t;
 
+/**
+ * @brief spi queue max transfer definition
+ * @note  spidev pads every transfer to SPI_QUEUE_ALIGN inside bufsiz, so 4096 / 128 transfers always fit
+ */
+#ifndef SPI_QUEUE_MAX_TRANSFER
+    #define SPI_QUEUE_MAX_TRANSFER    32          /**< 32 transfers */
+#endif
+
+/**
+ * @brief spi queue align definition
+ * @note  ARCH_DMA_MINALIGN of the kernel, 64 on arm32 and 128 on arm64
+ */
+#ifndef SPI_QUEUE_ALIGN
+    #define SPI_QUEUE_ALIGN           128         /**< 128 bytes */
+#endif
+
+/**
+ * @brief spi queue max byte definition
+ */
+#ifndef SPI_QUEUE_MAX_BYTE
+    #define SPI_QUEUE_MAX_BYTE        4096        /**< spidev default bufsiz */
+#endif
+
+/**
+ * @brief spi queue structure definition
+ */
+typedef struct spi_queue_s
+{
+    int fd;                                                      /**< spi handle */
+    struct spi_ioc_transfer transfer[SPI_QUEUE_MAX_TRANSFER];    /**< transfer list */
+    uint8_t *read_buf[SPI_QUEUE_MAX_TRANSFER];                   /**< read destination list */
+    uint16_t read_len[SPI_QUEUE_MAX_TRANSFER];                   /**< read length list */
+    uint8_t tx[SPI_QUEUE_MAX_BYTE];                              /**< tx buffer */
+    uint8_t rx[SPI_QUEUE_MAX_BYTE];                              /**< rx buffer */
+    uint16_t num;                                                /**< queued transfer number */
+    uint16_t used;                                               /**< used buffer length */
+    uint16_t tx_aligned;                                         /**< tx length as spidev counts it */
+    uint16_t rx_aligned;                                         /**< rx length as spidev counts it */
+} spi_queue_t;
+
 /**
  * @brief      spi bus init
  * @param[in]  *name pointer to a spi device name buffer
@@ -88,6 +129,17 @@ uint8_t spi_init(char *name, int *fd, spi_mode_type_t mode, uint32_t freq);
  */
 uint8_t spi_deinit(int fd);
 
+/**
+ * @brief     spi bus set frequence
+ * @param[in] fd spi handle
+ * @param[in] freq spi running frequence
+ * @return    status code
+ *            - 0 success
+ *            - 1 set frequence failed
+ * @note      none
+ */
+uint8_t spi_set_freq(int fd, uint32_t freq);
+
 /**
  * @brief      spi bus read command
  * @param[in]  fd spi handle
@@ -191,6 +243,68 @@ uint8_t spi_write_read(int fd, uint8_t *in_buf, uint32_t in_len, uint8_t *out_bu
  */
 uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief     spi queue init
+ * @param[in] *queue pointer to a spi queue structure
+ * @param[in] fd spi handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t spi_queue_init(spi_queue_t *queue, int fd);
+
+/**
+ * @brief     spi queue write command
+ * @param[in] *queue pointer to a spi queue structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] delay_us delay after the transfer in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      every queued transfer has its own chip select frame,
+ *            the queue is flushed automatically when it is full
+ */
+uint8_t spi_queue_write_cmd(spi_queue_t *queue, uint8_t *buf, uint16_t len, uint16_t delay_us);
+
+/**
+ * @brief      spi queue read address 16
+ * @param[in]  *queue pointer to a spi queue structure
+ * @param[in]  reg spi register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  delay_us delay after the transfer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       buf is valid after the queue is flushed
+ */
+uint8_t spi_queue_read_address16(spi_queue_t *queue, uint16_t reg, uint8_t *buf, uint16_t len, uint16_t delay_us);
+
+/**
+ * @brief     spi queue flush
+ * @param[in] *queue pointer to a spi queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      all queued transfers are sent by one SPI_IOC_MESSAGE(n) ioctl
+ */
+uint8_t spi_queue_flush(spi_queue_t *queue);
+
+/**
+ * @brief  spi get the ioctl count
+ * @return ioctl message count
+ * @note   none
+ */
+uint32_t spi_get_ioctl_count(void);
+
+/**
+ * @brief spi clear the ioctl count
+ * @note  none
+ */
+void spi_clear_ioctl_count(void);
+
 /**
  * @}
  */
@@ -34,9 +34,17 @@
  * </table>
  */
 
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                          /**< cpu affinity */
+#endif
+
 #include "gpio.h"
 #include <gpiod.h>
 #include <pthread.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/mman.h>
 
 /**
  * @brief gpio device name definition
@@ -54,7 +62,56 @@
 static struct gpiod_chip *gs_chip;              /**< gpio chip handle */
 static struct gpiod_line *gs_line;              /**< gpio line handle */
 static pthread_t gs_pid;                        /**< gpio pthread pid */
+static gpio_rt_t gs_rt = {0, -1, 0, 0};         /**< gpio real time configuration */
+static uint32_t gs_latency_count;               /**< measured edge count */
+static uint64_t gs_latency_sum;                 /**< latency sum in us */
+static uint32_t gs_latency_max;                 /**< latency max in us */
+static uint32_t gs_latency_late;                /**< late edge count */
 extern volatile uint8_t (*g_gpio_irq)(void);    /**< gpio extern callback */
+extern uint8_t (*g_gpio_irq_timestamp)(uint32_t edge_us);    /**< gpio extern edge time callback */
+
+/**
+ * @brief     touch the stack pages
+ * @param[in] size pre-faulted size in bytes
+ * @note      keeps the first irq from paying for the stack page faults
+ */
+static void a_gpio_prefault(uint32_t size)
+{
+    uint32_t i;
+    
+    if (size != 0)
+    {
+        uint8_t stack[size];
+        volatile uint8_t *p = stack;
+        
+        for (i = 0; i < size; i += 4096)
+        {
+            p[i] = 0;
+        }
+    }
+}
+
+/**
+ * @brief     record the edge to callback return latency
+ * @param[in] edge_us monotonic edge timestamp
+ * @note      none
+ */
+static void a_gpio_latency(uint32_t edge_us)
+{
+    uint32_t us;
+    
+    us = gpio_now_us() - edge_us;
+    gs_latency_count++;
+    gs_latency_sum += (uint64_t)us;
+    if (us > gs_latency_max)
+    {
+        gs_latency_max = us;
+    }
+    if (us > GPIO_LATENCY_LIMIT_US)
+    {
+        gs_latency_late++;
+    }
+}
 
 /**
  * @brief  gpio interrupt pthread
@@ -65,13 +122,18 @@ extern volatile uint8_t (*g_gpio_irq)(void);    /**< gpio extern callback */
 static void *a_gpio_interrupt_pthread(void *p)
 {
     int res;
-    struct gpiod_line_event event;
+    uint8_t ret;
+    uint32_t edge;
+    uint32_t age;
     
     /* enable catching cancel signal */
     pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
 
     /* cancel the pthread at once */
     pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
+    
+    /* pre-fault the stack */
+    a_gpio_prefault(gs_rt.stack_prefault);
 
     /* loop */
     while (1)
@@ -81,19 +143,28 @@ static void *a_gpio_interrupt_pthread(void *p)
         if (res == 1)
         {
             /* read the event */
-            if (gpiod_line_event_read(gs_line, &event) != 0)
-            {
-                continue;
-            }
+            ret = gpio_line_event_read(gs_line, &edge, &age);
 
             /* if the falling edge */
-            if (event.event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
+            if ((ret == 0) || (ret == 3))
             {
                 /* check the callback and try to run */
                 if (g_gpio_irq != NULL)
                 {
+                    /* pass the kernel edge time when it is monotonic */
+                    if ((g_gpio_irq_timestamp != NULL) && (ret == 0))
+                    {
+                        g_gpio_irq_timestamp(edge);
+                    }
+                    
                     /* run the callback */
                     g_gpio_irq();
+                    
+                    /* record the latency */
+                    if (ret == 0)
+                    {
+                        a_gpio_latency(edge);
+                    }
                 }
             }
         }
@@ -110,37 +181,50 @@ static void *a_gpio_interrupt_pthread(void *p)
 uint8_t gpio_interrupt_init(void)
 {
     uint8_t res;
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t cpus;
     
-    /* open the gpio group */
-    gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
-    if (gs_chip == NULL)
+    /* catch the falling edge */
+    if (gpio_line_event_init(GPIO_DEVICE_NAME, GPIO_DEVICE_LINE, "gpiointerrupt", &gs_chip, &gs_line, NULL) != 0)
     {
-        perror("gpio: open failed.\n");
-
         return 1;
     }
-    
-    /* get the gpio line */
-    gs_line = gpiod_chip_get_line(gs_chip, GPIO_DEVICE_LINE);
-    if (gs_line == NULL) 
+
+    /* lock the memory */
+    if ((gs_rt.lock_memory != 0) && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
     {
-        perror("gpio: get line failed.\n");
+        perror("gpio: lock memory failed.\n");
         gpiod_chip_close(gs_chip);
 
         return 1;
     }
-
-    /* catch the falling edge */
-    if (gpiod_line_request_falling_edge_events(gs_line, "gpiointerrupt") < 0)
+    
+    /* set the pthread attr */
+    (void)pthread_attr_init(&attr);
+    if (gs_rt.priority > 0)
     {
-        perror("gpio: set edge events failed.\n");
-        gpiod_chip_close(gs_chip);
-
-        return 1;
+        param.sched_priority = gs_rt.priority;
+        (void)pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        (void)pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        (void)pthread_attr_setschedparam(&attr, &param);
     }
-
+    if (gs_rt.cpu >= 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(gs_rt.cpu, &cpus);
+        (void)pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpus);
+    }
+    
+    /* clear the latency */
+    gs_latency_count = 0;
+    gs_latency_sum = 0;
+    gs_latency_max = 0;
+    gs_latency_late = 0;
+    
     /* creat a gpio interrupt pthread */
-    res = pthread_create(&gs_pid, NULL, a_gpio_interrupt_pthread, NULL);
+    res = pthread_create(&gs_pid, &attr, a_gpio_interrupt_pthread, NULL);
+    (void)pthread_attr_destroy(&attr);
     if (res != 0)
     {
         perror("gpio: creat pthread failed.\n");
@@ -177,3 +261,283 @@ uint8_t gpio_interrupt_deinit(void)
     
     return 0;
 }
+
+/**
+ * @brief     gpio interrupt set the real time configuration
+ * @param[in] *rt pointer to a real time configuration structure, NULL restores the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 set rt failed
+ * @note      call before gpio_interrupt_init, the pthread is created with the configuration
+ */
+uint8_t gpio_interrupt_set_rt(gpio_rt_t *rt)
+{
+    if (rt == NULL)
+    {
+        gs_rt.priority = 0;
+        gs_rt.cpu = -1;
+        gs_rt.lock_memory = 0;
+        gs_rt.stack_prefault = 0;
+        
+        return 0;
+    }
+    if ((rt->priority < 0) || (rt->priority > sched_get_priority_max(SCHED_FIFO)))
+    {
+        perror("gpio: priority is invalid.\n");
+        
+        return 1;
+    }
+    if (rt->cpu >= CPU_SETSIZE)
+    {
+        perror("gpio: cpu is invalid.\n");
+        
+        return 1;
+    }
+    gs_rt = *rt;
+    
+    return 0;
+}
+
+/**
+ * @brief      gpio interrupt get the latency statistics
+ * @param[out] *latency pointer to a latency statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get latency failed
+ * @note       the latency is the kernel edge timestamp to the return of the irq callback,
+ *             which covers the mp3 fifo refill when the irq handler runs directly
+ */
+uint8_t gpio_interrupt_get_latency(gpio_latency_t *latency)
+{
+    if (latency == NULL)
+    {
+        return 1;
+    }
+    
+    latency->count = gs_latency_count;
+    latency->avg_us = (gs_latency_count != 0) ? (uint32_t)(gs_latency_sum / gs_latency_count) : 0;
+    latency->max_us = gs_latency_max;
+    latency->late = gs_latency_late;
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio apply the real time configuration to the calling thread
+ * @return status code
+ *         - 0 success
+ *         - 1 apply failed
+ * @note   used by loops that service the gpio event fd themselves
+ */
+uint8_t gpio_rt_apply(void)
+{
+    struct sched_param param;
+    cpu_set_t cpus;
+    
+    /* lock the memory */
+    if ((gs_rt.lock_memory != 0) && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
+    {
+        perror("gpio: lock memory failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the priority */
+    if (gs_rt.priority > 0)
+    {
+        param.sched_priority = gs_rt.priority;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0)
+        {
+            perror("gpio: set priority failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* pin the cpu */
+    if (gs_rt.cpu >= 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(gs_rt.cpu, &cpus);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus) != 0)
+        {
+            perror("gpio: set affinity failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* pre-fault the stack */
+    a_gpio_prefault(gs_rt.stack_prefault);
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio get the monotonic time
+ * @return current time in us
+ * @note   same base as the gpio event timestamp
+ */
+uint32_t gpio_now_us(void)
+{
+    struct timespec t;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &t);
+    
+    return (uint32_t)((uint64_t)t.tv_sec * 1000000 + (uint64_t)t.tv_nsec / 1000);
+}
+
+/**
+ * @brief      gpio line event init
+ * @param[in]  *chip_name pointer to a gpiochip name buffer
+ * @param[in]  line gpio line
+ * @param[in]  *consumer pointer to a consumer name buffer
+ * @param[out] **chip pointer to a gpio chip handle buffer
+ * @param[out] **handle pointer to a gpio line handle buffer
+ * @param[out] *fd pointer to an event fd buffer, NULL keeps the fd blocking
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       requests the falling edge events of the line, the fd is set non blocking,
+ *             close the chip with gpiod_chip_close
+ */
+uint8_t gpio_line_event_init(const char *chip_name, uint32_t line, const char *consumer,
+                             struct gpiod_chip **chip, struct gpiod_line **handle, int *fd)
+{
+    int flags;
+    
+    /* open the gpio group */
+    *chip = gpiod_chip_open(chip_name);
+    if (*chip == NULL)
+    {
+        perror("gpio: open failed.\n");
+
+        return 1;
+    }
+    
+    /* get the gpio line */
+    *handle = gpiod_chip_get_line(*chip, line);
+    if (*handle == NULL) 
+    {
+        perror("gpio: get line failed.\n");
+        gpiod_chip_close(*chip);
+
+        return 1;
+    }
+
+    /* catch the falling edge */
+    if (gpiod_line_request_falling_edge_events(*handle, consumer) < 0)
+    {
+        perror("gpio: set edge events failed.\n");
+        gpiod_chip_close(*chip);
+
+        return 1;
+    }
+    
+    /* keep the fd blocking */
+    if (fd == NULL)
+    {
+        return 0;
+    }
+    
+    /* get the event fd and set it non blocking */
+    *fd = gpiod_line_event_get_fd(*handle);
+    flags = (*fd < 0) ? -1 : fcntl(*fd, F_GETFL);
+    if ((flags < 0) || (fcntl(*fd, F_SETFL, flags | O_NONBLOCK) < 0))
+    {
+        perror("gpio: get event fd failed.\n");
+        gpiod_chip_close(*chip);
+        *fd = -1;
+
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      gpio line event read
+ * @param[in]  *handle pointer to a gpio line handle
+ * @param[out] *timestamp_us pointer to an edge timestamp buffer
+ * @param[out] *age_us pointer to an edge age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ *             - 2 not the falling edge
+ *             - 3 timestamp is not monotonic
+ * @note       the timestamp is the kernel event time in the CLOCK_MONOTONIC base used since linux 5.7,
+ *             older kernels stamp with the realtime clock, so an edge older than
+ *             GPIO_EDGE_AGE_LIMIT_US returns 3 and only the event is valid
+ */
+uint8_t gpio_line_event_read(struct gpiod_line *handle, uint32_t *timestamp_us, uint32_t *age_us)
+{
+    struct gpiod_line_event event;
+    
+    /* read the event */
+    if (gpiod_line_event_read(handle, &event) != 0)
+    {
+        return 1;
+    }
+    
+    /* if not the falling edge */
+    if (event.event_type != GPIOD_LINE_EVENT_FALLING_EDGE)
+    {
+        return 2;
+    }
+    
+    /* convert the timestamp */
+    *timestamp_us = (uint32_t)((uint64_t)event.ts.tv_sec * 1000000 + (uint64_t)event.ts.tv_nsec / 1000);
+    *age_us = gpio_now_us() - *timestamp_us;
+    if (*age_us >= GPIO_EDGE_AGE_LIMIT_US)
+    {
+        return 3;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      gpio event init
+ * @param[out] *fd pointer to an event fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       no pthread is created, the non blocking fd is
+ *             polled by the caller and drained with gpio_event_read
+ */
+uint8_t gpio_event_init(int *fd)
+{
+    /* catch the falling edge with a non blocking fd */
+    return gpio_line_event_init(GPIO_DEVICE_NAME, GPIO_DEVICE_LINE, "gpiointerrupt", &gs_chip, &gs_line, fd);
+}
+
+/**
+ * @brief      gpio event read
+ * @param[out] *timestamp_us pointer to an edge timestamp buffer
+ * @param[out] *age_us pointer to an edge age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ *             - 2 not the falling edge
+ *             - 3 timestamp is not monotonic
+ * @note       same as gpio_line_event_read on the gpio_event_init line
+ */
+uint8_t gpio_event_read(uint32_t *timestamp_us, uint32_t *age_us)
+{
+    return gpio_line_event_read(gs_line, timestamp_us, age_us);
+}
+
+/**
+ * @brief  gpio event deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_event_deinit(void)
+{
+    /* close the gpio */
+    gpiod_chip_close(gs_chip);
+    
+    return 0;
+}
@@ -0,0 +1,371 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ld3320_device.c
+ * @brief     ld3320 linux device source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "ld3320_device.h"
+#include "gpio.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+
+/**
+ * @brief global var definition
+ */
+static int gs_epoll_fd = -1;                        /**< dispatch epoll fd */
+static ld3320_device_t *gs_device = NULL;           /**< dispatched devices */
+static uint8_t gs_device_num = 0;                   /**< dispatched device number */
+
+/**
+ * @brief     ld3320 device init
+ * @param[in] *device pointer to a device structure
+ * @param[in] *spi_name pointer to a spidev name buffer
+ * @param[in] *chip_name pointer to a gpiochip name buffer
+ * @param[in] reset_line reset gpio line
+ * @param[in] irq_line irq gpio line
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      only fills the device, the spidev and the reset line are opened by the driver callbacks,
+ *            link the device with DRIVER_LD3320_LINK_CONTEXT
+ */
+uint8_t ld3320_device_init(ld3320_device_t *device, char *spi_name, char *chip_name, uint32_t reset_line, uint32_t irq_line)
+{
+    pthread_mutexattr_t attr;
+    
+    /* clear the device */
+    memset(device, 0, sizeof(ld3320_device_t));
+    strncpy(device->spi_name, spi_name, sizeof(device->spi_name) - 1);
+    strncpy(device->chip_name, chip_name, sizeof(device->chip_name) - 1);
+    device->reset_line = reset_line;
+    device->irq_line = irq_line;
+    device->spi_fd = -1;
+    device->irq_fd = -1;
+    
+    /* init the handle mutex, recursive for the driver calls in receive_callback */
+    if (pthread_mutexattr_init(&attr) != 0)
+    {
+        return 1;
+    }
+    if (pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE) != 0)
+    {
+        (void)pthread_mutexattr_destroy(&attr);
+        
+        return 1;
+    }
+    if (pthread_mutex_init(&device->mutex, &attr) != 0)
+    {
+        (void)pthread_mutexattr_destroy(&attr);
+        
+        return 1;
+    }
+    (void)pthread_mutexattr_destroy(&attr);
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_deinit(ld3320_device_t *device)
+{
+    if (pthread_mutex_destroy(&device->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device reset gpio init
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_init(ld3320_device_t *device)
+{
+    /* open the gpio group */
+    device->reset_chip = gpiod_chip_open(device->chip_name);
+    if (device->reset_chip == NULL)
+    {
+        perror("gpio: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* get the gpio line */
+    device->reset = gpiod_chip_get_line(device->reset_chip, device->reset_line);
+    if (device->reset == NULL)
+    {
+        perror("gpio: get line failed.\n");
+        gpiod_chip_close(device->reset_chip);
+        
+        return 1;
+    }
+    
+    /* set output */
+    if (gpiod_line_request_output(device->reset, "ld3320_reset", GPIOD_LINE_ACTIVE_STATE_HIGH) != 0)
+    {
+        gpiod_chip_close(device->reset_chip);
+        
+        return 1;
+    }
+    
+    /* set high */
+    return ld3320_device_reset_write(device, 1);
+}
+
+/**
+ * @brief     ld3320 device reset gpio deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_deinit(ld3320_device_t *device)
+{
+    /* close the chip */
+    gpiod_chip_close(device->reset_chip);
+    device->reset_chip = NULL;
+    device->reset = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device reset gpio write
+ * @param[in] *device pointer to a device structure
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t ld3320_device_reset_write(ld3320_device_t *device, uint8_t value)
+{
+    /* write the value */
+    if (gpiod_line_set_value(device->reset, value) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device irq init
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      requests the falling edge events of the irq line with a non blocking event fd
+ */
+uint8_t ld3320_device_irq_init(ld3320_device_t *device)
+{
+    /* catch the falling edge with a non blocking fd */
+    if (gpio_line_event_init(device->chip_name, device->irq_line, "ld3320_irq", 
+                             &device->irq_chip, &device->irq, &device->irq_fd) != 0)
+    {
+        return 1;
+    }
+    device->irq_count = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device irq deinit
+ * @param[in] *device pointer to a device structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_device_irq_deinit(ld3320_device_t *device)
+{
+    /* close the chip */
+    gpiod_chip_close(device->irq_chip);
+    device->irq_chip = NULL;
+    device->irq = NULL;
+    device->irq_fd = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device dispatch init
+ * @param[in] *device pointer to a device array
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 num is invalid
+ * @note      adds the irq event fd of every device to one epoll fd,
+ *            the irq of every device must be inited and its handle linked
+ */
+uint8_t ld3320_device_dispatch_init(ld3320_device_t *device, uint8_t num)
+{
+    uint8_t i;
+    struct epoll_event event;
+    
+    /* check the num */
+    if ((num == 0) || (num > LD3320_DEVICE_MAX))
+    {
+        return 4;
+    }
+    
+    /* create the epoll fd */
+    gs_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_epoll_fd < 0)
+    {
+        perror("ld3320: epoll create failed.\n");
+        
+        return 1;
+    }
+    
+    /* add every irq event fd, the data is the device index */
+    for (i = 0; i < num; i++)
+    {
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.u32 = i;
+        if ((device[i].irq_fd < 0) || (device[i].handle == NULL) || 
+            (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, device[i].irq_fd, &event) != 0))
+        {
+            perror("ld3320: epoll add failed.\n");
+            (void)close(gs_epoll_fd);
+            gs_epoll_fd = -1;
+            
+            return 1;
+        }
+    }
+    gs_device = device;
+    gs_device_num = num;
+    
+    return 0;
+}
+
+/**
+ * @brief  ld3320 device dispatch deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ld3320_device_dispatch_deinit(void)
+{
+    if (gs_epoll_fd < 0)
+    {
+        return 1;
+    }
+    (void)close(gs_epoll_fd);
+    gs_epoll_fd = -1;
+    gs_device = NULL;
+    gs_device_num = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 device dispatch
+ * @param[in] ms max wait time in ms, -1 waits forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 dispatch failed
+ * @note      runs the irq handler of every device with a pending falling edge,
+ *            the kernel edge time is passed by ld3320_irq_timestamp first
+ */
+uint8_t ld3320_device_dispatch(int32_t ms)
+{
+    int n;
+    int i;
+    uint8_t res;
+    uint32_t edge;
+    uint32_t age;
+    ld3320_device_t *device;
+    struct epoll_event event[LD3320_DEVICE_MAX];
+    
+    /* check the epoll fd */
+    if (gs_epoll_fd < 0)
+    {
+        return 1;
+    }
+    
+    /* wait for the edges */
+    n = epoll_wait(gs_epoll_fd, event, LD3320_DEVICE_MAX, ms);
+    if (n < 0)
+    {
+        return (errno == EINTR) ? 0 : 1;
+    }
+    
+    /* serve every ready device */
+    for (i = 0; i < n; i++)
+    {
+        if (event[i].data.u32 >= gs_device_num)
+        {
+            continue;
+        }
+        device = &gs_device[event[i].data.u32];
+        
+        /* drain the falling edges of this device */
+        while ((res = gpio_line_event_read(device->irq, &edge, &age)) != 1)
+        {
+            if (res == 2)
+            {
+                continue;
+            }
+            device->irq_count++;
+            
+            /* pass the kernel edge time when it is monotonic */
+            if (res == 0)
+            {
+                (void)ld3320_irq_timestamp(device->handle, edge);
+            }
+            
+            /* run the irq handler */
+            (void)ld3320_irq_handler(device->handle);
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ld3320_linux.c
+ * @brief     ld3320 linux dispatch source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "ld3320_linux.h"
+#include "gpio.h"
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+/**
+ * @brief ld3320 linux dispatch structure definition
+ */
+typedef struct ld3320_linux_s
+{
+    int gpio_fd;                /**< gpio event fd */
+    int timer_fd;               /**< timerfd */
+    int epoll_fd;               /**< epoll fd */
+    uint8_t inited;             /**< inited flag */
+    uint32_t wakeup_count;      /**< epoll wakeup count */
+    uint32_t dispatch_count;    /**< dispatched falling edge count */
+    uint32_t timeout_count;     /**< expired timer count */
+    uint32_t latency_count;     /**< edge to dispatch latency sample count */
+    uint64_t latency_sum_us;    /**< edge to dispatch latency sum */
+    uint32_t latency_max_us;    /**< edge to dispatch latency max */
+} ld3320_linux_t;
+
+/**
+ * @brief global var definition
+ */
+static ld3320_linux_t gs_linux = {-1, -1, -1, 0, 0, 0, 0, 0, 0, 0};    /**< linux dispatch structure */
+extern uint8_t (*g_gpio_irq)(void);                                  /**< gpio extern callback */
+extern uint8_t (*g_gpio_irq_timestamp)(uint32_t edge_us);            /**< gpio extern edge time callback */
+
+/**
+ * @brief  ld3320 linux dispatch init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   opens the gpio event fd and a timerfd and adds both to an own epoll fd,
+ *         no pthread is created, the caller runs the dispatch from its own loop
+ */
+uint8_t ld3320_linux_init(void)
+{
+    struct epoll_event ev;
+    
+    /* init the gpio event fd */
+    if (gpio_event_init(&gs_linux.gpio_fd) != 0)
+    {
+        return 1;
+    }
+    
+    /* create the timerfd */
+    gs_linux.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (gs_linux.timer_fd < 0)
+    {
+        perror("ld3320_linux: create timerfd failed.\n");
+        (void)gpio_event_deinit();
+        
+        return 1;
+    }
+    
+    /* create the epoll fd */
+    gs_linux.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_linux.epoll_fd < 0)
+    {
+        perror("ld3320_linux: create epoll failed.\n");
+        (void)close(gs_linux.timer_fd);
+        (void)gpio_event_deinit();
+        
+        return 1;
+    }
+    
+    /* add the gpio and timer fds */
+    ev.events = EPOLLIN;
+    ev.data.fd = gs_linux.gpio_fd;
+    if (epoll_ctl(gs_linux.epoll_fd, EPOLL_CTL_ADD, gs_linux.gpio_fd, &ev) != 0)
+    {
+        perror("ld3320_linux: add gpio fd failed.\n");
+        (void)close(gs_linux.epoll_fd);
+        (void)close(gs_linux.timer_fd);
+        (void)gpio_event_deinit();
+        
+        return 1;
+    }
+    ev.events = EPOLLIN;
+    ev.data.fd = gs_linux.timer_fd;
+    if (epoll_ctl(gs_linux.epoll_fd, EPOLL_CTL_ADD, gs_linux.timer_fd, &ev) != 0)
+    {
+        perror("ld3320_linux: add timer fd failed.\n");
+        (void)close(gs_linux.epoll_fd);
+        (void)close(gs_linux.timer_fd);
+        (void)gpio_event_deinit();
+        
+        return 1;
+    }
+    
+    /* clear the statistics */
+    gs_linux.wakeup_count = 0;
+    gs_linux.dispatch_count = 0;
+    gs_linux.timeout_count = 0;
+    gs_linux.latency_count = 0;
+    gs_linux.latency_sum_us = 0;
+    gs_linux.latency_max_us = 0;
+    gs_linux.inited = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief  ld3320 linux dispatch deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ld3320_linux_deinit(void)
+{
+    if (gs_linux.inited == 0)
+    {
+        return 1;
+    }
+    
+    /* close all fds */
+    (void)close(gs_linux.epoll_fd);
+    (void)close(gs_linux.timer_fd);
+    gs_linux.epoll_fd = -1;
+    gs_linux.timer_fd = -1;
+    gs_linux.gpio_fd = -1;
+    gs_linux.inited = 0;
+    
+    return gpio_event_deinit();
+}
+
+/**
+ * @brief      ld3320 linux dispatch get the fds
+ * @param[out] *gpio_fd pointer to a gpio event fd buffer
+ * @param[out] *timer_fd pointer to a timerfd buffer
+ * @param[out] *epoll_fd pointer to an epoll fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not inited
+ * @note       add either the gpio and timer fds or the epoll fd alone with EPOLLIN
+ *             to the application loop and call ld3320_linux_dispatch when readable
+ */
+uint8_t ld3320_linux_get_fd(int *gpio_fd, int *timer_fd, int *epoll_fd)
+{
+    if (gs_linux.inited == 0)
+    {
+        return 1;
+    }
+    
+    *gpio_fd = gs_linux.gpio_fd;
+    *timer_fd = gs_linux.timer_fd;
+    *epoll_fd = gs_linux.epoll_fd;
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 linux dispatch set the timeout
+ * @param[in] ms timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set timeout failed
+ * @note      one shot, 0 disarms the timer
+ */
+uint8_t ld3320_linux_set_timeout(uint32_t ms)
+{
+    struct itimerspec spec;
+    
+    if (gs_linux.inited == 0)
+    {
+        return 1;
+    }
+    
+    /* set the one shot time */
+    spec.it_interval.tv_sec = 0;
+    spec.it_interval.tv_nsec = 0;
+    spec.it_value.tv_sec = ms / 1000;
+    spec.it_value.tv_nsec = (long)(ms % 1000) * 1000000;
+    if (timerfd_settime(gs_linux.timer_fd, 0, &spec, NULL) != 0)
+    {
+        perror("ld3320_linux: set timer failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  ld3320 linux dispatch
+ * @return status code
+ *         - 0 success
+ *         - 1 dispatch failed
+ *         - 2 timeout
+ * @note   never blocks, runs g_gpio_irq once for every pending falling edge
+ */
+uint8_t ld3320_linux_dispatch(void)
+{
+    uint8_t res;
+    uint32_t edge;
+    uint32_t latency;
+    uint64_t expired;
+    
+    if (gs_linux.inited == 0)
+    {
+        return 1;
+    }
+    
+    /* drain the gpio events */
+    while (1)
+    {
+        res = gpio_event_read(&edge, &latency);
+        if (res == 1)
+        {
+            break;
+        }
+        if (res == 2)
+        {
+            continue;
+        }
+        
+        /* edge to dispatch latency, older kernels stamp with the realtime clock */
+        if (res == 0)
+        {
+            gs_linux.latency_count++;
+            gs_linux.latency_sum_us += latency;
+            if (latency > gs_linux.latency_max_us)
+            {
+                gs_linux.latency_max_us = latency;
+            }
+        }
+        gs_linux.dispatch_count++;
+        
+        /* check the callback and try to run */
+        if (g_gpio_irq != NULL)
+        {
+            /* pass the kernel edge time when it is monotonic */
+            if ((g_gpio_irq_timestamp != NULL) && (res == 0))
+            {
+                g_gpio_irq_timestamp(edge);
+            }
+            
+            /* run the callback */
+            g_gpio_irq();
+        }
+    }
+    
+    /* check the timer */
+    if (read(gs_linux.timer_fd, &expired, sizeof(expired)) == (ssize_t)sizeof(expired))
+    {
+        gs_linux.timeout_count++;
+        
+        return 2;
+    }
+    if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ld3320 linux wait and dispatch
+ * @param[in] ms max wait time in ms, -1 waits forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      for applications without an own event loop
+ */
+uint8_t ld3320_linux_wait(int32_t ms)
+{
+    int n;
+    struct epoll_event ev[2];
+    
+    if (gs_linux.inited == 0)
+    {
+        return 1;
+    }
+    
+    /* wait for the gpio or the timer */
+    n = epoll_wait(gs_linux.epoll_fd, ev, 2, ms);
+    if (n < 0)
+    {
+        return (errno == EINTR) ? 0 : 1;
+    }
+    if (n == 0)
+    {
+        return 0;
+    }
+    gs_linux.wakeup_count++;
+    
+    return ld3320_linux_dispatch();
+}
+
+/**
+ * @brief      ld3320 linux dispatch get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the latency is the kernel edge timestamp to the start of g_gpio_irq
+ */
+uint8_t ld3320_linux_get_stats(ld3320_linux_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return 1;
+    }
+    
+    stats->wakeup_count = gs_linux.wakeup_count;
+    stats->dispatch_count = gs_linux.dispatch_count;
+    stats->timeout_count = gs_linux.timeout_count;
+    stats->latency_avg_us = (gs_linux.latency_count != 0) ? 
+                            (uint32_t)(gs_linux.latency_sum_us / gs_linux.latency_count) : 0;
+    stats->latency_max_us = gs_linux.latency_max_us;
+    
+    return 0;
+}
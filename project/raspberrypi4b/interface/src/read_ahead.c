@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      read_ahead.c
+ * @brief     read ahead source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "read_ahead.h"
+#include <pthread.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/**
+ * @brief read ahead ring mask definition
+ */
+#define READ_AHEAD_RING_MASK (READ_AHEAD_RING_SIZE - 1)
+
+/**
+ * @brief read ahead structure definition
+ */
+typedef struct read_ahead_s
+{
+    int fd;                                  /**< file handle */
+    pthread_t thread;                        /**< producer thread */
+    sem_t space;                             /**< posted by the consumer when space is freed */
+    sem_t data;                              /**< posted by the producer when data is added */
+    uint8_t ring[READ_AHEAD_RING_SIZE];      /**< ring buffer */
+    uint32_t head;                           /**< written bytes, producer owned */
+    uint32_t tail;                           /**< consumed bytes, consumer owned */
+    uint32_t base;                           /**< file address of the first ring byte */
+    uint32_t size;                           /**< file size */
+    uint8_t done;                            /**< producer finished flag */
+    uint8_t stop;                            /**< producer stop flag */
+    uint8_t running;                         /**< producer running flag */
+    uint8_t used;                            /**< read ahead used flag */
+    uint32_t high_watermark;                 /**< max ring occupancy seen by the producer */
+    uint32_t low_watermark;                  /**< min ring occupancy seen by the consumer */
+    uint32_t empty_count;                    /**< refills that found the ring empty */
+} read_ahead_t;
+
+/**
+ * @brief read ahead global structure
+ */
+static read_ahead_t gs_ra;        /**< read ahead structure */
+
+/**
+ * @brief     read ahead producer thread
+ * @param[in] *arg pointer to an argument
+ * @return    NULL
+ * @note      only the producer writes head and the ring data
+ */
+static void *a_read_ahead_thread(void *arg)
+{
+    read_ahead_t *ra = (read_ahead_t *)arg;
+    uint32_t head;
+    uint32_t used;
+    uint32_t remain;
+    uint32_t len;
+    ssize_t n;
+    
+    head = ra->head;
+    while (__atomic_load_n(&ra->stop, __ATOMIC_ACQUIRE) == 0)
+    {
+        /* check the end of file */
+        remain = ra->size - (ra->base + head);
+        if (remain == 0)
+        {
+            break;
+        }
+        
+        /* wait for space if less than one chunk is free */
+        used = head - __atomic_load_n(&ra->tail, __ATOMIC_ACQUIRE);
+        len = READ_AHEAD_RING_SIZE - used;
+        if ((len < READ_AHEAD_CHUNK_SIZE) && (len < remain))
+        {
+            while ((sem_wait(&ra->space) != 0) && (errno == EINTR))
+            {
+                
+            }
+            
+            continue;
+        }
+        
+        /* read one chunk straight into the ring */
+        if (len > READ_AHEAD_CHUNK_SIZE)
+        {
+            len = READ_AHEAD_CHUNK_SIZE;
+        }
+        if (len > READ_AHEAD_RING_SIZE - (head & READ_AHEAD_RING_MASK))
+        {
+            len = READ_AHEAD_RING_SIZE - (head & READ_AHEAD_RING_MASK);
+        }
+        if (len > remain)
+        {
+            len = remain;
+        }
+        n = pread(ra->fd, &ra->ring[head & READ_AHEAD_RING_MASK], len, (off_t)(ra->base + head));
+        if (n <= 0)
+        {
+            if ((n < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+            
+            break;
+        }
+        
+        /* publish the data */
+        head += (uint32_t)n;
+        __atomic_store_n(&ra->head, head, __ATOMIC_RELEASE);
+        if (used + (uint32_t)n > ra->high_watermark)
+        {
+            ra->high_watermark = used + (uint32_t)n;
+        }
+        (void)sem_post(&ra->data);
+    }
+    
+    /* wake up the consumer */
+    __atomic_store_n(&ra->done, 1, __ATOMIC_RELEASE);
+    (void)sem_post(&ra->data);
+    
+    return NULL;
+}
+
+/**
+ * @brief     read ahead start the producer
+ * @param[in] *ra pointer to a read ahead structure
+ * @param[in] addr file address
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      returns when the first chunk is in the ring or the producer finished
+ */
+static uint8_t a_read_ahead_start(read_ahead_t *ra, uint32_t addr)
+{
+    ra->base = addr;
+    ra->head = 0;
+    ra->tail = 0;
+    ra->done = 0;
+    ra->stop = 0;
+    if (pthread_create(&ra->thread, NULL, a_read_ahead_thread, ra) != 0)
+    {
+        return 1;
+    }
+    ra->running = 1;
+    
+    /* prime the ring */
+    while ((__atomic_load_n(&ra->head, __ATOMIC_ACQUIRE) == 0) &&
+           (__atomic_load_n(&ra->done, __ATOMIC_ACQUIRE) == 0))
+    {
+        (void)sem_wait(&ra->data);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     read ahead stop the producer
+ * @param[in] *ra pointer to a read ahead structure
+ * @note      none
+ */
+static void a_read_ahead_stop(read_ahead_t *ra)
+{
+    if (ra->running != 0)
+    {
+        __atomic_store_n(&ra->stop, 1, __ATOMIC_RELEASE);
+        (void)sem_post(&ra->space);
+        (void)pthread_join(ra->thread, NULL);
+        ra->running = 0;
+    }
+    
+    /* drop the stale wake ups */
+    while (sem_trywait(&ra->space) == 0)
+    {
+        
+    }
+    while (sem_trywait(&ra->data) == 0)
+    {
+        
+    }
+}
+
+/**
+ * @brief      read ahead init
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *size pointer to a file size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the producer thread starts filling the ring from address 0
+ */
+uint8_t read_ahead_init(char *name, uint32_t *size)
+{
+    struct stat st;
+    
+    /* open the file */
+    gs_ra.fd = open(name, O_RDONLY);
+    if (gs_ra.fd < 0)
+    {
+        perror("read ahead: open failed.\n");
+        
+        return 1;
+    }
+    if (fstat(gs_ra.fd, &st) != 0)
+    {
+        perror("read ahead: fstat failed.\n");
+        (void)close(gs_ra.fd);
+        
+        return 1;
+    }
+    (void)posix_fadvise(gs_ra.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    gs_ra.size = (uint32_t)st.st_size;
+    
+    /* reset the statistics */
+    gs_ra.high_watermark = 0;
+    gs_ra.low_watermark = READ_AHEAD_RING_SIZE;
+    gs_ra.empty_count = 0;
+    gs_ra.used = 1;
+    
+    /* start the producer */
+    gs_ra.running = 0;
+    (void)sem_init(&gs_ra.space, 0, 0);
+    (void)sem_init(&gs_ra.data, 0, 0);
+    if (a_read_ahead_start(&gs_ra, 0) != 0)
+    {
+        perror("read ahead: create thread failed.\n");
+        (void)sem_destroy(&gs_ra.space);
+        (void)sem_destroy(&gs_ra.data);
+        (void)close(gs_ra.fd);
+        
+        return 1;
+    }
+    *size = gs_ra.size;
+    
+    return 0;
+}
+
+/**
+ * @brief  read ahead deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t read_ahead_deinit(void)
+{
+    a_read_ahead_stop(&gs_ra);
+    (void)sem_destroy(&gs_ra.space);
+    (void)sem_destroy(&gs_ra.data);
+    if (close(gs_ra.fd) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read ahead acquire
+ * @param[in]  addr file address
+ * @param[in]  size max acquired size
+ * @param[out] **buffer pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 acquire failed
+ * @note       consumer side, only waits when the ring is empty,
+ *             a non sequential address restarts the producer
+ */
+uint8_t read_ahead_acquire(uint32_t addr, uint32_t size, uint8_t **buffer, uint32_t *len)
+{
+    uint32_t tail;
+    uint32_t used;
+    uint32_t offset;
+    
+    /* restart the producer on a seek */
+    if (addr != gs_ra.base + gs_ra.tail)
+    {
+        if (addr >= gs_ra.size)
+        {
+            return 1;
+        }
+        a_read_ahead_stop(&gs_ra);
+        if (a_read_ahead_start(&gs_ra, addr) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* record the ring occupancy at this refill, the drain at the end of file is not counted */
+    tail = gs_ra.tail;
+    used = __atomic_load_n(&gs_ra.head, __ATOMIC_ACQUIRE) - tail;
+    if ((used < gs_ra.low_watermark) && (__atomic_load_n(&gs_ra.done, __ATOMIC_ACQUIRE) == 0))
+    {
+        gs_ra.low_watermark = used;
+    }
+    
+    /* the producer fell behind, wait for it */
+    if (used == 0)
+    {
+        gs_ra.empty_count++;
+        while (used == 0)
+        {
+            if (__atomic_load_n(&gs_ra.done, __ATOMIC_ACQUIRE) != 0)
+            {
+                used = __atomic_load_n(&gs_ra.head, __ATOMIC_ACQUIRE) - tail;
+                if (used == 0)
+                {
+                    return 1;
+                }
+                
+                break;
+            }
+            (void)sem_wait(&gs_ra.data);
+            used = __atomic_load_n(&gs_ra.head, __ATOMIC_ACQUIRE) - tail;
+        }
+    }
+    
+    /* lend the contiguous part */
+    offset = tail & READ_AHEAD_RING_MASK;
+    if (used > READ_AHEAD_RING_SIZE - offset)
+    {
+        used = READ_AHEAD_RING_SIZE - offset;
+    }
+    if (used > size)
+    {
+        used = size;
+    }
+    *buffer = &gs_ra.ring[offset];
+    *len = used;
+    
+    return 0;
+}
+
+/**
+ * @brief     read ahead release
+ * @param[in] addr file address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 release failed
+ * @note      consumer side
+ */
+uint8_t read_ahead_release(uint32_t addr, uint32_t len)
+{
+    uint32_t tail;
+    
+    tail = gs_ra.tail;
+    if (addr != gs_ra.base + tail)
+    {
+        return 1;
+    }
+    if (len > __atomic_load_n(&gs_ra.head, __ATOMIC_ACQUIRE) - tail)
+    {
+        return 1;
+    }
+    if (len == 0)
+    {
+        return 0;
+    }
+    
+    /* hand the space back to the producer */
+    __atomic_store_n(&gs_ra.tail, tail + len, __ATOMIC_RELEASE);
+    (void)sem_post(&gs_ra.space);
+    
+    return 0;
+}
+
+/**
+ * @brief      read ahead get the ring statistics
+ * @param[out] *high pointer to a high watermark buffer
+ * @param[out] *low pointer to a low watermark buffer
+ * @param[out] *empty pointer to an empty refill count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read ahead is not used
+ * @note       the statistics are kept after the deinit
+ */
+uint8_t read_ahead_get_stats(uint32_t *high, uint32_t *low, uint32_t *empty)
+{
+    if (gs_ra.used == 0)
+    {
+        return 1;
+    }
+    *high = gs_ra.high_watermark;
+    *low = gs_ra.low_watermark;
+    *empty = gs_ra.empty_count;
+    
+    return 0;
+}
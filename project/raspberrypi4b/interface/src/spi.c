@@ -39,6 +39,11 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 
+/**
+ * @brief spi ioctl message counter
+ */
+static uint32_t gs_ioctl_count = 0;        /**< ioctl count */
+
 /**
  * @brief      spi bus init
  * @param[in]  *name pointer to a spi device name buffer
@@ -159,6 +164,39 @@ uint8_t spi_deinit(int fd)
     }
 }
 
+/**
+ * @brief     spi bus set frequence
+ * @param[in] fd spi handle
+ * @param[in] freq spi running frequence
+ * @return    status code
+ *            - 0 success
+ *            - 1 set frequence failed
+ * @note      none
+ */
+uint8_t spi_set_freq(int fd, uint32_t freq)
+{
+    uint32_t i;
+    
+    /* set the spi write frequence */
+    i = freq;
+    if (ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &i) < 0)
+    {
+        perror("spi: set spi write speed failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the spi read frequence */
+    if (ioctl(fd, SPI_IOC_RD_MAX_SPEED_HZ, &i) < 0)
+    {
+        perror("spi: set spi read speed failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief      spi bus read command
  * @param[in]  fd spi handle
@@ -183,6 +221,7 @@ uint8_t spi_read_cmd(int fd, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != len)
     {
@@ -226,6 +265,7 @@ uint8_t spi_read(int fd, uint8_t reg, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != k.len)
     {
@@ -273,6 +313,7 @@ uint8_t spi_read_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != k.len)
     {
@@ -311,6 +352,7 @@ uint8_t spi_write_cmd(int fd, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != len)
     {
@@ -352,6 +394,7 @@ uint8_t spi_write(int fd, uint8_t reg, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != k.len)
     {
@@ -394,6 +437,7 @@ uint8_t spi_write_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != k.len)
     {
@@ -436,6 +480,7 @@ uint8_t spi_write_read(int fd, uint8_t *in_buf, uint32_t in_len, uint8_t *out_bu
         k[1].cs_change = 0;
         
         /* transmit */
+        gs_ioctl_count++;
         l = ioctl(fd, SPI_IOC_MESSAGE(2), &k);
         if (l != (k[0].len + k[1].len))
         {
@@ -460,6 +505,7 @@ uint8_t spi_write_read(int fd, uint8_t *in_buf, uint32_t in_len, uint8_t *out_bu
         k.cs_change = 0;
         
         /* transmit */
+        gs_ioctl_count++;
         l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
         if (l != k.len)
         {
@@ -502,6 +548,7 @@ uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len)
     k.cs_change = 0;
     
     /* transmit */
+    gs_ioctl_count++;
     l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
     if (l != k.len)
     {
@@ -512,3 +559,216 @@ uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len)
     
     return 0;
 }
+
+/**
+ * @brief     spi queue init
+ * @param[in] *queue pointer to a spi queue structure
+ * @param[in] fd spi handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t spi_queue_init(spi_queue_t *queue, int fd)
+{
+    if (queue == NULL)
+    {
+        return 1;
+    }
+    
+    /* clear the queue */
+    memset(queue->transfer, 0, sizeof(struct spi_ioc_transfer) * SPI_QUEUE_MAX_TRANSFER);
+    queue->fd = fd;
+    queue->num = 0;
+    queue->used = 0;
+    queue->tx_aligned = 0;
+    queue->rx_aligned = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     spi queue push a transfer
+ * @param[in] *queue pointer to a spi queue structure
+ * @param[in] len transfer length
+ * @param[in] read transfer reads data back
+ * @param[in] delay_us delay after the transfer in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 push failed
+ * @note      spidev pads the tx and rx buffers of every transfer to SPI_QUEUE_ALIGN and rejects
+ *            a message whose padded tx or rx total is over bufsiz, so the queue flushes before that
+ */
+static uint8_t a_spi_queue_push(spi_queue_t *queue, uint16_t len, uint8_t read, uint16_t delay_us)
+{
+    struct spi_ioc_transfer *k;
+    uint16_t aligned;
+    
+    /* check the length */
+    aligned = (uint16_t)((len + SPI_QUEUE_ALIGN - 1) / SPI_QUEUE_ALIGN * SPI_QUEUE_ALIGN);
+    if (aligned > SPI_QUEUE_MAX_BYTE)
+    {
+        perror("spi: queue length is over.\n");
+        
+        return 1;
+    }
+    
+    /* flush if full */
+    if ((queue->num >= SPI_QUEUE_MAX_TRANSFER) || 
+        (queue->tx_aligned + aligned > SPI_QUEUE_MAX_BYTE) || 
+        ((read != 0) && (queue->rx_aligned + aligned > SPI_QUEUE_MAX_BYTE)))
+    {
+        if (spi_queue_flush(queue) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* set the param */
+    k = &queue->transfer[queue->num];
+    memset(k, 0, sizeof(struct spi_ioc_transfer));
+    k->tx_buf = (unsigned long)&queue->tx[queue->used];
+    k->rx_buf = (read != 0) ? (unsigned long)&queue->rx[queue->used] : 0;
+    queue->tx_aligned += aligned;
+    queue->rx_aligned += (read != 0) ? aligned : 0;
+    k->len = len;
+    k->delay_usecs = delay_us;
+    k->cs_change = 1;
+    queue->read_buf[queue->num] = NULL;
+    queue->read_len[queue->num] = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     spi queue write command
+ * @param[in] *queue pointer to a spi queue structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] delay_us delay after the transfer in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      every queued transfer has its own chip select frame,
+ *            the queue is flushed automatically when it is full
+ */
+uint8_t spi_queue_write_cmd(spi_queue_t *queue, uint8_t *buf, uint16_t len, uint16_t delay_us)
+{
+    /* push a transfer */
+    if (a_spi_queue_push(queue, len, 0, delay_us) != 0)
+    {
+        return 1;
+    }
+    
+    /* copy the command */
+    memcpy(&queue->tx[queue->used], buf, len);
+    queue->used += len;
+    queue->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief      spi queue read address 16
+ * @param[in]  *queue pointer to a spi queue structure
+ * @param[in]  reg spi register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  delay_us delay after the transfer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       buf is valid after the queue is flushed
+ */
+uint8_t spi_queue_read_address16(spi_queue_t *queue, uint16_t reg, uint8_t *buf, uint16_t len, uint16_t delay_us)
+{
+    /* push a transfer */
+    if (a_spi_queue_push(queue, len + 2, 1, delay_us) != 0)
+    {
+        return 1;
+    }
+    
+    /* set the command */
+    queue->tx[queue->used + 0] = (reg >> 8) & 0xFF;
+    queue->tx[queue->used + 1] = reg & 0xFF;
+    memset(&queue->tx[queue->used + 2], 0x00, len);
+    queue->read_buf[queue->num] = buf;
+    queue->read_len[queue->num] = len;
+    queue->used += len + 2;
+    queue->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     spi queue flush
+ * @param[in] *queue pointer to a spi queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      all queued transfers are sent by one SPI_IOC_MESSAGE(n) ioctl
+ */
+uint8_t spi_queue_flush(spi_queue_t *queue)
+{
+    uint16_t i;
+    int l;
+    
+    /* check the queue */
+    if (queue->num == 0)
+    {
+        return 0;
+    }
+    
+    /* keep the chip select released after the last transfer */
+    queue->transfer[queue->num - 1].cs_change = 0;
+    
+    /* transmit */
+    gs_ioctl_count++;
+    l = ioctl(queue->fd, SPI_IOC_MESSAGE(queue->num), queue->transfer);
+    if (l != queue->used)
+    {
+        perror("spi: length check error.\n");
+        queue->num = 0;
+        queue->used = 0;
+        queue->tx_aligned = 0;
+        queue->rx_aligned = 0;
+        
+        return 1;
+    }
+    
+    /* copy the data */
+    for (i = 0; i < queue->num; i++)
+    {
+        if (queue->read_buf[i] != NULL)
+        {
+            memcpy(queue->read_buf[i], (uint8_t *)(unsigned long)queue->transfer[i].rx_buf + 2, queue->read_len[i]);
+        }
+    }
+    
+    /* reset the queue */
+    queue->num = 0;
+    queue->used = 0;
+    queue->tx_aligned = 0;
+    queue->rx_aligned = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief  spi get the ioctl count
+ * @return ioctl message count
+ * @note   none
+ */
+uint32_t spi_get_ioctl_count(void)
+{
+    return gs_ioctl_count;
+}
+
+/**
+ * @brief spi clear the ioctl count
+ * @note  none
+ */
+void spi_clear_ioctl_count(void)
+{
+    gs_ioctl_count = 0;
+}
@@ -38,25 +38,84 @@
 #include "driver_ld3320_asr_test.h"
 #include "driver_ld3320_mp3_test.h"
 #include "driver_ld3320_asr.h"
+#include "driver_ld3320_pinyin.h"
 #include "driver_ld3320_mp3.h"
 #include "gpio.h"
+#include "ld3320_linux.h"
+#include "ld3320_device.h"
+#include "spi.h"
+#include "read_ahead.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include <pthread.h>
 
-static volatile uint8_t gs_flag;           /**< global flag */
-uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
+/**
+ * @brief load thread max number definition
+ */
+#define LOAD_THREAD_MAX 16        /**< max synthetic load threads */
+
+static volatile uint8_t gs_flag;                  /**< global flag */
+uint8_t (*g_gpio_irq)(void) = NULL;               /**< gpio irq */
+uint8_t (*g_gpio_irq_timestamp)(uint32_t) = NULL; /**< gpio irq edge time */
+static pthread_t gs_load[LOAD_THREAD_MAX];        /**< load threads */
+static uint32_t gs_load_num;                      /**< load thread number */
+static volatile uint8_t gs_load_run;              /**< load run flag */
+
+/**
+ * @brief multi example definition
+ */
+static ld3320_device_t gs_device[LD3320_DEVICE_MAX];        /**< multi devices */
+static ld3320_handle_t gs_multi[LD3320_DEVICE_MAX];         /**< multi handles */
+static volatile uint8_t gs_multi_found[LD3320_DEVICE_MAX];  /**< multi found flags */
+
+/**
+ * @brief grammar example definition
+ */
+static const char *const gs_grammar_wake[1] = {"xiao ai tong xue"};                 /**< wake page */
+static const uint16_t gs_grammar_wake_id[1] = {100};                                /**< wake page ids */
+static const uint8_t gs_grammar_wake_next[1] = {1};                                 /**< wake page links */
+static const char *const gs_grammar_category[2] = {"deng guang", "kong tiao"};      /**< category page */
+static const uint16_t gs_grammar_category_id[2] = {200, 201};                       /**< category page ids */
+static const uint8_t gs_grammar_category_next[2] = {2, 3};                          /**< category page links */
+static const char *const gs_grammar_light[2] = {"da kai", "guan bi"};               /**< light page */
+static const uint16_t gs_grammar_light_id[2] = {300, 301};                          /**< light page ids */
+static const char *const gs_grammar_air[2] = {"sheng wen", "jiang wen"};            /**< air page */
+static const uint16_t gs_grammar_air_id[2] = {400, 401};                            /**< air page ids */
+static const ld3320_grammar_page_t gs_grammar_page[4] =                             /**< grammar pages */
+{
+    {gs_grammar_wake, gs_grammar_wake_id, gs_grammar_wake_next, 1, 0},
+    {gs_grammar_category, gs_grammar_category_id, gs_grammar_category_next, 2, 0},
+    {gs_grammar_light, gs_grammar_light_id, NULL, 2, 0},
+    {gs_grammar_air, gs_grammar_air_id, NULL, 2, 0},
+};
+static ld3320_grammar_t gs_grammar;                                                 /**< grammar */
+
+/**
+ * @brief pinyin example definition
+ */
+static const ld3320_pinyin_override_t gs_pinyin_override[4] =        /**< polyphonic words */
+{
+    {"空调", "kong tiao"},
+    {"重庆", "chong qing"},
+    {"银行", "yin hang"},
+    {"音乐", "yin yue"},
+};
+static char gs_pinyin_vocabulary[1024][13];                          /**< benchmark vocabulary */
 
 /**
  * @brief     asr callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] index asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_asr_callback(uint8_t type, uint8_t index, char *text)
+static void a_asr_callback(void *context, uint8_t type, uint8_t index, char *text)
 {
     uint8_t res;
     
+    (void)context;
+    
     if (type == LD3320_STATUS_ASR_FOUND_OK)
     {
         ld3320_interface_debug_print("ld3320: detect index %d %s.\n", index, text);
@@ -83,13 +142,18 @@ static void a_asr_callback(uint8_t type, uint8_t index, char *text)
 
 /**
  * @brief     mp3 callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] index asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_mp3_callback(uint8_t type, uint8_t index, char *text)
+static void a_mp3_callback(void *context, uint8_t type, uint8_t index, char *text)
 {
+    (void)context;
+    (void)index;
+    (void)text;
+    
     if (type == LD3320_STATUS_MP3_LOAD)
     {
         /* do nothing */
@@ -106,6 +170,365 @@ static void a_mp3_callback(uint8_t type, uint8_t index, char *text)
     }
 }
 
+/**
+ * @brief     multi asr callback
+ * @param[in] *context pointer to the device context
+ * @param[in] type irq type
+ * @param[in] index asr index
+ * @param[in] *text pointer to a asr result buffer
+ * @note      none
+ */
+static void a_multi_callback(void *context, uint8_t type, uint8_t index, char *text)
+{
+    ld3320_device_t *device = (ld3320_device_t *)context;
+    
+    if (type == LD3320_STATUS_ASR_FOUND_OK)
+    {
+        ld3320_interface_debug_print("ld3320: %s detect index %d %s.\n", device->spi_name, index, text);
+        
+        /* flag found */
+        gs_multi_found[device - gs_device] = 1;
+    }
+    else if (type == LD3320_STATUS_ASR_FOUND_ZERO)
+    {
+        /* start again */
+        if (ld3320_start(device->handle) != 0)
+        {
+            ld3320_interface_debug_print("ld3320: %s start failed.\n", device->spi_name);
+        }
+    }
+    else
+    {
+        ld3320_interface_debug_print("ld3320: %s irq unknown type.\n", device->spi_name);
+    }
+}
+
+/**
+ * @brief     multi asr deinit
+ * @param[in] num device number
+ * @note      handles that are not linked yet are skipped
+ */
+static void a_multi_deinit(uint8_t num)
+{
+    uint8_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (gs_device[i].handle != NULL)
+        {
+            (void)ld3320_deinit(gs_device[i].handle);
+        }
+        if (gs_device[i].irq_fd >= 0)
+        {
+            (void)ld3320_device_irq_deinit(&gs_device[i]);
+        }
+        (void)ld3320_device_deinit(&gs_device[i]);
+    }
+}
+
+/**
+ * @brief     gpio irq init
+ * @param[in] epoll use the epoll dispatch
+ * @param[in] *rt pointer to a real time configuration structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_gpio_init(uint8_t epoll, gpio_rt_t *rt)
+{
+    if (gpio_interrupt_set_rt(rt) != 0)
+    {
+        return 1;
+    }
+    if (epoll != 0)
+    {
+        /* no pthread, dispatched from the main loop */
+        if (ld3320_linux_init() != 0)
+        {
+            return 1;
+        }
+        
+        /* the main thread services the chip */
+        if (gpio_rt_apply() != 0)
+        {
+            (void)ld3320_linux_deinit();
+            
+            return 1;
+        }
+        
+        return 0;
+    }
+    else
+    {
+        /* gpio interrupt pthread */
+        return gpio_interrupt_init();
+    }
+}
+
+/**
+ * @brief     gpio irq deinit
+ * @param[in] epoll use the epoll dispatch
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+static uint8_t a_gpio_deinit(uint8_t epoll)
+{
+    if (epoll != 0)
+    {
+        return ld3320_linux_deinit();
+    }
+    else
+    {
+        return gpio_interrupt_deinit();
+    }
+}
+
+/**
+ * @brief     load thread
+ * @param[in] *p pointer to an args buffer
+ * @return    NULL
+ * @note      spins at the default priority
+ */
+static void *a_load_thread(void *p)
+{
+    volatile uint32_t count = 0;
+    
+    (void)p;
+    
+    while (gs_load_run != 0)
+    {
+        count++;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     start the synthetic cpu load
+ * @param[in] num load thread number
+ * @note      none
+ */
+static void a_load_start(uint32_t num)
+{
+    gs_load_run = 1;
+    for (gs_load_num = 0; gs_load_num < num; gs_load_num++)
+    {
+        if (pthread_create(&gs_load[gs_load_num], NULL, a_load_thread, NULL) != 0)
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief stop the synthetic cpu load
+ * @note  none
+ */
+static void a_load_stop(void)
+{
+    uint32_t i;
+    
+    gs_load_run = 0;
+    for (i = 0; i < gs_load_num; i++)
+    {
+        (void)pthread_join(gs_load[i], NULL);
+    }
+    gs_load_num = 0;
+}
+
+/**
+ * @brief     pinyin conversion benchmark
+ * @param[in] rounds conversion rounds of the whole vocabulary
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the vocabulary has 1024 words of 4 hanzi spread over the whole table
+ */
+static uint8_t a_pinyin_benchmark(uint32_t rounds)
+{
+    uint16_t i, j;
+    uint32_t r;
+    uint32_t code;
+    uint32_t t;
+    uint32_t table_us, override_us;
+    const char *pinyin;
+    char buf[64];
+    
+    /* build the vocabulary from the table */
+    code = 0x4E00;
+    for (i = 0; i < 1024; i++)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            while (ld3320_pinyin_lookup(code, &pinyin) != 0)
+            {
+                code = (code >= 0x9FA5) ? 0x4E00 : (code + 1);
+            }
+            gs_pinyin_vocabulary[i][j * 3 + 0] = (char)(0xE0 | (code >> 12));
+            gs_pinyin_vocabulary[i][j * 3 + 1] = (char)(0x80 | ((code >> 6) & 0x3F));
+            gs_pinyin_vocabulary[i][j * 3 + 2] = (char)(0x80 | (code & 0x3F));
+            code = (code + 5 >= 0x9FA5) ? 0x4E00 : (code + 5);
+        }
+        gs_pinyin_vocabulary[i][12] = '\0';
+    }
+    
+    /* table only */
+    t = ld3320_interface_timestamp_us();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            if (ld3320_pinyin_convert(gs_pinyin_vocabulary[i], NULL, 0, buf, 64) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    table_us = ld3320_interface_timestamp_us() - t;
+    
+    /* table with the override list */
+    t = ld3320_interface_timestamp_us();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            if (ld3320_pinyin_convert(gs_pinyin_vocabulary[i], gs_pinyin_override, 4, buf, 64) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    override_us = ld3320_interface_timestamp_us() - t;
+    
+    /* output */
+    table_us = (table_us != 0) ? table_us : 1;
+    override_us = (override_us != 0) ? override_us : 1;
+    ld3320_interface_debug_print("ld3320: pinyin %d words %d rounds, %s ... %s.\n", 1024, rounds, gs_pinyin_vocabulary[0], buf);
+    ld3320_interface_debug_print("ld3320: table %dus, %0.0f words/s, %0.0f hanzi/s, %0.1fns per hanzi.\n", table_us, 
+                                 (double)rounds * 1024 * 1000000 / table_us, (double)rounds * 4096 * 1000000 / table_us, 
+                                 (double)table_us * 1000 / ((double)rounds * 4096));
+    ld3320_interface_debug_print("ld3320: override %dus, %0.0f words/s, %0.0f hanzi/s, %0.1fns per hanzi.\n", override_us, 
+                                 (double)rounds * 1024 * 1000000 / override_us, (double)rounds * 4096 * 1000000 / override_us, 
+                                 (double)override_us * 1000 / ((double)rounds * 4096));
+    
+    return 0;
+}
+
+/**
+ * @brief     spi mp3 chunk benchmark
+ * @param[in] *path pointer to a mp3 file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_spi_benchmark(char *path)
+{
+    uint8_t res;
+    uint8_t status;
+    uint8_t cmd[3];
+    uint8_t buf[512];
+    uint8_t batch[LD3320_BATCH_MAX_LEN * 3];
+    uint16_t i, len, num;
+    uint32_t size;
+    uint32_t t;
+    uint32_t legacy_ioctl, legacy_us;
+    uint32_t queue_ioctl, queue_us;
+    
+    /* read one mp3 chunk */
+    res = ld3320_interface_mp3_init(NULL, path, &size);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: open %s failed.\n", path);
+        
+        return 1;
+    }
+    len = (size > 512) ? 512 : (uint16_t)size;
+    res = ld3320_interface_mp3_read(NULL, 0, len, buf);
+    (void)ld3320_interface_mp3_deinit(NULL);
+    if ((res != 0) || (len == 0))
+    {
+        ld3320_interface_debug_print("ld3320: read %s failed.\n", path);
+        
+        return 1;
+    }
+    
+    /* spi init */
+    res = ld3320_interface_spi_init(NULL);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* legacy byte feed, one status read, one write and the 60 us byte delay per byte */
+    spi_clear_ioctl_count();
+    t = ld3320_interface_timestamp_us();
+    for (i = 0; i < len; i++)
+    {
+        if (ld3320_interface_spi_read_address16(NULL, (0x05 << 8) | 0x06, &status, 1) != 0)
+        {
+            (void)ld3320_interface_spi_deinit(NULL);
+            
+            return 1;
+        }
+        cmd[0] = 0x04;
+        cmd[1] = 0x01;
+        cmd[2] = buf[i];
+        if (ld3320_interface_spi_write_cmd(NULL, cmd, 3) != 0)
+        {
+            (void)ld3320_interface_spi_deinit(NULL);
+            
+            return 1;
+        }
+        ld3320_interface_delay_us(60);
+    }
+    legacy_us = ld3320_interface_timestamp_us() - t;
+    legacy_ioctl = spi_get_ioctl_count();
+    
+    /* queued burst feed, one status read and batched writes */
+    spi_clear_ioctl_count();
+    t = ld3320_interface_timestamp_us();
+    if (ld3320_interface_spi_read_address16(NULL, (0x05 << 8) | 0x06, &status, 1) != 0)
+    {
+        (void)ld3320_interface_spi_deinit(NULL);
+        
+        return 1;
+    }
+    num = 0;
+    for (i = 0; i < len; i++)
+    {
+        batch[num * 3 + 0] = 0x04;
+        batch[num * 3 + 1] = 0x01;
+        batch[num * 3 + 2] = buf[i];
+        num++;
+        if ((num >= LD3320_BATCH_MAX_LEN) || (i == len - 1))
+        {
+            if (ld3320_interface_spi_write_batch(NULL, batch, num * 3) != 0)
+            {
+                (void)ld3320_interface_spi_deinit(NULL);
+                
+                return 1;
+            }
+            num = 0;
+        }
+    }
+    queue_us = ld3320_interface_timestamp_us() - t;
+    queue_ioctl = spi_get_ioctl_count();
+    
+    /* output */
+    ld3320_interface_debug_print("ld3320: mp3 chunk is %d bytes.\n", len);
+    ld3320_interface_debug_print("ld3320: legacy feed uses %d ioctls in %d us.\n", legacy_ioctl, legacy_us);
+    ld3320_interface_debug_print("ld3320: queued feed uses %d ioctls in %d us.\n", queue_ioctl, queue_us);
+    
+    /* spi deinit */
+    (void)ld3320_interface_spi_deinit(NULL);
+    
+    return 0;
+}
+
 /**
  * @brief     ld3320 full function
  * @param[in] argc arg numbers
@@ -120,9 +543,10 @@ uint8_t ld3320(uint8_t argc, char **argv)
 {
     int c;
     int longindex = 0;
-    const char short_options[] = "hipe:t:";
+    const char short_options[] = "hipbe:t:";
     const struct option long_options[] =
     {
+        {"benchmark", no_argument, NULL, 'b'},
         {"help", no_argument, NULL, 'h'},
         {"information", no_argument, NULL, 'i'},
         {"port", no_argument, NULL, 'p'},
@@ -130,11 +554,29 @@ uint8_t ld3320(uint8_t argc, char **argv)
         {"test", required_argument, NULL, 't'},
         {"file", required_argument, NULL, 1},
         {"keyword", required_argument, NULL, 2},
+        {"irq", required_argument, NULL, 3},
+        {"event", required_argument, NULL, 4},
+        {"loop", required_argument, NULL, 5},
+        {"rt", required_argument, NULL, 6},
+        {"cpu", required_argument, NULL, 7},
+        {"load", required_argument, NULL, 8},
+        {"start", required_argument, NULL, 9},
+        {"device", required_argument, NULL, 10},
+        {"rearm", required_argument, NULL, 11},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     char path[73]= "test.mp3";
     char key[33]= "ha-lou";
+    uint8_t deferred = 0;
+    uint8_t poll = 0;
+    uint8_t queue = 0;
+    uint8_t epoll = 0;
+    uint8_t async = 0;
+    uint8_t warm = 0;
+    uint32_t load = 0;
+    uint8_t device_num = 0;
+    gpio_rt_t rt = {0, -1, 0, 0};
     
     /* if no params */
     if (argc == 1)
@@ -185,6 +627,16 @@ uint8_t ld3320(uint8_t argc, char **argv)
                 break;
             }
             
+            /* benchmark */
+            case 'b' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "b");
+                
+                break;
+            }
+            
             /* example */
             case 'e' :
             {
@@ -224,6 +676,167 @@ uint8_t ld3320(uint8_t argc, char **argv)
                 
                 break;
             }
+            
+            /* irq */
+            case 3 :
+            {
+                /* set the irq mode */
+                if (strcmp("direct", optarg) == 0)
+                {
+                    deferred = 0;
+                    poll = 0;
+                }
+                else if (strcmp("deferred", optarg) == 0)
+                {
+                    deferred = 1;
+                }
+                else if (strcmp("poll", optarg) == 0)
+                {
+                    poll = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* event */
+            case 4 :
+            {
+                /* set the event mode */
+                if (strcmp("callback", optarg) == 0)
+                {
+                    queue = 0;
+                }
+                else if (strcmp("queue", optarg) == 0)
+                {
+                    queue = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* loop */
+            case 5 :
+            {
+                /* set the loop mode */
+                if (strcmp("thread", optarg) == 0)
+                {
+                    epoll = 0;
+                }
+                else if (strcmp("epoll", optarg) == 0)
+                {
+                    epoll = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* rt */
+            case 6 :
+            {
+                /* set the fifo priority, lock the memory and pre-fault the stack */
+                rt.priority = atoi(optarg);
+                rt.lock_memory = 1;
+                rt.stack_prefault = 64 * 1024;
+                
+                break;
+            }
+            
+            /* cpu */
+            case 7 :
+            {
+                /* set the pinned cpu */
+                rt.cpu = atoi(optarg);
+                
+                break;
+            }
+            
+            /* load */
+            case 8 :
+            {
+                /* set the load thread number */
+                load = (uint32_t)atoi(optarg);
+                if (load > LOAD_THREAD_MAX)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* start */
+            case 9 :
+            {
+                /* set the start mode */
+                if (strcmp("block", optarg) == 0)
+                {
+                    async = 0;
+                }
+                else if (strcmp("async", optarg) == 0)
+                {
+                    async = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* device */
+            case 10 :
+            {
+                char spi_name[32];
+                char chip_name[32];
+                unsigned int reset_line;
+                unsigned int irq_line;
+                
+                /* spidev:gpiochip:reset:irq */
+                if ((device_num >= LD3320_DEVICE_MAX) || 
+                    (sscanf(optarg, "%31[^:]:%31[^:]:%u:%u", spi_name, chip_name, &reset_line, &irq_line) != 4))
+                {
+                    return 5;
+                }
+                if (ld3320_device_init(&gs_device[device_num], spi_name, chip_name, reset_line, irq_line) != 0)
+                {
+                    return 1;
+                }
+                device_num++;
+                
+                break;
+            }
+            
+            /* rearm */
+            case 11 :
+            {
+                /* set the rearm mode */
+                if (strcmp("full", optarg) == 0)
+                {
+                    warm = 0;
+                }
+                else if (strcmp("warm", optarg) == 0)
+                {
+                    warm = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
 
             /* the end */
             case -1 :
@@ -327,9 +940,22 @@ uint8_t ld3320(uint8_t argc, char **argv)
     else if (strcmp("e_asr", type) == 0)
     {
         uint8_t res;
-        char text[1][50];
+        const char *word[1];
         uint16_t i, len;
         uint32_t timeout;
+        ld3320_irq_stats_t stats;
+        ld3320_event_t event;
+        uint32_t overflow;
+        ld3320_linux_stats_t dispatch;
+        ld3320_lock_stats_t lock;
+        ld3320_poll_stats_t polled;
+        ld3320_event_latency_t lat;
+        uint32_t interval;
+        ld3320_start_stats_t start;
+        ld3320_asr_ready_stats_t ready;
+        ld3320_rearm_stats_t rearm;
+        ld3320_key_word_stats_t words;
+        uint32_t delay;
         
         /* replace the - */
         len = (uint16_t)strlen(key);
@@ -341,15 +967,30 @@ uint8_t ld3320(uint8_t argc, char **argv)
             }
         }
         
+        /* the poll mode has no edge to wait for */
+        if ((poll != 0) && (epoll != 0))
+        {
+            return 5;
+        }
+        
         /* gpio init */
-        res = gpio_interrupt_init();
+        res = a_gpio_init(epoll, &rt);
         if (res != 0)
         {
             return 1;
         }
         
         /* set the gpio irq */
-        g_gpio_irq = ld3320_asr_irq_handler; 
+        if (poll != 0)
+        {
+            g_gpio_irq = NULL;
+            g_gpio_irq_timestamp = NULL;
+        }
+        else
+        {
+            g_gpio_irq = (deferred != 0) ? ld3320_asr_irq_latch : ld3320_asr_irq_handler;
+            g_gpio_irq_timestamp = ld3320_asr_irq_timestamp;
+        }
         
         /* output */
         ld3320_interface_debug_print("ld3320: key word is %s.\n", key);
@@ -359,47 +1000,140 @@ uint8_t ld3320(uint8_t argc, char **argv)
         if (res != 0)
         {
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         
+        /* set the event queue */
+        if (queue != 0)
+        {
+            res = ld3320_asr_set_event_queue(LD3320_BOOL_TRUE);
+            if (res != 0)
+            {
+                (void)ld3320_asr_deinit();
+                g_gpio_irq = NULL;
+                (void)a_gpio_deinit(epoll);
+                
+                return 1;
+            }
+        }
+        
         /* set the keywords */
-        memset(text[0], 0, sizeof(char) * 50);
-        memcpy(text[0], key, strlen(key));
-        res = ld3320_asr_set_keys(text, 1);
+        word[0] = key;
+        res = ld3320_asr_set_key_list(word, 1);
         if (res != 0)
         {
             (void)ld3320_asr_deinit();
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
+            
+            return 1;
+        }
+        
+        /* set the rearm mode */
+        res = ld3320_asr_set_rearm((warm != 0) ? LD3320_ASR_REARM_WARM : LD3320_ASR_REARM_FULL);
+        if (res != 0)
+        {
+            (void)ld3320_asr_deinit();
+            g_gpio_irq = NULL;
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         
         /* start asr */
         gs_flag = 0;
-        res = ld3320_asr_start();
+        if (async != 0)
+        {
+            /* step the start and sleep until each deadline */
+            res = ld3320_asr_start_async();
+            delay = 1;
+            while ((res == 0) && (delay != 0))
+            {
+                res = ld3320_asr_step(&delay);
+                if ((res == 0) && (delay != 0))
+                {
+                    ld3320_interface_delay_ms(delay);
+                }
+            }
+        }
+        else
+        {
+            res = ld3320_asr_start();
+        }
         if (res != 0)
         {
             (void)ld3320_asr_deinit();
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         
         /* waiting */
         timeout = 1000 * 10;
+        if (epoll != 0)
+        {
+            /* the timerfd bounds the wait */
+            res = ld3320_linux_set_timeout(timeout);
+            if (res != 0)
+            {
+                (void)ld3320_asr_deinit();
+                g_gpio_irq = NULL;
+                (void)a_gpio_deinit(epoll);
+                
+                return 1;
+            }
+        }
+        a_load_start(load);
         while (timeout != 0)
         {
+            if (deferred != 0)
+            {
+                (void)ld3320_asr_service();
+            }
+            if (poll != 0)
+            {
+                /* check the interrupt flags */
+                if (ld3320_asr_poll(&interval) != 0)
+                {
+                    interval = 1;
+                }
+            }
+            if (queue != 0)
+            {
+                while (ld3320_asr_poll_event(&event) == 0)
+                {
+                    a_asr_callback(NULL, event.type, event.index, event.text);
+                }
+            }
             if (gs_flag != 0)
             {
                 break;
             }
-            timeout--;
-            ld3320_interface_delay_ms(1);
+            if (epoll != 0)
+            {
+                /* sleep until the next edge or the timer */
+                if (ld3320_linux_wait(-1) != 0)
+                {
+                    timeout = 0;
+                }
+            }
+            else if (poll != 0)
+            {
+                /* sleep the suggested interval */
+                interval = (interval < timeout) ? interval : timeout;
+                timeout -= interval;
+                ld3320_interface_delay_ms(interval);
+            }
+            else
+            {
+                timeout--;
+                ld3320_interface_delay_ms(1);
+            }
         }
+        a_load_stop();
         
         /* check the result */
         if (timeout == 0)
@@ -407,16 +1141,95 @@ uint8_t ld3320(uint8_t argc, char **argv)
             ld3320_interface_debug_print("ld3320: wait timeout.\n");
             (void)ld3320_asr_deinit();
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
 
             return 1;
         }
         ld3320_interface_debug_print("ld3320: found key word.\n");
+        if ((deferred != 0) && (ld3320_asr_get_irq_stats(&stats) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: irq latch %d, service %d, coalesced %d.\n", 
+                                         stats.latch_count, stats.service_count, stats.coalesced);
+            ld3320_interface_debug_print("ld3320: irq latency avg %dus, max %dus.\n", stats.latency_avg_us, stats.latency_max_us);
+            ld3320_interface_debug_print("ld3320: irq service avg %dus, max %dus.\n", stats.service_avg_us, stats.service_max_us);
+        }
+        if ((poll != 0) && (ld3320_asr_get_poll_stats(&polled) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: poll %d, events %d, wasted %d, wasted per event %0.2f.\n", 
+                                         polled.poll_count, polled.event_count, polled.wasted_count, polled.wasted_per_event);
+            ld3320_interface_debug_print("ld3320: poll interval %dms, period %dms.\n", polled.interval_ms, polled.period_ms);
+        }
+        if ((queue != 0) && (ld3320_asr_get_event_overflow(&overflow) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: event overflow %d.\n", overflow);
+        }
+        if ((ld3320_asr_get_event_latency(LD3320_STATUS_ASR_FOUND_OK, &lat) == 0) && (lat.count != 0))
+        {
+            ld3320_interface_debug_print("ld3320: found ok %d, edge to service min %dus, avg %dus, max %dus.\n", 
+                                         lat.count, lat.service_min_us, lat.service_avg_us, lat.service_max_us);
+            ld3320_interface_debug_print("ld3320: found ok edge to callback min %dus, avg %dus, max %dus.\n", 
+                                         lat.callback_min_us, lat.callback_avg_us, lat.callback_max_us);
+        }
+        if ((ld3320_asr_get_event_latency(LD3320_STATUS_ASR_FOUND_ZERO, &lat) == 0) && (lat.count != 0))
+        {
+            ld3320_interface_debug_print("ld3320: found zero %d, edge to service min %dus, avg %dus, max %dus.\n", 
+                                         lat.count, lat.service_min_us, lat.service_avg_us, lat.service_max_us);
+            ld3320_interface_debug_print("ld3320: found zero edge to callback min %dus, avg %dus, max %dus.\n", 
+                                         lat.callback_min_us, lat.callback_avg_us, lat.callback_max_us);
+        }
+        if ((epoll != 0) && (ld3320_linux_get_stats(&dispatch) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: dispatch wakeup %d, edge %d, timeout %d.\n", 
+                                         dispatch.wakeup_count, dispatch.dispatch_count, dispatch.timeout_count);
+            ld3320_interface_debug_print("ld3320: dispatch latency avg %dus, max %dus.\n", dispatch.latency_avg_us, dispatch.latency_max_us);
+        }
+        if (ld3320_asr_get_lock_stats(&lock) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: lock %d, contention %d, status conflict %d, deferred start %d.\n", 
+                                         lock.lock_count, lock.contention, lock.status_conflict, lock.deferred_start);
+        }
+        if (ld3320_asr_get_start_stats(&start) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: start init %dus, key words %dus, asr %dus, reset %dus.\n", 
+                                         start.phase_us[LD3320_START_PHASE_INIT], start.phase_us[LD3320_START_PHASE_KEY_WORDS], 
+                                         start.phase_us[LD3320_START_PHASE_ASR], start.phase_us[LD3320_START_PHASE_RESET]);
+            ld3320_interface_debug_print("ld3320: start total %dus, steps %d, max step %dus, attempts %d.\n", 
+                                         start.total_us, start.steps, start.step_max_us, start.attempts);
+        }
+        if ((ld3320_asr_get_key_word_stats(&words) == 0) && (words.count != 0))
+        {
+            ld3320_interface_debug_print("ld3320: key words %d, upload total %dus.\n", words.count, words.total_us);
+            for (i = 0; i < words.count; i++)
+            {
+                ld3320_interface_debug_print("ld3320: key word %d upload %dus.\n", i, words.word_us[i]);
+            }
+        }
+        if (ld3320_asr_get_ready_stats(&ready) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: asr ready %d, timeout %d, without sleep %d, avg %dus, max %dus, sleep slack %dus.\n", 
+                                         ready.ready_count, ready.timeout_count, ready.spin_count, 
+                                         (ready.ready_count != 0) ? (ready.total_us / ready.ready_count) : 0, 
+                                         ready.max_us, ready.slack_us);
+            for (i = 0; i < LD3320_ASR_READY_HIST_SIZE; i++)
+            {
+                ld3320_interface_debug_print("ld3320: asr ready %s %dus: %d.\n", 
+                                             (i == LD3320_ASR_READY_HIST_SIZE - 1) ? ">=" : "<", 
+                                             (i == LD3320_ASR_READY_HIST_SIZE - 1) ? (250 << (i - 1)) : (250 << i), 
+                                             ready.hist[i]);
+            }
+        }
+        if (ld3320_asr_get_rearm_stats(&rearm) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: warm rearm %d, dead time avg %dus, max %dus.\n", 
+                                         rearm.warm_count, rearm.warm_avg_us, rearm.warm_max_us);
+            ld3320_interface_debug_print("ld3320: full rearm %d, dead time avg %dus, max %dus, warm fallback %d.\n", 
+                                         rearm.full_count, rearm.full_avg_us, rearm.full_max_us, rearm.fallback);
+        }
         
         /* deinit */
         (void)ld3320_asr_deinit();
         g_gpio_irq = NULL;
-        (void)gpio_interrupt_deinit();
+        (void)a_gpio_deinit(epoll);
         
         return 0;
     }
@@ -425,6 +1238,13 @@ uint8_t ld3320(uint8_t argc, char **argv)
         uint8_t res;
         uint16_t i, len;
         uint32_t timeout;
+        ld3320_event_t event;
+        ld3320_linux_stats_t dispatch;
+        gpio_latency_t latency;
+        ld3320_poll_stats_t polled;
+        ld3320_event_latency_t lat;
+        uint32_t interval;
+        uint32_t high, low, empty;
         
         /* replace the - */
         len = (uint16_t)strlen(path);
@@ -436,15 +1256,30 @@ uint8_t ld3320(uint8_t argc, char **argv)
             }
         }
         
+        /* the poll mode has no edge to wait for */
+        if ((poll != 0) && (epoll != 0))
+        {
+            return 5;
+        }
+        
         /* gpio init */
-        res = gpio_interrupt_init();
+        res = a_gpio_init(epoll, &rt);
         if (res != 0)
         {
             return 1;
         }
         
         /* set the gpio irq */
-        g_gpio_irq = ld3320_mp3_irq_handler;
+        if (poll != 0)
+        {
+            g_gpio_irq = NULL;
+            g_gpio_irq_timestamp = NULL;
+        }
+        else
+        {
+            g_gpio_irq = (deferred != 0) ? ld3320_mp3_irq_latch : ld3320_mp3_irq_handler;
+            g_gpio_irq_timestamp = ld3320_mp3_irq_timestamp;
+        }
         ld3320_interface_debug_print("ld3320: play %s.\n", path);
         
         /* mp3 init */
@@ -452,11 +1287,25 @@ uint8_t ld3320(uint8_t argc, char **argv)
         if (res != 0)
         {
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         
+        /* set the event queue */
+        if (queue != 0)
+        {
+            res = ld3320_mp3_set_event_queue(LD3320_BOOL_TRUE);
+            if (res != 0)
+            {
+                (void)ld3320_mp3_deinit();
+                g_gpio_irq = NULL;
+                (void)a_gpio_deinit(epoll);
+                
+                return 1;
+            }
+        }
+        
         /* start mp3 */
         gs_flag = 0;
         res = ld3320_mp3_start();
@@ -464,22 +1313,74 @@ uint8_t ld3320(uint8_t argc, char **argv)
         {
             (void)ld3320_mp3_deinit();
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         
         /* waiting */
         timeout = 1000 * 60 * 10;
+        if (epoll != 0)
+        {
+            /* the timerfd bounds the wait */
+            res = ld3320_linux_set_timeout(timeout);
+            if (res != 0)
+            {
+                (void)ld3320_mp3_deinit();
+                g_gpio_irq = NULL;
+                (void)a_gpio_deinit(epoll);
+                
+                return 1;
+            }
+        }
+        a_load_start(load);
         while (timeout != 0)
         {
+            if (deferred != 0)
+            {
+                (void)ld3320_mp3_service();
+            }
+            if (poll != 0)
+            {
+                /* check the interrupt flags */
+                if (ld3320_mp3_poll(&interval) != 0)
+                {
+                    interval = 1;
+                }
+            }
+            if (queue != 0)
+            {
+                while (ld3320_mp3_poll_event(&event) == 0)
+                {
+                    a_mp3_callback(NULL, event.type, event.index, event.text);
+                }
+            }
             if (gs_flag != 0)
             {
                 break;
             }
-            timeout--;
-            ld3320_interface_delay_ms(1);
+            if (epoll != 0)
+            {
+                /* sleep until the next edge or the timer */
+                if (ld3320_linux_wait(-1) != 0)
+                {
+                    timeout = 0;
+                }
+            }
+            else if (poll != 0)
+            {
+                /* sleep the suggested interval */
+                interval = (interval < timeout) ? interval : timeout;
+                timeout -= interval;
+                ld3320_interface_delay_ms(interval);
+            }
+            else
+            {
+                timeout--;
+                ld3320_interface_delay_ms(1);
+            }
         }
+        a_load_stop();
         
         /* check the result */
         if (timeout == 0)
@@ -487,16 +1388,284 @@ uint8_t ld3320(uint8_t argc, char **argv)
             ld3320_interface_debug_print("ld3320: wait timeout.\n");
             (void)ld3320_mp3_deinit();
             g_gpio_irq = NULL;
-            (void)gpio_interrupt_deinit();
+            (void)a_gpio_deinit(epoll);
             
             return 1;
         }
         ld3320_interface_debug_print("ld3320: play end.\n");
+        if ((epoll == 0) && (poll == 0) && (gpio_interrupt_get_latency(&latency) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: irq to refill avg %dus, max %dus, late %d of %d with %d load threads.\n", 
+                                         latency.avg_us, latency.max_us, latency.late, latency.count, load);
+        }
+        if ((poll != 0) && (ld3320_mp3_get_poll_stats(&polled) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: poll %d, events %d, wasted %d, wasted per event %0.2f.\n", 
+                                         polled.poll_count, polled.event_count, polled.wasted_count, polled.wasted_per_event);
+            ld3320_interface_debug_print("ld3320: poll interval %dms, period %dms.\n", polled.interval_ms, polled.period_ms);
+        }
+        if ((ld3320_mp3_get_event_latency(LD3320_STATUS_MP3_LOAD, &lat) == 0) && (lat.count != 0))
+        {
+            ld3320_interface_debug_print("ld3320: load %d, edge to service min %dus, avg %dus, max %dus.\n", 
+                                         lat.count, lat.service_min_us, lat.service_avg_us, lat.service_max_us);
+            ld3320_interface_debug_print("ld3320: load edge to callback min %dus, avg %dus, max %dus.\n", 
+                                         lat.callback_min_us, lat.callback_avg_us, lat.callback_max_us);
+        }
+        if ((ld3320_mp3_get_event_latency(LD3320_STATUS_MP3_END, &lat) == 0) && (lat.count != 0))
+        {
+            ld3320_interface_debug_print("ld3320: end %d, edge to service min %dus, avg %dus, max %dus.\n", 
+                                         lat.count, lat.service_min_us, lat.service_avg_us, lat.service_max_us);
+            ld3320_interface_debug_print("ld3320: end edge to callback min %dus, avg %dus, max %dus.\n", 
+                                         lat.callback_min_us, lat.callback_avg_us, lat.callback_max_us);
+        }
+        if ((epoll != 0) && (ld3320_linux_get_stats(&dispatch) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: dispatch wakeup %d, edge %d, timeout %d.\n", 
+                                         dispatch.wakeup_count, dispatch.dispatch_count, dispatch.timeout_count);
+            ld3320_interface_debug_print("ld3320: dispatch latency avg %dus, max %dus.\n", dispatch.latency_avg_us, dispatch.latency_max_us);
+        }
         
         /* deinit */
         (void)ld3320_mp3_deinit();
         g_gpio_irq = NULL;
-        (void)gpio_interrupt_deinit();
+        (void)a_gpio_deinit(epoll);
+        
+        /* output the read ahead ring statistics */
+        if (read_ahead_get_stats(&high, &low, &empty) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: ring high watermark %d bytes.\n", high);
+            ld3320_interface_debug_print("ld3320: ring low watermark %d bytes.\n", low);
+            ld3320_interface_debug_print("ld3320: ring empty refill %d.\n", empty);
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_multi", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint8_t found;
+        uint32_t t0;
+        const char *word[1];
+        ld3320_event_latency_t lat;
+        
+        /* at least one device */
+        if (device_num == 0)
+        {
+            return 5;
+        }
+        
+        /* one handle and one irq line per device */
+        word[0] = key;
+        for (i = 0; i < device_num; i++)
+        {
+            res = ld3320_asr_init_handle(&gs_multi[i], &gs_device[i], a_multi_callback);
+            if (res != 0)
+            {
+                a_multi_deinit(device_num);
+                
+                return 1;
+            }
+            gs_device[i].handle = &gs_multi[i];
+            gs_multi_found[i] = 0;
+            if ((ld3320_device_irq_init(&gs_device[i]) != 0) || 
+                (ld3320_set_key_word_list(&gs_multi[i], word, 1) != 0))
+            {
+                a_multi_deinit(device_num);
+                
+                return 1;
+            }
+            ld3320_interface_debug_print("ld3320: %s key word is %s.\n", gs_device[i].spi_name, key);
+        }
+        
+        /* one dispatch loop for all irq lines */
+        if (ld3320_device_dispatch_init(gs_device, device_num) != 0)
+        {
+            a_multi_deinit(device_num);
+            
+            return 1;
+        }
+        for (i = 0; i < device_num; i++)
+        {
+            if (ld3320_start(&gs_multi[i]) != 0)
+            {
+                (void)ld3320_device_dispatch_deinit();
+                a_multi_deinit(device_num);
+                
+                return 1;
+            }
+        }
+        
+        /* wait until every chip found the key word or 10s */
+        t0 = ld3320_interface_timestamp_us();
+        do
+        {
+            if (ld3320_device_dispatch(100) != 0)
+            {
+                break;
+            }
+            found = 0;
+            for (i = 0; i < device_num; i++)
+            {
+                found += gs_multi_found[i];
+            }
+        } while ((found < device_num) && (ld3320_interface_timestamp_us() - t0 < 10000000));
+        (void)ld3320_device_dispatch_deinit();
+        
+        /* output */
+        for (i = 0; i < device_num; i++)
+        {
+            ld3320_interface_debug_print("ld3320: %s %s, edge %d.\n", gs_device[i].spi_name, 
+                                         (gs_multi_found[i] != 0) ? "found" : "timeout", gs_device[i].irq_count);
+            if ((ld3320_get_event_latency(&gs_multi[i], LD3320_STATUS_ASR_FOUND_OK, &lat) == 0) && (lat.count != 0))
+            {
+                ld3320_interface_debug_print("ld3320: %s edge to callback min %dus, avg %dus, max %dus.\n", 
+                                             gs_device[i].spi_name, lat.callback_min_us, lat.callback_avg_us, lat.callback_max_us);
+            }
+        }
+        
+        /* deinit */
+        a_multi_deinit(device_num);
+        
+        return 0;
+    }
+    else if (strcmp("e_grammar", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i, index;
+        uint8_t found;
+        uint32_t timeout;
+        ld3320_event_t event;
+        ld3320_grammar_stats_t stats;
+        ld3320_rearm_stats_t rearm;
+        
+        /* add the pages */
+        (void)ld3320_grammar_init(&gs_grammar);
+        for (i = 0; i < 4; i++)
+        {
+            if (ld3320_grammar_add_page(&gs_grammar, &gs_grammar_page[i], &index) != 0)
+            {
+                return 1;
+            }
+        }
+        
+        /* gpio init */
+        res = a_gpio_init(0, &rt);
+        if (res != 0)
+        {
+            return 1;
+        }
+        g_gpio_irq = ld3320_asr_irq_handler;
+        g_gpio_irq_timestamp = ld3320_asr_irq_timestamp;
+        
+        /* asr init, the events carry the page and the command id */
+        res = ld3320_asr_init(a_asr_callback);
+        if (res != 0)
+        {
+            g_gpio_irq = NULL;
+            (void)a_gpio_deinit(0);
+            
+            return 1;
+        }
+        if ((ld3320_asr_set_event_queue(LD3320_BOOL_TRUE) != 0) || 
+            (ld3320_asr_set_grammar(&gs_grammar) != 0) || 
+            (ld3320_asr_set_rearm((warm != 0) ? LD3320_ASR_REARM_WARM : LD3320_ASR_REARM_FULL) != 0) || 
+            (ld3320_asr_start() != 0))
+        {
+            (void)ld3320_asr_deinit();
+            g_gpio_irq = NULL;
+            (void)a_gpio_deinit(0);
+            
+            return 1;
+        }
+        
+        /* wake word, category and command, or 30s */
+        found = 0;
+        timeout = 1000 * 30;
+        while ((found < 3) && (timeout != 0))
+        {
+            while (ld3320_asr_poll_event(&event) == 0)
+            {
+                if (event.type == LD3320_STATUS_ASR_FOUND_OK)
+                {
+                    ld3320_interface_debug_print("ld3320: page %d detect id %d %s.\n", event.page, event.id, event.text);
+                    found++;
+                }
+                
+                /* start on the next page */
+                if ((found < 3) && (ld3320_asr_start() != 0))
+                {
+                    ld3320_interface_debug_print("ld3320: start failed.\n");
+                }
+            }
+            timeout--;
+            ld3320_interface_delay_ms(1);
+        }
+        if (timeout == 0)
+        {
+            ld3320_interface_debug_print("ld3320: wait timeout.\n");
+        }
+        if (ld3320_asr_get_grammar_stats(&stats) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: grammar page %d, switch %d, stay %d.\n", 
+                                         stats.page, stats.switch_count, stats.stay_count);
+            ld3320_interface_debug_print("ld3320: page switch avg %dus, max %dus.\n", stats.switch_avg_us, stats.switch_max_us);
+        }
+        if (ld3320_asr_get_rearm_stats(&rearm) == 0)
+        {
+            ld3320_interface_debug_print("ld3320: warm rearm %d, dead time avg %dus, max %dus.\n", 
+                                         rearm.warm_count, rearm.warm_avg_us, rearm.warm_max_us);
+        }
+        
+        /* deinit */
+        (void)ld3320_asr_deinit();
+        g_gpio_irq = NULL;
+        (void)a_gpio_deinit(0);
+        
+        return (timeout != 0) ? 0 : 1;
+    }
+    else if (strcmp("e_pinyin", type) == 0)
+    {
+        char buf[LD3320_KEY_WORD_LEN];
+        
+        /* convert the keyword */
+        if (ld3320_pinyin_convert(key, gs_pinyin_override, 4, buf, LD3320_KEY_WORD_LEN) != 0)
+        {
+            ld3320_interface_debug_print("ld3320: convert %s failed.\n", key);
+            
+            return 1;
+        }
+        ld3320_interface_debug_print("ld3320: %s is %s.\n", key, buf);
+        
+        /* run the benchmark */
+        if (a_pinyin_benchmark(100) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("b", type) == 0)
+    {
+        uint8_t res;
+        uint16_t i, len;
+        
+        /* replace the - */
+        len = (uint16_t)strlen(path);
+        for (i = 0; i < len; i++)
+        {
+            if (path[i] == '-')
+            {
+                path[i] = ' ';
+            }
+        }
+        
+        /* run the spi benchmark */
+        res = a_spi_benchmark(path);
+        if (res != 0)
+        {
+            return 1;
+        }
         
         return 0;
     }
@@ -510,16 +1679,37 @@ uint8_t ld3320(uint8_t argc, char **argv)
         ld3320_interface_debug_print("  ld3320 (-t reg | --test=reg)\n");
         ld3320_interface_debug_print("  ld3320 (-t asr | --test=asr)\n");
         ld3320_interface_debug_print("  ld3320 (-t mp3 | --test=mp3) [--file=<path>]\n");
-        ld3320_interface_debug_print("  ld3320 (-e asr | --example=asr) [--keyword=<word>]\n");
-        ld3320_interface_debug_print("  ld3320 (-e mp3 | --example=mp3) [--file=<path>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e asr | --example=asr) [--keyword=<word>] [--irq=<direct | deferred | poll>] [--event=<callback | queue>] [--loop=<thread | epoll>] [--rt=<priority>] [--cpu=<n>] [--load=<n>] [--start=<block | async>] [--rearm=<full | warm>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e mp3 | --example=mp3) [--file=<path>] [--irq=<direct | deferred | poll>] [--event=<callback | queue>] [--loop=<thread | epoll>] [--rt=<priority>] [--cpu=<n>] [--load=<n>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e multi | --example=multi) --device=<spidev:gpiochip:reset:irq> [--device=<spidev:gpiochip:reset:irq>]... [--keyword=<word>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e grammar | --example=grammar) [--rearm=<full | warm>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e pinyin | --example=pinyin) [--keyword=<word>]\n");
+        ld3320_interface_debug_print("  ld3320 (-b | --benchmark) [--file=<path>]\n");
         ld3320_interface_debug_print("\n");
         ld3320_interface_debug_print("Options:\n");
-        ld3320_interface_debug_print("  -e <asr | mp3>, --example=<asr | mp3>\n");
+        ld3320_interface_debug_print("  -b, --benchmark         Run the spi ioctl benchmark of one mp3 chunk.\n");
+        ld3320_interface_debug_print("      --cpu=<n>           Pin the gpio service thread to the cpu.([default: all])\n");
+        ld3320_interface_debug_print("      --device=<spidev:gpiochip:reset:irq>\n");
+        ld3320_interface_debug_print("                          Add one chip to the multi example, e.g. /dev/spidev0.1:/dev/gpiochip0:22:23.\n");
+        ld3320_interface_debug_print("      --event=<callback | queue>\n");
+        ld3320_interface_debug_print("                          Set the event mode, queue reads the events in the main loop.([default: callback])\n");
+        ld3320_interface_debug_print("  -e <asr | mp3 | multi | grammar | pinyin>, --example=<asr | mp3 | multi | grammar | pinyin>\n");
         ld3320_interface_debug_print("                          Run the driver example.\n");
         ld3320_interface_debug_print("      --file=<path>       Set the mp3 file path.([default: test.mp3])\n");
         ld3320_interface_debug_print("  -h, --help              Show the help.\n");
         ld3320_interface_debug_print("  -i, --information       Show the chip information.\n");
-        ld3320_interface_debug_print("      --keyword=<word>    Set the asr keyword.([default: ha-lou])\n");
+        ld3320_interface_debug_print("      --irq=<direct | deferred | poll>\n");
+        ld3320_interface_debug_print("                          Set the irq mode, deferred latches in the irq and services in the main loop,\n");
+        ld3320_interface_debug_print("                          poll reads the interrupt flags in the main loop without the irq line.([default: direct])\n");
+        ld3320_interface_debug_print("      --keyword=<word>    Set the asr keyword, the pinyin example also takes utf-8 hanzi.([default: ha-lou])\n");
+        ld3320_interface_debug_print("      --load=<n>          Run n spinning threads as the synthetic cpu load while waiting.([default: 0])\n");
+        ld3320_interface_debug_print("      --loop=<thread | epoll>\n");
+        ld3320_interface_debug_print("                          Set the gpio loop, epoll dispatches the gpio and timer fds in the main loop.([default: thread])\n");
+        ld3320_interface_debug_print("      --rearm=<full | warm>\n");
+        ld3320_interface_debug_print("                          Set the asr rearm after a result, warm restarts the recognition without the soft reset and key words upload.([default: full])\n");
+        ld3320_interface_debug_print("      --rt=<priority>     Run the gpio service thread as SCHED_FIFO with the locked memory and the pre-faulted stack.([default: 0])\n");
+        ld3320_interface_debug_print("      --start=<block | async>\n");
+        ld3320_interface_debug_print("                          Set the asr start, async steps the start state machine from the main loop.([default: block])\n");
         ld3320_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         ld3320_interface_debug_print("  -t <reg | asr | mp3>, --test=<reg | asr | mp3>\n");
         ld3320_interface_debug_print("                          Run the driver test.\n");
@@ -541,6 +1731,8 @@ uint8_t ld3320(uint8_t argc, char **argv)
         ld3320_interface_debug_print("ld3320: max current is %0.2fmA.\n", info.max_current_ma);
         ld3320_interface_debug_print("ld3320: max temperature is %0.1fC.\n", info.temperature_max);
         ld3320_interface_debug_print("ld3320: min temperature is %0.1fC.\n", info.temperature_min);
+        ld3320_interface_debug_print("ld3320: handle size is %d bytes, key word pool is %d bytes.\n", 
+                                     (int)sizeof(ld3320_handle_t), LD3320_KEY_WORD_POOL_SIZE);
         
         return 0;
     }
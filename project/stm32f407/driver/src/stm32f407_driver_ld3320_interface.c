@@ -39,6 +39,7 @@
 #include "ff.h"
 #include "wire.h"
 #include "spi.h"
+#include "sdio.h"
 #include "uart.h"
 #include <stdarg.h>
 
@@ -49,31 +50,54 @@ FATFS g_fs;        /**< fatfs handle */
 FIL g_file;        /**< fs handle */
 
 /**
- * @brief  interface spi bus init
- * @return status code
- *         - 0 success
- *         - 1 spi init failed
- * @note   none
+ * @brief mp3 window definition
  */
-uint8_t ld3320_interface_spi_init(void)
+#define MP3_WINDOW_SIZE 2048                       /**< 2048 bytes, multiple of the sector size */
+#define MP3_SECTOR_SIZE 512                        /**< sd sector size */
+static uint32_t gs_block[2][MP3_WINDOW_SIZE / 4];  /**< mp3 ping-pong dma buffers */
+static uint32_t gs_block_addr[2];                  /**< mp3 block address */
+static uint32_t gs_block_len[2];                   /**< mp3 block length */
+static uint8_t gs_block_cur = 0;                   /**< mp3 lent block */
+static uint8_t gs_block_pending = 0;               /**< mp3 prefetch block */
+static uint8_t gs_block_busy = 0;                  /**< mp3 prefetch block is in flight */
+static uint32_t gs_size = 0;                       /**< mp3 file size */
+
+/**
+ * @brief mp3 fast seek definition
+ */
+#define MP3_CLMT_SIZE 64                           /**< cluster link map table size in DWORD */
+static DWORD gs_clmt[MP3_CLMT_SIZE];               /**< cluster link map table */
+static uint8_t gs_clmt_valid = 0;                  /**< cluster link map table is valid */
+
+/**
+ * @brief     interface spi bus init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi init failed
+ * @note      none
+ */
+uint8_t ld3320_interface_spi_init(void *context)
 {
     return spi_init(SPI_MODE_2);
 }
 
 /**
- * @brief  interface spi bus deinit
- * @return status code
- *         - 0 success
- *         - 1 spi deinit failed
- * @note   none
+ * @brief     interface spi bus deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_spi_deinit(void)
+uint8_t ld3320_interface_spi_deinit(void *context)
 {
     return spi_deinit();
 }
 
 /**
  * @brief      interface spi bus read
+ * @param[in]  *context pointer to the device context
  * @param[in]  reg register address
  * @param[out] *buf pointer to a data buffer
  * @param[in]  len length of data buffer
@@ -82,13 +106,14 @@ uint8_t ld3320_interface_spi_deinit(void)
  *             - 1 read failed
  * @note       none
  */
-uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t len)
+uint8_t ld3320_interface_spi_read_address16(void *context, uint16_t reg, uint8_t *buf, uint16_t len)
 {
     return spi_read_address16(reg, buf, len);
 }
 
 /**
  * @brief     interface spi bus write
+ * @param[in] *context pointer to the device context
  * @param[in] *buf pointer to a data buffer
  * @param[in] len length of data buffer
  * @return    status code
@@ -96,44 +121,124 @@ uint8_t ld3320_interface_spi_read_address16(uint16_t reg, uint8_t *buf, uint16_t
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
+uint8_t ld3320_interface_spi_write_cmd(void *context, uint8_t *buf, uint16_t len)
 {
     return spi_write_cmd(buf, len);
 }
 
 /**
- * @brief  interface reset gpio init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief     interface spi bus write batch
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      buf holds len / 3 write commands and every 3 bytes command has its own chip select frame
+ */
+uint8_t ld3320_interface_spi_write_batch(void *context, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    for (i = 0; i + 3 <= len; i += 3)
+    {
+        if (spi_write_cmd(buf + i, 3) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus write batch start
+ * @param[in] *context pointer to the device context
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch start failed
+ * @note      the batch is sent by dma when spi_get_dma is 1, otherwise before return
+ */
+uint8_t ld3320_interface_spi_write_batch_start(void *context, uint8_t *buf, uint16_t len)
+{
+    if (spi_get_dma() != 0)
+    {
+        return spi_write_batch_dma(buf, len);
+    }
+    
+    return ld3320_interface_spi_write_batch(context, buf, len);
+}
+
+/**
+ * @brief     interface spi bus write batch wait
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_init(void)
+uint8_t ld3320_interface_spi_write_batch_wait(void *context)
+{
+    if (spi_get_dma() != 0)
+    {
+        return (spi_write_batch_dma_wait() != 0) ? 1 : 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus set clock
+ * @param[in] *context pointer to the device context
+ * @param[in] hz spi clock in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 set clock failed
+ * @note      the nearest supported clock not over hz is used
+ */
+uint8_t ld3320_interface_spi_set_clock(void *context, uint32_t hz)
+{
+    return spi_set_freq(hz);
+}
+
+/**
+ * @brief     interface reset gpio init
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ld3320_interface_reset_gpio_init(void *context)
 {
     return wire_init();
 }
 
 /**
- * @brief  interface reset gpio deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     interface reset gpio deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_deinit(void)
+uint8_t ld3320_interface_reset_gpio_deinit(void *context)
 {
     return wire_deinit();
 }
 
 /**
  * @brief     interface reset gpio write
+ * @param[in] *context pointer to the device context
  * @param[in] data written data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-uint8_t ld3320_interface_reset_gpio_write(uint8_t data)
+uint8_t ld3320_interface_reset_gpio_write(void *context, uint8_t data)
 {
     return wire_write(data);
 }
@@ -158,19 +263,145 @@ void ld3320_interface_delay_us(uint32_t us)
     delay_us(us);
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return current timestamp in us
+ * @note   none
+ */
+uint32_t ld3320_interface_timestamp_us(void)
+{
+    return delay_timestamp_us();
+}
+
+/**
+ * @brief      mp3 map a file address to sd sectors
+ * @param[in]  addr sector aligned file address
+ * @param[out] *sector pointer to a first sector buffer
+ * @param[out] *count pointer to a contiguous sector count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       walks the cluster link map table, no fat access
+ */
+static uint8_t a_mp3_map(uint32_t addr, uint32_t *sector, uint32_t *count)
+{
+    FATFS *fs = g_file.obj.fs;
+    DWORD *tbl = &gs_clmt[1];
+    uint32_t cl;
+    uint32_t offset;
+    
+    /* find the fragment */
+    cl = (addr / MP3_SECTOR_SIZE) / fs->csize;
+    while (1)
+    {
+        if (tbl[0] == 0)
+        {
+            return 1;
+        }
+        if (cl < tbl[0])
+        {
+            break;
+        }
+        cl -= tbl[0];
+        tbl += 2;
+    }
+    
+    /* cluster to sector */
+    offset = (addr / MP3_SECTOR_SIZE) % fs->csize;
+    *sector = (uint32_t)(fs->database + (LBA_t)fs->csize * (tbl[1] + cl - 2)) + offset;
+    *count = (tbl[0] - cl) * fs->csize - offset;
+    
+    return 0;
+}
+
+/**
+ * @brief     mp3 start a block read
+ * @param[in] index block index
+ * @param[in] addr sector aligned file address
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      whole sectors are read by dma straight into the block
+ */
+static uint8_t a_mp3_block_start(uint8_t index, uint32_t addr)
+{
+    uint32_t sector;
+    uint32_t count;
+    uint32_t remain;
+    
+    gs_block_len[index] = 0;
+    if (a_mp3_map(addr, &sector, &count) != 0)
+    {
+        return 1;
+    }
+    
+    /* limit to the block, the fragment and the file end */
+    remain = (gs_size - addr + MP3_SECTOR_SIZE - 1) / MP3_SECTOR_SIZE;
+    if (count > MP3_WINDOW_SIZE / MP3_SECTOR_SIZE)
+    {
+        count = MP3_WINDOW_SIZE / MP3_SECTOR_SIZE;
+    }
+    if (count > remain)
+    {
+        count = remain;
+    }
+    if (sdio_read_start(sector, (uint8_t *)gs_block[index], count) != 0)
+    {
+        return 1;
+    }
+    gs_block_pending = index;
+    gs_block_addr[index] = addr;
+    gs_block_len[index] = count * MP3_SECTOR_SIZE;
+    if (gs_block_len[index] > gs_size - addr)
+    {
+        gs_block_len[index] = gs_size - addr;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  mp3 wait the prefetch block
+ * @return status code
+ *         - 0 success
+ *         - 1 wait failed
+ * @note   none
+ */
+static uint8_t a_mp3_block_wait(void)
+{
+    if (gs_block_busy != 0)
+    {
+        gs_block_busy = 0;
+        if (sdio_read_wait() != 0)
+        {
+            gs_block_len[gs_block_pending] = 0;
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
 /**
  * @brief      interface mp3 init
+ * @param[in]  *context pointer to the device context
  * @param[in]  *name pointer to a name buffer
  * @param[out] *size pointer to a file size buffer
  * @return     status code
  *             - 0 success
  *             - 1 mp3 init failed
- * @note       none
+ * @note       the cluster link map table is built here, a file too fragmented
+ *             for the table is read through f_read
  */
-uint8_t ld3320_interface_mp3_init(char *name, uint32_t *size)
+uint8_t ld3320_interface_mp3_init(void *context, char *name, uint32_t *size)
 {
     FRESULT res;
     
+    gs_block_len[0] = 0;
+    gs_block_len[1] = 0;
+    gs_block_cur = 0;
+    gs_block_busy = 0;
     res = f_mount(&g_fs, "0:", 1);
     if (res != FR_OK)
     {
@@ -181,30 +412,52 @@ uint8_t ld3320_interface_mp3_init(char *name, uint32_t *size)
     {
         return 1;
     }
-    *size = f_size(&g_file);
+    gs_size = f_size(&g_file);
+    *size = gs_size;
+    
+    /* build the cluster link map table */
+    gs_clmt[0] = MP3_CLMT_SIZE;
+    g_file.cltbl = gs_clmt;
+    res = f_lseek(&g_file, CREATE_LINKMAP);
+    if (res == FR_OK)
+    {
+        gs_clmt_valid = 1;
+    }
+    else
+    {
+        g_file.cltbl = NULL;
+        gs_clmt_valid = 0;
+    }
     
     return 0;
 }
 
 /**
  * @brief      interface mp3 read
+ * @param[in]  *context pointer to the device context
  * @param[in]  addr mp3 file address
  * @param[in]  size read size
  * @param[out] *buffer pointer to a data buffer
  * @return     status code
  *             - 0 success
  *             - 1 mp3 read failed
- * @note       none
+ * @note       the seek is skipped when the read is sequential
  */
-uint8_t ld3320_interface_mp3_read(uint32_t addr, uint16_t size, uint8_t *buffer)
+uint8_t ld3320_interface_mp3_read(void *context, uint32_t addr, uint16_t size, uint8_t *buffer)
 {
     FRESULT res;
     UINT bw;
     
-    res = f_lseek(&g_file, addr);
-    if (res != FR_OK)
+    /* the sd bus is shared with the prefetch */
+    (void)a_mp3_block_wait();
+    
+    if (f_tell(&g_file) != addr)
     {
-        return 1;
+        res = f_lseek(&g_file, addr);
+        if (res != FR_OK)
+        {
+            return 1;
+        }
     }
     res = f_read(&g_file, buffer, size, &bw);  
     if (res != FR_OK)
@@ -216,16 +469,170 @@ uint8_t ld3320_interface_mp3_read(uint32_t addr, uint16_t size, uint8_t *buffer)
 }
 
 /**
- * @brief  interface mp3 deinit
- * @return status code
- *         - 0 success
- *         - 1 mp3 deinit failed
- * @note   none
+ * @brief      interface mp3 acquire
+ * @param[in]  *context pointer to the device context
+ * @param[in]  addr mp3 file address
+ * @param[in]  size max acquired size
+ * @param[out] **buffer pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mp3 acquire failed
+ * @note       the lent data must stay valid until the mp3 release,
+ *             the next block is prefetched by dma while the current one is lent
+ */
+uint8_t ld3320_interface_mp3_acquire(void *context, uint32_t addr, uint32_t size, uint8_t **buffer, uint32_t *len)
+{
+    uint8_t cur = gs_block_cur;
+    
+    /* refill if addr is outside the lent block */
+    if ((addr < gs_block_addr[cur]) || (addr >= gs_block_addr[cur] + gs_block_len[cur]))
+    {
+        uint32_t start;
+        
+        if (addr >= gs_size)
+        {
+            return 1;
+        }
+        start = addr & ~(uint32_t)(MP3_SECTOR_SIZE - 1);
+        
+        if (gs_clmt_valid == 0)
+        {
+            FRESULT res;
+            UINT bw;
+            
+            /* read through fatfs, sector aligned reads go straight into the block */
+            if (f_tell(&g_file) != start)
+            {
+                res = f_lseek(&g_file, start);
+                if (res != FR_OK)
+                {
+                    return 1;
+                }
+            }
+            res = f_read(&g_file, gs_block[cur], MP3_WINDOW_SIZE, &bw);
+            if ((res != FR_OK) || (bw == 0))
+            {
+                gs_block_len[cur] = 0;
+                
+                return 1;
+            }
+            gs_block_addr[cur] = start;
+            gs_block_len[cur] = bw;
+        }
+        else
+        {
+            /* switch to the prefetched block or load it now */
+            (void)a_mp3_block_wait();
+            cur ^= 1;
+            gs_block_cur = cur;
+            if ((gs_block_len[cur] == 0) || (gs_block_addr[cur] != start))
+            {
+                if (a_mp3_block_start(cur, start) != 0)
+                {
+                    return 1;
+                }
+                gs_block_busy = 1;
+                if (a_mp3_block_wait() != 0)
+                {
+                    return 1;
+                }
+            }
+            if (addr >= gs_block_addr[cur] + gs_block_len[cur])
+            {
+                return 1;
+            }
+            
+            /* prefetch the next block into the other buffer */
+            start = gs_block_addr[cur] + gs_block_len[cur];
+            if (start < gs_size)
+            {
+                if (a_mp3_block_start(cur ^ 1, start) == 0)
+                {
+                    gs_block_busy = 1;
+                }
+            }
+        }
+    }
+    
+    /* lend the block */
+    *buffer = (uint8_t *)gs_block[cur] + (addr - gs_block_addr[cur]);
+    *len = gs_block_addr[cur] + gs_block_len[cur] - addr;
+    if (*len > size)
+    {
+        *len = size;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface mp3 release
+ * @param[in] *context pointer to the device context
+ * @param[in] addr mp3 file address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 release failed
+ * @note      none
+ */
+uint8_t ld3320_interface_mp3_release(void *context, uint32_t addr, uint32_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface mutex lock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      bare metal, the exti irq can't wait for a lock, so nothing to do
+ */
+uint8_t ld3320_interface_mutex_lock(void *context)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface mutex trylock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mutex is busy
+ * @note      bare metal, nothing to do
+ */
+uint8_t ld3320_interface_mutex_trylock(void *context)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface mutex unlock
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      bare metal, nothing to do
+ */
+uint8_t ld3320_interface_mutex_unlock(void *context)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface mp3 deinit
+ * @param[in] *context pointer to the device context
+ * @return    status code
+ *            - 0 success
+ *            - 1 mp3 deinit failed
+ * @note      none
  */
-uint8_t ld3320_interface_mp3_deinit(void)
+uint8_t ld3320_interface_mp3_deinit(void *context)
 {
     FRESULT res;
     
+    (void)a_mp3_block_wait();
     res = f_close(&g_file);
     if (res != FR_OK)
     {
@@ -242,12 +649,13 @@ uint8_t ld3320_interface_mp3_deinit(void)
 
 /**
  * @brief     interface receive callback
+ * @param[in] *context pointer to the device context
  * @param[in] type receive callback type
  * @param[in] ind index
  * @param[in] *text pointer to a text buffer
  * @note      none
  */
-void ld3320_interface_receive_callback(uint8_t type, uint8_t ind, char *text)
+void ld3320_interface_receive_callback(void *context, uint8_t type, uint8_t ind, char *text)
 {
     if (type == LD3320_STATUS_ASR_FOUND_OK)
     {
@@ -71,6 +71,40 @@ void delay_us(uint32_t us);
  */
 void delay_ms(uint32_t ms);
 
+/**
+ * @brief  get the timestamp
+ * @return current timestamp in us
+ * @note   none
+ */
+uint32_t delay_timestamp_us(void);
+
+/**
+ * @brief sleep the core until the next interrupt
+ * @note  the slept time is counted as idle, call with the irq masked after checking
+ *        the wake condition so that no wake up is lost
+ */
+void delay_sleep(void);
+
+/**
+ * @brief     sleep ms
+ * @param[in] ms time
+ * @note      the core sleeps between the ticks and the slept time is counted as idle
+ */
+void delay_sleep_ms(uint32_t ms);
+
+/**
+ * @brief clear the idle statistics
+ * @note  none
+ */
+void delay_idle_clear(void);
+
+/**
+ * @brief  get the idle percentage
+ * @return idle percentage since the last clear
+ * @note   none
+ */
+uint8_t delay_idle_get_percent(void);
+
 /**
  * @}
  */
@@ -95,6 +95,27 @@ uint8_t sdio_write(uint32_t sector, uint8_t *buf, uint32_t cnt);
  */
 uint8_t sdio_read(uint32_t sector, uint8_t *buf, uint32_t cnt);
 
+/**
+ * @brief      sdio read start
+ * @param[in]  sector read first sector
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  cnt data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the dma keeps running after return, call sdio_read_wait before using buf
+ */
+uint8_t sdio_read_start(uint32_t sector, uint8_t *buf, uint32_t cnt);
+
+/**
+ * @brief  sdio read wait
+ * @return status code
+ *         - 0 success
+ *         - 2 read timeout
+ * @note   none
+ */
+uint8_t sdio_read_wait(void);
+
 /**
  * @brief  sdio get sd handle
  * @return pointer to a sd handle
@@ -79,6 +79,15 @@ uint8_t spi_init(spi_mode_t mode);
  */
 uint8_t spi_deinit(void);
 
+/**
+ * @brief     spi bus set frequence
+ * @param[in] freq spi running frequence
+ * @return    status code
+ *            - 0 success
+ * @note      the fastest prescaler not over freq is used
+ */
+uint8_t spi_set_freq(uint32_t freq);
+
 /**
  * @brief     spi bus write command
  * @param[in] *buf pointer to a data buffer
@@ -174,6 +183,62 @@ uint8_t spi_write_read(uint8_t *in_buf, uint32_t in_len, uint8_t *out_buf, uint3
  */
 uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief     spi bus write batch by dma
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      buf holds len / 3 commands, every command is sent by dma in its own chip select frame
+ *            and the next one is chained from the dma complete interrupt,
+ *            buf must stay valid until spi_write_batch_dma_wait returns
+ */
+uint8_t spi_write_batch_dma(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief  spi bus wait the dma batch
+ * @return status code
+ *         - 0 success
+ *         - 1 write failed
+ *         - 2 timeout
+ * @note   the core sleeps until the batch completes
+ */
+uint8_t spi_write_batch_dma_wait(void);
+
+/**
+ * @brief     spi bus enable or disable the dma
+ * @param[in] enable 0 blocking transfers, 1 dma transfers
+ * @note      none
+ */
+void spi_set_dma(uint8_t enable);
+
+/**
+ * @brief  spi bus get the dma status
+ * @return 0 blocking transfers, 1 dma transfers
+ * @note   none
+ */
+uint8_t spi_get_dma(void);
+
+/**
+ * @brief  spi get the tx dma handle
+ * @return pointer to a tx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef* spi_get_tx_dma_handle(void);
+
+/**
+ * @brief spi set tx done
+ * @note  called from the spi tx complete callback
+ */
+void spi_set_tx_done(void);
+
+/**
+ * @brief spi set tx error
+ * @note  called from the spi error callback
+ */
+void spi_set_tx_error(void);
+
 /**
  * @}
  */
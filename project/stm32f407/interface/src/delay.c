@@ -37,6 +37,8 @@
 #include "delay.h"
 
 static volatile uint32_t gs_fac_us = 0;        /**< fac cnt */
+static volatile uint32_t gs_idle_us = 0;       /**< slept time */
+static volatile uint32_t gs_idle_tick = 0;     /**< idle start tick */
 
 /**
  * @brief  delay clock init
@@ -107,3 +109,99 @@ void delay_ms(uint32_t ms)
     /* use the hal delay */
     HAL_Delay(ms);
 }
+
+/**
+ * @brief  get the timestamp
+ * @return current timestamp in us
+ * @note   none
+ */
+uint32_t delay_timestamp_us(void)
+{
+    uint32_t ms;
+    uint32_t val;
+    
+    /* read the tick and the systick counter until they are consistent */
+    do
+    {
+        ms = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (ms != HAL_GetTick());
+    
+    return ms * 1000 + (SysTick->LOAD - val) / gs_fac_us;
+}
+
+/**
+ * @brief sleep the core until the next interrupt
+ * @note  the slept time is counted as idle, call with the irq masked after checking
+ *        the wake condition so that no wake up is lost
+ */
+void delay_sleep(void)
+{
+    uint32_t t0;
+    uint32_t t1;
+    
+    /* the systick interrupt wakes the core at least every tick */
+    t0 = SysTick->VAL;
+    __WFI();
+    t1 = SysTick->VAL;
+    
+    /* the systick counts down */
+    if (t0 >= t1)
+    {
+        gs_idle_us += (t0 - t1) / gs_fac_us;
+    }
+    else
+    {
+        gs_idle_us += (t0 + SysTick->LOAD + 1 - t1) / gs_fac_us;
+    }
+}
+
+/**
+ * @brief     sleep ms
+ * @param[in] ms time
+ * @note      the core sleeps between the ticks and the slept time is counted as idle
+ */
+void delay_sleep_ms(uint32_t ms)
+{
+    uint32_t tick;
+    
+    tick = HAL_GetTick();
+    while ((HAL_GetTick() - tick) < ms)
+    {
+        __disable_irq();
+        delay_sleep();
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief clear the idle statistics
+ * @note  none
+ */
+void delay_idle_clear(void)
+{
+    gs_idle_us = 0;
+    gs_idle_tick = HAL_GetTick();
+}
+
+/**
+ * @brief  get the idle percentage
+ * @return idle percentage since the last clear
+ * @note   none
+ */
+uint8_t delay_idle_get_percent(void)
+{
+    uint32_t ms;
+    
+    ms = HAL_GetTick() - gs_idle_tick;
+    if (ms == 0)
+    {
+        return 0;
+    }
+    if (gs_idle_us / 10 >= ms)
+    {
+        return 100;
+    }
+    
+    return (uint8_t)(gs_idle_us / 10 / ms);
+}
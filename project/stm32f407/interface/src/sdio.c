@@ -167,6 +167,73 @@ uint8_t sdio_read(uint32_t sector, uint8_t *buf, uint32_t cnt)
     }
 }
 
+/**
+ * @brief      sdio read start
+ * @param[in]  sector read first sector
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  cnt data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the dma keeps running after return, call sdio_read_wait before using buf
+ */
+uint8_t sdio_read_start(uint32_t sector, uint8_t *buf, uint32_t cnt)
+{
+    HAL_StatusTypeDef res;
+    
+    /* set rx done 0 */
+    g_sd_rx_done = 0;
+    
+    /* start reading blocks */
+    res = HAL_SD_ReadBlocks_DMA(&g_sd_handle, (uint8_t*)buf, sector, cnt);
+    if (res != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  sdio read wait
+ * @return status code
+ *         - 0 success
+ *         - 2 read timeout
+ * @note   none
+ */
+uint8_t sdio_read_wait(void)
+{
+    uint32_t timeout = 1000;
+    
+    while (1)
+    {
+        /* if rx done */
+        if (g_sd_rx_done != 0)
+        {
+            break;
+        }
+        else
+        {
+            timeout--;
+            
+            /* if timeout */
+            if (timeout == 0)
+            {
+                return 2;
+            }
+        }
+        HAL_Delay(1);
+    }
+    
+    /* wait finished */
+    while (HAL_SD_GetCardState(&g_sd_handle) != HAL_SD_CARD_TRANSFER)
+    {
+        
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     sdio write
  * @param[in] sector write first sector
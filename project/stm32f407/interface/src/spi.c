@@ -35,11 +35,19 @@
  */
 
 #include "spi.h"
+#include "delay.h"
 
 /**
  * @brief spi var definition
  */
-SPI_HandleTypeDef g_spi_handle;        /**< spi handle */
+SPI_HandleTypeDef g_spi_handle;                  /**< spi handle */
+DMA_HandleTypeDef g_spi_tx_dma_handle;           /**< spi tx dma handle */
+static uint8_t gs_dma_enable = 1;                /**< dma enable */
+static uint8_t *gs_dma_buf;                      /**< dma batch buffer */
+static uint16_t gs_dma_len;                      /**< dma batch length */
+static volatile uint16_t gs_dma_pos;             /**< dma batch position */
+static volatile uint8_t gs_dma_done = 1;         /**< dma batch done */
+static volatile uint8_t gs_dma_error = 0;        /**< dma batch error */
 
 /**
  * @brief  spi cs init
@@ -137,6 +145,43 @@ uint8_t spi_deinit(void)
     return 0;
 }
 
+/**
+ * @brief     spi bus set frequence
+ * @param[in] freq spi running frequence
+ * @return    status code
+ *            - 0 success
+ * @note      the fastest prescaler not over freq is used
+ */
+uint8_t spi_set_freq(uint32_t freq)
+{
+    const uint32_t prescaler[8] = {SPI_BAUDRATEPRESCALER_2, SPI_BAUDRATEPRESCALER_4,
+                                   SPI_BAUDRATEPRESCALER_8, SPI_BAUDRATEPRESCALER_16,
+                                   SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_64,
+                                   SPI_BAUDRATEPRESCALER_128, SPI_BAUDRATEPRESCALER_256};
+    uint32_t pclk;
+    uint8_t i;
+    
+    /* spi1 runs on apb2 */
+    pclk = HAL_RCC_GetPCLK2Freq();
+    
+    /* find the fastest prescaler */
+    for (i = 0; i < 7; i++)
+    {
+        if ((pclk >> (i + 1)) <= freq)
+        {
+            break;
+        }
+    }
+    
+    /* set the prescaler */
+    __HAL_SPI_DISABLE(&g_spi_handle);
+    g_spi_handle.Init.BaudRatePrescaler = prescaler[i];
+    MODIFY_REG(g_spi_handle.Instance->CR1, SPI_CR1_BR, prescaler[i]);
+    __HAL_SPI_ENABLE(&g_spi_handle);
+    
+    return 0;
+}
+
 /**
  * @brief     spi bus write command
  * @param[in] *buf pointer to a data buffer
@@ -495,3 +540,165 @@ uint8_t spi_write_read(uint8_t *in_buf, uint32_t in_len, uint8_t *out_buf, uint3
     
     return 0;
 }
+
+/**
+ * @brief     spi bus write batch by dma
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      buf holds len / 3 commands, every command is sent by dma in its own chip select frame
+ *            and the next one is chained from the dma complete interrupt,
+ *            buf must stay valid until spi_write_batch_dma_wait returns
+ */
+uint8_t spi_write_batch_dma(uint8_t *buf, uint16_t len)
+{
+    /* check the running batch */
+    if (gs_dma_done == 0)
+    {
+        return 1;
+    }
+    
+    /* if len < 3 */
+    if (len < 3)
+    {
+        return 0;
+    }
+    
+    /* set the batch */
+    gs_dma_buf = buf;
+    gs_dma_len = len;
+    gs_dma_pos = 0;
+    gs_dma_error = 0;
+    gs_dma_done = 0;
+    
+    /* set cs low */
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_RESET);
+    
+    /* transmit the first command */
+    if (HAL_SPI_Transmit_DMA(&g_spi_handle, buf, 3) != HAL_OK)
+    {
+        /* set cs high */
+        HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+        gs_dma_done = 1;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  spi bus wait the dma batch
+ * @return status code
+ *         - 0 success
+ *         - 1 write failed
+ *         - 2 timeout
+ * @note   the core sleeps until the batch completes
+ */
+uint8_t spi_write_batch_dma_wait(void)
+{
+    uint32_t tick;
+    
+    tick = HAL_GetTick();
+    while (1)
+    {
+        /* check and sleep with the irq masked, a pending irq still wakes the core */
+        __disable_irq();
+        if (gs_dma_done != 0)
+        {
+            __enable_irq();
+            
+            break;
+        }
+        delay_sleep();
+        __enable_irq();
+        
+        /* if timeout */
+        if ((HAL_GetTick() - tick) > 1000)
+        {
+            (void)HAL_SPI_DMAStop(&g_spi_handle);
+            
+            /* set cs high */
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+            gs_dma_done = 1;
+            
+            return 2;
+        }
+    }
+    
+    return gs_dma_error;
+}
+
+/**
+ * @brief     spi bus enable or disable the dma
+ * @param[in] enable 0 blocking transfers, 1 dma transfers
+ * @note      none
+ */
+void spi_set_dma(uint8_t enable)
+{
+    gs_dma_enable = enable;
+}
+
+/**
+ * @brief  spi bus get the dma status
+ * @return 0 blocking transfers, 1 dma transfers
+ * @note   none
+ */
+uint8_t spi_get_dma(void)
+{
+    return gs_dma_enable;
+}
+
+/**
+ * @brief  spi get the tx dma handle
+ * @return pointer to a tx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef* spi_get_tx_dma_handle(void)
+{
+    return &g_spi_tx_dma_handle;
+}
+
+/**
+ * @brief spi set tx done
+ * @note  called from the spi tx complete callback
+ */
+void spi_set_tx_done(void)
+{
+    /* set cs high */
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+    
+    /* chain the next command */
+    gs_dma_pos += 3;
+    if (gs_dma_pos + 3 <= gs_dma_len)
+    {
+        /* set cs low */
+        HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_RESET);
+        
+        if (HAL_SPI_Transmit_DMA(&g_spi_handle, gs_dma_buf + gs_dma_pos, 3) != HAL_OK)
+        {
+            /* set cs high */
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+            gs_dma_error = 1;
+            gs_dma_done = 1;
+        }
+    }
+    else
+    {
+        gs_dma_done = 1;
+    }
+}
+
+/**
+ * @brief spi set tx error
+ * @note  called from the spi error callback
+ */
+void spi_set_tx_error(void)
+{
+    /* set cs high */
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+    gs_dma_error = 1;
+    gs_dma_done = 1;
+}
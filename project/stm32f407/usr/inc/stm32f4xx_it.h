@@ -126,6 +126,12 @@ void DMA2_Stream6_IRQHandler(void);
  */
 void DMA2_Stream3_IRQHandler(void);
 
+/**
+ * @brief dma2 stream5 irq handler
+ * @note  none
+ */
+void DMA2_Stream5_IRQHandler(void);
+
 /**
  * @brief sd irq handler
  * @note  none
@@ -44,7 +44,9 @@
 #include "gpio.h"
 #include "delay.h"
 #include "uart.h"
+#include "spi.h"
 #include "getopt.h"
+#include "ff.h"
 #include <stdlib.h>
 
 /**
@@ -54,6 +56,14 @@ uint8_t g_buf[256];                        /**< uart buffer */
 uint16_t volatile g_len;                   /**< uart buffer length */
 static volatile uint8_t gs_flag;           /**< global flag */
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
+static FATFS gs_fs;                        /**< benchmark fatfs handle */
+static FIL gs_file;                        /**< benchmark file handle */
+static uint8_t gs_chunk[512];              /**< benchmark chunk buffer */
+
+/**
+ * @brief mp3 read benchmark size definition
+ */
+#define MP3_BENCHMARK_SIZE (64 * 1024)     /**< 64 KB */
 
 /**
  * @brief exti 0 irq
@@ -82,12 +92,13 @@ void HAL_GPIO_EXTI_Callback(uint16_t pin)
 
 /**
  * @brief     asr callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] i asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_asr_callback(uint8_t type, uint8_t i, char *text)
+static void a_asr_callback(void *context, uint8_t type, uint8_t i, char *text)
 {
     uint8_t res;
     
@@ -117,12 +128,13 @@ static void a_asr_callback(uint8_t type, uint8_t i, char *text)
 
 /**
  * @brief     mp3 callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] i asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_mp3_callback(uint8_t type, uint8_t i, char *text)
+static void a_mp3_callback(void *context, uint8_t type, uint8_t i, char *text)
 {
     if (type == LD3320_STATUS_MP3_LOAD)
     {
@@ -140,6 +152,112 @@ static void a_mp3_callback(uint8_t type, uint8_t i, char *text)
     }
 }
 
+/**
+ * @brief     mp3 read chunk benchmark
+ * @param[in] *path pointer to a mp3 file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_mp3_benchmark(char *path)
+{
+    FRESULT res;
+    UINT bw;
+    uint8_t *buf;
+    uint32_t addr, size, len, num;
+    uint32_t t, us;
+    uint32_t legacy_us, legacy_max;
+    uint32_t stream_us, stream_max;
+    
+    /* legacy, f_lseek and f_read every chunk */
+    res = f_mount(&gs_fs, "0:", 1);
+    if (res != FR_OK)
+    {
+        ld3320_interface_debug_print("ld3320: mount failed.\n");
+        
+        return 1;
+    }
+    res = f_open(&gs_file, path, FA_READ);
+    if (res != FR_OK)
+    {
+        ld3320_interface_debug_print("ld3320: open %s failed.\n", path);
+        (void)f_unmount("0:");
+        
+        return 1;
+    }
+    size = f_size(&gs_file);
+    if (size > MP3_BENCHMARK_SIZE)
+    {
+        size = MP3_BENCHMARK_SIZE;
+    }
+    legacy_us = 0;
+    legacy_max = 0;
+    num = 0;
+    for (addr = 0; addr < size; addr += 512)
+    {
+        t = delay_timestamp_us();
+        res = f_lseek(&gs_file, addr);
+        if (res == FR_OK)
+        {
+            res = f_read(&gs_file, gs_chunk, 512, &bw);
+        }
+        us = delay_timestamp_us() - t;
+        if (res != FR_OK)
+        {
+            ld3320_interface_debug_print("ld3320: read failed.\n");
+            (void)f_close(&gs_file);
+            (void)f_unmount("0:");
+            
+            return 1;
+        }
+        legacy_us += us;
+        legacy_max = (us > legacy_max) ? us : legacy_max;
+        num++;
+    }
+    (void)f_close(&gs_file);
+    (void)f_unmount("0:");
+    if (num == 0)
+    {
+        ld3320_interface_debug_print("ld3320: %s is empty.\n", path);
+        
+        return 1;
+    }
+    
+    /* streaming, fast seek map and dma ping-pong blocks */
+    if (ld3320_interface_mp3_init(NULL, path, &len) != 0)
+    {
+        ld3320_interface_debug_print("ld3320: open %s failed.\n", path);
+        
+        return 1;
+    }
+    stream_us = 0;
+    stream_max = 0;
+    for (addr = 0; addr < size; addr += len)
+    {
+        t = delay_timestamp_us();
+        if (ld3320_interface_mp3_acquire(NULL, addr, 512, &buf, &len) != 0)
+        {
+            ld3320_interface_debug_print("ld3320: read failed.\n");
+            (void)ld3320_interface_mp3_deinit(NULL);
+            
+            return 1;
+        }
+        (void)ld3320_interface_mp3_release(NULL, addr, len);
+        us = delay_timestamp_us() - t;
+        stream_us += us;
+        stream_max = (us > stream_max) ? us : stream_max;
+    }
+    (void)ld3320_interface_mp3_deinit(NULL);
+    
+    /* output */
+    ld3320_interface_debug_print("ld3320: %d chunks of 512 bytes.\n", num);
+    ld3320_interface_debug_print("ld3320: legacy read avg %d us max %d us per chunk.\n", legacy_us / num, legacy_max);
+    ld3320_interface_debug_print("ld3320: stream read avg %d us max %d us per chunk.\n", stream_us / num, stream_max);
+    
+    return 0;
+}
+
 /**
  * @brief     ld3320 full function
  * @param[in] argc arg numbers
@@ -154,9 +272,10 @@ uint8_t ld3320(uint8_t argc, char **argv)
 {
     int c;
     int longindex = 0;
-    const char short_options[] = "hipe:t:";
+    const char short_options[] = "hipbe:t:";
     const struct option long_options[] =
     {
+        {"benchmark", no_argument, NULL, 'b'},
         {"help", no_argument, NULL, 'h'},
         {"information", no_argument, NULL, 'i'},
         {"port", no_argument, NULL, 'p'},
@@ -164,11 +283,17 @@ uint8_t ld3320(uint8_t argc, char **argv)
         {"test", required_argument, NULL, 't'},
         {"file", required_argument, NULL, 1},
         {"keyword", required_argument, NULL, 2},
+        {"dma", required_argument, NULL, 3},
+        {"irq", required_argument, NULL, 4},
+        {"event", required_argument, NULL, 5},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     char path[73]= "test.mp3";
     char key[33]= "ha-lou";
+    uint8_t dma = 1;
+    uint8_t deferred = 0;
+    uint8_t queue = 0;
     
     /* if no params */
     if (argc == 1)
@@ -219,6 +344,16 @@ uint8_t ld3320(uint8_t argc, char **argv)
                 break;
             }
             
+            /* benchmark */
+            case 'b' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "b");
+                
+                break;
+            }
+            
             /* example */
             case 'e' :
             {
@@ -258,6 +393,66 @@ uint8_t ld3320(uint8_t argc, char **argv)
                 
                 break;
             }
+            
+            /* dma */
+            case 3 :
+            {
+                /* set the dma */
+                if (strcmp("on", optarg) == 0)
+                {
+                    dma = 1;
+                }
+                else if (strcmp("off", optarg) == 0)
+                {
+                    dma = 0;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* irq */
+            case 4 :
+            {
+                /* set the irq mode */
+                if (strcmp("direct", optarg) == 0)
+                {
+                    deferred = 0;
+                }
+                else if (strcmp("deferred", optarg) == 0)
+                {
+                    deferred = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* event */
+            case 5 :
+            {
+                /* set the event mode */
+                if (strcmp("callback", optarg) == 0)
+                {
+                    queue = 0;
+                }
+                else if (strcmp("queue", optarg) == 0)
+                {
+                    queue = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
 
             /* the end */
             case -1 :
@@ -364,6 +559,9 @@ uint8_t ld3320(uint8_t argc, char **argv)
         char text[1][50];
         uint16_t i, len;
         uint32_t timeout;
+        ld3320_irq_stats_t stats;
+        ld3320_event_t event;
+        uint32_t overflow;
         
         /* replace the - */
         len = (uint16_t)strlen(key);
@@ -383,7 +581,7 @@ uint8_t ld3320(uint8_t argc, char **argv)
         }
         
         /* set the gpio irq */
-        g_gpio_irq = ld3320_asr_irq_handler; 
+        g_gpio_irq = (deferred != 0) ? ld3320_asr_irq_latch : ld3320_asr_irq_handler;
         
         /* output */
         ld3320_interface_debug_print("ld3320: key word is %s.\n", key);
@@ -398,6 +596,20 @@ uint8_t ld3320(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* set the event queue */
+        if (queue != 0)
+        {
+            res = ld3320_asr_set_event_queue(LD3320_BOOL_TRUE);
+            if (res != 0)
+            {
+                (void)ld3320_asr_deinit();
+                g_gpio_irq = NULL;
+                (void)gpio_interrupt_deinit();
+                
+                return 1;
+            }
+        }
+        
         /* set the keywords */
         memset(text[0], 0, sizeof(char) * 50);
         memcpy(text[0], key, strlen(key));
@@ -427,6 +639,17 @@ uint8_t ld3320(uint8_t argc, char **argv)
         timeout = 1000 * 10;
         while (timeout != 0)
         {
+            if (deferred != 0)
+            {
+                (void)ld3320_asr_service();
+            }
+            if (queue != 0)
+            {
+                while (ld3320_asr_poll_event(&event) == 0)
+                {
+                    a_asr_callback(NULL, event.type, event.index, event.text);
+                }
+            }
             if (gs_flag != 0)
             {
                 break;
@@ -446,6 +669,17 @@ uint8_t ld3320(uint8_t argc, char **argv)
             return 1;
         }
         ld3320_interface_debug_print("ld3320: found key word.\n");
+        if ((deferred != 0) && (ld3320_asr_get_irq_stats(&stats) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: irq latch %d, service %d, coalesced %d.\n", 
+                                         stats.latch_count, stats.service_count, stats.coalesced);
+            ld3320_interface_debug_print("ld3320: irq latency avg %dus, max %dus.\n", stats.latency_avg_us, stats.latency_max_us);
+            ld3320_interface_debug_print("ld3320: irq service avg %dus, max %dus.\n", stats.service_avg_us, stats.service_max_us);
+        }
+        if ((queue != 0) && (ld3320_asr_get_event_overflow(&overflow) == 0))
+        {
+            ld3320_interface_debug_print("ld3320: event overflow %d.\n", overflow);
+        }
         
         /* deinit */
         (void)ld3320_asr_deinit();
@@ -459,6 +693,7 @@ uint8_t ld3320(uint8_t argc, char **argv)
         uint8_t res;
         uint16_t i, len;
         uint32_t timeout;
+        ld3320_event_t event;
         
         /* replace the - */
         len = (uint16_t)strlen(path);
@@ -478,9 +713,12 @@ uint8_t ld3320(uint8_t argc, char **argv)
         }
         
         /* set the gpio irq */
-        g_gpio_irq = ld3320_mp3_irq_handler;
+        g_gpio_irq = (deferred != 0) ? ld3320_mp3_irq_latch : ld3320_mp3_irq_handler;
         ld3320_interface_debug_print("ld3320: play %s.\n", path);
         
+        /* set the spi dma */
+        spi_set_dma(dma);
+        
         /* mp3 init */
         res = ld3320_mp3_init(path, a_mp3_callback);
         if (res != 0)
@@ -491,8 +729,23 @@ uint8_t ld3320(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* set the event queue */
+        if (queue != 0)
+        {
+            res = ld3320_mp3_set_event_queue(LD3320_BOOL_TRUE);
+            if (res != 0)
+            {
+                (void)ld3320_mp3_deinit();
+                g_gpio_irq = NULL;
+                (void)gpio_interrupt_deinit();
+                
+                return 1;
+            }
+        }
+        
         /* start mp3 */
         gs_flag = 0;
+        delay_idle_clear();
         res = ld3320_mp3_start();
         if (res != 0)
         {
@@ -503,16 +756,27 @@ uint8_t ld3320(uint8_t argc, char **argv)
             return 1;
         }
         
-        /* waiting */
+        /* waiting, sleep the core to measure the idle time */
         timeout = 1000 * 60 * 10;
         while (timeout != 0)
         {
+            if (deferred != 0)
+            {
+                (void)ld3320_mp3_service();
+            }
+            if (queue != 0)
+            {
+                while (ld3320_mp3_poll_event(&event) == 0)
+                {
+                    a_mp3_callback(NULL, event.type, event.index, event.text);
+                }
+            }
             if (gs_flag != 0)
             {
                 break;
             }
             timeout--;
-            ld3320_interface_delay_ms(1);
+            delay_sleep_ms(1);
         }
         
         /* check the result */
@@ -526,6 +790,7 @@ uint8_t ld3320(uint8_t argc, char **argv)
             return 1;
         }
         ld3320_interface_debug_print("ld3320: play end.\n");
+        ld3320_interface_debug_print("ld3320: spi dma %s, cpu idle %d%%.\n", (dma != 0) ? "on" : "off", delay_idle_get_percent());
         
         /* deinit */
         (void)ld3320_mp3_deinit();
@@ -534,6 +799,30 @@ uint8_t ld3320(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("b", type) == 0)
+    {
+        uint8_t res;
+        uint16_t i, len;
+        
+        /* replace the - */
+        len = (uint16_t)strlen(path);
+        for (i = 0; i < len; i++)
+        {
+            if (path[i] == '-')
+            {
+                path[i] = ' ';
+            }
+        }
+        
+        /* run the mp3 read benchmark */
+        res = a_mp3_benchmark(path);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -544,15 +833,22 @@ uint8_t ld3320(uint8_t argc, char **argv)
         ld3320_interface_debug_print("  ld3320 (-t reg | --test=reg)\n");
         ld3320_interface_debug_print("  ld3320 (-t asr | --test=asr)\n");
         ld3320_interface_debug_print("  ld3320 (-t mp3 | --test=mp3) [--file=<path>]\n");
-        ld3320_interface_debug_print("  ld3320 (-e asr | --example=asr) [--keyword=<word>]\n");
-        ld3320_interface_debug_print("  ld3320 (-e mp3 | --example=mp3) [--file=<path>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e asr | --example=asr) [--keyword=<word>] [--irq=<direct | deferred>] [--event=<callback | queue>]\n");
+        ld3320_interface_debug_print("  ld3320 (-e mp3 | --example=mp3) [--file=<path>] [--dma=<on | off>] [--irq=<direct | deferred>] [--event=<callback | queue>]\n");
+        ld3320_interface_debug_print("  ld3320 (-b | --benchmark) [--file=<path>]\n");
         ld3320_interface_debug_print("\n");
         ld3320_interface_debug_print("Options:\n");
+        ld3320_interface_debug_print("  -b, --benchmark         Run the mp3 read benchmark of the legacy and streaming readers.\n");
+        ld3320_interface_debug_print("      --dma=<on | off>    Set the spi dma of the mp3 playback.([default: on])\n");
+        ld3320_interface_debug_print("      --event=<callback | queue>\n");
+        ld3320_interface_debug_print("                          Set the event mode, queue reads the events in the main loop.([default: callback])\n");
         ld3320_interface_debug_print("  -e <asr | mp3>, --example=<asr | mp3>\n");
         ld3320_interface_debug_print("                          Run the driver example.\n");
         ld3320_interface_debug_print("      --file=<path>       Set the mp3 file path.([default: test.mp3])\n");
         ld3320_interface_debug_print("  -h, --help              Show the help.\n");
         ld3320_interface_debug_print("  -i, --information       Show the chip information.\n");
+        ld3320_interface_debug_print("      --irq=<direct | deferred>\n");
+        ld3320_interface_debug_print("                          Set the irq mode, deferred latches in the irq and services in the main loop.([default: direct])\n");
         ld3320_interface_debug_print("      --keyword=<word>    Set the asr keyword.([default: ha-lou])\n");
         ld3320_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         ld3320_interface_debug_print("  -t <reg | asr | mp3>, --test=<reg | asr | mp3>\n");
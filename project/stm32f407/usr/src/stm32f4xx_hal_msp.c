@@ -36,6 +36,7 @@
 
 #include "stm32f4xx_hal.h"
 #include "sdio.h"
+#include "spi.h"
 
 /** 
  * @defgroup msp HAL_MSP_Private_Functions
@@ -156,6 +157,7 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
 void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
 {
     GPIO_InitTypeDef GPIO_InitStruct;
+    DMA_HandleTypeDef *spi_tx_dma_handle;
     
     if (hspi->Instance == SPI1)
     {
@@ -165,6 +167,9 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
         /* enable spi1 clock */
         __HAL_RCC_SPI1_CLK_ENABLE();
         
+        /* enable dma2 clock */
+        __HAL_RCC_DMA2_CLK_ENABLE();
+        
         /**
          * PA5 ------> SPI1_SCK
          * PA6 ------> SPI1_MISO
@@ -176,6 +181,30 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
         GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
         GPIO_InitStruct.Alternate = GPIO_AF5_SPI1;
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+        
+        /* get tx dma handle */
+        spi_tx_dma_handle = spi_get_tx_dma_handle();
+        
+        /* set tx dma, stream 3 is used by the sdio rx */
+        spi_tx_dma_handle->Instance = DMA2_Stream5;
+        spi_tx_dma_handle->Init.Channel = DMA_CHANNEL_3;
+        spi_tx_dma_handle->Init.Direction = DMA_MEMORY_TO_PERIPH;
+        spi_tx_dma_handle->Init.PeriphInc = DMA_PINC_DISABLE;
+        spi_tx_dma_handle->Init.MemInc = DMA_MINC_ENABLE;
+        spi_tx_dma_handle->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        spi_tx_dma_handle->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        spi_tx_dma_handle->Init.Mode = DMA_NORMAL;
+        spi_tx_dma_handle->Init.Priority = DMA_PRIORITY_HIGH;
+        spi_tx_dma_handle->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        
+        /* link tx dma */
+        __HAL_LINKDMA(hspi, hdmatx, *spi_tx_dma_handle);
+        (void)HAL_DMA_DeInit(spi_tx_dma_handle);
+        (void)HAL_DMA_Init(spi_tx_dma_handle);
+        
+        /* enable dma interrupt, it must preempt the exti running the driver */
+        HAL_NVIC_SetPriority(DMA2_Stream5_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(DMA2_Stream5_IRQn);
     }
 }
 
@@ -193,6 +222,12 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* hspi)
         
         /* spi gpio deinit */
         HAL_GPIO_DeInit(GPIOA, GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7);
+        
+        /* disable dma */
+        (void)HAL_DMA_DeInit(spi_get_tx_dma_handle());
+        
+        /* disable dma interrupt */
+        HAL_NVIC_DisableIRQ(DMA2_Stream5_IRQn);
     }
 }
 
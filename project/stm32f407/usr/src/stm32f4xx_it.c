@@ -36,6 +36,7 @@
 
 #include "stm32f4xx_it.h"
 #include "sdio.h"
+#include "spi.h"
 #include "uart.h"
 
 /**
@@ -231,6 +232,37 @@ void DMA2_Stream3_IRQHandler(void)
     HAL_DMA_IRQHandler(sdio_get_handle()->hdmarx);
 }
 
+/**
+ * @brief dma2 stream5 irq handler
+ * @note  none
+ */
+void DMA2_Stream5_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(spi_get_tx_dma_handle());
+}
+
+/**
+ * @brief     spi tx complete callback
+ * @param[in] *hspi pointer to a spi handle
+ * @note      none
+ */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    /* set tx done */
+    spi_set_tx_done();
+}
+
+/**
+ * @brief     spi error callback
+ * @param[in] *hspi pointer to a spi handle
+ * @note      none
+ */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    /* set tx error */
+    spi_set_tx_error();
+}
+
 /**
  * @brief sd irq handler
  * @note  none
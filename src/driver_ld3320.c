@@ -35,6 +35,7 @@
  */
 
 #include "driver_ld3320.h"
+#include "driver_ld3320_pinyin.h"
 
 /**
  * @brief chip information definition
@@ -126,6 +127,339 @@
 #define LD3320_PLL_ASR_1B        0x48
 #define LD3320_PLL_ASR_1D        0x1F
 
+/**
+ * @brief mp3 fifo layout definition
+ */
+#define LD3320_MP3_FIFO_LOWER                 0x0000        /**< mp3 fifo lower boundary */
+#define LD3320_MP3_FIFO_UPPER                 0x07EF        /**< mp3 fifo upper boundary */
+#define LD3320_MP3_FIFO_MCU_WATER_MARK        0x0377        /**< mcu is interrupted below this level */
+#define LD3320_MP3_FIFO_DSP_WATER_MARK        0x01BB        /**< dsp requests data below this level */
+
+/**
+ * @brief async start state definition
+ */
+#define LD3320_START_STATE_IDLE                 0x00        /**< no async start */
+#define LD3320_START_STATE_SOFT_RESET           0x01        /**< send the soft reset command */
+#define LD3320_START_STATE_INIT                 0x02        /**< check the fifo after the soft reset */
+#define LD3320_START_STATE_SEQUENCE             0x03        /**< write the current sequence */
+#define LD3320_START_STATE_WORD_BUSY            0x04        /**< poll the asr status before a key word */
+#define LD3320_START_STATE_WORD_CLEAR           0x05        /**< select the key word, clear and release the fifo */
+#define LD3320_START_STATE_WORD_DATA            0x06        /**< write the key word */
+#define LD3320_START_STATE_ASR_BUSY             0x07        /**< poll the asr status before the start */
+#define LD3320_START_STATE_RESET_HIGH           0x08        /**< reset gpio high */
+#define LD3320_START_STATE_RESET_LOW            0x09        /**< reset gpio low */
+#define LD3320_START_STATE_RESET_RELEASE        0x0A        /**< reset gpio high and wake the spi */
+#define LD3320_START_STATE_RESET_WAIT           0x0B        /**< wait after the reset */
+#define LD3320_START_STATE_RETRY                0x0C        /**< retry or give up */
+
+/**
+ * @brief async start sequence id definition
+ */
+#define LD3320_START_SEQ_COMMON_INIT            0x00        /**< gs_common_init_seq */
+#define LD3320_START_SEQ_ASR_CLOCK              0x01        /**< gs_common_asr_clock_seq */
+#define LD3320_START_SEQ_COMMON_TAIL            0x02        /**< gs_common_tail_seq */
+#define LD3320_START_SEQ_ASR_INIT               0x03        /**< gs_asr_init_seq */
+#define LD3320_START_SEQ_ASR_PREPARE            0x04        /**< gs_asr_prepare_seq with the mic gain and vad */
+#define LD3320_START_SEQ_ASR_START              0x05        /**< gs_asr_start_seq */
+
+/**
+ * @brief built sequence length definition
+ */
+#define LD3320_ASR_PREPARE_SEQ_LEN              6           /**< gs_asr_prepare_seq entries */
+#define LD3320_KEY_WORD_CLEAR_SEQ_LEN           4           /**< gs_asr_key_word_clear_seq entries */
+#define LD3320_KEY_WORD_TAIL_SEQ_LEN            3           /**< gs_asr_key_word_tail_seq entries */
+
+/**
+ * @brief asr ready wait definition
+ */
+#define LD3320_ASR_READY_SPIN                   4           /**< back to back status reads before sleeping */
+#define LD3320_ASR_READY_BACKOFF_MIN_US         125         /**< first sleep, doubled after every miss */
+#define LD3320_ASR_READY_BACKOFF_MAX_US         10000       /**< longest sleep */
+#define LD3320_ASR_READY_TIMEOUT_MS             100         /**< default deadline */
+#define LD3320_ASR_READY_HIST_BASE_US           250         /**< first histogram bucket */
+
+/**
+ * @brief poll interval definition
+ */
+#define LD3320_POLL_MIN_MS                      1           /**< near the mp3 fifo watermark */
+#define LD3320_POLL_PROBE_MS                    8           /**< max step while the mp3 period is unknown */
+#define LD3320_POLL_ASR_MS                      20          /**< asr waiting for the speech */
+#define LD3320_POLL_IDLE_MS                     100         /**< nothing running */
+#define LD3320_POLL_ASR_FLAG                    0x10        /**< asr sync interrupt */
+#define LD3320_POLL_MP3_FLAG                    0x14        /**< fifo data and sync interrupt */
+
+/**
+ * @brief common init sequence definition
+ */
+static const ld3320_sequence_t gs_common_init_seq[] =
+{
+    {LD3320_REG_ANALOG_CONTROL2, 0x03, 5},                    /* set analog control2 */
+    {LD3320_REG_LOW_POWER, 0x43, 5},                          /* set low power */
+    {LD3320_REG_ASR_RES_4, 0x02, 0},                          /* set asr result 4 */
+    {LD3320_REG_CLK_CONF1, LD3320_PLL_11, 0},                 /* set clock configure 1 */
+};
+
+/**
+ * @brief common asr clock sequence definition
+ */
+static const ld3320_sequence_t gs_common_asr_clock_seq[] =
+{
+    {LD3320_REG_ADC_CONTROL, 0x00, 0},                        /* set the adc control */
+    {LD3320_REG_CLK_CONF2, LD3320_PLL_ASR_19, 0},             /* set clock conf 2 */
+    {LD3320_REG_CLK_CONF3, LD3320_PLL_ASR_1B, 0},             /* set clock conf 3 */
+    {LD3320_REG_CLK_CONF4, LD3320_PLL_ASR_1D, 10},            /* set clock conf 4 */
+};
+
+/**
+ * @brief common mp3 clock sequence definition
+ */
+static const ld3320_sequence_t gs_common_mp3_clock_seq[] =
+{
+    {LD3320_REG_ADC_CONTROL, 0x00, 0},                        /* set the adc control */
+    {LD3320_REG_CLK_CONF2, LD3320_PLL_MP3_19, 0},             /* set clock conf 2 */
+    {LD3320_REG_CLK_CONF3, LD3320_PLL_MP3_1B, 0},             /* set clock conf 3 */
+    {LD3320_REG_CLK_CONF4, LD3320_PLL_MP3_1D, 10},            /* set clock conf 4 */
+};
+
+/**
+ * @brief common tail sequence definition
+ */
+static const ld3320_sequence_t gs_common_tail_seq[] =
+{
+    {LD3320_REG_ASR_DSP_SLEEP, 0x04, 0},                      /* enable dsp sleep */
+    {LD3320_REG_CMD, 0x4C, 5},                                /* send dsp sleep enable command */
+    {LD3320_REG_ASR_STR_LEN, 0x00, 0},                        /* set string length 0 */
+    {LD3320_REG_LOW_POWER, 0x4F, 0},                          /* set low power */
+    {LD3320_REG_INIT, 0xFF, 0},                               /* set init */
+};
+
+/**
+ * @brief mp3 init sequence definition
+ */
+static const ld3320_sequence_t gs_mp3_init_seq[] =
+{
+    {LD3320_REG_INIT_CONTROL, 0x02, 0},                                                         /* set mp3 mode */
+    {LD3320_REG_CMD, 0x48, 10},                                                                 /* active dsp */
+    {LD3320_REG_FEEDBACK, 0x52, 0},                                                             /* set feedback */
+    {LD3320_REG_LINEOUT, 0x00, 0},                                                              /* set line out */
+    {LD3320_REG_HEADSET_LEFT, 0x00, 0},                                                         /* set headset left */
+    {LD3320_REG_HEADSET_RIGHT, 0x00, 2},                                                        /* set headset right */
+    {LD3320_REG_SPEAKER, 0xFF, 0},                                                              /* set speaker */
+    {LD3320_REG_GAIN_CONTROL, 0xFF, 2},                                                         /* set gain control */
+    {LD3320_REG_ANALOG_CONTROL1, 0xFF, 0},                                                      /* set analog control 1 */
+    {LD3320_REG_ANALOG_CONTROL2, 0xFF, 2},                                                      /* set analog control 2 */
+    {LD3320_REG_FIFO_DATA_LOWER_LOW, LD3320_MP3_FIFO_LOWER & 0xFF, 0},                          /* set fifo data lower low */
+    {LD3320_REG_FIFO_DATA_LOWER_HIGH, (LD3320_MP3_FIFO_LOWER >> 8) & 0xFF, 0},                  /* set fifo data lower high */
+    {LD3320_REG_FIFO_DATA_UPPER_LOW, LD3320_MP3_FIFO_UPPER & 0xFF, 0},                          /* set fifo data upper low */
+    {LD3320_REG_FIFO_DATA_UPPER_HIGH, (LD3320_MP3_FIFO_UPPER >> 8) & 0xFF, 0},                  /* set fifo data upper high */
+    {LD3320_REG_FIFO_MCU_WATER_MARK_L, LD3320_MP3_FIFO_MCU_WATER_MARK & 0xFF, 0},               /* set fifo mcu watermark low */
+    {LD3320_REG_FIFO_MCU_WATER_MARK_H, (LD3320_MP3_FIFO_MCU_WATER_MARK >> 8) & 0xFF, 0},        /* set fifo mcu watermark high */
+    {LD3320_REG_FIFO_DSP_WATER_MARK_L, LD3320_MP3_FIFO_DSP_WATER_MARK & 0xFF, 0},               /* set fifo dsp watermark low */
+    {LD3320_REG_FIFO_DSP_WATER_MARK_H, (LD3320_MP3_FIFO_DSP_WATER_MARK >> 8) & 0xFF, 0},        /* set fifo dsp watermark high */
+};
+
+/**
+ * @brief mp3 start sequence definition
+ */
+static const ld3320_sequence_t gs_mp3_start_seq[] =
+{
+    {LD3320_REG_INT_AUX, 0x00, 0},                            /* write int aux */
+    {LD3320_REG_CMD, 0x48, 0},                                /* write command */
+    {LD3320_REG_MP3_CONF, 0x01, 0},                           /* set mp3 conf */
+    {LD3320_REG_INT_CONF, 0x04, 0},                           /* set int conf */
+    {LD3320_REG_FIFO_INT_CONF, 0x01, 0},                      /* set fifo int conf */
+    {LD3320_REG_FEEDBACK, 0x5A, 0},                           /* set feedback */
+};
+
+/**
+ * @brief asr init sequence definition
+ */
+static const ld3320_sequence_t gs_asr_init_seq[] =
+{
+    {LD3320_REG_INIT_CONTROL, 0x00, 0},                       /* set asr mode */
+    {LD3320_REG_CMD, 0x48, 10},                               /* active dsp */
+    {LD3320_REG_FIFO_EXT_LOWER_LOW, 0x80, 0},                 /* fifo ext lower low */
+    {LD3320_REG_FIFO_EXT_LOWER_HIGH, 0x07, 0},                /* fifo ext lower high */
+    {LD3320_REG_FIFO_EXT_UPPER_LOW, 0xFF, 0},                 /* fifo ext upper low */
+    {LD3320_REG_FIFO_EXT_UPPER_HIGH, 0x07, 0},                /* fifo ext upper high */
+    {LD3320_REG_FIFO_EXT_MCU_WATER_MARK_L, 0x00, 0},          /* fifo ext mcu watermark low */
+    {LD3320_REG_FIFO_EXT_MCU_WATER_MARK_H, 0x08, 0},          /* fifo ext mcu watermark high */
+    {LD3320_REG_FIFO_EXT_DSP_WATER_MARK_L, 0x00, 0},          /* fifo ext dsp watermark low */
+    {LD3320_REG_FIFO_EXT_DSP_WATER_MARK_H, 0x08, 2},          /* fifo ext dsp watermark high */
+};
+
+/**
+ * @brief asr prepare sequence definition
+ * @note  the gain and the vad entries are set from the handle
+ */
+static const ld3320_sequence_t gs_asr_prepare_seq[LD3320_ASR_PREPARE_SEQ_LEN] =
+{
+    {LD3320_REG_ADC_GAIN, 0x00, 0},                           /* set ad gain */
+    {LD3320_REG_ASR_VAD_PARAM, 0x00, 0},                      /* set asr vad param */
+    {LD3320_REG_ADC_CONF, 0x09, 0},                           /* set adc conf */
+    {LD3320_REG_INIT_CONTROL, 0x20, 0},                       /* set init control */
+    {LD3320_REG_FIFO_CLEAR, 0x01, 2},                         /* set fifo clear */
+    {LD3320_REG_FIFO_CLEAR, 0x00, 2},                         /* clear fifo clear */
+};
+
+/**
+ * @brief asr key word clear sequence definition
+ * @note  the index entry is set from the key word
+ */
+static const ld3320_sequence_t gs_asr_key_word_clear_seq[LD3320_KEY_WORD_CLEAR_SEQ_LEN] =
+{
+    {LD3320_REG_ASR_INDEX, 0x00, 0},                          /* write asr index */
+    {LD3320_REG_ASR_DATA, 0x00, 0},                           /* write asr data */
+    {LD3320_REG_FIFO_CLEAR, 0x04, LD3320_KEY_WORD_CLEAR_MS},  /* fifo clear */
+    {LD3320_REG_FIFO_CLEAR, 0x00, LD3320_KEY_WORD_CLEAR_MS},  /* release the fifo clear */
+};
+
+/**
+ * @brief asr key word tail sequence definition
+ * @note  the length entry is set from the key word
+ */
+static const ld3320_sequence_t gs_asr_key_word_tail_seq[LD3320_KEY_WORD_TAIL_SEQ_LEN] =
+{
+    {LD3320_REG_ASR_STR_LEN, 0x00, 0},                        /* asr str length */
+    {LD3320_REG_ASR_STATUS, 0xFF, 0},                         /* clear asr status */
+    {LD3320_REG_DSP_CMD, 0x04, 0},                            /* add dsp words status */
+};
+
+/**
+ * @brief asr start sequence definition
+ */
+static const ld3320_sequence_t gs_asr_start_seq[] =
+{
+    {LD3320_REG_ASR_STATUS, 0xFF, 0},                         /* clear asr status */
+    {LD3320_REG_DSP_CMD, 0x06, 5},                            /* start dsp asr */
+    {LD3320_REG_ADC_CONF, 0x0B, 0},                           /* enable adc mic */
+    {LD3320_REG_INT_CONF, 0x10, 0},                           /* enable sync */
+    {LD3320_REG_INIT_CONTROL, 0x00, 0},                       /* set the init control */
+};
+
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+/**
+ * @brief     check the register is cacheable
+ * @param[in] address register address
+ * @return    status code
+ *            - 0 not cacheable
+ *            - 1 cacheable
+ * @note      only the configuration registers that the chip never changes by itself are cacheable
+ */
+static uint8_t a_ld3320_cache_check(uint8_t address)
+{
+    switch (address)
+    {
+        case LD3320_REG_FIFO_INT_CONF :
+        case LD3320_REG_CLK_CONF1 :
+        case LD3320_REG_CLK_CONF2 :
+        case LD3320_REG_CLK_CONF3 :
+        case LD3320_REG_CLK_CONF4 :
+        case LD3320_REG_ADC_CONTROL :
+        case LD3320_REG_FIFO_DATA_UPPER_LOW :
+        case LD3320_REG_FIFO_DATA_UPPER_HIGH :
+        case LD3320_REG_FIFO_DATA_LOWER_LOW :
+        case LD3320_REG_FIFO_DATA_LOWER_HIGH :
+        case LD3320_REG_FIFO_MCU_WATER_MARK_L :
+        case LD3320_REG_FIFO_MCU_WATER_MARK_H :
+        case LD3320_REG_FIFO_DSP_WATER_MARK_L :
+        case LD3320_REG_FIFO_DSP_WATER_MARK_H :
+        case LD3320_REG_INT_CONF :
+        case LD3320_REG_ADC_GAIN :
+        case LD3320_REG_FIFO_EXT_UPPER_LOW :
+        case LD3320_REG_FIFO_EXT_UPPER_HIGH :
+        case LD3320_REG_FIFO_EXT_LOWER_LOW :
+        case LD3320_REG_FIFO_EXT_LOWER_HIGH :
+        case LD3320_REG_FIFO_EXT_MCU_WATER_MARK_L :
+        case LD3320_REG_FIFO_EXT_MCU_WATER_MARK_H :
+        case LD3320_REG_FIFO_EXT_DSP_WATER_MARK_L :
+        case LD3320_REG_FIFO_EXT_DSP_WATER_MARK_H :
+        case LD3320_REG_CLK_CONF5 :
+        case LD3320_REG_HEADSET_LEFT :
+        case LD3320_REG_HEADSET_RIGHT :
+        case LD3320_REG_FEEDBACK :
+        case LD3320_REG_ANALOG_CONTROL1 :
+        case LD3320_REG_ANALOG_CONTROL2 :
+        case LD3320_REG_GAIN_CONTROL :
+        case LD3320_REG_SPEAKER :
+        case LD3320_REG_LINEOUT :
+        case LD3320_REG_ASR_VAD_PARAM :
+        case LD3320_REG_ASR_VAD_START :
+        case LD3320_REG_ASR_VAD_SILENCE_END :
+        case LD3320_REG_ASR_VAD_VOICE_MAX_LEN :
+        case LD3320_REG_ASR_PASS_FRAME :
+        case LD3320_REG_ASR_TIME :
+        {
+            return 1;
+        }
+        default :
+        {
+            return 0;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief     invalidate the register cache
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      none
+ */
+static void a_ld3320_cache_invalidate(ld3320_handle_t *handle)
+{
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    memset(handle->cache_valid, 0, sizeof(uint8_t) * 32);        /* clear the valid bitmap */
+#else
+    (void)handle;                                                /* no cache */
+#endif
+}
+
+/**
+ * @brief     update the register cache before writing
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] address register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 write to the bus
+ *            - 1 skip the write
+ * @note      none
+ */
+static uint8_t a_ld3320_cache_write(ld3320_handle_t *handle, uint8_t address, uint8_t data)
+{
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    if ((address == LD3320_REG_CMD) && (data == 0x35))                              /* soft reset command */
+    {
+        a_ld3320_cache_invalidate(handle);                                          /* invalidate the cache */
+        
+        return 0;                                                                   /* write to the bus */
+    }
+    if ((handle->cache_enable == 0) || (a_ld3320_cache_check(address) == 0))        /* check the cache */
+    {
+        return 0;                                                                   /* write to the bus */
+    }
+    if (((handle->cache_valid[address / 8] >> (address % 8)) & 0x01) != 0)          /* check valid */
+    {
+        if (handle->cache[address] == data)                                         /* check the value */
+        {
+            handle->cache_hit++;                                                    /* hit++ */
+            
+            return 1;                                                               /* skip the write */
+        }
+    }
+    handle->cache_miss++;                                                           /* miss++ */
+    handle->cache[address] = data;                                                  /* update the cache */
+    handle->cache_valid[address / 8] |= (uint8_t)(1 << (address % 8));              /* set valid */
+    
+    return 0;                                                                       /* write to the bus */
+#else
+    (void)handle;                                                                   /* no cache */
+    (void)address;                                                                  /* no cache */
+    (void)data;                                                                     /* no cache */
+    
+    return 0;                                                                       /* write to the bus */
+#endif
+}
+
 /**
  * @brief     write the data
  * @param[in] *handle pointer to an ld3320 handle structure
@@ -141,17 +475,24 @@ static uint8_t a_ld3320_write_byte(ld3320_handle_t *handle, uint8_t address, uin
     uint8_t res;
     uint8_t buf[3];
     
-    buf[0] = 0x04;                                         /* set write command */
-    buf[1] = address;                                      /* set register address */
-    buf[2] = data;                                         /* set written data */
-    res = handle->spi_write_cmd((uint8_t *)buf, 3);        /* write data command */
-    if (res != 0)                                          /* check result */
+    if (a_ld3320_cache_write(handle, address, data) != 0)        /* check the cache */
+    {
+        return 0;                                                /* success return 0 */
+    }
+    buf[0] = 0x04;                                               /* set write command */
+    buf[1] = address;                                            /* set register address */
+    buf[2] = data;                                               /* set written data */
+    res = handle->spi_write_cmd(handle->context, 
+                                (uint8_t *)buf, 3);              /* write data command */
+    if (res != 0)                                                /* check result */
     {
-        return 1;                                          /* return error */
+        a_ld3320_cache_invalidate(handle);                       /* invalidate the cache */
+        
+        return 1;                                                /* return error */
     }
     else
     {
-        return 0;                                          /* success return 0 */
+        return 0;                                                /* success return 0 */
     }
 }
 
@@ -169,17 +510,150 @@ static uint8_t a_ld3320_read_byte(ld3320_handle_t *handle, uint8_t address, uint
 {
     uint8_t res;
     uint16_t reg;
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    uint8_t cacheable;
     
-    reg = ((uint16_t)(0x05) << 8) | address;               /* set register */
-    res = handle->spi_read_address16(reg, data, 1);        /* read data */
-    if (res != 0)                                          /* check result */
+    cacheable = (uint8_t)((handle->cache_enable != 0) && 
+                          (a_ld3320_cache_check(address) != 0));                    /* check cacheable */
+    if ((cacheable != 0) && 
+        (((handle->cache_valid[address / 8] >> (address % 8)) & 0x01) != 0))        /* check valid */
     {
-        return 1;                                          /* return error */
+        *data = handle->cache[address];                                             /* get the cached data */
+        handle->cache_hit++;                                                        /* hit++ */
+        
+        return 0;                                                                   /* success return 0 */
     }
-    else
+#endif
+    
+    reg = ((uint16_t)(0x05) << 8) | address;                                        /* set register */
+    res = handle->spi_read_address16(handle->context, reg, data, 1);                /* read data */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    if (cacheable != 0)                                                             /* cacheable */
+    {
+        handle->cache_miss++;                                                       /* miss++ */
+        handle->cache[address] = *data;                                             /* update the cache */
+        handle->cache_valid[address / 8] |= (uint8_t)(1 << (address % 8));          /* set valid */
+    }
+#endif
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief         write the sequence up to the next delay
+ * @param[in]     *handle pointer to an ld3320 handle structure
+ * @param[in]     *seq pointer to a sequence table
+ * @param[in]     len sequence table length
+ * @param[in,out] *index pointer to a sequence position buffer
+ * @param[out]    *delay_ms pointer to a delay buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 write failed
+ * @note          stops after the first entry with a delay and returns the delay instead of sleeping
+ */
+static uint8_t a_ld3320_write_sequence_part(ld3320_handle_t *handle, const ld3320_sequence_t *seq, uint16_t len,
+                                            uint16_t *index, uint16_t *delay_ms)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t num;
+    uint8_t buf[LD3320_BATCH_MAX_LEN * 3];
+    
+    *delay_ms = 0;                                                                            /* init 0 */
+    if (handle->spi_write_batch == NULL)                                                      /* check spi_write_batch */
+    {
+        for (i = *index; i < len; i++)                                                        /* write one by one */
+        {
+            res = a_ld3320_write_byte(handle, seq[i].reg, seq[i].data);                       /* write data */
+            if (res != 0)                                                                     /* check result */
+            {
+                *index = i;                                                                   /* save the position */
+                
+                return 1;                                                                     /* return error */
+            }
+            if (seq[i].delay_ms != 0)                                                         /* check delay */
+            {
+                *delay_ms = seq[i].delay_ms;                                                  /* set delay */
+                i++;                                                                          /* skip this entry */
+                
+                break;                                                                        /* break */
+            }
+        }
+        *index = i;                                                                           /* save the position */
+        
+        return 0;                                                                             /* success return 0 */
+    }
+    
+    num = 0;                                                                                  /* init 0 */
+    for (i = *index; i < len; i++)                                                            /* pack the commands */
+    {
+        if (a_ld3320_cache_write(handle, seq[i].reg, seq[i].data) == 0)                       /* check the cache */
+        {
+            buf[num * 3 + 0] = 0x04;                                                          /* set write command */
+            buf[num * 3 + 1] = seq[i].reg;                                                    /* set register address */
+            buf[num * 3 + 2] = seq[i].data;                                                   /* set written data */
+            num++;                                                                            /* num++ */
+        }
+        if ((num != 0) && 
+            ((seq[i].delay_ms != 0) || (num >= LD3320_BATCH_MAX_LEN) || (i == len - 1)))      /* flush point */
+        {
+            res = handle->spi_write_batch(handle->context, 
+                                          (uint8_t *)buf, (uint16_t)(num * 3));               /* write batch */
+            if (res != 0)                                                                     /* check result */
+            {
+                a_ld3320_cache_invalidate(handle);                                            /* invalidate the cache */
+                *index = i;                                                                   /* save the position */
+                
+                return 1;                                                                     /* return error */
+            }
+            num = 0;                                                                          /* reset num */
+        }
+        if (seq[i].delay_ms != 0)                                                             /* check delay */
+        {
+            *delay_ms = seq[i].delay_ms;                                                      /* set delay */
+            i++;                                                                              /* skip this entry */
+            
+            break;                                                                            /* break */
+        }
+    }
+    *index = i;                                                                               /* save the position */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     write the sequence
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *seq pointer to a sequence table
+ * @param[in] len sequence table length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ld3320_write_sequence(ld3320_handle_t *handle, const ld3320_sequence_t *seq, uint16_t len)
+{
+    uint16_t i;
+    uint16_t delay;
+    
+    i = 0;                                                                                    /* init 0 */
+    while (i < len)                                                                           /* write all */
     {
-        return 0;                                          /* success return 0 */
+        if (a_ld3320_write_sequence_part(handle, seq, len, &i, &delay) != 0)                  /* write to the next delay */
+        {
+            return 1;                                                                         /* return error */
+        }
+        if (delay != 0)                                                                       /* check delay */
+        {
+            handle->delay_ms(delay);                                                          /* delay */
+        }
     }
+    
+    return 0;                                                                                 /* success return 0 */
 }
 
 /**
@@ -195,165 +669,74 @@ static uint8_t a_ld3320_common_init(ld3320_handle_t *handle)
     uint8_t res;
     uint8_t reg;
     
-    res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, (uint8_t *)&reg);            /* read fifo status */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: read fifo status failed.\n");                        /* read fifo status failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x35);                              /* send soft reset command */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: send command failed.\n");                            /* send command failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    handle->delay_ms(10);                                                                 /* delay 10 ms */
-    res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, (uint8_t *)&reg);            /* read fifo status */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: read fifo status failed.\n");                        /* read fifo status failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL2, 0x03);                  /* set analog control2 */
-    if (res != 0)                                                                         /* check result */
+    res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, (uint8_t *)&reg);                             /* read fifo status */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("ld3320: write byte failed.\n");                              /* write byte failed */
+        handle->debug_print("ld3320: read fifo status failed.\n");                                         /* read fifo status failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
-    handle->delay_ms(5);                                                                  /* delay 5 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_LOW_POWER, 0x43);                        /* set low power */
-    if (res != 0)                                                                         /* check result */
+    res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x35);                                               /* send soft reset command */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("ld3320: set low power failed.\n");                           /* set low power failed */
+        handle->debug_print("ld3320: send command failed.\n");                                             /* send command failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
-    handle->delay_ms(5);                                                                  /* delay 5 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_RES_4, 0x02);                        /* set asr result 4 */
-    if (res != 0)                                                                         /* check result */
+    handle->delay_ms(10);                                                                                  /* delay 10 ms */
+    res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, (uint8_t *)&reg);                             /* read fifo status */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("ld3320: write byte failed.\n");                              /* write byte failed */
+        handle->debug_print("ld3320: read fifo status failed.\n");                                         /* read fifo status failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF1, LD3320_PLL_11);               /* set clock configure 1 */
-    if (res != 0)                                                                         /* check result */
+    res = a_ld3320_write_sequence(handle, gs_common_init_seq,
+                                  sizeof(gs_common_init_seq) / sizeof(ld3320_sequence_t));                 /* write common init sequence */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("ld3320: set clock configure 1 failed.\n");                   /* set clock configure 1 failed */
+        handle->debug_print("ld3320: write common init sequence failed.\n");                               /* write common init sequence failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
-    if (handle->mode == LD3320_MODE_ASR)                                                  /* asr mode */
+    if (handle->mode == LD3320_MODE_ASR)                                                                   /* asr mode */
     {
-        res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONTROL, 0x00);                  /* set the adc control */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set adc control failed.\n");                     /* set adc control failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF2, LD3320_PLL_ASR_19);       /* set clock conf 2 */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set clock conf 3 failed.\n");                    /* set clock conf 2 failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF3, LD3320_PLL_ASR_1B);       /* set clock conf 3 */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set clock conf 3 failed.\n");                    /* set clock conf 3 failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF4, LD3320_PLL_ASR_1D);       /* set clock conf 4 */
-        if (res != 0)                                                                     /* check result */
+        res = a_ld3320_write_sequence(handle, gs_common_asr_clock_seq,
+                                      sizeof(gs_common_asr_clock_seq) / sizeof(ld3320_sequence_t));        /* write asr clock sequence */
+        if (res != 0)                                                                                      /* check result */
         {
-            handle->debug_print("ld3320: set clock conf 4 failed.\n");                    /* set clock conf 4 failed */
+            handle->debug_print("ld3320: write asr clock sequence failed.\n");                             /* write asr clock sequence failed */
             
-            return 1;                                                                     /* return error */
+            return 1;                                                                                      /* return error */
         }
     }
-    else if (handle->mode == LD3320_MODE_MP3)                                             /* mp3 mode */
+    else if (handle->mode == LD3320_MODE_MP3)                                                              /* mp3 mode */
     {
-        res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONTROL, 0x00);                  /* set the adc control */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set adc control failed.\n");                     /* set adc control failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF2, LD3320_PLL_MP3_19);       /* set clock conf 2 */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set clock conf 3 failed.\n");                    /* set clock conf 2 failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF3, LD3320_PLL_MP3_1B);       /* set clock conf 3 */
-        if (res != 0)                                                                     /* check result */
-        {
-            handle->debug_print("ld3320: set clock conf 3 failed.\n");                    /* set clock conf 3 failed */
-            
-            return 1;                                                                     /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CLK_CONF4, LD3320_PLL_MP3_1D);       /* set clock conf 4 */
-        if (res != 0)                                                                     /* check result */
+        res = a_ld3320_write_sequence(handle, gs_common_mp3_clock_seq,
+                                      sizeof(gs_common_mp3_clock_seq) / sizeof(ld3320_sequence_t));        /* write mp3 clock sequence */
+        if (res != 0)                                                                                      /* check result */
         {
-            handle->debug_print("ld3320: set clock conf 4 failed.\n");                    /* set clock conf 4 failed */
+            handle->debug_print("ld3320: write mp3 clock sequence failed.\n");                             /* write mp3 clock sequence failed */
             
-            return 1;                                                                     /* return error */
+            return 1;                                                                                      /* return error */
         }
     }
     else
     {
-        handle->debug_print("ld3320: mode is invalid.\n");                                /* mode is invalid */
-        
-        return 1;                                                                         /* return error */
-    }
-    handle->delay_ms(10);                                                                 /* delay 10 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_DSP_SLEEP, 0x04);                    /* enable dsp sleep */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set dsp sleep failed.\n");                           /* set dsp sleep failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x4C);                              /* send dsp sleep enable command */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: send command failed.\n");                            /* send command failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    handle->delay_ms(5);                                                                  /* delay 5 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_STR_LEN, 0x00);                      /* set string length 0 */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set string length failed.\n");                       /* set string length failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_LOW_POWER, 0x4F);                        /* set low power */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set low power failed.\n");                           /* set low power failed */
+        handle->debug_print("ld3320: mode is invalid.\n");                                                 /* mode is invalid */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INIT, 0xFF);                             /* set init */
-    if (res != 0)                                                                         /* check result */
+    res = a_ld3320_write_sequence(handle, gs_common_tail_seq,
+                                  sizeof(gs_common_tail_seq) / sizeof(ld3320_sequence_t));                 /* write common tail sequence */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("ld3320: set init failed.\n");                                /* set init failed */
+        handle->debug_print("ld3320: write common tail sequence failed.\n");                               /* write common tail sequence failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                                          /* return error */
     }
     
-    return 0;                                                                             /* success return 0 */
+    return 0;                                                                                              /* success return 0 */
 }
 
 /**
@@ -368,158 +751,205 @@ static uint8_t a_ld3320_mp3_init(ld3320_handle_t *handle)
 {
     uint8_t res;
     
-    res = a_ld3320_common_init(handle);                                               /* common init */
-    if (res != 0)                                                                     /* check result */
-    {
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INIT_CONTROL, 0x02);                 /* set mp3 mode */
-    if (res != 0)                                                                     /* check result */
+    res = a_ld3320_common_init(handle);                                                        /* common init */
+    if (res != 0)                                                                              /* check result */
     {
-        handle->debug_print("ld3320: set int control failed.\n");                     /* set int control failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x48);                          /* active dsp */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set command failed.\n");                         /* set command failed */
-        
-        return 1;                                                                     /* return error */
+        return 1;                                                                              /* return error */
     }
-    handle->delay_ms(10);                                                             /* delay 10 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_FEEDBACK, 0x52);                     /* set feedback */
-    if (res != 0)                                                                     /* check result */
+    res = a_ld3320_write_sequence(handle, gs_mp3_init_seq,
+                                  sizeof(gs_mp3_init_seq) / sizeof(ld3320_sequence_t));        /* write mp3 init sequence */
+    if (res != 0)                                                                              /* check result */
     {
-        handle->debug_print("ld3320: set feedback failed.\n");                        /* set feedback failed */
+        handle->debug_print("ld3320: write mp3 init sequence failed.\n");                      /* write mp3 init sequence failed */
         
-        return 1;                                                                     /* return error */
+        return 1;                                                                              /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_LINEOUT, 0x00);                      /* set line out */
-    if (res != 0)                                                                     /* check result */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     write the fifo
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] address fifo register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the next batch is packed while the running one is sent if the async batch hooks are linked
+ */
+static uint8_t a_ld3320_write_fifo(ld3320_handle_t *handle, uint8_t address, const uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    uint8_t page;
+    uint8_t busy;
+    uint16_t i;
+    uint16_t num;
+    uint8_t cmd[2][LD3320_BATCH_MAX_LEN * 3];
+    
+    if ((handle->spi_write_batch_start != NULL) && 
+        (handle->spi_write_batch_wait != NULL))                                     /* check the async batch */
     {
-        handle->debug_print("ld3320: set line out failed.\n");                        /* set line out failed */
+        page = 0;                                                                   /* init page 0 */
+        busy = 0;                                                                   /* init busy 0 */
+        num = 0;                                                                    /* init 0 */
+        for (i = 0; i < len; i++)                                                   /* pack the commands */
+        {
+            cmd[page][num * 3 + 0] = 0x04;                                          /* set write command */
+            cmd[page][num * 3 + 1] = address;                                       /* set register address */
+            cmd[page][num * 3 + 2] = buf[i];                                        /* set written data */
+            num++;                                                                  /* num++ */
+            if ((num >= LD3320_BATCH_MAX_LEN) || (i == len - 1))                    /* flush point */
+            {
+                if (busy != 0)                                                      /* check the running batch */
+                {
+                    res = handle->spi_write_batch_wait(handle->context);            /* wait the running batch */
+                    if (res != 0)                                                   /* check result */
+                    {
+                        return 1;                                                   /* return error */
+                    }
+                }
+                res = handle->spi_write_batch_start(handle->context, cmd[page], 
+                                                    (uint16_t)(num * 3));           /* start this batch */
+                if (res != 0)                                                       /* check result */
+                {
+                    return 1;                                                       /* return error */
+                }
+                busy = 1;                                                           /* set busy */
+                page ^= 1;                                                          /* pack into the other page */
+                num = 0;                                                            /* reset num */
+            }
+        }
+        if (busy != 0)                                                              /* check the running batch */
+        {
+            res = handle->spi_write_batch_wait(handle->context);                    /* wait the last batch */
+            if (res != 0)                                                           /* check result */
+            {
+                return 1;                                                           /* return error */
+            }
+        }
         
-        return 1;                                                                     /* return error */
+        return 0;                                                                   /* success return 0 */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_LEFT, 0x00);                 /* set headset left */
-    if (res != 0)                                                                     /* check result */
+    if (handle->spi_write_batch == NULL)                                            /* check spi_write_batch */
     {
-        handle->debug_print("ld3320: set headset left failed.\n");                    /* set headset left failed */
+        for (i = 0; i < len; i++)                                                   /* write one by one */
+        {
+            res = a_ld3320_write_byte(handle, address, buf[i]);                     /* write data */
+            if (res != 0)                                                           /* check result */
+            {
+                return 1;                                                           /* return error */
+            }
+        }
         
-        return 1;                                                                     /* return error */
+        return 0;                                                                   /* success return 0 */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_RIGHT, 0x00);                /* set headset right */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set headset right failed.\n");                   /* set headset right failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    handle->delay_ms(2);                                                              /* delay 2 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_SPEAKER, 0xFF);                      /* set speaker */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set headset right failed.\n");                   /* set speaker failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_GAIN_CONTROL, 0xFF);                 /* set gain control */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set gain control failed.\n");                    /* set gain control failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    handle->delay_ms(2);                                                              /* delay 2 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0xFF);              /* set analog control 1 */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set analog control 1 failed.\n");                /* set analog control 1 failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL2, 0xFF);              /* set analog control 2 */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set analog control 2 failed.\n");                /* set analog control 2 failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    handle->delay_ms(2);                                                              /* delay 2 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA_LOWER_LOW, 0x00);          /* set fifo data lower low */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set fifo data lower low failed.\n");             /* set fifo data lower low failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA_LOWER_HIGH, 0x00);         /* set fifo data high low */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set fifo data lower high failed.\n");            /* set fifo data lower high failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA_UPPER_LOW, 0xEF);          /* set fifo data upper low */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set fifo data upper low failed.\n");             /* set fifo data upper low failed */
-        
-        return 1;                                                                     /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA_UPPER_HIGH, 0x07);         /* set fifo data upper high */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("ld3320: set fifo data upper high failed.\n");            /* set fifo data upper high failed */
-        
-        return 1;                                                                     /* return error */
+    
+    num = 0;                                                                        /* init 0 */
+    for (i = 0; i < len; i++)                                                       /* pack the commands */
+    {
+        cmd[0][num * 3 + 0] = 0x04;                                                 /* set write command */
+        cmd[0][num * 3 + 1] = address;                                              /* set register address */
+        cmd[0][num * 3 + 2] = buf[i];                                               /* set written data */
+        num++;                                                                      /* num++ */
+        if ((num >= LD3320_BATCH_MAX_LEN) || (i == len - 1))                        /* flush point */
+        {
+            res = handle->spi_write_batch(handle->context, 
+                                          cmd[0], (uint16_t)(num * 3));             /* write batch */
+            if (res != 0)                                                           /* check result */
+            {
+                return 1;                                                           /* return error */
+            }
+            num = 0;                                                                /* reset num */
+        }
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_MCU_WATER_MARK_L, 0x77);        /* set fifo mcu watermark low */
-    if (res != 0)                                                                     /* check result */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      acquire the mp3 data
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  size max acquired size
+ * @param[out] **buf pointer to a data pointer buffer
+ * @param[out] *len pointer to an acquired length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 acquire failed
+ * @note       the source buffer is used directly if mp3_acquire is linked,
+ *             otherwise one chunk is copied into handle->buf by mp3_read
+ */
+static uint8_t a_ld3320_mp3_acquire(ld3320_handle_t *handle, uint32_t size, uint8_t **buf, uint32_t *len)
+{
+    if ((handle->mp3_acquire != NULL) && (handle->mp3_release != NULL))        /* zero copy source */
     {
-        handle->debug_print("ld3320: set fifo mcu water mark low failed.\n");         /* set fifo mcu watermark low failed */
+        if (handle->mp3_acquire(handle->context, 
+                                handle->point, size, buf, len) != 0)           /* acquire data */
+        {
+            return 1;                                                          /* return error */
+        }
+        if ((*buf == NULL) || (*len == 0))                                     /* check the lent data */
+        {
+            return 1;                                                          /* return error */
+        }
+        if (*len > size)                                                       /* check the length */
+        {
+            *len = size;                                                       /* limit to size */
+        }
         
-        return 1;                                                                     /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_MCU_WATER_MARK_H, 0x03);        /* set fifo mcu watermark high */
-    if (res != 0)                                                                     /* check result */
+    if (size > 512)                                                            /* check the size */
     {
-        handle->debug_print("ld3320: set fifo mcu water mark high failed.\n");        /* set fifo mcu watermark high failed */
-        
-        return 1;                                                                     /* return error */
+        size = 512;                                                            /* limit to buffer size */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DSP_WATER_MARK_L, 0xBB);        /* set fifo dsp watermark low */
-    if (res != 0)                                                                     /* check result */
+    if (handle->mp3_read(handle->context, 
+                         handle->point, (uint16_t)size, handle->buf) != 0)     /* read data */
     {
-        handle->debug_print("ld3320: set fifo mcu water mark low failed.\n");         /* set fifo mcu watermark low failed */
-        
-        return 1;                                                                     /* return error */
+        return 1;                                                              /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DSP_WATER_MARK_H, 0x01);        /* set fifo dsp watermark high */
-    if (res != 0)                                                                     /* check result */
+    *buf = handle->buf;                                                        /* set the buffer */
+    *len = size;                                                               /* set the length */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     release the mp3 data
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] addr acquired address
+ * @param[in] len consumed length
+ * @return    status code
+ *            - 0 success
+ *            - 1 release failed
+ * @note      none
+ */
+static uint8_t a_ld3320_mp3_release(ld3320_handle_t *handle, uint32_t addr, uint32_t len)
+{
+    if ((handle->mp3_acquire != NULL) && (handle->mp3_release != NULL))        /* zero copy source */
     {
-        handle->debug_print("ld3320: set fifo mcu water mark high failed.\n");        /* set fifo mcu watermark high failed */
-        
-        return 1;                                                                     /* return error */
+        return handle->mp3_release(handle->context, addr, len);                /* release data */
     }
     
-    return 0;                                                                         /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     mp3 load data
+ * @brief     mp3 load data byte by byte
  * @param[in] *handle pointer to an ld3320 handle structure
  * @return    status code
  *            - 0 success
  *            - 1 mp3 load failed
  * @note      none
  */
-static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle)
+static uint8_t a_ld3320_mp3_load_byte(ld3320_handle_t *handle)
 {
     uint8_t res;
     uint8_t data;
-    uint16_t size, i;
+    uint8_t *buf;
+    uint32_t addr;
+    uint32_t size, i;
     
     while (1)                                                                                      /* loop */
     {
@@ -530,9 +960,12 @@ static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle)
             
             return 1;                                                                              /* return error */
         }
-        size = (uint16_t)(512 < (handle->size - handle->point) ? 
-                          512 : (handle->size - handle->point));                                   /* get size */
-        res = handle->mp3_read(handle->point, size, handle->buf);                                  /* read data */
+        if (handle->point >= handle->size)                                                         /* check the end */
+        {
+            break;                                                                                 /* break */
+        }
+        addr = handle->point;                                                                      /* save the address */
+        res = a_ld3320_mp3_acquire(handle, handle->size - handle->point, &buf, &size);             /* acquire data */
         if (res != 0)                                                                              /* check result */
         {
             handle->debug_print("ld3320: mp3 read failed.\n");                                     /* mp3 read failed */
@@ -542,10 +975,11 @@ static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle)
         i = 0;                                                                                     /* set index 0 */
         while (!(data & 0x08) && (i < size))
         {
-            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA, handle->buf[i]);               /* write data */
+            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_DATA, buf[i]);                       /* write data */
             if (res != 0)                                                                          /* check result */
             {
                 handle->debug_print("ld3320: write fifo failed.\n");                               /* write failed */
+                (void)a_ld3320_mp3_release(handle, addr, i);                                       /* release data */
                 
                 return 1;                                                                          /* return error */
             }
@@ -556,10 +990,18 @@ static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle)
             if (res != 0)                                                                          /* check result */
             {
                 handle->debug_print("ld3320: fifo status read failed.\n");                         /* fifo status read failed */
+                (void)a_ld3320_mp3_release(handle, addr, i);                                       /* release data */
                 
                 return 1;                                                                          /* return error */
             }
         }
+        res = a_ld3320_mp3_release(handle, addr, i);                                               /* release data */
+        if (res != 0)                                                                              /* check result */
+        {
+            handle->debug_print("ld3320: mp3 release failed.\n");                                  /* mp3 release failed */
+            
+            return 1;                                                                              /* return error */
+        }
         if (!(data & 0x08))                                                                        /* check fifo full */
         {
             continue;                                                                              /* continue */
@@ -569,1396 +1011,4304 @@ static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle)
             break;                                                                                 /* break */
         }
     }
-    if (handle->point >= handle->size)                                                             /* check the size */
-    {
-        handle->running_status = LD3320_STATUS_NONE;                                               /* clear status */
-        handle->receive_callback(LD3320_STATUS_MP3_END, 0, NULL);                                  /* run the callback */
-    }
     
     return 0;                                                                                      /* success return 0 */
 }
 
 /**
- * @brief     asr mode init
+ * @brief     mp3 load data in a burst
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] free_size guaranteed free fifo size
  * @return    status code
  *            - 0 success
- *            - 1 asr init failed
+ *            - 1 mp3 load failed
  * @note      none
  */
-static uint8_t a_ld3320_asr_init(ld3320_handle_t *handle)
+static uint8_t a_ld3320_mp3_load_burst(ld3320_handle_t *handle, uint16_t free_size)
 {
     uint8_t res;
-
-    res = a_ld3320_common_init(handle);                                                   /* common init */
-    if (res != 0)                                                                         /* check result */
-    {
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INIT_CONTROL, 0x00);                     /* set asr mode */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set int control failed.\n");                         /* set int control failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x48);                              /* active dsp */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set command failed.\n");                             /* set command failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    handle->delay_ms(10);                                                                 /* delay 10 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_LOWER_LOW, 0x80);               /* fifo ext lower low */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set fifo ext lower low failed.\n");                  /* set fifo ext lower low failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_LOWER_HIGH, 0x07);              /* fifo ext lower high */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set fifo ext lower high failed.\n");                 /* set fifo ext lower high failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_UPPER_LOW, 0xFF);               /* fifo ext upper low */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set fifo ext upper low failed.\n");                  /* set fifo ext upper low failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_UPPER_HIGH, 0x07);              /* fifo ext upper high */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set fifo ext upper high failed.\n");                 /* set fifo ext upper high failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_MCU_WATER_MARK_L, 0x00);        /* fifo ext mcu watermark low */
-    if (res != 0)                                                                         /* check result */
-    {
-        handle->debug_print("ld3320: set fifo ext mcu water mark low failed.\n");         /* set fifo ext mcu watermark low failed */
-        
-        return 1;                                                                         /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_MCU_WATER_MARK_H, 0x08);        /* fifo ext mcu watermark high */
-    if (res != 0)                                                                         /* check result */
+    uint8_t data;
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t remain;
+    
+    res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, (uint8_t *)&data);            /* read fifo status once */
+    if (res != 0)                                                                          /* check result */
     {
-        handle->debug_print("ld3320: set fifo ext mcu water mark high failed.\n");        /* set fifo ext mcu watermark high failed */
+        handle->debug_print("ld3320: fifo status read failed.\n");                         /* fifo status read failed */
         
-        return 1;                                                                         /* return error */
+        return 1;                                                                          /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_DSP_WATER_MARK_L, 0x00);        /* fifo ext mcu watermark low */
-    if (res != 0)                                                                         /* check result */
+    if ((data & 0x08) != 0)                                                                /* check fifo full */
     {
-        handle->debug_print("ld3320: set fifo ext mcu water mark low failed.\n");         /* set fifo ext mcu watermark low failed */
-        
-        return 1;                                                                         /* return error */
+        return 0;                                                                          /* nothing to do */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT_DSP_WATER_MARK_H, 0x08);        /* fifo ext mcu watermark high */
-    if (res != 0)                                                                         /* check result */
+    remain = handle->size - handle->point;                                                 /* get remain size */
+    if (remain > free_size)                                                                /* check free size */
     {
-        handle->debug_print("ld3320: set fifo ext mcu water mark high failed.\n");        /* set fifo ext mcu watermark high failed */
-        
-        return 1;                                                                         /* return error */
+        remain = free_size;                                                                /* limit to free size */
     }
-    handle->delay_ms(2);                                                                  /* delay 2 ms */
-    
-    return 0;                                                                             /* success return 0 */
-}
-
-/**
- * @brief      check asr busy
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *s pointer to a status buffer
- * @return     status code
- *             - 0 success
- *             - 1 check asr busy failed
- * @note       none
- */
-static uint8_t a_ld3320_check_asr_busy(ld3320_handle_t *handle, uint8_t *s)
-{
-    uint8_t res, i;
-    uint8_t status;
-    
-    *s = 0;                                                                                /* clear status */
-    for (i = 0; i < 10; i++)                                                               /* wait 100 ms */
+    while (remain != 0)                                                                    /* push the burst */
     {
-        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS, (uint8_t *)&status);       /* read asr status */
+        res = a_ld3320_mp3_acquire(handle, remain, &buf, &size);                           /* acquire data */
         if (res != 0)                                                                      /* check result */
         {
-            handle->debug_print("ld3320: read asr status failed.\n");                      /* read asr status failed */
+            handle->debug_print("ld3320: mp3 read failed.\n");                             /* mp3 read failed */
             
             return 1;                                                                      /* return error */
         }
-        if (status == 0x21)                                                                /* check status */
+        res = a_ld3320_write_fifo(handle, LD3320_REG_FIFO_DATA, buf, (uint16_t)size);      /* write fifo */
+        if (res != 0)                                                                      /* check result */
+        {
+            handle->debug_print("ld3320: write fifo failed.\n");                           /* write failed */
+            (void)a_ld3320_mp3_release(handle, handle->point, 0);                          /* release data */
+            
+            return 1;                                                                      /* return error */
+        }
+        res = a_ld3320_mp3_release(handle, handle->point, size);                           /* release data */
+        if (res != 0)                                                                      /* check result */
         {
-            *s = 1;                                                                        /* flag */
+            handle->debug_print("ld3320: mp3 release failed.\n");                          /* mp3 release failed */
             
-            break;                                                                         /* break */
+            return 1;                                                                      /* return error */
         }
-        handle->delay_ms(10);                                                              /* delay 10 ms */
+        handle->point += size;                                                             /* point += size */
+        remain -= size;                                                                    /* remain -= size */
     }
     
     return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     asr start
+ * @brief     lock the handle
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] mic_gain microphone gain
- * @param[in] vad vad param
  * @return    status code
  *            - 0 success
- *            - 1 asr start failed
- * @note      none
+ *            - 1 lock failed
+ * @note      does nothing if the mutex is not linked
  */
-static uint8_t a_ld3320_asr_start(ld3320_handle_t *handle, uint8_t mic_gain, uint8_t vad)
+static uint8_t a_ld3320_lock(ld3320_handle_t *handle)
 {
-    uint8_t res;
-    uint8_t s;
+    uint8_t contended = 0;
     
-    res = a_ld3320_write_byte(handle, LD3320_REG_ADC_GAIN, mic_gain);           /* set ad gain */
-    if (res != 0)                                                               /* check result */
-    {
-        handle->debug_print("ld3320: set adc gain failed.\n");                  /* set adc gain failed */
-        
-        return 1;                                                               /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_VAD_PARAM, vad);           /* set asr vad param gain */
-    if (res != 0)                                                               /* check result */
-    {
-        handle->debug_print("ld3320: set asr vad param failed.\n");             /* set asr vad param failed */
-        
-        return 1;                                                               /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONF, 0x09);               /* set adc conf */
-    if (res != 0)                                                               /* check result */
-    {
-        handle->debug_print("ld3320: set adc conf failed.\n");                  /* set adc conf failed */
-        
-        return 1;                                                               /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INIT_CONTROL, 0x20);           /* set init control */
-    if (res != 0)                                                               /* check result */
-    {
-        handle->debug_print("ld3320: set init control failed.\n");              /* set init control failed */
-        
-        return 1;                                                               /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x01);             /* set init control */
-    if (res != 0)                                                               /* check result */
+    if ((handle->mutex_lock == NULL) || (handle->mutex_unlock == NULL))        /* no mutex */
     {
-        handle->debug_print("ld3320: set fifo clear failed.\n");                /* set fifo clear failed */
-        
-        return 1;                                                               /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    handle->delay_ms(2);                                                        /* delay 2 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x00);             /* set init control */
-    if (res != 0)                                                               /* check result */
+    if ((handle->mutex_trylock == NULL) || 
+        (handle->mutex_trylock(handle->context) != 0))                         /* try to lock */
     {
-        handle->debug_print("ld3320: set fifo clear failed.\n");                /* set fifo clear failed */
-        
-        return 1;                                                               /* return error */
+        if (handle->mutex_lock(handle->context) != 0)                          /* wait for the lock */
+        {
+            return 1;                                                          /* return error */
+        }
+        contended = (handle->mutex_trylock != NULL) ? 1 : 0;                   /* the lock was held */
     }
-    handle->delay_ms(2);                                                        /* delay 2 ms */
-    res = a_ld3320_check_asr_busy(handle, (uint8_t *)&s);                       /* check asr busy */
-    if (res != 0)                                                               /* check result */
+    handle->lock_count++;                                                      /* lock count++ */
+    handle->lock_contention += contended;                                      /* add contention */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     unlock the handle
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      does nothing if the mutex is not linked
+ */
+static void a_ld3320_unlock(ld3320_handle_t *handle)
+{
+    if ((handle->mutex_lock == NULL) || (handle->mutex_unlock == NULL))        /* no mutex */
     {
-        handle->debug_print("ld3320: check asr busy failed.\n");                /* check asr busy failed */
-        
-        return 1;                                                               /* return error */
+        return;                                                                /* return */
     }
-    if (s == 0)                                                                 /* check result */
+    (void)handle->mutex_unlock(handle->context);                               /* unlock */
+}
+
+/**
+ * @brief     change the running status
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] from expected status
+ * @param[in] to new status
+ * @return    1 if changed, 0 if the status is not the expected one
+ * @note      none
+ */
+static uint8_t a_ld3320_transition(ld3320_handle_t *handle, uint8_t from, uint8_t to)
+{
+    if (LD3320_ATOMIC_CAS(&handle->running_status, from, to) != 0)        /* compare and swap */
     {
-        handle->debug_print("ld3320: asr busy .\n");                            /* asr busy */
-        
-        return 1;                                                               /* return error */
+        return 1;                                                         /* changed */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_STATUS, 0xFF);             /* clear asr status */
-    if (res != 0)                                                               /* check result */
+    
+    return 0;                                                             /* not changed */
+}
+
+/**
+ * @brief     add the event latency
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] type event type
+ * @param[in] now event time
+ * @note      none
+ */
+static void a_ld3320_latency(ld3320_handle_t *handle, uint8_t type, uint32_t now)
+{
+    uint32_t service;
+    uint32_t callback;
+    
+    if (type >= LD3320_STATUS_NUM)                                                                    /* check type */
     {
-        handle->debug_print("ld3320: clear asr status failed.\n");              /* clear asr status failed */
-        
-        return 1;                                                               /* return error */
+        return;                                                                                       /* return */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_DSP_CMD, 0x06);                /* start dsp asr */
-    if (res != 0)                                                               /* check result */
+    service = handle->event_service_us - handle->event_edge_us;                                       /* edge to service */
+    callback = now - handle->event_edge_us;                                                           /* edge to callback */
+    if ((handle->latency_count[type] == 0) || (service < handle->latency_service_min_us[type]))       /* check min */
     {
-        handle->debug_print("ld3320: start dsp asr failed.\n");                 /* start dsp asr failed */
-        
-        return 1;                                                               /* return error */
+        handle->latency_service_min_us[type] = service;                                               /* save min */
     }
-    handle->delay_ms(5);                                                        /* delay 5 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONF, 0x0B);               /* enable adc mic */
-    if (res != 0)                                                               /* check result */
+    if (service > handle->latency_service_max_us[type])                                               /* check max */
     {
-        handle->debug_print("ld3320: enable adc mic failed.\n");                /* enable adc mic failed */
-        
-        return 1;                                                               /* return error */
+        handle->latency_service_max_us[type] = service;                                               /* save max */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x10);               /* enable sync */
-    if (res != 0)                                                               /* check result */
+    if ((handle->latency_count[type] == 0) || (callback < handle->latency_callback_min_us[type]))     /* check min */
     {
-        handle->debug_print("ld3320: enable sync failed.\n");                   /* enable sync failed */
-        
-        return 1;                                                               /* return error */
+        handle->latency_callback_min_us[type] = callback;                                             /* save min */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_INIT_CONTROL, 0x00);           /* set the init control */
-    if (res != 0)                                                               /* check result */
+    if (callback > handle->latency_callback_max_us[type])                                             /* check max */
     {
-        handle->debug_print("ld3320: set the init control failed.\n");          /* set the init control failed */
-        
-        return 1;                                                               /* return error */
+        handle->latency_callback_max_us[type] = callback;                                             /* save max */
     }
-    
-    return 0;                                                                   /* success return 0 */
+    handle->latency_service_us[type] += service;                                                      /* add service latency */
+    handle->latency_callback_us[type] += callback;                                                    /* add callback latency */
+    handle->latency_count[type]++;                                                                    /* count++ */
 }
 
 /**
- * @brief     asr add key word
+ * @brief     get a key word
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] ind key word index
- * @param[in] *word pointer to a key word buffer
- * @param[in] len key word length
+ * @param[in] index key word index
+ * @return    pointer to the key word
+ * @note      none
+ */
+static char *a_ld3320_key_word(ld3320_handle_t *handle, uint8_t index)
+{
+#if (LD3320_KEY_WORD_POOL_SIZE > 0)
+    return &handle->text_pool[handle->text_offset[index]];        /* word in the pool */
+#else
+    return handle->text[index];                                   /* word in its row */
+#endif
+}
+
+/**
+ * @brief     check the key words fit the key word storage
+ * @param[in] **text pointer to a key word pointer list
+ * @param[in] len key words length
  * @return    status code
  *            - 0 success
- *            - 1 asr add key word failed
+ *            - 1 key words are invalid
  * @note      none
  */
-static uint8_t a_ld3320_asr_add_key_word(ld3320_handle_t *handle, uint8_t ind, char *word, uint16_t len)
+static uint8_t a_ld3320_key_word_check(const char *const *text, uint8_t len)
 {
-    uint8_t res;
-    uint16_t i, k;
+    uint8_t i;
+    size_t n;
+    size_t total;
     
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_INDEX, ind);                /* write asr index */
-    if (res != 0)                                                                /* check result */
-    {
-        handle->debug_print("ld3320: set asr index failed.\n");                  /* set asr index failed */
-        
-        return 1;                                                                /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_DATA, 0x00);                /* write asr data */
-    if (res != 0)                                                                /* check result */
-    {
-        handle->debug_print("ld3320: set asr data failed.\n");                   /* set asr data failed */
-        
-        return 1;                                                                /* return error */
-    }
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x04);              /* fifo clear */
-    if (res != 0)                                                                /* check result */
+    if (len > LD3320_KEY_WORD_MAX)                                   /* check the count */
     {
-        handle->debug_print("ld3320: fifo clear failed.\n");                     /* fifo clear failed */
-        
-        return 1;                                                                /* return error */
+        return 1;                                                    /* return error */
     }
-    handle->delay_ms(2);                                                         /* delay 2 ms */
-    res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x00);              /* fifo clear */
-    if (res != 0)                                                                /* check result */
+    if ((len != 0) && (text == NULL))                                /* check the list */
     {
-        handle->debug_print("ld3320: fifo clear failed.\n");                     /* fifo clear failed */
-        
-        return 1;                                                                /* return error */
+        return 1;                                                    /* return error */
     }
-    handle->delay_ms(2);                                                         /* delay 2 ms */
-    k = (len < 50) ? len : 50;                                                   /* get the mini length */
-    for (i = 0; i < k; i++)                                                      /* write data */
+    total = 0;                                                       /* init 0 */
+    for (i = 0; i < len; i++)                                        /* check every key word */
     {
-        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_EXT , word[i]);        /* fifo ext write */
-        if (res != 0)                                                            /* check result */
+        if (text[i] == NULL)                                         /* check the key word */
         {
-            handle->debug_print("ld3320: fifo ext write failed.\n");             /* fifo ext write failed */
-            
-            return 1;                                                            /* return error */
+            return 1;                                                /* return error */
+        }
+        n = strlen(text[i]);                                         /* get the length */
+        if ((n == 0) || (n >= LD3320_KEY_WORD_LEN))                  /* check the length */
+        {
+            return 1;                                                /* return error */
         }
+        total += n + 1;                                              /* add the word and its null */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_STR_LEN, (uint8_t)k);       /* asr str length */
-    if (res != 0)                                                                /* check result */
+#if (LD3320_KEY_WORD_POOL_SIZE > 0)
+    if (total > LD3320_KEY_WORD_POOL_SIZE)                           /* check the pool */
     {
-        handle->debug_print("ld3320: asr string length failed.\n");              /* asr string length failed */
-        
-        return 1;                                                                /* return error */
+        return 1;                                                    /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ASR_STATUS, 0xFF);              /* clear asr status */
-    if (res != 0)                                                                /* check result */
+#else
+    (void)total;                                                     /* rows always fit */
+#endif
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief         put one key word into the storage
+ * @param[in]     *handle pointer to an ld3320 handle structure
+ * @param[in]     index key word index
+ * @param[in]     *word pointer to a checked key word
+ * @param[in]     changed earlier key words changed
+ * @param[in,out] *offset pointer to a pool offset buffer
+ * @return        1 if this or an earlier key word changed, else 0
+ * @note          while nothing changed the stored word starts at the same offset, so it is compared in place
+ */
+static uint8_t a_ld3320_key_word_put(ld3320_handle_t *handle, uint8_t index, const char *word, 
+                                     uint8_t changed, uint16_t *offset)
+{
+    size_t n;
+    
+    n = strlen(word) + 1;                                                        /* word with its null */
+    if ((changed == 0) && (strcmp(a_ld3320_key_word(handle, index), word) != 0)) /* key word changed */
     {
-        handle->debug_print("ld3320: asr status failed.\n");                     /* asr status failed */
-        
-        return 1;                                                                /* return error */
+        changed = 1;                                                             /* set changed */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_DSP_CMD, 0x04);                 /* add dsp words status */
-    if (res != 0)                                                                /* check result */
+    if (changed != 0)                                                            /* write the word */
     {
-        handle->debug_print("ld3320: dsp command failed.\n");                    /* dsp command failed */
-        
-        return 1;                                                                /* return error */
+#if (LD3320_KEY_WORD_POOL_SIZE > 0)
+        memcpy(&handle->text_pool[*offset], word, n);                            /* copy the key word */
+        handle->text_offset[index] = *offset;                                    /* save the offset */
+#else
+        memcpy(handle->text[index], word, n);                                    /* copy the text */
+#endif
     }
+    *offset = (uint16_t)(*offset + n);                                           /* next word */
     
-    return 0;                                                                    /* success return 0 */
+    return changed;                                                              /* return the flag */
 }
 
 /**
- * @brief     asr add fixed
+ * @brief     store the key words
  * @param[in] *handle pointer to an ld3320 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 asr add fixed failed
- * @note      none
+ * @param[in] **text pointer to a checked key word pointer list
+ * @param[in] len key words length
+ * @note      unchanged key words keep the chip setup for a warm rearm
  */
-static uint8_t a_ld3320_asr_add_fixed(ld3320_handle_t *handle)
+static void a_ld3320_key_word_store(ld3320_handle_t *handle, const char *const *text, uint8_t len)
 {
-    uint8_t res, i, s;
+    uint8_t i;
+    uint8_t changed;
+    uint16_t offset;
     
-    for (i = 0; i < handle->len; i++)                                                               /* add fixed length */
+    changed = (len != handle->len) ? 1 : 0;                                      /* count changed */
+    offset = 0;                                                                  /* storage start */
+    for (i = 0; i < len; i++)                                                    /* every key word */
     {
-        res = a_ld3320_check_asr_busy(handle, (uint8_t *)&s);                                       /* check asr busy */
-        if (res != 0)                                                                               /* check result */
-        {
-            handle->debug_print("ld3320: check asr busy failed.\n");                                /* check asr busy failed */
-           
-            return 1;                                                                               /* return error */
-        }
-        if (s == 0)                                                                                 /* check status */
-        {
-            return 1;                                                                               /* return error */
-        }
-        res = a_ld3320_asr_add_key_word(handle, i, handle->text[i], 
-                                       (uint16_t)strlen(handle->text[i]));                          /* asr add key word */
-        if (res != 0)                                                                               /* check result */
-        {
-            handle->debug_print("ld3320: asr add key word failed.\n");                              /* asr add key word failed */
-           
-            return 1;                                                                               /* return error */
-        }
+        changed = a_ld3320_key_word_put(handle, i, text[i], changed, &offset);  /* put the key word */
     }
-    
-    return 0;                                                                                       /* success return 0 */
+    if (changed != 0)                                                            /* key words changed */
+    {
+        handle->asr_configured = 0;                                              /* full start next */
+    }
+    handle->len = len;                                                           /* set length */
 }
 
 /**
- * @brief     reset the chip
+ * @brief     report an event
  * @param[in] *handle pointer to an ld3320 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 reset failed
- * @note      none
+ * @param[in] type event type
+ * @param[in] index asr result index
+ * @param[in] flag int flag register
+ * @param[in] status asr status or int aux register
+ * @note      runs receive_callback or pushes the event into the queue
  */
-static uint8_t a_ld3320_reset(ld3320_handle_t *handle)
+static void a_ld3320_event(ld3320_handle_t *handle, uint8_t type, uint8_t index, uint8_t flag, uint8_t status)
 {
-    if (handle->reset_gpio_write(1) != 0)                                    /* reset gpio write 1 */
-    {
-        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
-       
-        return 1;                                                            /* return error */
+    uint16_t head;
+    uint32_t now;
+    ld3320_event_t *event;
+    const ld3320_grammar_page_t *page;
+    
+    now = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;                              /* get event time */
+    event = &handle->event_last;                                                                    /* get the last event */
+    event->type = type;                                                                             /* set type */
+    event->index = index;                                                                           /* set index */
+    event->flag = flag;                                                                             /* set flag */
+    event->status = status;                                                                         /* set status */
+    event->timestamp_us = now;                                                                      /* set timestamp */
+    event->edge_us = handle->event_edge_us;                                                         /* set edge time */
+    event->service_us = handle->event_service_us;                                                   /* set service time */
+    event->page = 0;                                                                                /* no page */
+    event->id = index;                                                                              /* id is the index */
+    event->text[0] = '\0';                                                                          /* no text */
+    if (type == LD3320_STATUS_ASR_FOUND_OK)                                                         /* asr ok */
+    {
+        strncpy(event->text, a_ld3320_key_word(handle, index), LD3320_KEY_WORD_LEN - 1);            /* copy the text */
+        event->text[LD3320_KEY_WORD_LEN - 1] = '\0';                                                /* set the end */
+    }
+    if (handle->grammar != NULL)                                                                    /* check the grammar */
+    {
+        event->page = handle->grammar->active;                                                      /* set page */
+        if (type == LD3320_STATUS_ASR_FOUND_OK)                                                     /* asr ok */
+        {
+            page = handle->grammar->page[event->page];                                              /* get the page */
+            event->id = (page->id != NULL) ? page->id[index] : index;                               /* set id */
+        }
     }
-    handle->delay_ms(2);                                                     /* delay 2 ms */
-    if (handle->reset_gpio_write(0) != 0)                                    /* reset gpio write 0 */
+    if (handle->timestamp_us != NULL)                                                               /* check timestamp_us */
     {
-        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
-       
-        return 1;                                                            /* return error */
+        a_ld3320_latency(handle, type, now);                                                        /* add the latency */
     }
-    handle->delay_ms(2);                                                     /* delay 2 ms */
-    if (handle->reset_gpio_write(1) != 0)                                    /* reset gpio write 1 */
+    if (handle->event_enable == 0)                                                                  /* no event queue */
     {
-        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
-       
-        return 1;                                                            /* return error */
+        handle->callback_guard = 1;                                                                 /* enter the callback */
+        handle->receive_callback(handle->context, type, index, 
+                                 (type == LD3320_STATUS_ASR_FOUND_OK) ? event->text : NULL);        /* run the callback */
+        if (LD3320_ATOMIC_CAS(&handle->callback_guard, 1, 0) == 0)                                  /* start called in the callback */
+        {
+            handle->callback_guard = 0;                                                             /* leave the callback */
+            handle->start_deferred = 1;                                                             /* run the start later */
+            handle->deferred_start++;                                                               /* deferred start++ */
+        }
+        
+        return;                                                                                     /* return */
     }
-    if (handle->spi_write_cmd(NULL, 0) != 0)                                 /* spi write command */
+    head = handle->event_head;                                                                      /* get head */
+    if ((uint16_t)(head - handle->event_tail) >= LD3320_EVENT_QUEUE_SIZE)                           /* check full */
     {
-        handle->debug_print("ld3320: spi write command failed.\n");          /* spi write command failed */
-       
-        return 1;                                                            /* return error */
+        handle->event_overflow++;                                                                   /* overflow++ */
+        
+        return;                                                                                     /* drop the event */
     }
-    handle->delay_ms(2);                                                     /* delay 2 ms */
-    
-    return 0;                                                                /* success return 0 */
+    handle->event[head & (LD3320_EVENT_QUEUE_SIZE - 1)] = *event;                                   /* copy into the slot */
+    LD3320_MEMORY_BARRIER();                                                                        /* publish the slot before the head */
+    handle->event_head = (uint16_t)(head + 1);                                                      /* head++ */
 }
 
 /**
- * @brief     run the asr
+ * @brief     mp3 load data
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] start 1 if the fifo is empty before playing, 0 in the irq
  * @return    status code
  *            - 0 success
- *            - 1 run asr failed
+ *            - 1 mp3 load failed
  * @note      none
  */
-static uint8_t a_ld3320_run_asr(ld3320_handle_t *handle)
+static uint8_t a_ld3320_mp3_load(ld3320_handle_t *handle, uint8_t start)
 {
-    uint8_t res, i, flag;
+    uint8_t res;
+    uint32_t point;
+    uint32_t t0 = 0;
     
-    flag = 2;
-    for (i = 0; i < 5; i++)
+    point = handle->point;                                                                       /* save point */
+    if (handle->timestamp_us != NULL)                                                            /* check timestamp_us */
     {
-        res = a_ld3320_asr_init(handle);                                           /* asr init */
-        if (res != 0)                                                              /* check result */
+        t0 = handle->timestamp_us();                                                             /* get start time */
+    }
+    if (handle->mp3_feed_mode == LD3320_MP3_FEED_MODE_BURST)                                     /* burst mode */
+    {
+        if (start != 0)                                                                          /* empty fifo */
         {
-            handle->debug_print("ld3320: asr init failed.\n");                     /* asr init failed */
-            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
-            handle->delay_ms(100);                                                 /* delay 100 ms */
-            
-            return 1;                                                              /* return error */
+            res = a_ld3320_mp3_load_burst(handle, 
+                                          LD3320_MP3_FIFO_UPPER - LD3320_MP3_FIFO_LOWER);        /* fill the whole fifo */
         }
-        handle->delay_ms(100);                                                     /* delay 100 ms */
-        res = a_ld3320_asr_add_fixed(handle);                                      /* asr add fixed */
-        if (res != 0)                                                              /* check result */
+        else
         {
-            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
-            handle->delay_ms(100);                                                 /* delay 100 ms */
-            
-            continue;                                                              /* continue */
+            res = a_ld3320_mp3_load_burst(handle, 
+                                          LD3320_MP3_FIFO_UPPER - 
+                                          LD3320_MP3_FIFO_MCU_WATER_MARK);                       /* fill above the mcu water mark */
         }
-        handle->delay_ms(10);                                                      /* delay 10 ms */
-        res = a_ld3320_asr_start(handle, handle->mic_gain, handle->vad);           /* asr start */
-        if (res != 0)                                                              /* check result */
+    }
+    else
+    {
+        res = a_ld3320_mp3_load_byte(handle);                                                    /* load byte by byte */
+    }
+    if (res != 0)                                                                                /* check result */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (handle->timestamp_us != NULL)                                                            /* check timestamp_us */
+    {
+        handle->mp3_feed_us += handle->timestamp_us() - t0;                                      /* add feeding time */
+    }
+    handle->mp3_last_bytes = handle->point - point;                                              /* save last bytes */
+    handle->mp3_total_bytes += handle->mp3_last_bytes;                                           /* add total bytes */
+    if (start == 0)                                                                              /* irq refill */
+    {
+        handle->mp3_irq_count++;                                                                 /* irq count++ */
+        handle->mp3_irq_bytes += handle->mp3_last_bytes;                                         /* add irq bytes */
+    }
+    if (handle->point >= handle->size)                                                           /* check the size */
+    {
+        handle->running_status = LD3320_STATUS_NONE;                                             /* clear status */
+        if ((start != 0) && (handle->timestamp_us != NULL))                                      /* not from the irq */
         {
-            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
-            handle->delay_ms(100);                                                 /* delay 100 ms */
-            
-            continue;                                                              /* continue */
+            handle->event_service_us = handle->timestamp_us();                                   /* save the service time */
+            handle->event_edge_us = handle->event_service_us;                                    /* no edge */
         }
-        flag = 0;                                                                  /* flag ok */
-        
-        break;                                                                     /* break the loop */
+        a_ld3320_event(handle, LD3320_STATUS_MP3_END, 0, 0x00, 0x00);                            /* report the event */
     }
     
-    return flag;                                                                   /* return flag */
+    return 0;                                                                                    /* success return 0 */
 }
 
 /**
- * @brief     set the chip mode
+ * @brief     asr mode init
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] mode chip mode
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 asr init failed
  * @note      none
  */
-uint8_t ld3320_set_mode(ld3320_handle_t *handle, ld3320_mode_t mode)
+static uint8_t a_ld3320_asr_init(ld3320_handle_t *handle)
 {
-    if (handle == NULL)             /* check handle */
+    uint8_t res;
+
+    res = a_ld3320_common_init(handle);                                                        /* common init */
+    if (res != 0)                                                                              /* check result */
     {
-        return 2;                   /* return error */
+        return 1;                                                                              /* return error */
     }
-    if (handle->inited != 1)        /* check handle initialization */
+    res = a_ld3320_write_sequence(handle, gs_asr_init_seq,
+                                  sizeof(gs_asr_init_seq) / sizeof(ld3320_sequence_t));        /* write asr init sequence */
+    if (res != 0)                                                                              /* check result */
     {
-        return 3;                   /* return error */
+        handle->debug_print("ld3320: write asr init sequence failed.\n");                      /* write asr init sequence failed */
+        
+        return 1;                                                                              /* return error */
     }
     
-    handle->mode = (uint8_t)mode;   /* set mode */
-    
-    return 0;                       /* success return 0 */
+    return 0;                                                                                  /* success return 0 */
 }
 
 /**
- * @brief      get the chip mode
+ * @brief     begin an asr ready wait
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] min_us first sleep
+ * @note      none
+ */
+static void a_ld3320_asr_ready_begin(ld3320_handle_t *handle, uint32_t min_us)
+{
+    handle->asr_ready_begin_us = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;        /* save begin time */
+    handle->asr_ready_waited_us = 0;                                                                 /* clear slept time */
+    handle->asr_ready_backoff_us = min_us;                                                           /* first sleep */
+    handle->asr_ready_sleep_us = 0;                                                                  /* not slept yet */
+}
+
+/**
+ * @brief      check the asr ready
  * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *mode pointer to a chip mode buffer
+ * @param[out] *sleep_us pointer to a next sleep buffer
  * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ *             - 0 ready
+ *             - 1 read asr status failed
+ *             - 2 timeout
+ *             - 3 not ready, sleep *sleep_us and check again
+ * @note       spins a few reads first, then the sleep doubles up to the max and never passes the deadline
  */
-uint8_t ld3320_get_mode(ld3320_handle_t *handle, ld3320_mode_t *mode)
+static uint8_t a_ld3320_asr_ready_check(ld3320_handle_t *handle, uint32_t *sleep_us)
 {
-    if (handle == NULL)                           /* check handle */
+    uint8_t res, i;
+    uint8_t status;
+    uint32_t elapsed;
+    uint32_t deadline;
+    
+    status = 0;                                                                                    /* init 0 */
+    for (i = 0; i < LD3320_ASR_READY_SPIN; i++)                                                    /* spin */
     {
-        return 2;                                 /* return error */
+        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS, (uint8_t *)&status);               /* read asr status */
+        if (res != 0)                                                                              /* check result */
+        {
+            handle->debug_print("ld3320: read asr status failed.\n");                              /* read asr status failed */
+            
+            return 1;                                                                              /* return error */
+        }
+        if (status == 0x21)                                                                        /* check status */
+        {
+            break;                                                                                 /* break */
+        }
     }
-    if (handle->inited != 1)                      /* check handle initialization */
+    if (handle->timestamp_us != NULL)                                                              /* check timestamp_us */
     {
-        return 3;                                 /* return error */
+        elapsed = handle->timestamp_us() - handle->asr_ready_begin_us;                             /* measured time */
     }
+    else
+    {
+        elapsed = handle->asr_ready_waited_us;                                                     /* slept time */
+    }
+    if (status == 0x21)                                                                            /* ready */
+    {
+        handle->asr_ready_count++;                                                                 /* ready count++ */
+        if (handle->asr_ready_sleep_us == 0)                                                       /* never slept */
+        {
+            handle->asr_ready_spin++;                                                              /* spin count++ */
+        }
+        handle->asr_ready_slack_us += handle->asr_ready_sleep_us;                                  /* ready at most one sleep ago */
+        handle->asr_ready_total_us += elapsed;                                                     /* add ready time */
+        if (elapsed > handle->asr_ready_max_us)                                                    /* check max */
+        {
+            handle->asr_ready_max_us = elapsed;                                                    /* save max */
+        }
+        for (i = 0; i < LD3320_ASR_READY_HIST_SIZE - 1; i++)                                       /* find the bucket */
+        {
+            if (elapsed < ((uint32_t)LD3320_ASR_READY_HIST_BASE_US << i))                          /* check the bound */
+            {
+                break;                                                                             /* break */
+            }
+        }
+        handle->asr_ready_hist[i]++;                                                               /* bucket++ */
+        
+        return 0;                                                                                  /* success return 0 */
+    }
+    deadline = handle->asr_ready_timeout_ms * 1000;                                                /* deadline in us */
+    if (elapsed >= deadline)                                                                       /* check the deadline */
+    {
+        handle->asr_ready_timeout++;                                                               /* timeout count++ */
+        handle->debug_print("ld3320: asr ready timeout.\n");                                       /* asr ready timeout */
+        
+        return 2;                                                                                  /* return error */
+    }
+    *sleep_us = handle->asr_ready_backoff_us;                                                      /* next sleep */
+    if (*sleep_us > deadline - elapsed)                                                            /* check the deadline */
+    {
+        *sleep_us = deadline - elapsed;                                                            /* sleep to the deadline */
+    }
+    handle->asr_ready_backoff_us *= 2;                                                             /* back off */
+    if (handle->asr_ready_backoff_us > LD3320_ASR_READY_BACKOFF_MAX_US)                            /* check max */
+    {
+        handle->asr_ready_backoff_us = LD3320_ASR_READY_BACKOFF_MAX_US;                            /* set max */
+    }
+    handle->asr_ready_sleep_us = *sleep_us;                                                        /* save the sleep */
+    handle->asr_ready_waited_us += *sleep_us;                                                      /* add slept time */
     
-    *mode = (ld3320_mode_t)(handle->mode);        /* get mode */
-    
-    return 0;                                     /* success return 0 */
+    return 3;                                                                                      /* not ready */
 }
 
 /**
- * @brief     set the key words
+ * @brief     wait for the asr ready
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] **text pointer to a text buffer
- * @param[in] len key words length
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 read asr status failed
+ *            - 2 timeout
  * @note      none
  */
-uint8_t ld3320_set_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t len)
+static uint8_t a_ld3320_wait_asr_ready(ld3320_handle_t *handle)
 {
-    uint8_t i;
+    uint8_t res;
+    uint32_t us;
     
-    if (handle == NULL)                          /* check handle */
-    {
-        return 2;                                /* return error */
-    }
-    if (handle->inited != 1)                     /* check handle initialization */
+    a_ld3320_asr_ready_begin(handle, LD3320_ASR_READY_BACKOFF_MIN_US);        /* begin the wait */
+    while (1)                                                                 /* loop */
     {
-        return 3;                                /* return error */
+        res = a_ld3320_asr_ready_check(handle, &us);                          /* check the asr */
+        if (res != 3)                                                         /* ready or failed */
+        {
+            return res;                                                       /* return the result */
+        }
+        if (us >= 1000)                                                       /* check the sleep */
+        {
+            handle->delay_ms(us / 1000);                                      /* delay ms */
+        }
+        if ((us % 1000) != 0)                                                 /* check the rest */
+        {
+            handle->delay_us(us % 1000);                                      /* delay us */
+        }
     }
+}
+
+/**
+ * @brief      build the asr prepare sequence
+ * @param[out] *seq pointer to a sequence buffer
+ * @param[in]  mic_gain microphone gain
+ * @param[in]  vad vad param
+ * @note       shared by the blocking and the async start
+ */
+static void a_ld3320_asr_prepare_build(ld3320_sequence_t *seq, uint8_t mic_gain, uint8_t vad)
+{
+    memcpy(seq, gs_asr_prepare_seq, sizeof(gs_asr_prepare_seq));        /* copy the sequence */
+    seq[0].data = mic_gain;                                              /* set ad gain */
+    seq[1].data = vad;                                                   /* set asr vad param */
+}
+
+/**
+ * @brief      build the key word sequences
+ * @param[out] *clear pointer to a clear sequence buffer
+ * @param[out] *tail pointer to a tail sequence buffer
+ * @param[in]  ind key word index
+ * @param[in]  len key word length
+ * @return     uploaded key word length
+ * @note       shared by the blocking and the async start
+ */
+static uint16_t a_ld3320_key_word_build(ld3320_sequence_t *clear, ld3320_sequence_t *tail, uint8_t ind, uint16_t len)
+{
+    uint16_t k;
     
-    for (i = 0; i < len; i++)                    /* copy the text */
-    {
-        strcpy(handle->text[i], text[i]);        /* copy the text */
-    }
-    handle->len = len;                           /* set length */
+    k = (len < LD3320_KEY_WORD_LEN) ? len : LD3320_KEY_WORD_LEN;                      /* get the mini length */
+    memcpy(clear, gs_asr_key_word_clear_seq, sizeof(gs_asr_key_word_clear_seq));      /* copy the clear sequence */
+    memcpy(tail, gs_asr_key_word_tail_seq, sizeof(gs_asr_key_word_tail_seq));         /* copy the tail sequence */
+    clear[0].data = ind;                                                              /* set the index */
+    tail[0].data = (uint8_t)k;                                                        /* set the length */
     
-    return 0;                                    /* success return 0 */
+    return k;                                                                         /* return the length */
 }
 
 /**
- * @brief      get the key words
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] **text pointer to a text buffer
- * @param[out] *len pointer to a key words length buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     asr start
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] mic_gain microphone gain
+ * @param[in] vad vad param
+ * @return    status code
+ *            - 0 success
+ *            - 1 asr start failed
+ * @note      none
  */
-uint8_t ld3320_get_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t *len)
+static uint8_t a_ld3320_asr_start(ld3320_handle_t *handle, uint8_t mic_gain, uint8_t vad)
 {
-    uint8_t i;
+    uint8_t res;
+    ld3320_sequence_t seq[LD3320_ASR_PREPARE_SEQ_LEN];
     
-    if (handle == NULL)                          /* check handle */
+    a_ld3320_asr_prepare_build(seq, mic_gain, vad);                                             /* build the prepare sequence */
+    res = a_ld3320_write_sequence(handle, seq, LD3320_ASR_PREPARE_SEQ_LEN);                     /* write asr prepare sequence */
+    if (res != 0)                                                                               /* check result */
     {
-        return 2;                                /* return error */
+        handle->debug_print("ld3320: write asr prepare sequence failed.\n");                    /* write asr prepare sequence failed */
+        
+        return 1;                                                                               /* return error */
     }
-    if (handle->inited != 1)                     /* check handle initialization */
+    res = a_ld3320_wait_asr_ready(handle);                                                      /* wait for the asr */
+    if (res != 0)                                                                               /* check result */
     {
-        return 3;                                /* return error */
+        handle->debug_print("ld3320: asr busy .\n");                                            /* asr busy */
+        
+        return 1;                                                                               /* return error */
     }
-    
-    for (i = 0; i < handle->len; i++)            /* copy the text */
+    res = a_ld3320_write_sequence(handle, gs_asr_start_seq,
+                                  sizeof(gs_asr_start_seq) / sizeof(ld3320_sequence_t));        /* write asr start sequence */
+    if (res != 0)                                                                               /* check result */
     {
-        strcpy(text[i], handle->text[i]);        /* copy the text */
+        handle->debug_print("ld3320: write asr start sequence failed.\n");                      /* write asr start sequence failed */
+        
+        return 1;                                                                               /* return error */
     }
-    *len = handle->len;                          /* get length */
     
-    return 0;                                    /* success return 0 */
+    return 0;                                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set the microphone gain
+ * @brief     asr add key word
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] gain microphone gain
+ * @param[in] ind key word index
+ * @param[in] *word pointer to a key word buffer
+ * @param[in] len key word length
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 asr add key word failed
+ * @note      the select, the key word bytes and the tail are sent as batches if spi_write_batch is linked
  */
-uint8_t ld3320_set_mic_gain(ld3320_handle_t *handle, ld3320_mic_gain_t gain)
+static uint8_t a_ld3320_asr_add_key_word(ld3320_handle_t *handle, uint8_t ind, char *word, uint16_t len)
 {
-    if (handle == NULL)                      /* check handle */
+    uint8_t res;
+    uint16_t k;
+    ld3320_sequence_t clear[LD3320_KEY_WORD_CLEAR_SEQ_LEN];
+    ld3320_sequence_t tail[LD3320_KEY_WORD_TAIL_SEQ_LEN];
+    
+    k = a_ld3320_key_word_build(clear, tail, ind, len);                                 /* build the sequences */
+    res = a_ld3320_write_sequence(handle, clear, LD3320_KEY_WORD_CLEAR_SEQ_LEN);        /* select and clear */
+    if (res != 0)                                                                       /* check result */
     {
-        return 2;                            /* return error */
+        handle->debug_print("ld3320: fifo clear failed.\n");                            /* fifo clear failed */
+        
+        return 1;                                                                       /* return error */
     }
-    if (handle->inited != 1)                 /* check handle initialization */
+    res = a_ld3320_write_fifo(handle, LD3320_REG_FIFO_EXT, (const uint8_t *)word, k);   /* fifo ext write */
+    if (res != 0)                                                                       /* check result */
     {
-        return 3;                            /* return error */
+        handle->debug_print("ld3320: fifo ext write failed.\n");                        /* fifo ext write failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    res = a_ld3320_write_sequence(handle, tail, LD3320_KEY_WORD_TAIL_SEQ_LEN);          /* length and dsp command */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->debug_print("ld3320: dsp command failed.\n");                           /* dsp command failed */
+        
+        return 1;                                                                       /* return error */
     }
     
-    handle->mic_gain = (uint8_t)gain;        /* set mode */
-    
-    return 0;                                /* success return 0 */
+    return 0;                                                                           /* success return 0 */
 }
 
 /**
- * @brief      get the microphone gain
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *gain pointer to a microphone gain buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     begin the key word upload time
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      the time includes the asr ready wait before the key word
  */
-uint8_t ld3320_get_mic_gain(ld3320_handle_t *handle, ld3320_mic_gain_t *gain)
+static void a_ld3320_key_word_begin(ld3320_handle_t *handle)
 {
-    if (handle == NULL)                                   /* check handle */
+    handle->key_word_begin_us = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;        /* save begin time */
+}
+
+/**
+ * @brief     save the key word upload time
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] ind key word index
+ * @note      none
+ */
+static void a_ld3320_key_word_end(ld3320_handle_t *handle, uint8_t ind)
+{
+    uint32_t us;
+    
+    us = 0;                                                                          /* init 0 */
+    if (handle->timestamp_us != NULL)                                                /* check timestamp_us */
     {
-        return 2;                                         /* return error */
+        us = handle->timestamp_us() - handle->key_word_begin_us;                     /* upload time */
     }
-    if (handle->inited != 1)                              /* check handle initialization */
+    handle->key_word_us[ind] = us;                                                   /* save the key word time */
+    handle->key_word_total_us += us;                                                 /* add to the total */
+    handle->key_word_count = (uint8_t)(ind + 1);                                     /* uploaded count */
+}
+
+/**
+ * @brief     asr add fixed
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 asr add fixed failed
+ * @note      none
+ */
+static uint8_t a_ld3320_asr_add_fixed(ld3320_handle_t *handle)
+{
+    uint8_t res, i;
+    
+    handle->key_word_count = 0;                                                                     /* clear uploaded count */
+    handle->key_word_total_us = 0;                                                                  /* clear upload time */
+    for (i = 0; i < handle->len; i++)                                                               /* add fixed length */
     {
-        return 3;                                         /* return error */
+        a_ld3320_key_word_begin(handle);                                                            /* begin the time */
+        res = a_ld3320_wait_asr_ready(handle);                                                      /* wait for the asr */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: check asr busy failed.\n");                                /* check asr busy failed */
+           
+            return 1;                                                                               /* return error */
+        }
+        res = a_ld3320_asr_add_key_word(handle, i, a_ld3320_key_word(handle, i), 
+                                       (uint16_t)strlen(a_ld3320_key_word(handle, i)));             /* asr add key word */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: asr add key word failed.\n");                              /* asr add key word failed */
+           
+            return 1;                                                                               /* return error */
+        }
+        a_ld3320_key_word_end(handle, i);                                                           /* save the time */
     }
     
-    *gain = (ld3320_mic_gain_t)(handle->mic_gain);        /* get mode */
-    
-    return 0;                                             /* success return 0 */
+    return 0;                                                                                       /* success return 0 */
 }
 
 /**
- * @brief     set the vad
+ * @brief     reset the chip
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] vad vad param
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 reset failed
  * @note      none
  */
-uint8_t ld3320_set_vad(ld3320_handle_t *handle, ld3320_vad_t vad)
+static uint8_t a_ld3320_reset(ld3320_handle_t *handle)
 {
-    if (handle == NULL)             /* check handle */
+    a_ld3320_cache_invalidate(handle);                                       /* invalidate the cache */
+    handle->asr_configured = 0;                                              /* the chip loses the asr setup */
+    if (handle->reset_gpio_write(handle->context, 1) != 0)                   /* reset gpio write 1 */
     {
-        return 2;                   /* return error */
+        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
+       
+        return 1;                                                            /* return error */
     }
-    if (handle->inited != 1)        /* check handle initialization */
+    handle->delay_ms(2);                                                     /* delay 2 ms */
+    if (handle->reset_gpio_write(handle->context, 0) != 0)                   /* reset gpio write 0 */
     {
-        return 3;                   /* return error */
+        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
+       
+        return 1;                                                            /* return error */
     }
+    handle->delay_ms(2);                                                     /* delay 2 ms */
+    if (handle->reset_gpio_write(handle->context, 1) != 0)                   /* reset gpio write 1 */
+    {
+        handle->debug_print("ld3320: reset gpio write failed.\n");           /* reset gpio write failed */
+       
+        return 1;                                                            /* return error */
+    }
+    if (handle->spi_write_cmd(handle->context, NULL, 0) != 0)                /* spi write command */
+    {
+        handle->debug_print("ld3320: spi write command failed.\n");          /* spi write command failed */
+       
+        return 1;                                                            /* return error */
+    }
+    handle->delay_ms(2);                                                     /* delay 2 ms */
     
-    handle->vad = (uint8_t)vad;     /* set vad */
-    
-    return 0;                       /* success return 0 */
+    return 0;                                                                /* success return 0 */
 }
 
 /**
- * @brief      get the vad
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *vad pointer to a vad param buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     verify the spi bus
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 verify failed
+ * @note      none
  */
-uint8_t ld3320_get_vad(ld3320_handle_t *handle, ld3320_vad_t *vad)
+static uint8_t a_ld3320_verify_spi(ld3320_handle_t *handle)
 {
-    if (handle == NULL)                        /* check handle */
-    {
-        return 2;                              /* return error */
-    }
-    if (handle->inited != 1)                   /* check handle initialization */
+    const uint8_t pattern[4] = {0x00, 0xFF, 0x55, 0xAA};
+    uint8_t data;
+    uint16_t i;
+    uint8_t j;
+    
+    for (i = 0; i < LD3320_SPI_CLOCK_VERIFY_ROUNDS; i++)                                   /* run all rounds */
     {
-        return 3;                              /* return error */
+        for (j = 0; j < 4; j++)                                                            /* run all patterns */
+        {
+            if (a_ld3320_write_byte(handle, LD3320_REG_ASR_STR_LEN, pattern[j]) != 0)      /* write pattern */
+            {
+                return 1;                                                                  /* return error */
+            }
+            if (a_ld3320_read_byte(handle, LD3320_REG_ASR_STR_LEN, &data) != 0)            /* read back */
+            {
+                return 1;                                                                  /* return error */
+            }
+            if (data != pattern[j])                                                        /* check pattern */
+            {
+                return 1;                                                                  /* return error */
+            }
+        }
     }
     
-    *vad = (ld3320_vad_t)(handle->vad);        /* get vad */
-    
-    return 0;                                  /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief      get the status
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *status pointer to a status buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     switch the start phase
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] phase next phase
+ * @note      the time since the last switch is added to the current phase
  */
-uint8_t ld3320_get_status(ld3320_handle_t *handle, ld3320_status_t *status)
+static void a_ld3320_start_phase(ld3320_handle_t *handle, uint8_t phase)
 {
-    if (handle == NULL)                                         /* check handle */
-    {
-        return 2;                                               /* return error */
-    }
-    if (handle->inited != 1)                                    /* check handle initialization */
+    uint32_t now;
+    
+    if (handle->timestamp_us != NULL)                                                       /* check timestamp_us */
     {
-        return 3;                                               /* return error */
+        now = handle->timestamp_us();                                                       /* get time */
+        handle->start_phase_us[handle->start_phase] += now - handle->start_last_us;         /* add to the phase */
+        handle->start_last_us = now;                                                        /* save time */
     }
+    handle->start_phase = phase;                                                            /* set phase */
+}
+
+/**
+ * @brief     begin the start statistics
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      none
+ */
+static void a_ld3320_start_begin(ld3320_handle_t *handle)
+{
+    uint8_t i;
     
-    *status = (ld3320_status_t)(handle->running_status);        /* get running status */
-    
-    return 0;                                                   /* success return 0 */
+    for (i = 0; i < 4; i++)                                                                 /* clear all phases */
+    {
+        handle->start_phase_us[i] = 0;                                                      /* clear phase time */
+    }
+    for (i = 0; i < LD3320_ASR_READY_HIST_SIZE; i++)                                        /* clear the histogram */
+    {
+        handle->asr_ready_hist[i] = 0;                                                      /* clear bucket */
+    }
+    handle->asr_ready_count = 0;                                                            /* clear ready count */
+    handle->asr_ready_timeout = 0;                                                          /* clear timeout count */
+    handle->asr_ready_spin = 0;                                                             /* clear spin count */
+    handle->asr_ready_total_us = 0;                                                         /* clear ready time */
+    handle->asr_ready_max_us = 0;                                                           /* clear max ready time */
+    handle->asr_ready_slack_us = 0;                                                         /* clear sleep slack */
+    handle->start_total_us = 0;                                                             /* clear total time */
+    handle->start_steps = 0;                                                                /* clear steps */
+    handle->start_step_max_us = 0;                                                          /* clear longest step */
+    handle->start_attempt = 1;                                                              /* first attempt */
+    handle->start_fatal = 0;                                                                /* clear fatal */
+    handle->start_phase = LD3320_START_PHASE_INIT;                                          /* init phase */
+    handle->start_begin_us = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;   /* save begin time */
+    handle->start_last_us = handle->start_begin_us;                                         /* save phase time */
+    handle->start_deadline_us = handle->start_begin_us;                                     /* run at once */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     end the start statistics
  * @param[in] *handle pointer to an ld3320 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 spi initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 reset failed
  * @note      none
  */
-uint8_t ld3320_init(ld3320_handle_t *handle)
+static void a_ld3320_start_end(ld3320_handle_t *handle)
 {
-    if (handle == NULL)                                                      /* check handle */
+    a_ld3320_start_phase(handle, handle->start_phase);                                      /* close the phase */
+    handle->start_total_us = handle->start_last_us - handle->start_begin_us;                /* total time */
+}
+
+/**
+ * @brief     fail the async start attempt
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] fatal give up after the reset
+ * @note      none
+ */
+static void a_ld3320_start_fail(ld3320_handle_t *handle, uint8_t fatal)
+{
+    if (fatal != 0)                                                                         /* check fatal */
     {
-        return 2;                                                            /* return error */
+        handle->debug_print("ld3320: asr init failed.\n");                                  /* asr init failed */
+        handle->start_fatal = 1;                                                            /* set fatal */
     }
-    if (handle->debug_print == NULL)                                         /* check debug_print */
+    if (handle->start_warm != 0)                                                            /* warm rearm failed */
     {
-        return 3;                                                            /* return error */
+        handle->debug_print("ld3320: warm rearm failed.\n");                                /* warm rearm failed */
+        handle->rearm_fallback++;                                                           /* fallback++ */
+        handle->start_warm = 0;                                                             /* full start next */
     }
-    if (handle->spi_init == NULL)                                            /* check spi_init */
+    handle->start_state = LD3320_START_STATE_RESET_HIGH;                                    /* reset the chip */
+}
+
+/**
+ * @brief     check the warm rearm
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 full start
+ *            - 1 warm rearm
+ * @note      the chip must have finished an asr with the current key words and mode
+ */
+static uint8_t a_ld3320_asr_warm(ld3320_handle_t *handle)
+{
+    if ((handle->asr_rearm == LD3320_ASR_REARM_WARM) &&
+        (handle->asr_configured != 0) &&
+        (handle->running_status == LD3320_STATUS_NONE))                                     /* check the warm rearm */
     {
-        handle->debug_print("ld3320: spi_init is null.\n");                  /* spi_init is null */
-       
-        return 3;                                                            /* return error */
+        return 1;                                                                           /* warm rearm */
     }
-    if (handle->spi_deinit == NULL)                                          /* check spi_deinit */
+    
+    return 0;                                                                               /* full start */
+}
+
+/**
+ * @brief     mark the asr running and save the dead time
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      the dead time is only counted for a start after an asr result
+ */
+static void a_ld3320_asr_armed(ld3320_handle_t *handle)
+{
+    uint32_t dead;
+    
+    handle->asr_configured = 1;                                                             /* chip keeps the key words */
+    if ((handle->asr_result_valid != 0) && (handle->timestamp_us != NULL))                  /* after a result */
     {
-        handle->debug_print("ld3320: spi_deinit is null.\n");                /* spi_deinit is null */
-       
-        return 3;                                                            /* return error */
+        dead = handle->timestamp_us() - handle->asr_result_us;                              /* dead time */
+        if (handle->start_warm != 0)                                                        /* warm rearm */
+        {
+            handle->rearm_warm_count++;                                                     /* warm count++ */
+            handle->rearm_warm_us += dead;                                                  /* add dead time */
+            if (dead > handle->rearm_warm_max_us)                                           /* check max */
+            {
+                handle->rearm_warm_max_us = dead;                                           /* save max */
+            }
+        }
+        else                                                                                /* full start */
+        {
+            handle->rearm_full_count++;                                                     /* full count++ */
+            handle->rearm_full_us += dead;                                                  /* add dead time */
+            if (dead > handle->rearm_full_max_us)                                           /* check max */
+            {
+                handle->rearm_full_max_us = dead;                                           /* save max */
+            }
+        }
     }
-    if (handle->spi_read_address16 == NULL)                                  /* check spi_read */
+    handle->asr_result_valid = 0;                                                           /* result consumed */
+    if ((handle->grammar != NULL) && (handle->grammar->pending != 0))                       /* page switched */
     {
-        handle->debug_print("ld3320: spi_read_address16 is null.\n");        /* spi_read_address16 is null */
-       
-        return 3;                                                            /* return error */
+        handle->grammar->pending = 0;                                                       /* page is running */
+        handle->grammar->switch_count++;                                                    /* switch count++ */
+        if (handle->timestamp_us != NULL)                                                   /* check timestamp_us */
+        {
+            dead = handle->timestamp_us() - handle->grammar->switch_begin_us;               /* switch latency */
+            handle->grammar->switch_us += dead;                                             /* add latency */
+            if (dead > handle->grammar->switch_max_us)                                      /* check max */
+            {
+                handle->grammar->switch_max_us = dead;                                      /* save max */
+            }
+        }
     }
-    if (handle->spi_write_cmd == NULL)                                       /* check spi_write_cmd */
+}
+
+/**
+ * @brief     load a grammar page into the key words
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] page grammar page
+ * @note      the next start uploads the page unless it has the same key words
+ */
+static void a_ld3320_grammar_load(ld3320_handle_t *handle, uint8_t page)
+{
+    const ld3320_grammar_page_t *p;
+    
+    p = handle->grammar->page[page];                                                        /* get the page */
+    a_ld3320_key_word_store(handle, p->text, p->len);                                       /* copy the key words */
+    handle->grammar->active = page;                                                         /* set active page */
+}
+
+/**
+ * @brief     switch the grammar page after a result
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] type result type
+ * @param[in] index result index
+ * @note      a kept page leaves the chip untouched, so a warm rearm can restart it
+ */
+static void a_ld3320_grammar_next(ld3320_handle_t *handle, uint8_t type, uint8_t index)
+{
+    uint8_t next;
+    const ld3320_grammar_page_t *p;
+    
+    p = handle->grammar->page[handle->grammar->active];                                     /* get the page */
+    if (type == LD3320_STATUS_ASR_FOUND_OK)                                                 /* asr ok */
     {
-        handle->debug_print("ld3320: spi_write_cmd is null.\n");             /* spi_write_cmd is null */
-       
-        return 3;                                                            /* return error */
+        next = (p->next != NULL) ? p->next[index] : handle->grammar->active;                /* page after the key word */
     }
-    if (handle->reset_gpio_init == NULL)                                     /* check reset_gpio_init */
+    else
     {
-        handle->debug_print("ld3320: reset_gpio_init is null.\n");           /* reset_gpio_init is null */
-       
-        return 3;                                                            /* return error */
+        next = p->zero_next;                                                                /* page after no key word */
     }
-    if (handle->reset_gpio_deinit == NULL)                                   /* check reset_gpio_deinit */
+    if (next == handle->grammar->active)                                                    /* keep the page */
     {
-        handle->debug_print("ld3320: reset_gpio_deinit is null.\n");         /* reset_gpio_deinit is null */
-       
-        return 3;                                                            /* return error */
+        handle->grammar->stay_count++;                                                      /* stay count++ */
+        
+        return;                                                                             /* return */
     }
-    if (handle->reset_gpio_write == NULL)                                    /* check reset_gpio_write */
+    a_ld3320_grammar_load(handle, next);                                                    /* load the page */
+    handle->grammar->pending = 1;                                                           /* wait for the start */
+    handle->grammar->switch_begin_us = handle->asr_result_us;                               /* from the result */
+}
+
+/**
+ * @brief      run the async start until the next sleep
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *delay_ms pointer to a delay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       the caller holds the lock, follows a_ld3320_run_asr with every
+ *             delay_ms returned to the caller, *delay_ms is 0 when the asr runs
+ */
+static uint8_t a_ld3320_start_run(ld3320_handle_t *handle, uint32_t *delay_ms)
+{
+    uint8_t res;
+    uint8_t fatal;
+    uint8_t status;
+    uint16_t k;
+    uint16_t len;
+    uint16_t delay;
+    uint32_t us;
+    const ld3320_sequence_t *seq;
+    ld3320_sequence_t prepare[LD3320_ASR_PREPARE_SEQ_LEN];
+    ld3320_sequence_t clear[LD3320_KEY_WORD_CLEAR_SEQ_LEN];
+    ld3320_sequence_t tail[LD3320_KEY_WORD_TAIL_SEQ_LEN];
+    
+    a_ld3320_asr_prepare_build(prepare, handle->mic_gain, handle->vad);                             /* build the prepare sequence */
+
+    while (1)                                                                                       /* run to the next sleep */
     {
-        handle->debug_print("ld3320: reset_gpio_write is null.\n");          /* reset_gpio_write is null */
-       
-        return 3;                                                            /* return error */
+        switch (handle->start_state)
+        {
+            case LD3320_START_STATE_SOFT_RESET :
+            {
+                a_ld3320_start_phase(handle, LD3320_START_PHASE_INIT);                              /* init phase */
+                if ((a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, &status) != 0) ||
+                    (a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x35) != 0))                       /* soft reset */
+                {
+                    a_ld3320_start_fail(handle, 1);                                                 /* give up */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_state = LD3320_START_STATE_INIT;                                      /* check the fifo next */
+                *delay_ms = 10;                                                                     /* delay 10 ms */
+                
+                return 0;                                                                           /* success return 0 */
+            }
+            case LD3320_START_STATE_INIT :
+            {
+                if (a_ld3320_read_byte(handle, LD3320_REG_FIFO_STATUS, &status) != 0)               /* read fifo status */
+                {
+                    a_ld3320_start_fail(handle, 1);                                                 /* give up */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_seq = LD3320_START_SEQ_COMMON_INIT;                                   /* common init sequence */
+                handle->start_seq_index = 0;                                                        /* from the first entry */
+                handle->start_state = LD3320_START_STATE_SEQUENCE;                                  /* write the sequences */
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_SEQUENCE :
+            {
+                a_ld3320_start_phase(handle, (handle->start_seq <= LD3320_START_SEQ_ASR_INIT) ? 
+                                     LD3320_START_PHASE_INIT : LD3320_START_PHASE_ASR);             /* sequence phase */
+                if (handle->start_seq == LD3320_START_SEQ_COMMON_INIT)                              /* common init */
+                {
+                    seq = gs_common_init_seq;                                                       /* set sequence */
+                    len = sizeof(gs_common_init_seq) / sizeof(ld3320_sequence_t);                   /* set length */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_ASR_CLOCK)                           /* asr clock */
+                {
+                    seq = gs_common_asr_clock_seq;                                                  /* set sequence */
+                    len = sizeof(gs_common_asr_clock_seq) / sizeof(ld3320_sequence_t);              /* set length */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_COMMON_TAIL)                         /* common tail */
+                {
+                    seq = gs_common_tail_seq;                                                       /* set sequence */
+                    len = sizeof(gs_common_tail_seq) / sizeof(ld3320_sequence_t);                   /* set length */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_ASR_INIT)                            /* asr init */
+                {
+                    seq = gs_asr_init_seq;                                                          /* set sequence */
+                    len = sizeof(gs_asr_init_seq) / sizeof(ld3320_sequence_t);                      /* set length */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_ASR_PREPARE)                         /* asr prepare */
+                {
+                    seq = prepare;                                                                  /* set sequence */
+                    len = LD3320_ASR_PREPARE_SEQ_LEN;                                               /* set length */
+                }
+                else                                                                                /* asr start */
+                {
+                    seq = gs_asr_start_seq;                                                         /* set sequence */
+                    len = sizeof(gs_asr_start_seq) / sizeof(ld3320_sequence_t);                     /* set length */
+                }
+                if (handle->start_seq_index < len)                                                  /* not finished */
+                {
+                    res = a_ld3320_write_sequence_part(handle, seq, len, 
+                                                       &handle->start_seq_index, &delay);           /* write to the next delay */
+                    if (res != 0)                                                                   /* check result */
+                    {
+                        handle->debug_print("ld3320: write sequence failed.\n");                    /* write sequence failed */
+                        fatal = (handle->start_seq <= LD3320_START_SEQ_ASR_INIT) ? 1 : 0;           /* init errors give up */
+                        a_ld3320_start_fail(handle, fatal);                                         /* fail the attempt */
+                        
+                        break;                                                                      /* break */
+                    }
+                    if (delay != 0)                                                                 /* check delay */
+                    {
+                        *delay_ms = delay;                                                          /* set delay */
+                        
+                        return 0;                                                                   /* success return 0 */
+                    }
+                    
+                    break;                                                                          /* break */
+                }
+                if (handle->start_seq < LD3320_START_SEQ_ASR_INIT)                                  /* next init sequence */
+                {
+                    handle->start_seq++;                                                            /* next sequence */
+                    handle->start_seq_index = 0;                                                    /* from the first entry */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_ASR_INIT)                            /* init finished */
+                {
+                    handle->start_index = 0;                                                        /* first key word */
+                    handle->key_word_count = 0;                                                     /* clear uploaded count */
+                    handle->key_word_total_us = 0;                                                  /* clear upload time */
+                    handle->start_poll = 0;                                                         /* clear poll */
+                    handle->start_state = LD3320_START_STATE_WORD_BUSY;                             /* add the key words */
+                    *delay_ms = 100;                                                                /* delay 100 ms */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                else if (handle->start_seq == LD3320_START_SEQ_ASR_PREPARE)                         /* prepare finished */
+                {
+                    handle->start_poll = 0;                                                         /* clear poll */
+                    handle->start_state = LD3320_START_STATE_ASR_BUSY;                              /* wait for the asr */
+                }
+                else                                                                                /* asr started */
+                {
+                    handle->start_state = LD3320_START_STATE_IDLE;                                  /* idle */
+                    handle->running_status = LD3320_STATUS_ASR_RUNNING;                             /* set running */
+                    a_ld3320_start_end(handle);                                                     /* close the statistics */
+                    a_ld3320_asr_armed(handle);                                                     /* save the dead time */
+                    *delay_ms = 0;                                                                  /* finished */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_WORD_BUSY :
+            {
+                a_ld3320_start_phase(handle, LD3320_START_PHASE_KEY_WORDS);                         /* key words phase */
+                if (handle->start_index >= handle->len)                                             /* all key words added */
+                {
+                    handle->start_seq = LD3320_START_SEQ_ASR_PREPARE;                               /* prepare sequence */
+                    handle->start_seq_index = 0;                                                    /* from the first entry */
+                    handle->start_state = LD3320_START_STATE_SEQUENCE;                              /* write the sequence */
+                    *delay_ms = 10;                                                                 /* delay 10 ms */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                if (handle->start_poll == 0)                                                        /* first check */
+                {
+                    a_ld3320_key_word_begin(handle);                                                /* begin the time */
+                    a_ld3320_asr_ready_begin(handle, 1000);                                         /* begin the wait */
+                    handle->start_poll = 1;                                                         /* wait armed */
+                }
+                res = a_ld3320_asr_ready_check(handle, &us);                                        /* check the asr */
+                if (res == 3)                                                                       /* not ready */
+                {
+                    *delay_ms = (us + 999) / 1000;                                                  /* sleep in ms */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                if (res != 0)                                                                       /* read failed or timeout */
+                {
+                    handle->debug_print("ld3320: check asr busy failed.\n");                        /* check asr busy failed */
+                    a_ld3320_start_fail(handle, 0);                                                 /* retry */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_seq_index = 0;                                                        /* from the first entry */
+                handle->start_state = LD3320_START_STATE_WORD_CLEAR;                                /* add the key word */
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_WORD_CLEAR :
+            {
+                (void)a_ld3320_key_word_build(clear, tail, handle->start_index, 0);                 /* build the sequences */
+                if (a_ld3320_write_sequence_part(handle, clear, LD3320_KEY_WORD_CLEAR_SEQ_LEN, 
+                                                 &handle->start_seq_index, &delay) != 0)            /* write to the next delay */
+                {
+                    handle->debug_print("ld3320: asr add key word failed.\n");                      /* asr add key word failed */
+                    a_ld3320_start_fail(handle, 0);                                                 /* retry */
+                    
+                    break;                                                                          /* break */
+                }
+                if (handle->start_seq_index >= LD3320_KEY_WORD_CLEAR_SEQ_LEN)                       /* clear released */
+                {
+                    handle->start_state = LD3320_START_STATE_WORD_DATA;                             /* write the key word */
+                }
+                if (delay != 0)                                                                     /* check delay */
+                {
+                    *delay_ms = delay;                                                              /* hold the clear */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_WORD_DATA :
+            {
+                len = (uint16_t)strlen(a_ld3320_key_word(handle, handle->start_index));             /* get the length */
+                k = a_ld3320_key_word_build(clear, tail, handle->start_index, len);                 /* build the sequences */
+                if ((a_ld3320_write_fifo(handle, LD3320_REG_FIFO_EXT, 
+                                         (const uint8_t *)a_ld3320_key_word(handle, handle->start_index), k) != 0) ||
+                    (a_ld3320_write_sequence(handle, tail, LD3320_KEY_WORD_TAIL_SEQ_LEN) != 0))     /* add the key word */
+                {
+                    handle->debug_print("ld3320: asr add key word failed.\n");                      /* asr add key word failed */
+                    a_ld3320_start_fail(handle, 0);                                                 /* retry */
+                    
+                    break;                                                                          /* break */
+                }
+                a_ld3320_key_word_end(handle, handle->start_index);                                 /* save the time */
+                handle->start_index++;                                                              /* next key word */
+                handle->start_poll = 0;                                                             /* clear poll */
+                handle->start_state = LD3320_START_STATE_WORD_BUSY;                                 /* wait for the asr */
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_ASR_BUSY :
+            {
+                a_ld3320_start_phase(handle, LD3320_START_PHASE_ASR);                               /* asr phase */
+                if (handle->start_poll == 0)                                                        /* first check */
+                {
+                    a_ld3320_asr_ready_begin(handle, 1000);                                         /* begin the wait */
+                    handle->start_poll = 1;                                                         /* wait armed */
+                }
+                res = a_ld3320_asr_ready_check(handle, &us);                                        /* check the asr */
+                if (res == 3)                                                                       /* not ready */
+                {
+                    *delay_ms = (us + 999) / 1000;                                                  /* sleep in ms */
+                    
+                    return 0;                                                                       /* success return 0 */
+                }
+                if (res != 0)                                                                       /* read failed or timeout */
+                {
+                    handle->debug_print("ld3320: asr busy .\n");                                    /* asr busy */
+                    a_ld3320_start_fail(handle, 0);                                                 /* retry */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_seq = LD3320_START_SEQ_ASR_START;                                     /* start sequence */
+                handle->start_seq_index = 0;                                                        /* from the first entry */
+                handle->start_state = LD3320_START_STATE_SEQUENCE;                                  /* write the sequence */
+                
+                break;                                                                              /* break */
+            }
+            case LD3320_START_STATE_RESET_HIGH :
+            {
+                a_ld3320_start_phase(handle, LD3320_START_PHASE_RESET);                             /* reset phase */
+                a_ld3320_cache_invalidate(handle);                                                  /* invalidate the cache */
+                handle->asr_configured = 0;                                                         /* the chip loses the asr setup */
+                if (handle->reset_gpio_write(handle->context, 1) != 0)                              /* reset gpio write 1 */
+                {
+                    handle->debug_print("ld3320: reset gpio write failed.\n");                      /* reset gpio write failed */
+                    handle->start_state = LD3320_START_STATE_RESET_WAIT;                            /* skip the reset */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_state = LD3320_START_STATE_RESET_LOW;                                 /* reset low next */
+                *delay_ms = 2;                                                                      /* delay 2 ms */
+                
+                return 0;                                                                           /* success return 0 */
+            }
+            case LD3320_START_STATE_RESET_LOW :
+            {
+                if (handle->reset_gpio_write(handle->context, 0) != 0)                              /* reset gpio write 0 */
+                {
+                    handle->debug_print("ld3320: reset gpio write failed.\n");                      /* reset gpio write failed */
+                    handle->start_state = LD3320_START_STATE_RESET_WAIT;                            /* skip the reset */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_state = LD3320_START_STATE_RESET_RELEASE;                             /* release next */
+                *delay_ms = 2;                                                                      /* delay 2 ms */
+                
+                return 0;                                                                           /* success return 0 */
+            }
+            case LD3320_START_STATE_RESET_RELEASE :
+            {
+                if (handle->reset_gpio_write(handle->context, 1) != 0)                              /* reset gpio write 1 */
+                {
+                    handle->debug_print("ld3320: reset gpio write failed.\n");                      /* reset gpio write failed */
+                    handle->start_state = LD3320_START_STATE_RESET_WAIT;                            /* skip the reset */
+                    
+                    break;                                                                          /* break */
+                }
+                if (handle->spi_write_cmd(handle->context, NULL, 0) != 0)                           /* spi write command */
+                {
+                    handle->debug_print("ld3320: spi write command failed.\n");                     /* spi write command failed */
+                    handle->start_state = LD3320_START_STATE_RESET_WAIT;                            /* skip the reset */
+                    
+                    break;                                                                          /* break */
+                }
+                handle->start_state = LD3320_START_STATE_RESET_WAIT;                                /* wait next */
+                *delay_ms = 2;                                                                      /* delay 2 ms */
+                
+                return 0;                                                                           /* success return 0 */
+            }
+            case LD3320_START_STATE_RESET_WAIT :
+            {
+                handle->start_state = LD3320_START_STATE_RETRY;                                     /* retry next */
+                *delay_ms = 100;                                                                    /* delay 100 ms */
+                
+                return 0;                                                                           /* success return 0 */
+            }
+            case LD3320_START_STATE_RETRY :
+            {
+                if ((handle->start_fatal != 0) || (handle->start_attempt >= 5))                     /* give up */
+                {
+                    handle->start_state = LD3320_START_STATE_IDLE;                                  /* idle */
+                    a_ld3320_start_end(handle);                                                     /* close the statistics */
+                    
+                    return 1;                                                                       /* return error */
+                }
+                handle->start_attempt++;                                                            /* next attempt */
+                handle->start_state = LD3320_START_STATE_SOFT_RESET;                                /* start again */
+                
+                break;                                                                              /* break */
+            }
+            default :
+            {
+                return 1;                                                                           /* return error */
+            }
+        }
     }
-    if (handle->delay_ms == NULL)                                            /* check delay_ms */
+}
+
+/**
+ * @brief     run the asr
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run asr failed
+ * @note      none
+ */
+static uint8_t a_ld3320_run_asr(ld3320_handle_t *handle)
+{
+    uint8_t res, i, flag;
+    
+    a_ld3320_start_begin(handle);                                                  /* clear the start statistics */
+    handle->start_state = LD3320_START_STATE_IDLE;                                 /* abort the async start */
+    handle->start_warm = a_ld3320_asr_warm(handle);                                /* check the warm rearm */
+    handle->asr_configured = 0;                                                    /* unknown until the start ends */
+    if (handle->start_warm != 0)                                                   /* warm rearm */
     {
-        handle->debug_print("ld3320: delay_ms is null.\n");                  /* delay_ms is null */
-       
-        return 3;                                                            /* return error */
+        a_ld3320_start_phase(handle, LD3320_START_PHASE_ASR);                      /* asr phase */
+        res = a_ld3320_asr_start(handle, handle->mic_gain, handle->vad);           /* asr start */
+        if (res == 0)                                                              /* check result */
+        {
+            a_ld3320_start_end(handle);                                            /* close the statistics */
+            handle->start_steps = 1;                                               /* one blocking step */
+            handle->start_step_max_us = handle->start_total_us;                    /* blocked the whole time */
+            
+            return 0;                                                              /* success return 0 */
+        }
+        handle->debug_print("ld3320: warm rearm failed.\n");                       /* warm rearm failed */
+        handle->rearm_fallback++;                                                  /* fallback++ */
+        handle->start_warm = 0;                                                    /* run the full start */
     }
-    if (handle->delay_us == NULL)                                            /* check delay_us */
+    flag = 2;
+    for (i = 0; i < 5; i++)
     {
-        handle->debug_print("ld3320: delay_us is null.\n");                  /* delay_us is null */
-       
-        return 3;                                                            /* return error */
+        handle->start_attempt = (uint8_t)(i + 1);                                  /* set attempt */
+        a_ld3320_start_phase(handle, LD3320_START_PHASE_INIT);                     /* init phase */
+        res = a_ld3320_asr_init(handle);                                           /* asr init */
+        if (res != 0)                                                              /* check result */
+        {
+            handle->debug_print("ld3320: asr init failed.\n");                     /* asr init failed */
+            a_ld3320_start_phase(handle, LD3320_START_PHASE_RESET);                /* reset phase */
+            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
+            handle->delay_ms(100);                                                 /* delay 100 ms */
+            a_ld3320_start_end(handle);                                            /* close the statistics */
+            
+            return 1;                                                              /* return error */
+        }
+        handle->delay_ms(100);                                                     /* delay 100 ms */
+        a_ld3320_start_phase(handle, LD3320_START_PHASE_KEY_WORDS);                /* key words phase */
+        res = a_ld3320_asr_add_fixed(handle);                                      /* asr add fixed */
+        if (res != 0)                                                              /* check result */
+        {
+            a_ld3320_start_phase(handle, LD3320_START_PHASE_RESET);                /* reset phase */
+            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
+            handle->delay_ms(100);                                                 /* delay 100 ms */
+            
+            continue;                                                              /* continue */
+        }
+        handle->delay_ms(10);                                                      /* delay 10 ms */
+        a_ld3320_start_phase(handle, LD3320_START_PHASE_ASR);                      /* asr phase */
+        res = a_ld3320_asr_start(handle, handle->mic_gain, handle->vad);           /* asr start */
+        if (res != 0)                                                              /* check result */
+        {
+            a_ld3320_start_phase(handle, LD3320_START_PHASE_RESET);                /* reset phase */
+            (void)a_ld3320_reset(handle);                                          /* reset the ld3320 */
+            handle->delay_ms(100);                                                 /* delay 100 ms */
+            
+            continue;                                                              /* continue */
+        }
+        flag = 0;                                                                  /* flag ok */
+        
+        break;                                                                     /* break the loop */
     }
-    if (handle->receive_callback == NULL)                                    /* check receive_callback */
+    a_ld3320_start_end(handle);                                                    /* close the statistics */
+    handle->start_steps = 1;                                                       /* one blocking step */
+    handle->start_step_max_us = handle->start_total_us;                            /* blocked the whole time */
+    
+    return flag;                                                                   /* return flag */
+}
+
+/**
+ * @brief     set the chip mode
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] mode chip mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_set_mode(ld3320_handle_t *handle, ld3320_mode_t mode)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        handle->debug_print("ld3320: receive_callback is null.\n");          /* receive_callback is null */
-       
-        return 3;                                                            /* return error */
+        return 2;                          /* return error */
     }
-    if (handle->mp3_read_init == NULL)                                       /* check mp3_read_init */
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        handle->debug_print("ld3320: mp3_read_init is null.\n");             /* mp3_read_init is null */
-       
-        return 3;                                                            /* return error */
+        return 3;                          /* return error */
     }
-    if (handle->mp3_read_deinit == NULL)                                     /* check mp3_read_deinit */
+    
+    if (a_ld3320_lock(handle) != 0)        /* lock */
     {
-        handle->debug_print("ld3320: mp3_read_deinit is null.\n");           /* mp3_read_deinit is null */
-       
-        return 3;                                                            /* return error */
+        return 1;                          /* return error */
     }
-    if (handle->mp3_read == NULL)                                            /* check mp3_read */
+    if (handle->mode != (uint8_t)mode)     /* mode changed */
     {
-        handle->debug_print("ld3320: mp3_read is null.\n");                  /* mp3_read is null */
-       
-        return 3;                                                            /* return error */
+        handle->asr_configured = 0;        /* full start next */
     }
+    handle->mode = (uint8_t)mode;          /* set mode */
+    a_ld3320_unlock(handle);               /* unlock */
     
-    if (handle->spi_init() != 0)                                             /* spi init */
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief      get the chip mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *mode pointer to a chip mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_mode(ld3320_handle_t *handle, ld3320_mode_t *mode)
+{
+    if (handle == NULL)                           /* check handle */
     {
-        handle->debug_print("ld3320: spi init failed.\n");                   /* spi init failed */
-       
-        return 1;                                                            /* return error */
+        return 2;                                 /* return error */
     }
-    if (handle->reset_gpio_init() != 0)                                      /* reset gpio init */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        handle->debug_print("ld3320: reset gpio init failed.\n");            /* reset gpio init failed */
-        (void)handle->spi_deinit();                                          /* spi deinit */
+        return 3;                                 /* return error */
+    }
+    
+    *mode = (ld3320_mode_t)(handle->mode);        /* get mode */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief     set the key words
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a text buffer
+ * @param[in] len key words length
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 key words are invalid
+ * @note      none
+ */
+uint8_t ld3320_set_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t len)
+{
+    uint8_t i;
+    const char *word[LD3320_KEY_WORD_MAX];
+    
+    if (handle == NULL)                                          /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    if (handle->inited != 1)                                     /* check handle initialization */
+    {
+        return 3;                                                /* return error */
+    }
+    if (len > LD3320_KEY_WORD_MAX)                               /* check length */
+    {
+        handle->debug_print("ld3320: len is invalid.\n");        /* len is invalid */
         
-        return 4;                                                            /* return error */
+        return 4;                                                /* return error */
     }
-    if (a_ld3320_reset(handle) != 0)                                         /* result */
+    
+    for (i = 0; i < len; i++)                                    /* list the rows */
     {
-        handle->debug_print("ld3320: reset failed.\n");                      /* reset failed */
-        (void)handle->spi_deinit();                                          /* spi deinit */
-        (void)handle->reset_gpio_deinit();                                   /* gpio deinit */
+        word[i] = text[i];                                       /* point to the row */
+    }
+    
+    return ld3320_set_key_word_list(handle, word, len);          /* set the key words */
+}
+
+/**
+ * @brief     set the key words from a pointer list
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a key word pointer list
+ * @param[in] len key words length
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 key words are invalid
+ * @note      every key word must be shorter than LD3320_KEY_WORD_LEN and all of them must fit the key word pool,
+ *            the key words are copied and may not point into the handle
+ */
+uint8_t ld3320_set_key_word_list(ld3320_handle_t *handle, const char *const *text, uint8_t len)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    if (a_ld3320_key_word_check(text, len) != 0)                      /* check the key words */
+    {
+        handle->debug_print("ld3320: key words are invalid.\n");      /* key words are invalid */
         
-        return 4;                                                            /* return error */
+        return 4;                                                     /* return error */
     }
-    handle->mic_gain = LD3320_MIC_GAIN_COMMON;                               /* set mic gain common */
-    handle->vad = LD3320_VAD_COMMON;                                         /* set vad common */
-    handle->running_status = LD3320_STATUS_NONE;                             /* set status none */
-    handle->inited = 1;                                                      /* flag finished */
     
-    return 0;                                                                /* success return 0 */
+    if (a_ld3320_lock(handle) != 0)                                   /* lock */
+    {
+        return 1;                                                     /* return error */
+    }
+    a_ld3320_key_word_store(handle, text, len);                       /* store the key words */
+    handle->grammar = NULL;                                           /* detach the grammar */
+    a_ld3320_unlock(handle);                                          /* unlock */
+    
+    return 0;                                                         /* success return 0 */
 }
 
 /**
- * @brief     irq handler
+ * @brief     set the key words from utf-8 texts
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a utf-8 text pointer list
+ * @param[in] len key words length
+ * @param[in] *override pointer to a pinyin override list
+ * @param[in] override_len override list length
  * @return    status code
  *            - 0 success
- *            - 1 run failed
+ *            - 1 lock failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 mode is invalid
- * @note      none
+ *            - 4 key words are invalid
+ * @note      every text is converted once by ld3320_pinyin_convert into a LD3320_KEY_WORD_MAX * LD3320_KEY_WORD_LEN bytes stack buffer,
+ *            the pinyin must be shorter than LD3320_KEY_WORD_LEN and all of them must fit the key word pool
  */
-uint8_t ld3320_irq_handler(ld3320_handle_t *handle)
+uint8_t ld3320_set_key_words_utf8(ld3320_handle_t *handle, const char *const *text, uint8_t len, 
+                                  const ld3320_pinyin_override_t *override, uint16_t override_len)
 {
-    uint8_t res;
-    uint8_t flag;
-    uint8_t asr_status;
-    uint8_t asr_status2;
-    uint8_t count;
     uint8_t i;
+    char word[LD3320_KEY_WORD_MAX][LD3320_KEY_WORD_LEN];
+    const char *list[LD3320_KEY_WORD_MAX];
     
-    if (handle == NULL)                                                                           /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                                                 /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                                                 /* return error */
+        return 3;                                                                   /* return error */
     }
-
-    if (handle->mode == LD3320_MODE_ASR)                                                          /* asr mode */
+    if ((len > LD3320_KEY_WORD_MAX) || ((len != 0) && (text == NULL)))              /* check the list */
     {
-        res = a_ld3320_read_byte(handle, LD3320_REG_INT_FLAG, (uint8_t *)&flag);                  /* read int flag */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: read int flag failed.\n");                               /* read int flag failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x00);                             /* write int conf */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: write int conf failed.\n");                              /* write int conf failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, 0x00);                        /* write fifo int conf */
-        if (res != 0)                                                                             /* check result */
+        handle->debug_print("ld3320: key words are invalid.\n");                    /* key words are invalid */
+        
+        return 4;                                                                   /* return error */
+    }
+    for (i = 0; i < len; i++)                                                       /* convert every key word */
+    {
+        if (ld3320_pinyin_convert(text[i], override, override_len, 
+                                  word[i], LD3320_KEY_WORD_LEN) != 0)               /* convert the key word */
         {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: write fifo int conf failed.\n");                         /* write fifo int conf failed */
+            handle->debug_print("ld3320: key word %d convert failed.\n", i);        /* convert failed */
             
-            return 1;                                                                             /* return error */
+            return 4;                                                               /* return error */
         }
-        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS, (uint8_t *)&asr_status);          /* read asr status flag */
-        if (res != 0)                                                                             /* check result */
-        {
+        list[i] = word[i];                                                          /* set the pinyin */
+    }
+    if (a_ld3320_key_word_check(list, len) != 0)                                    /* check the key words */
+    {
+        handle->debug_print("ld3320: key words are invalid.\n");                    /* key words are invalid */
+        
+        return 4;                                                                   /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                                 /* lock */
+    {
+        return 1;                                                                   /* return error */
+    }
+    a_ld3320_key_word_store(handle, list, len);                                     /* store the key words */
+    handle->grammar = NULL;                                                         /* detach the grammar */
+    a_ld3320_unlock(handle);                                                        /* unlock */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the key words
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] **text pointer to a text buffer
+ * @param[out] *len pointer to a key words length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t *len)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    if (handle->inited != 1)                     /* check handle initialization */
+    {
+        return 3;                                /* return error */
+    }
+    
+    for (i = 0; i < handle->len; i++)                          /* copy the text */
+    {
+        strcpy(text[i], a_ld3320_key_word(handle, i));         /* copy the text */
+    }
+    *len = handle->len;                                        /* get length */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief      get one key word
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  index key word index
+ * @param[out] **text pointer to a key word pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 index is invalid
+ * @note       the key word stays valid until the key words change
+ */
+uint8_t ld3320_get_key_word(ld3320_handle_t *handle, uint8_t index, const char **text)
+{
+    if (handle == NULL)                                      /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    if (handle->inited != 1)                                 /* check handle initialization */
+    {
+        return 3;                                            /* return error */
+    }
+    if (index >= handle->len)                                /* check index */
+    {
+        handle->debug_print("ld3320: index is invalid.\n");  /* index is invalid */
+        
+        return 4;                                            /* return error */
+    }
+    
+    *text = a_ld3320_key_word(handle, index);                /* get the key word */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the microphone gain
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] gain microphone gain
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_set_mic_gain(ld3320_handle_t *handle, ld3320_mic_gain_t gain)
+{
+    if (handle == NULL)                      /* check handle */
+    {
+        return 2;                            /* return error */
+    }
+    if (handle->inited != 1)                 /* check handle initialization */
+    {
+        return 3;                            /* return error */
+    }
+    
+    handle->mic_gain = (uint8_t)gain;        /* set mode */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief      get the microphone gain
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *gain pointer to a microphone gain buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_mic_gain(ld3320_handle_t *handle, ld3320_mic_gain_t *gain)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    if (handle->inited != 1)                              /* check handle initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    
+    *gain = (ld3320_mic_gain_t)(handle->mic_gain);        /* get mode */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the vad
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] vad vad param
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_set_vad(ld3320_handle_t *handle, ld3320_vad_t vad)
+{
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+    
+    handle->vad = (uint8_t)vad;     /* set vad */
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief      get the vad
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *vad pointer to a vad param buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_vad(ld3320_handle_t *handle, ld3320_vad_t *vad)
+{
+    if (handle == NULL)                        /* check handle */
+    {
+        return 2;                              /* return error */
+    }
+    if (handle->inited != 1)                   /* check handle initialization */
+    {
+        return 3;                              /* return error */
+    }
+    
+    *vad = (ld3320_vad_t)(handle->vad);        /* get vad */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief      get the status
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_status(ld3320_handle_t *handle, ld3320_status_t *status)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    *status = (ld3320_status_t)(handle->running_status);        /* get running status */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      none
+ */
+uint8_t ld3320_init(ld3320_handle_t *handle)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->debug_print == NULL)                                         /* check debug_print */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (handle->spi_init == NULL)                                            /* check spi_init */
+    {
+        handle->debug_print("ld3320: spi_init is null.\n");                  /* spi_init is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->spi_deinit == NULL)                                          /* check spi_deinit */
+    {
+        handle->debug_print("ld3320: spi_deinit is null.\n");                /* spi_deinit is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->spi_read_address16 == NULL)                                  /* check spi_read */
+    {
+        handle->debug_print("ld3320: spi_read_address16 is null.\n");        /* spi_read_address16 is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->spi_write_cmd == NULL)                                       /* check spi_write_cmd */
+    {
+        handle->debug_print("ld3320: spi_write_cmd is null.\n");             /* spi_write_cmd is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->reset_gpio_init == NULL)                                     /* check reset_gpio_init */
+    {
+        handle->debug_print("ld3320: reset_gpio_init is null.\n");           /* reset_gpio_init is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->reset_gpio_deinit == NULL)                                   /* check reset_gpio_deinit */
+    {
+        handle->debug_print("ld3320: reset_gpio_deinit is null.\n");         /* reset_gpio_deinit is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->reset_gpio_write == NULL)                                    /* check reset_gpio_write */
+    {
+        handle->debug_print("ld3320: reset_gpio_write is null.\n");          /* reset_gpio_write is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->delay_ms == NULL)                                            /* check delay_ms */
+    {
+        handle->debug_print("ld3320: delay_ms is null.\n");                  /* delay_ms is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->delay_us == NULL)                                            /* check delay_us */
+    {
+        handle->debug_print("ld3320: delay_us is null.\n");                  /* delay_us is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->receive_callback == NULL)                                    /* check receive_callback */
+    {
+        handle->debug_print("ld3320: receive_callback is null.\n");          /* receive_callback is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->mp3_read_init == NULL)                                       /* check mp3_read_init */
+    {
+        handle->debug_print("ld3320: mp3_read_init is null.\n");             /* mp3_read_init is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if (handle->mp3_read_deinit == NULL)                                     /* check mp3_read_deinit */
+    {
+        handle->debug_print("ld3320: mp3_read_deinit is null.\n");           /* mp3_read_deinit is null */
+       
+        return 3;                                                            /* return error */
+    }
+    if ((handle->mp3_read == NULL) && 
+        ((handle->mp3_acquire == NULL) || (handle->mp3_release == NULL)))    /* check mp3_read */
+    {
+        handle->debug_print("ld3320: mp3_read is null.\n");                  /* mp3_read is null */
+       
+        return 3;                                                            /* return error */
+    }
+    
+    if (handle->spi_init(handle->context) != 0)                              /* spi init */
+    {
+        handle->debug_print("ld3320: spi init failed.\n");                   /* spi init failed */
+       
+        return 1;                                                            /* return error */
+    }
+    if (handle->reset_gpio_init(handle->context) != 0)                       /* reset gpio init */
+    {
+        handle->debug_print("ld3320: reset gpio init failed.\n");            /* reset gpio init failed */
+        (void)handle->spi_deinit(handle->context);                           /* spi deinit */
+        
+        return 4;                                                            /* return error */
+    }
+    if (a_ld3320_reset(handle) != 0)                                         /* result */
+    {
+        handle->debug_print("ld3320: reset failed.\n");                      /* reset failed */
+        (void)handle->spi_deinit(handle->context);                           /* spi deinit */
+        (void)handle->reset_gpio_deinit(handle->context);                    /* gpio deinit */
+        
+        return 4;                                                            /* return error */
+    }
+    handle->mic_gain = LD3320_MIC_GAIN_COMMON;                               /* set mic gain common */
+    handle->vad = LD3320_VAD_COMMON;                                         /* set vad common */
+    handle->running_status = LD3320_STATUS_NONE;                             /* set status none */
+    handle->mp3_feed_mode = LD3320_MP3_FEED_MODE_BYTE;                       /* set byte feed mode */
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    handle->cache_enable = 0;                                                /* disable the register cache */
+    handle->cache_hit = 0;                                                   /* clear cache hit */
+    handle->cache_miss = 0;                                                  /* clear cache miss */
+#endif
+    handle->spi_clock_hz = 0;                                                /* interface default clock */
+    handle->event_enable = 0;                                                /* disable the event queue */
+    handle->event_head = 0;                                                  /* clear event head */
+    handle->event_tail = 0;                                                  /* clear event tail */
+    handle->event_overflow = 0;                                              /* clear event overflow */
+    handle->callback_guard = 0;                                              /* clear callback guard */
+    handle->start_deferred = 0;                                              /* clear deferred start */
+    handle->lock_count = 0;                                                  /* clear lock count */
+    handle->lock_contention = 0;                                             /* clear lock contention */
+    handle->status_conflict = 0;                                             /* clear status conflict */
+    handle->deferred_start = 0;                                              /* clear deferred start count */
+    handle->start_state = LD3320_START_STATE_IDLE;                           /* no async start */
+    handle->asr_ready_timeout_ms = LD3320_ASR_READY_TIMEOUT_MS;              /* set the asr ready deadline */
+    handle->irq_edge_valid = 0;                                              /* no edge time */
+    handle->event_edge_us = 0;                                               /* clear event edge time */
+    handle->event_service_us = 0;                                            /* clear event service time */
+    memset(&handle->event_last, 0, sizeof(ld3320_event_t));                  /* clear the last event */
+    for (i = 0; i < LD3320_STATUS_NUM; i++)                                  /* clear the event latency */
+    {
+        handle->latency_count[i] = 0;                                        /* clear count */
+        handle->latency_service_min_us[i] = 0;                               /* clear min service latency */
+        handle->latency_service_us[i] = 0;                                   /* clear service latency */
+        handle->latency_service_max_us[i] = 0;                               /* clear max service latency */
+        handle->latency_callback_min_us[i] = 0;                              /* clear min callback latency */
+        handle->latency_callback_us[i] = 0;                                  /* clear callback latency */
+        handle->latency_callback_max_us[i] = 0;                              /* clear max callback latency */
+    }
+    handle->asr_rearm = LD3320_ASR_REARM_FULL;                               /* full start by default */
+    handle->asr_configured = 0;                                              /* chip is not configured */
+    handle->asr_result_valid = 0;                                            /* no asr result */
+    handle->start_warm = 0;                                                  /* no warm rearm */
+    handle->asr_result_us = 0;                                               /* clear result time */
+    handle->rearm_warm_count = 0;                                            /* clear warm count */
+    handle->rearm_warm_us = 0;                                               /* clear warm dead time */
+    handle->rearm_warm_max_us = 0;                                           /* clear max warm dead time */
+    handle->rearm_full_count = 0;                                            /* clear full count */
+    handle->rearm_full_us = 0;                                               /* clear full dead time */
+    handle->rearm_full_max_us = 0;                                           /* clear max full dead time */
+    handle->rearm_fallback = 0;                                              /* clear fallback count */
+    handle->key_word_count = 0;                                              /* clear uploaded count */
+    handle->key_word_total_us = 0;                                           /* clear upload time */
+    handle->grammar = NULL;                                                  /* no grammar */
+    handle->inited = 1;                                                      /* flag finished */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     irq handler
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 4 mode is invalid
+ * @note      the caller holds the lock
+ */
+static uint8_t a_ld3320_irq_handler(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t flag;
+    uint8_t status;
+    uint8_t asr_status;
+    uint8_t asr_status2;
+    uint8_t count;
+    uint8_t i;
+    
+    if (handle->mode == LD3320_MODE_ASR)                                                          /* asr mode */
+    {
+        res = a_ld3320_read_byte(handle, LD3320_REG_INT_FLAG, (uint8_t *)&flag);                  /* read int flag */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: read int flag failed.\n");                               /* read int flag failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x00);                             /* write int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: write int conf failed.\n");                              /* write int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, 0x00);                        /* write fifo int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: write fifo int conf failed.\n");                         /* write fifo int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS, (uint8_t *)&asr_status);          /* read asr status flag */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: read asr status failed.\n");                             /* read asr status failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        status = asr_status;                                                                      /* save asr status */
+        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS2 , (uint8_t *)&asr_status2);       /* read asr status2 flag */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: read asr status2 failed.\n");                            /* read asr status2 failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        if (((flag & 0x10) != 0) && (asr_status == 0x21) && (asr_status2 == 0x35))                /* check flags */
+        {
+            res = a_ld3320_read_byte(handle, LD3320_REG_INT_AUX , (uint8_t *)&count);             /* read count */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_ASR_ERROR;                                 /* set error */
+                handle->debug_print("ld3320: read count failed.\n");                              /* read count failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            if ((count > 0) && (count <= 4))                                                      /* check count */
+            {
+                handle->running_status = LD3320_STATUS_ASR_FOUND_OK;                              /* set ok */
+            }
+            else
+            {
+                handle->running_status = LD3320_STATUS_ASR_FOUND_ZERO;                            /* set zero */
+            }
+        }
+        else
+        {
+            handle->running_status = LD3320_STATUS_ASR_FOUND_ZERO;                                /* set zero */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_INT_FLAG, 0x00);                             /* write int flag */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: write int flag failed.\n");                              /* write int flag failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONF, 0x00);                             /* write adc conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: write adc conf failed.\n");                              /* write adc conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+    }
+    else if (handle->mode == LD3320_MODE_MP3)                                                     /* if mp3 mode */
+    {
+        uint8_t reg1;
+        uint8_t reg2;
+        
+        res = a_ld3320_read_byte(handle, LD3320_REG_INT_FLAG, (uint8_t *)&flag);                  /* read int flag */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: read int flag failed.\n");                               /* read int flag failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_read_byte(handle, LD3320_REG_INT_CONF, (uint8_t *)&reg1);                  /* read int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
+            handle->debug_print("ld3320: read int conf failed.\n");                               /* read int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_INT_CONF, (uint8_t *)&reg2);             /* read fifo int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
+            handle->debug_print("ld3320: read fifo int conf failed.\n");                          /* read fifo int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x00);                             /* write int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
+            handle->debug_print("ld3320: write int conf failed.\n");                              /* write int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, 0x00);                        /* write fifo int conf */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
+            handle->debug_print("ld3320: write fifo int conf failed.\n");                         /* write fifo int conf failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        res = a_ld3320_read_byte(handle, LD3320_REG_INT_AUX, (uint8_t *)&status);                 /* read status */
+        if (res != 0)                                                                             /* check result */
+        {
+            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
+            handle->debug_print("ld3320: read status failed.\n");                                 /* read status failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        if ((status & 0x20) != 0)                                                                 /* check the status */
+        {
+            res = a_ld3320_write_byte(handle, LD3320_REG_INT_FLAG , 0x00);                        /* write int conf */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: write int conf failed.\n");                          /* write int conf failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_INT_AUX, 0x00);                          /* write int aux */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: write int aux failed.\n");                           /* write int aux failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_ASR_FORCE_STOP, 0x00);                   /* asr force stop */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: asr force stop failed.\n");                          /* asr force stop failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            handle->point = 0;                                                                    /* set zero */
+            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x01);                       /* clear fifo */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: clear fifo failed.\n");                              /* clear fifo failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x00);                       /* clear fifo */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: clear fifo failed.\n");                              /* clear fifo failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_MP3_CONF, 0x00);                         /* set mp3 conf */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: mp3 conf failed.\n");                                /* mp3 conf failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            handle->running_status = LD3320_STATUS_MP3_END;                                       /* set end */
+        }
+        else if (handle->point >= handle->size &&
+                 handle->running_status == LD3320_STATUS_ASR_RUNNING)                             /* check size */
+        {
+            res = a_ld3320_write_byte(handle, LD3320_REG_ASR_FORCE_STOP, 0x01);                   /* set asr force stop */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: asr force stop failed.\n");                          /* asr force stop failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x10);                         /* set int conf */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: set int conf failed.\n");                            /* set int conf failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            handle->running_status = LD3320_STATUS_MP3_END;                                       /* set end */
+        }
+        else
+        {
+            res = a_ld3320_mp3_load(handle, 0);                                                   /* mp3 load */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: mp3 load failed.\n");                                /* mp3 load failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, reg1);                         /* write int conf */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: write int conf failed.\n");                          /* write int conf failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, reg2);                    /* write fifo int conf */
+            if (res != 0)                                                                         /* check result */
+            {
+                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
+                handle->debug_print("ld3320: write fifo int conf failed.\n");                     /* write fifo int conf failed */
+                
+                return 1;                                                                         /* return error */
+            }
+            handle->running_status = LD3320_STATUS_MP3_LOAD;                                      /* set load */
+        }
+    }
+    else                                                                                          /* unknown mode */
+    {
+        handle->debug_print("ld3320: mode is invalid.\n");                                        /* mode is invalid failed */
+       
+        return 4;                                                                                 /* return error */
+    }
+    if (a_ld3320_transition(handle, LD3320_STATUS_ASR_FOUND_OK, 
+                            LD3320_STATUS_NONE) != 0)                                             /* asr ok */
+    {
+        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_RES_1 , (uint8_t *)&i);                   /* read asr index */
+        if (res != 0)                                                                             /* check result */
+        {
             handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: read asr status failed.\n");                             /* read asr status failed */
+            handle->debug_print("ld3320: read asr index failed.\n");                              /* read asr index failed */
+            
+            return 1;                                                                             /* return error */
+        }
+        if (i >= handle->len)                                                                     /* check index */
+        {
+            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
+            handle->debug_print("ld3320: index is invalid.\n");                                   /* index is invalid */
+            
+            return 1;                                                                             /* return error */
+        }
+        handle->asr_result_us = handle->event_edge_us;                                            /* save the result time */
+        handle->asr_result_valid = 1;                                                             /* result time is set */
+        a_ld3320_event(handle, LD3320_STATUS_ASR_FOUND_OK, i, flag, status);                      /* report the event */
+        if (handle->grammar != NULL)                                                              /* check the grammar */
+        {
+            a_ld3320_grammar_next(handle, LD3320_STATUS_ASR_FOUND_OK, i);                         /* switch the page */
+        }
+    }
+    else if (a_ld3320_transition(handle, LD3320_STATUS_ASR_FOUND_ZERO, 
+                                 LD3320_STATUS_NONE) != 0)                                        /* asr zero */
+    {
+        handle->asr_result_us = handle->event_edge_us;                                            /* save the result time */
+        handle->asr_result_valid = 1;                                                             /* result time is set */
+        a_ld3320_event(handle, LD3320_STATUS_ASR_FOUND_ZERO, 0, flag, status);                    /* report the event */
+        if (handle->grammar != NULL)                                                              /* check the grammar */
+        {
+            a_ld3320_grammar_next(handle, LD3320_STATUS_ASR_FOUND_ZERO, 0);                       /* switch the page */
+        }
+    }
+    else if (a_ld3320_transition(handle, LD3320_STATUS_MP3_END, 
+                                 LD3320_STATUS_NONE) != 0)                                        /* mp3 end */
+    {
+        a_ld3320_event(handle, LD3320_STATUS_MP3_END, 0, flag, status);                           /* report the event */
+    }
+    else if (a_ld3320_transition(handle, LD3320_STATUS_MP3_LOAD, 
+                                 LD3320_STATUS_ASR_RUNNING) != 0)                                 /* mp3 load */
+    {
+        a_ld3320_event(handle, LD3320_STATUS_MP3_LOAD, 0, flag, status);                          /* report the event */
+    }
+    else if (handle->running_status == LD3320_STATUS_NONE)                                        /* stopped meanwhile */
+    {
+        handle->status_conflict++;                                                                /* status conflict++ */
+    }
+    else
+    {
+        handle->debug_print("ld3320: unknown status.\n");                                         /* unknown status failed */
+            
+        return 1;                                                                                 /* return error */
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     latch the irq without any bus access
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it in the interrupt context and run ld3320_service later
+ */
+uint8_t ld3320_irq_latch(ld3320_handle_t *handle)
+{
+    if (handle == NULL)                                     /* check handle */
+    {
+        return 2;                                           /* return error */
+    }
+    if (handle->inited != 1)                                /* check handle initialization */
+    {
+        return 3;                                           /* return error */
+    }
+    
+    if (handle->timestamp_us != NULL)                       /* check timestamp_us */
+    {
+        handle->irq_latch_us = handle->timestamp_us();      /* save latch time */
+    }
+    handle->irq_latch_count++;                              /* latch count++ */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the irq edge time
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] edge_us edge time in the timestamp_us clock
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it before ld3320_irq_handler or ld3320_irq_latch when the interface knows the edge time,
+ *            otherwise the latch time or the service start is used
+ */
+uint8_t ld3320_irq_timestamp(ld3320_handle_t *handle, uint32_t edge_us)
+{
+    if (handle == NULL)                         /* check handle */
+    {
+        return 2;                               /* return error */
+    }
+    if (handle->inited != 1)                    /* check handle initialization */
+    {
+        return 3;                               /* return error */
+    }
+    
+    handle->irq_edge_us = edge_us;              /* save edge time */
+    handle->irq_edge_valid = 1;                 /* set valid */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     service the latched irq
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is invalid
+ * @note      call it in the thread or main loop context, returns 0 if nothing is latched
+ */
+uint8_t ld3320_service(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    uint32_t latch;
+    uint32_t t0 = 0;
+    uint32_t us;
+    
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->inited != 1)                                            /* check handle initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    
+    latch = handle->irq_latch_count;                                    /* snapshot the latch count */
+    if (latch == handle->irq_serviced)                                  /* nothing latched */
+    {
+        return 0;                                                       /* success return 0 */
+    }
+    if (handle->timestamp_us != NULL)                                   /* check timestamp_us */
+    {
+        t0 = handle->timestamp_us();                                    /* get start time */
+        us = t0 - handle->irq_latch_us;                                 /* latch to service latency */
+        handle->irq_latency_us += us;                                   /* add latency */
+        if (us > handle->irq_latency_max_us)                            /* check max latency */
+        {
+            handle->irq_latency_max_us = us;                            /* save max latency */
+        }
+        if (handle->irq_edge_valid == 0)                                /* no edge time from the interface */
+        {
+            handle->irq_edge_us = handle->irq_latch_us;                 /* the latch time is the edge */
+            handle->irq_edge_valid = 1;                                 /* set valid */
+        }
+    }
+    handle->irq_serviced = latch;                                       /* edges before the snapshot are served */
+    handle->irq_service_count++;                                        /* service count++ */
+    res = ld3320_irq_handler(handle);                                   /* run the irq handler */
+    if (handle->timestamp_us != NULL)                                   /* check timestamp_us */
+    {
+        us = handle->timestamp_us() - t0;                               /* service time */
+        handle->irq_service_us += us;                                   /* add service time */
+        if (us > handle->irq_service_max_us)                            /* check max service time */
+        {
+            handle->irq_service_max_us = us;                            /* save max service time */
+        }
+    }
+    
+    return res;                                                         /* return the result */
+}
+
+/**
+ * @brief      get the irq statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an irq statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       statistics are cleared by ld3320_start
+ */
+uint8_t ld3320_get_irq_stats(ld3320_handle_t *handle, ld3320_irq_stats_t *stats)
+{
+    uint32_t n;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    n = handle->irq_service_count;                                                       /* save service count */
+    stats->latch_count = handle->irq_latch_count;                                        /* get latch count */
+    stats->service_count = n;                                                            /* get service count */
+    stats->coalesced = handle->irq_serviced - n;                                         /* get merged edges */
+    stats->latency_avg_us = (n != 0) ? (handle->irq_latency_us / n) : 0;                 /* get average latency */
+    stats->latency_max_us = handle->irq_latency_max_us;                                  /* get max latency */
+    stats->service_avg_us = (n != 0) ? (handle->irq_service_us / n) : 0;                 /* get average service time */
+    stats->service_max_us = handle->irq_service_max_us;                                  /* get max service time */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the event queue
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      when enabled, events are queued instead of running receive_callback,
+ *            the queue and the overflow count are cleared
+ */
+uint8_t ld3320_set_event_queue(ld3320_handle_t *handle, ld3320_bool_t enable)
+{
+    if (handle == NULL)                            /* check handle */
+    {
+        return 2;                                  /* return error */
+    }
+    if (handle->inited != 1)                       /* check handle initialization */
+    {
+        return 3;                                  /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                /* lock */
+    {
+        return 1;                                  /* return error */
+    }
+    handle->event_enable = 0;                      /* stop queuing */
+    handle->event_head = 0;                        /* clear head */
+    handle->event_tail = 0;                        /* clear tail */
+    handle->event_overflow = 0;                    /* clear overflow */
+    handle->event_enable = (uint8_t)enable;        /* set enable */
+    a_ld3320_unlock(handle);                       /* unlock */
+    
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief      get the event queue status
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_event_queue(ld3320_handle_t *handle, ld3320_bool_t *enable)
+{
+    if (handle == NULL)                                        /* check handle */
+    {
+        return 2;                                              /* return error */
+    }
+    if (handle->inited != 1)                                   /* check handle initialization */
+    {
+        return 3;                                              /* return error */
+    }
+    
+    *enable = (ld3320_bool_t)(handle->event_enable);           /* get enable */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief      poll one event from the event queue
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is empty
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the queue has one producer (the irq handler) and one consumer (this function)
+ */
+uint8_t ld3320_poll_event(ld3320_handle_t *handle, ld3320_event_t *event)
+{
+    uint16_t tail;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    tail = handle->event_tail;                                              /* get tail */
+    if (tail == handle->event_head)                                         /* check empty */
+    {
+        return 1;                                                           /* return empty */
+    }
+    LD3320_MEMORY_BARRIER();                                                /* read the slot after the head */
+    *event = handle->event[tail & (LD3320_EVENT_QUEUE_SIZE - 1)];           /* copy the event */
+    LD3320_MEMORY_BARRIER();                                                /* release the slot after the copy */
+    handle->event_tail = (uint16_t)(tail + 1);                              /* tail++ */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the event queue overflow count
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       events are dropped and counted when the queue is full
+ */
+uint8_t ld3320_get_event_overflow(ld3320_handle_t *handle, uint32_t *count)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    
+    *count = handle->event_overflow;                 /* get overflow count */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the last reported event
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it in receive_callback to get the timestamps of the current event
+ */
+uint8_t ld3320_get_last_event(ld3320_handle_t *handle, ld3320_event_t *event)
+{
+    if (handle == NULL)                         /* check handle */
+    {
+        return 2;                               /* return error */
+    }
+    if (handle->inited != 1)                    /* check handle initialization */
+    {
+        return 3;                               /* return error */
+    }
+    
+    *event = handle->event_last;                /* get the last event */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the event latency
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 type is invalid
+ * @note       running since ld3320_init, needs timestamp_us
+ */
+uint8_t ld3320_get_event_latency(ld3320_handle_t *handle, ld3320_status_t type, ld3320_event_latency_t *latency)
+{
+    uint32_t n;
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    if ((uint8_t)type >= LD3320_STATUS_NUM)                                                      /* check type */
+    {
+        handle->debug_print("ld3320: type is invalid.\n");                                       /* type is invalid */
+        
+        return 4;                                                                                /* return error */
+    }
+    
+    n = handle->latency_count[type];                                                             /* get count */
+    latency->count = n;                                                                          /* set count */
+    latency->service_min_us = handle->latency_service_min_us[type];                              /* get min service latency */
+    latency->service_avg_us = (n != 0) ? (handle->latency_service_us[type] / n) : 0;             /* get average service latency */
+    latency->service_max_us = handle->latency_service_max_us[type];                              /* get max service latency */
+    latency->callback_min_us = handle->latency_callback_min_us[type];                            /* get min callback latency */
+    latency->callback_avg_us = (n != 0) ? (handle->latency_callback_us[type] / n) : 0;           /* get average callback latency */
+    latency->callback_max_us = handle->latency_callback_max_us[type];                            /* get max callback latency */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the lock statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a lock statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_lock_stats(ld3320_handle_t *handle, ld3320_lock_stats_t *stats)
+{
+    if (handle == NULL)                                      /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    if (handle->inited != 1)                                 /* check handle initialization */
+    {
+        return 3;                                            /* return error */
+    }
+    
+    stats->lock_count = handle->lock_count;                  /* get lock count */
+    stats->contention = handle->lock_contention;             /* get contention */
+    stats->status_conflict = handle->status_conflict;        /* get status conflict */
+    stats->deferred_start = handle->deferred_start;          /* get deferred start */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     clear the irq statistics
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @note      none
+ */
+static void a_ld3320_irq_stats_clear(ld3320_handle_t *handle)
+{
+    handle->irq_latch_count = 0;                              /* clear latch count */
+    handle->irq_serviced = 0;                                 /* clear serviced count */
+    handle->irq_service_count = 0;                            /* clear service count */
+    handle->irq_latency_us = 0;                               /* clear latency */
+    handle->irq_latency_max_us = 0;                           /* clear max latency */
+    handle->irq_service_us = 0;                               /* clear service time */
+    handle->irq_service_max_us = 0;                           /* clear max service time */
+    handle->poll_count = 0;                                   /* clear poll count */
+    handle->poll_event_count = 0;                             /* clear poll event count */
+    handle->poll_interval_ms = 0;                             /* clear poll interval */
+    handle->poll_period_ms = 0;                               /* period is unknown */
+    handle->poll_elapsed_ms = 0;                              /* clear elapsed time */
+}
+
+/**
+ * @brief     start the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the caller holds the lock
+ */
+static uint8_t a_ld3320_start(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    a_ld3320_irq_stats_clear(handle);                                                               /* clear the irq statistics */
+    if (handle->mode == LD3320_MODE_ASR)                                                            /* asr mode */
+    {
+        res = a_ld3320_run_asr(handle);                                                             /* run asr */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: run adr failed.\n");                                       /* run receive callback failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        handle->running_status = LD3320_STATUS_ASR_RUNNING;                                         /* set running */
+        a_ld3320_asr_armed(handle);                                                                 /* save the dead time */
+    }
+    else if(handle->mode == LD3320_MODE_MP3)                                                        /* mp3 mode */
+    {
+        uint8_t volume;
+        
+        handle->asr_configured = 0;                                                                 /* mp3 init drops the asr setup */
+        if (handle->point >= handle->size)                                                          /* check point */
+        {
+            handle->debug_print("ld3320: point is the end.\n");                                     /* point is the end */
+            
+            return 1;                                                                               /* return error */
+        }
+        handle->mp3_irq_count = 0;                                                                  /* clear irq count */
+        handle->mp3_irq_bytes = 0;                                                                  /* clear irq bytes */
+        handle->mp3_last_bytes = 0;                                                                 /* clear last bytes */
+        handle->mp3_total_bytes = 0;                                                                /* clear total bytes */
+        handle->mp3_feed_us = 0;                                                                    /* clear feeding time */
+        res = a_ld3320_mp3_init(handle);                                                            /* mp3 init */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: mp3 init failed.\n");                                      /* mp3 init failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        volume = 5;
+        volume =((15 - volume) & 0x0F) << 2;                                                        /* get register data */
+        res = a_ld3320_write_byte(handle, LD3320_REG_SPEAKER, volume | 0xC3);                       /* set speaker volume */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: set speaker volume failed.\n");                            /* set speaker volume failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);                        /* enable control1 */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: set analog control1 failed.\n");                           /* set analog control1 failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        res = a_ld3320_mp3_load(handle, 1);                                                         /* load data */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: load data failed.\n");                                     /* load data failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        res = a_ld3320_write_sequence(handle, gs_mp3_start_seq,
+                                      sizeof(gs_mp3_start_seq) / sizeof(ld3320_sequence_t));        /* write mp3 start sequence */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("ld3320: write mp3 start sequence failed.\n");                      /* write mp3 start sequence failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        if (handle->timestamp_us != NULL)                                                           /* check timestamp_us */
+        {
+            handle->poll_last_us = handle->timestamp_us();                                          /* the fifo is full */
+        }
+        handle->running_status = LD3320_STATUS_MP3_RUNNING;                                         /* set status */
+    }
+    else
+    {
+        handle->debug_print("ld3320: mode is invalid.\n");                                          /* mode is invalid */
+        
+        return 1;
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     start the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      called in receive_callback, the start is deferred until the callback returns,
+ *            the guard is checked under the lock, so only the thread running the callback is deferred
+ */
+uint8_t ld3320_start(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                         /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                      /* lock failed */
+        
+        return 1;                                                           /* return error */
+    }
+    if (LD3320_ATOMIC_CAS(&handle->callback_guard, 1, 2) != 0)              /* called in the receive callback */
+    {
+        a_ld3320_unlock(handle);                                            /* unlock */
+        
+        return 0;                                                           /* run after the callback returns */
+    }
+    res = a_ld3320_start(handle);                                           /* start */
+    if (handle->start_deferred != 0)                                        /* start called in the callback */
+    {
+        handle->start_deferred = 0;                                         /* clear the flag */
+        if (a_ld3320_start(handle) != 0)                                    /* run the deferred start */
+        {
+            handle->debug_print("ld3320: deferred start failed.\n");        /* deferred start failed */
+            res = 1;                                                        /* set error */
+        }
+    }
+    a_ld3320_unlock(handle);                                                /* unlock */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     run the irq handler and the deferred start
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 4 mode is invalid
+ * @note      the caller holds the lock
+ */
+static uint8_t a_ld3320_irq_run(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    handle->event_service_us = 0;                                           /* clear the service time */
+    if (handle->timestamp_us != NULL)                                       /* check timestamp_us */
+    {
+        handle->event_service_us = handle->timestamp_us();                  /* save the service time */
+    }
+    if (handle->irq_edge_valid != 0)                                        /* edge time is known */
+    {
+        handle->event_edge_us = handle->irq_edge_us;                        /* use the edge time */
+        handle->irq_edge_valid = 0;                                         /* consume it */
+    }
+    else
+    {
+        handle->event_edge_us = handle->event_service_us;                   /* use the service time */
+    }
+    res = a_ld3320_irq_handler(handle);                                     /* run the irq handler */
+    if (handle->start_deferred != 0)                                        /* start called in the callback */
+    {
+        handle->start_deferred = 0;                                         /* clear the flag */
+        if (a_ld3320_start(handle) != 0)                                    /* run the deferred start */
+        {
+            handle->debug_print("ld3320: deferred start failed.\n");        /* deferred start failed */
+            res = 1;                                                        /* set error */
+        }
+    }
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     irq handler
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is invalid
+ * @note      none
+ */
+uint8_t ld3320_irq_handler(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                         /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                      /* lock failed */
+        
+        return 1;                                                           /* return error */
+    }
+    res = a_ld3320_irq_run(handle);                                         /* run the irq handler */
+    a_ld3320_unlock(handle);                                                /* unlock */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     get the next poll interval
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    interval in ms
+ * @note      the caller holds the lock
+ */
+static uint32_t a_ld3320_poll_interval(ld3320_handle_t *handle)
+{
+    uint32_t guard;
+    
+    if ((handle->mode == LD3320_MODE_ASR) && 
+        (handle->running_status == LD3320_STATUS_ASR_RUNNING))                  /* asr waits for the speech */
+    {
+        return LD3320_POLL_ASR_MS;                                              /* relaxed */
+    }
+    if ((handle->mode != LD3320_MODE_MP3) || 
+        ((handle->running_status != LD3320_STATUS_MP3_RUNNING) && 
+         (handle->running_status != LD3320_STATUS_ASR_RUNNING)))                /* nothing is playing */
+    {
+        return LD3320_POLL_IDLE_MS;                                             /* idle */
+    }
+    if (handle->poll_period_ms == 0)                                            /* period is unknown */
+    {
+        guard = handle->poll_elapsed_ms / 2;                                    /* back off while probing */
+        if (guard < LD3320_POLL_MIN_MS)                                         /* check min */
+        {
+            guard = LD3320_POLL_MIN_MS;                                         /* set min */
+        }
+        if (guard > LD3320_POLL_PROBE_MS)                                       /* check max */
+        {
+            guard = LD3320_POLL_PROBE_MS;                                       /* set max */
+        }
+        
+        return guard;                                                           /* probe */
+    }
+    guard = handle->poll_period_ms / 8;                                         /* wake up before the watermark */
+    if (guard < LD3320_POLL_MIN_MS)                                             /* check the guard */
+    {
+        guard = LD3320_POLL_MIN_MS;                                             /* at least one poll */
+    }
+    if (handle->poll_elapsed_ms + guard < handle->poll_period_ms)               /* far from the watermark */
+    {
+        return handle->poll_period_ms - guard - handle->poll_elapsed_ms;        /* sleep until the guard */
+    }
+    guard /= 4;                                                                 /* split the guard */
+    if (guard < LD3320_POLL_MIN_MS)                                             /* check min */
+    {
+        guard = LD3320_POLL_MIN_MS;                                             /* set min */
+    }
+    
+    return guard;                                                               /* near the watermark */
+}
+
+/**
+ * @brief      poll the interrupt flags instead of the irq line
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mode is invalid
+ * @note       for boards without the intb line, call it again after *interval_ms,
+ *             a pending interrupt runs the same path as ld3320_irq_handler
+ */
+uint8_t ld3320_poll(ld3320_handle_t *handle, uint32_t *interval_ms)
+{
+    uint8_t res;
+    uint8_t flag;
+    uint8_t mask;
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                                              /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                                           /* lock failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    res = 0;                                                                                     /* init 0 */
+    if (handle->timestamp_us != NULL)                                                            /* check timestamp_us */
+    {
+        handle->poll_elapsed_ms = (handle->timestamp_us() - handle->poll_last_us) / 1000;        /* measured time */
+    }
+    handle->poll_count++;                                                                        /* poll count++ */
+    if (handle->running_status != LD3320_STATUS_NONE)                                            /* something is running */
+    {
+        mask = (handle->mode == LD3320_MODE_MP3) ? 
+               LD3320_POLL_MP3_FLAG : LD3320_POLL_ASR_FLAG;                                      /* enabled interrupts */
+        res = a_ld3320_read_byte(handle, LD3320_REG_INT_FLAG, (uint8_t *)&flag);                 /* read int flag */
+        if (res != 0)                                                                            /* check result */
+        {
+            handle->debug_print("ld3320: read int flag failed.\n");                              /* read int flag failed */
+            a_ld3320_unlock(handle);                                                             /* unlock */
+            
+            return 1;                                                                            /* return error */
+        }
+        if ((flag & mask) != 0)                                                                  /* interrupt pending */
+        {
+            handle->poll_event_count++;                                                          /* event count++ */
+            if ((handle->poll_period_ms == 0) || 
+                (handle->poll_elapsed_ms < handle->poll_period_ms))                              /* first or shorter period */
+            {
+                handle->poll_period_ms = handle->poll_elapsed_ms;                                /* follow it at once */
+            }
+            else
+            {
+                handle->poll_period_ms = (handle->poll_period_ms * 3 + 
+                                          handle->poll_elapsed_ms) / 4;                          /* grow slowly, it may be late */
+            }
+            res = a_ld3320_irq_run(handle);                                                      /* run the irq path */
+            handle->poll_elapsed_ms = 0;                                                         /* the fifo is refilled */
+            if (handle->timestamp_us != NULL)                                                    /* check timestamp_us */
+            {
+                handle->poll_last_us = handle->timestamp_us();                                   /* save the refill time */
+            }
+        }
+    }
+    *interval_ms = a_ld3320_poll_interval(handle);                                               /* get the next interval */
+    handle->poll_interval_ms = *interval_ms;                                                     /* save the interval */
+    handle->poll_elapsed_ms += *interval_ms;                                                     /* the caller sleeps */
+    a_ld3320_unlock(handle);                                                                     /* unlock */
+    
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief      get the poll statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a poll statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       statistics are cleared by ld3320_start
+ */
+uint8_t ld3320_get_poll_stats(ld3320_handle_t *handle, ld3320_poll_stats_t *stats)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    stats->poll_count = handle->poll_count;                                              /* get poll count */
+    stats->event_count = handle->poll_event_count;                                       /* get event count */
+    stats->wasted_count = handle->poll_count - handle->poll_event_count;                 /* get wasted count */
+    stats->wasted_per_event = (handle->poll_event_count != 0) ? 
+                              ((float)(stats->wasted_count) / 
+                              (float)(handle->poll_event_count)) : 0.0f;                 /* get wasted polls per event */
+    stats->interval_ms = handle->poll_interval_ms;                                       /* get interval */
+    stats->period_ms = handle->poll_period_ms;                                           /* get period */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     start the asr without blocking
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start async failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is not asr
+ * @note      only arms the start, ld3320_step runs it, don't call it in receive_callback
+ */
+uint8_t ld3320_start_async(ld3320_handle_t *handle)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    if (handle->mode != LD3320_MODE_ASR)                               /* check mode */
+    {
+        handle->debug_print("ld3320: mode is not asr.\n");             /* mode is not asr */
+        
+        return 4;                                                      /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                    /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                 /* lock failed */
+        
+        return 1;                                                      /* return error */
+    }
+    a_ld3320_irq_stats_clear(handle);                                  /* clear the irq statistics */
+    a_ld3320_start_begin(handle);                                      /* clear the start statistics */
+    handle->start_warm = a_ld3320_asr_warm(handle);                    /* check the warm rearm */
+    handle->asr_configured = 0;                                        /* unknown until the start ends */
+    if (handle->start_warm != 0)                                       /* warm rearm */
+    {
+        handle->start_seq = LD3320_START_SEQ_ASR_PREPARE;              /* prepare sequence */
+        handle->start_seq_index = 0;                                   /* from the first entry */
+        handle->start_state = LD3320_START_STATE_SEQUENCE;             /* skip the init and key words */
+    }
+    else
+    {
+        handle->start_state = LD3320_START_STATE_SOFT_RESET;           /* first state */
+    }
+    a_ld3320_unlock(handle);                                           /* unlock */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      run the async start until the next sleep
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *delay_ms pointer to a next deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no start in progress
+ * @note       never calls delay_ms, call again after *delay_ms, 0 means the asr is running,
+ *             with timestamp_us linked an early call returns the time left without a bus access
+ */
+uint8_t ld3320_step(ld3320_handle_t *handle, uint32_t *delay_ms)
+{
+    uint8_t res;
+    uint32_t now;
+    uint32_t end;
+    int32_t left;
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                                    /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                                 /* lock failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    if (handle->start_state == LD3320_START_STATE_IDLE)                                /* check the start */
+    {
+        a_ld3320_unlock(handle);                                                       /* unlock */
+        
+        return 4;                                                                      /* return error */
+    }
+    now = 0;                                                                           /* init 0 */
+    if (handle->timestamp_us != NULL)                                                  /* check timestamp_us */
+    {
+        now = handle->timestamp_us();                                                  /* get time */
+        left = (int32_t)(handle->start_deadline_us - now);                             /* time to the deadline */
+        if (left > 0)                                                                  /* too early */
+        {
+            *delay_ms = ((uint32_t)left + 999) / 1000;                                 /* round up */
+            a_ld3320_unlock(handle);                                                   /* unlock */
             
-            return 1;                                                                             /* return error */
+            return 0;                                                                  /* success return 0 */
         }
-        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_STATUS2 , (uint8_t *)&asr_status2);       /* read asr status2 flag */
-        if (res != 0)                                                                             /* check result */
+    }
+    res = a_ld3320_start_run(handle, delay_ms);                                        /* run to the next sleep */
+    handle->start_steps++;                                                             /* steps++ */
+    if (handle->timestamp_us != NULL)                                                  /* check timestamp_us */
+    {
+        end = handle->timestamp_us();                                                  /* get time */
+        if (end - now > handle->start_step_max_us)                                     /* check the longest step */
+        {
+            handle->start_step_max_us = end - now;                                     /* save the longest step */
+        }
+        handle->start_deadline_us = end + (*delay_ms) * 1000;                          /* next deadline */
+    }
+    a_ld3320_unlock(handle);                                                           /* unlock */
+    
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief      get the start statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a start statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       filled by the last asr start, blocking or async, the times need timestamp_us
+ */
+uint8_t ld3320_get_start_stats(ld3320_handle_t *handle, ld3320_start_stats_t *stats)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    for (i = 0; i < 4; i++)                                     /* all phases */
+    {
+        stats->phase_us[i] = handle->start_phase_us[i];         /* get phase time */
+    }
+    stats->total_us = handle->start_total_us;                   /* get total time */
+    stats->steps = handle->start_steps;                         /* get steps */
+    stats->step_max_us = handle->start_step_max_us;             /* get longest step */
+    stats->attempts = handle->start_attempt;                    /* get attempts */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the asr ready deadline
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] ms deadline in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ms is 0
+ * @note      the start fails when the asr status is not ready before the deadline
+ */
+uint8_t ld3320_set_asr_ready_timeout(ld3320_handle_t *handle, uint32_t ms)
+{
+    if (handle == NULL)                                    /* check handle */
+    {
+        return 2;                                          /* return error */
+    }
+    if (handle->inited != 1)                               /* check handle initialization */
+    {
+        return 3;                                          /* return error */
+    }
+    if (ms == 0)                                           /* check ms */
+    {
+        handle->debug_print("ld3320: ms is 0.\n");         /* ms is 0 */
+        
+        return 4;                                          /* return error */
+    }
+    
+    handle->asr_ready_timeout_ms = ms;                     /* set deadline */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the asr ready deadline
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *ms pointer to a deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_asr_ready_timeout(ld3320_handle_t *handle, uint32_t *ms)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    
+    *ms = handle->asr_ready_timeout_ms;              /* get deadline */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the asr ready statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an asr ready statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       cleared by every asr start, without timestamp_us the times only count the sleeps
+ */
+uint8_t ld3320_get_asr_ready_stats(ld3320_handle_t *handle, ld3320_asr_ready_stats_t *stats)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                            /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+    
+    stats->ready_count = handle->asr_ready_count;                  /* get ready count */
+    stats->timeout_count = handle->asr_ready_timeout;              /* get timeout count */
+    stats->spin_count = handle->asr_ready_spin;                    /* get spin count */
+    for (i = 0; i < LD3320_ASR_READY_HIST_SIZE; i++)               /* copy the histogram */
+    {
+        stats->hist[i] = handle->asr_ready_hist[i];                /* get bucket */
+    }
+    stats->total_us = handle->asr_ready_total_us;                  /* get ready time */
+    stats->max_us = handle->asr_ready_max_us;                      /* get max ready time */
+    stats->slack_us = handle->asr_ready_slack_us;                  /* get sleep slack */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set the asr rearm mode
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] rearm asr rearm mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the warm rearm falls back to the full start after a mode or key words change,
+ *            a stop, an error or a failed warm start
+ */
+uint8_t ld3320_set_asr_rearm(ld3320_handle_t *handle, ld3320_asr_rearm_t rearm)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    if (handle->inited != 1)                     /* check handle initialization */
+    {
+        return 3;                                /* return error */
+    }
+    
+    handle->asr_rearm = (uint8_t)rearm;          /* set asr rearm mode */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the asr rearm mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *rearm pointer to an asr rearm mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_asr_rearm(ld3320_handle_t *handle, ld3320_asr_rearm_t *rearm)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    *rearm = (ld3320_asr_rearm_t)(handle->asr_rearm);           /* get asr rearm mode */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the rearm statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a rearm statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the dead time runs from the edge of the asr result irq to the next asr running,
+ *             it needs timestamp_us and is cleared by ld3320_init
+ */
+uint8_t ld3320_get_rearm_stats(ld3320_handle_t *handle, ld3320_rearm_stats_t *stats)
+{
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    stats->warm_count = handle->rearm_warm_count;                                         /* get warm count */
+    stats->warm_avg_us = (handle->rearm_warm_count != 0) ? 
+                         (handle->rearm_warm_us / handle->rearm_warm_count) : 0;          /* get average warm dead time */
+    stats->warm_max_us = handle->rearm_warm_max_us;                                       /* get max warm dead time */
+    stats->full_count = handle->rearm_full_count;                                         /* get full count */
+    stats->full_avg_us = (handle->rearm_full_count != 0) ? 
+                         (handle->rearm_full_us / handle->rearm_full_count) : 0;          /* get average full dead time */
+    stats->full_max_us = handle->rearm_full_max_us;                                       /* get max full dead time */
+    stats->fallback = handle->rearm_fallback;                                             /* get fallback count */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the key word upload statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a key word statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       filled by the last full asr start, the times need timestamp_us
+ */
+uint8_t ld3320_get_key_word_stats(ld3320_handle_t *handle, ld3320_key_word_stats_t *stats)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                          /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    if (handle->inited != 1)                                     /* check handle initialization */
+    {
+        return 3;                                                /* return error */
+    }
+    
+    memset(stats, 0, sizeof(ld3320_key_word_stats_t));           /* clear the statistics */
+    stats->count = handle->key_word_count;                       /* get uploaded count */
+    stats->total_us = handle->key_word_total_us;                 /* get total time */
+    for (i = 0; i < handle->key_word_count; i++)                 /* copy every key word */
+    {
+        stats->word_us[i] = handle->key_word_us[i];              /* get key word time */
+    }
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     init a grammar
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 grammar is NULL
+ * @note      none
+ */
+uint8_t ld3320_grammar_init(ld3320_grammar_t *grammar)
+{
+    if (grammar == NULL)                                 /* check grammar */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    memset(grammar, 0, sizeof(ld3320_grammar_t));        /* clear the grammar */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      add a key word page to the grammar
+ * @param[in]  *grammar pointer to an ld3320 grammar structure
+ * @param[in]  *page pointer to a grammar page structure
+ * @param[out] *index pointer to a page index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 grammar is NULL
+ *             - 4 page is invalid
+ *             - 5 grammar is full
+ * @note       the page is checked once here and kept by reference, every key word must be shorter than LD3320_KEY_WORD_LEN
+ *             and all key words of a page must fit the key word pool
+ */
+uint8_t ld3320_grammar_add_page(ld3320_grammar_t *grammar, const ld3320_grammar_page_t *page, uint8_t *index)
+{
+    if (grammar == NULL)                                                     /* check grammar */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((page == NULL) || (page->len == 0) || 
+        (a_ld3320_key_word_check(page->text, page->len) != 0))               /* check the page */
+    {
+        return 4;                                                            /* return error */
+    }
+    if (grammar->page_num >= LD3320_GRAMMAR_PAGE_MAX)                        /* check the pages */
+    {
+        return 5;                                                            /* return error */
+    }
+    
+    grammar->page[grammar->page_num] = page;                                 /* save the page */
+    *index = grammar->page_num;                                              /* get the index */
+    grammar->page_num++;                                                     /* page num++ */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the global command id of a result
+ * @param[in]  *grammar pointer to an ld3320 grammar structure
+ * @param[in]  page grammar page
+ * @param[in]  index chip result index
+ * @param[out] *id pointer to a command id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 grammar is NULL
+ *             - 4 page or index is invalid
+ * @note       none
+ */
+uint8_t ld3320_grammar_get_id(ld3320_grammar_t *grammar, uint8_t page, uint8_t index, uint16_t *id)
+{
+    if (grammar == NULL)                                                                          /* check grammar */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if ((page >= grammar->page_num) || (index >= grammar->page[page]->len))                       /* check page and index */
+    {
+        return 4;                                                                                 /* return error */
+    }
+    
+    *id = (grammar->page[page]->id != NULL) ? grammar->page[page]->id[index] : index;             /* get id */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     attach a grammar to the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 grammar is invalid
+ * @note      page 0 is loaded, every result switches to the next page before the next start,
+ *            NULL detaches the grammar, ld3320_set_key_words detaches it too
+ */
+uint8_t ld3320_set_grammar(ld3320_handle_t *handle, ld3320_grammar_t *grammar)
+{
+    uint8_t i, j;
+    const ld3320_grammar_page_t *page;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (grammar != NULL)                                                                   /* check grammar */
+    {
+        if (grammar->page_num == 0)                                                        /* check the pages */
         {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: read asr status2 failed.\n");                            /* read asr status2 failed */
+            handle->debug_print("ld3320: grammar is empty.\n");                            /* grammar is empty */
             
-            return 1;                                                                             /* return error */
+            return 4;                                                                      /* return error */
         }
-        if (((flag & 0x10) != 0) && (asr_status == 0x21) && (asr_status2 == 0x35))                /* check flags */
+        for (i = 0; i < grammar->page_num; i++)                                            /* check every link */
         {
-            res = a_ld3320_read_byte(handle, LD3320_REG_INT_AUX , (uint8_t *)&count);             /* read count */
-            if (res != 0)                                                                         /* check result */
+            page = grammar->page[i];                                                       /* get the page */
+            if (page->zero_next >= grammar->page_num)                                      /* check zero next */
             {
-                handle->running_status = LD3320_STATUS_ASR_ERROR;                                 /* set error */
-                handle->debug_print("ld3320: read count failed.\n");                              /* read count failed */
+                handle->debug_print("ld3320: grammar page link is invalid.\n");            /* grammar page link is invalid */
                 
-                return 1;                                                                         /* return error */
-            }
-            if ((count > 0) && (count <= 4))                                                      /* check count */
-            {
-                handle->running_status = LD3320_STATUS_ASR_FOUND_OK;                              /* set ok */
+                return 4;                                                                  /* return error */
             }
-            else
+            for (j = 0; (page->next != NULL) && (j < page->len); j++)                      /* check next pages */
             {
-                handle->running_status = LD3320_STATUS_ASR_FOUND_ZERO;                            /* set zero */
+                if (page->next[j] >= grammar->page_num)                                    /* check next */
+                {
+                    handle->debug_print("ld3320: grammar page link is invalid.\n");        /* grammar page link is invalid */
+                    
+                    return 4;                                                              /* return error */
+                }
             }
         }
-        else
-        {
-            handle->running_status = LD3320_STATUS_ASR_FOUND_ZERO;                                /* set zero */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_INT_FLAG, 0x00);                             /* write int flag */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: write int flag failed.\n");                              /* write int flag failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_ADC_CONF, 0x00);                             /* write adc conf */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: write adc conf failed.\n");                              /* write adc conf failed */
-            
-            return 1;                                                                             /* return error */
-        }
     }
-    else if (handle->mode == LD3320_MODE_MP3)                                                     /* if mp3 mode */
+    
+    if (a_ld3320_lock(handle) != 0)                                                        /* lock */
     {
-        uint8_t reg1;
-        uint8_t reg2;
-        uint8_t status;
+        return 1;                                                                          /* return error */
+    }
+    handle->grammar = grammar;                                                             /* attach the grammar */
+    if (grammar != NULL)                                                                   /* check grammar */
+    {
+        grammar->pending = 0;                                                              /* no switch */
+        a_ld3320_grammar_load(handle, 0);                                                  /* load the first page */
+    }
+    a_ld3320_unlock(handle);                                                               /* unlock */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     select the grammar page
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] page grammar page
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 no grammar
+ *            - 5 page is invalid
+ *            - 6 asr is running
+ * @note      the page runs from the next start,
+ *            the key words can't change while the asr is running, so stop the asr first
+ */
+uint8_t ld3320_grammar_select(ld3320_handle_t *handle, uint8_t page)
+{
+    if (handle == NULL)                                                                             /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    if (handle->grammar == NULL)                                                                    /* check grammar */
+    {
+        handle->debug_print("ld3320: no grammar.\n");                                               /* no grammar */
         
-        res = a_ld3320_read_byte(handle, LD3320_REG_INT_FLAG, (uint8_t *)&flag);                  /* read int flag */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: read int flag failed.\n");                               /* read int flag failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_read_byte(handle, LD3320_REG_INT_CONF, (uint8_t *)&reg1);                  /* read int conf */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
-            handle->debug_print("ld3320: read int conf failed.\n");                               /* read int conf failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_read_byte(handle, LD3320_REG_FIFO_INT_CONF, (uint8_t *)&reg2);             /* read fifo int conf */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
-            handle->debug_print("ld3320: read fifo int conf failed.\n");                          /* read fifo int conf failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x00);                             /* write int conf */
-        if (res != 0)                                                                             /* check result */
-        {
-            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
-            handle->debug_print("ld3320: write int conf failed.\n");                              /* write int conf failed */
-            
-            return 1;                                                                             /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, 0x00);                        /* write fifo int conf */
-        if (res != 0)                                                                             /* check result */
+        return 4;                                                                                   /* return error */
+    }
+    if (page >= handle->grammar->page_num)                                                          /* check page */
+    {
+        handle->debug_print("ld3320: page is invalid.\n");                                          /* page is invalid */
+        
+        return 5;                                                                                   /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                                                 /* lock */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    if (handle->running_status == LD3320_STATUS_ASR_RUNNING)                                        /* check running status */
+    {
+        handle->debug_print("ld3320: asr is running.\n");                                           /* asr is running */
+        a_ld3320_unlock(handle);                                                                    /* unlock */
+        
+        return 6;                                                                                   /* return error */
+    }
+    if (page != handle->grammar->active)                                                            /* page changed */
+    {
+        a_ld3320_grammar_load(handle, page);                                                        /* load the page */
+        handle->grammar->pending = 1;                                                               /* wait for the start */
+        handle->grammar->switch_begin_us = (handle->timestamp_us != NULL) ? 
+                                           handle->timestamp_us() : 0;                              /* from now */
+    }
+    a_ld3320_unlock(handle);                                                                        /* unlock */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the grammar statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a grammar statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no grammar
+ * @note       the switch latency runs from the edge of the result irq to the asr running on the new page
+ */
+uint8_t ld3320_get_grammar_stats(ld3320_handle_t *handle, ld3320_grammar_stats_t *stats)
+{
+    ld3320_grammar_t *grammar;
+    
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (handle->grammar == NULL)                                                        /* check grammar */
+    {
+        return 4;                                                                       /* return error */
+    }
+    
+    grammar = handle->grammar;                                                          /* get grammar */
+    stats->page = grammar->active;                                                      /* get active page */
+    stats->switch_count = grammar->switch_count;                                        /* get switch count */
+    stats->stay_count = grammar->stay_count;                                            /* get stay count */
+    stats->switch_avg_us = (grammar->switch_count != 0) ? 
+                           (grammar->switch_us / grammar->switch_count) : 0;            /* get average latency */
+    stats->switch_max_us = grammar->switch_max_us;                                      /* get max latency */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     deinit the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 4 gpio deinit failed
+ *            - 5 spi deinit failed
+ *            - 6 mp3 deinit failed
+ * @note      the caller holds the lock
+ */
+static uint8_t a_ld3320_deinit(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle->mode == LD3320_MODE_ASR)                                 /* asr mode */
+    {
+        res = a_ld3320_reset(handle);                                    /* reset handle */
+        if (res != 0)                                                    /* check result */
         {
-            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
-            handle->debug_print("ld3320: write fifo int conf failed.\n");                         /* write fifo int conf failed */
+            handle->debug_print("ld3320: reset failed.\n");              /* reset failed */
             
-            return 1;                                                                             /* return error */
+            return 1;                                                    /* return error */
         }
-        res = a_ld3320_read_byte(handle, LD3320_REG_INT_AUX, (uint8_t *)&status);                 /* read status */
-        if (res != 0)                                                                             /* check result */
+        res = handle->reset_gpio_deinit(handle->context);                /* deinit */
+        if (res != 0)                                                    /* check result */
         {
-            handle->running_status = LD3320_STATUS_MP3_ERROR;                                     /* set mp3 error */
-            handle->debug_print("ld3320: read status failed.\n");                                 /* read status failed */
+            handle->debug_print("ld3320: gpio deinit failed.\n");        /* gpio deinit failed */
             
-            return 1;                                                                             /* return error */
+            return 4;                                                    /* return error */
         }
-        if ((status & 0x20) != 0)                                                                 /* check the status */
-        {
-            res = a_ld3320_write_byte(handle, LD3320_REG_INT_FLAG , 0x00);                        /* write int conf */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: write int conf failed.\n");                          /* write int conf failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_INT_AUX, 0x00);                          /* write int aux */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: write int aux failed.\n");                           /* write int aux failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_ASR_FORCE_STOP, 0x00);                   /* asr force stop */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: asr force stop failed.\n");                          /* asr force stop failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            handle->point = 0;                                                                    /* set zero */
-            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x01);                       /* clear fifo */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: clear fifo failed.\n");                              /* clear fifo failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_CLEAR, 0x00);                       /* clear fifo */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: clear fifo failed.\n");                              /* clear fifo failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_MP3_CONF, 0x00);                         /* set mp3 conf */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: mp3 conf failed.\n");                                /* mp3 conf failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            handle->running_status = LD3320_STATUS_MP3_END;                                       /* set end */
+        res = handle->spi_deinit(handle->context);                       /* spi deinit */
+        if (res != 0)                                                    /* check result */
+        {
+            handle->debug_print("ld3320: spi deinit failed.\n");         /* spi deinit failed */
+            
+            return 5;                                                    /* return error */
         }
-        else if (handle->point >= handle->size &&
-                 handle->running_status == LD3320_STATUS_ASR_RUNNING)                             /* check size */
+    }
+    else if (handle->mode == LD3320_MODE_MP3)                            /* mp3 mode */
+    {
+        res = a_ld3320_reset(handle);                                    /* reset handle */
+        if (res != 0)                                                    /* check result */
         {
-            res = a_ld3320_write_byte(handle, LD3320_REG_ASR_FORCE_STOP, 0x01);                   /* set asr force stop */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: asr force stop failed.\n");                          /* asr force stop failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x10);                         /* set int conf */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: set int conf failed.\n");                            /* set int conf failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            handle->running_status = LD3320_STATUS_MP3_END;                                       /* set end */
+            handle->debug_print("ld3320: reset failed.\n");              /* reset failed */
+            
+            return 1;                                                    /* return error */
         }
-        else
+        res = handle->reset_gpio_deinit(handle->context);                /* deinit */
+        if (res != 0)                                                    /* check result */
         {
-            res = a_ld3320_mp3_load(handle);                                                      /* mp3 load */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: mp3 load failed.\n");                                /* mp3 load failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, reg1);                         /* write int conf */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: write int conf failed.\n");                          /* write int conf failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, reg2);                    /* write fifo int conf */
-            if (res != 0)                                                                         /* check result */
-            {
-                handle->running_status = LD3320_STATUS_MP3_ERROR;                                 /* set mp3 error */
-                handle->debug_print("ld3320: write fifo int conf failed.\n");                     /* write fifo int conf failed */
-                
-                return 1;                                                                         /* return error */
-            }
-            handle->running_status = LD3320_STATUS_MP3_LOAD;                                      /* set load */
+            handle->debug_print("ld3320: gpio deinit failed.\n");        /* gpio deinit failed */
+            
+            return 4;                                                    /* return error */
+        }
+        res = handle->spi_deinit(handle->context);                       /* spi deinit */
+        if (res != 0)                                                    /* check result */
+        {
+            handle->debug_print("ld3320: spi deinit failed.\n");         /* spi deinit failed */
+            
+            return 5;                                                    /* return error */
+        }
+        res = handle->mp3_read_deinit(handle->context);                  /* close */
+        if (res != 0)                                                    /* check result */
+        {
+            handle->debug_print("ld3320: mp3 deinit failed.\n");         /* deinit failed */
+            
+            return 6;                                                    /* return error */
         }
     }
-    else                                                                                          /* unknown mode */
+    else                                                                 /* invalid mode */
     {
-        handle->debug_print("ld3320: mode is invalid.\n");                                        /* mode is invalid failed */
-       
-        return 4;                                                                                 /* return error */
+        handle->debug_print("ld3320: mode is invalid.\n");               /* mode is invalid */
+        
+        return 1;                                                        /* return error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     deinit the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 gpio deinit failed
+ *            - 5 spi deinit failed
+ *            - 6 mp3 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_deinit(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
     }
-    if (handle->running_status == LD3320_STATUS_ASR_FOUND_OK)                                     /* asr ok */
+    if (handle->inited != 1)                                  /* check handle initialization */
     {
-        handle->running_status = LD3320_STATUS_NONE;                                              /* clear status */
-        res = a_ld3320_read_byte(handle, LD3320_REG_ASR_RES_1 , (uint8_t *)&i);                   /* read asr index */
-        if (res != 0)                                                                             /* check result */
+        return 3;                                             /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                           /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");        /* lock failed */
+        
+        return 1;                                             /* return error */
+    }
+    res = a_ld3320_deinit(handle);                            /* deinit */
+    a_ld3320_unlock(handle);                                  /* unlock */
+    
+    return res;                                               /* return the result */
+}
+
+/**
+ * @brief     stop the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the caller holds the lock
+ */
+static uint8_t a_ld3320_stop(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle->mode == LD3320_MODE_ASR)                            /* asr mode */
+    {
+        res = a_ld3320_reset(handle);                               /* reset handle */
+        if (res != 0)                                               /* check result */
         {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: read asr index failed.\n");                              /* read asr index failed */
+            handle->debug_print("ld3320: reset failed.\n");         /* reset failed */
             
-            return 1;                                                                             /* return error */
+            return 1;                                               /* return error */
         }
-        if (i >= handle->len)                                                                     /* check index */
+    }
+    else if (handle->mode == LD3320_MODE_MP3)                       /* mp3 mode */
+    {
+        res = a_ld3320_reset(handle);                               /* reset handle */
+        if (res != 0)                                               /* check result */
         {
-            handle->running_status = LD3320_STATUS_ASR_ERROR;                                     /* set error */
-            handle->debug_print("ld3320: index is invalid.\n");                                   /* index is invalid */
+            handle->debug_print("ld3320: reset failed.\n");         /* reset failed */
             
-            return 1;                                                                             /* return error */
+            return 1;                                               /* return error */
         }
-        handle->receive_callback(LD3320_STATUS_ASR_FOUND_OK, i, handle->text[i]);                 /* run callback */
     }
-    else if (handle->running_status == LD3320_STATUS_ASR_FOUND_ZERO)                              /* asr zero */
+    else                                                            /* invalid mode */
+    {
+        handle->debug_print("ld3320: mode is invalid.\n");          /* mode is invalid */
+        
+        return 1;                                                   /* return error */
+    }
+    
+    handle->running_status = LD3320_STATUS_NONE;                    /* set status none */
+    handle->start_state = LD3320_START_STATE_IDLE;                  /* abort the async start */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     stop the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_stop(ld3320_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    if (handle->inited != 1)                                  /* check handle initialization */
+    {
+        return 3;                                             /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                           /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");        /* lock failed */
+        
+        return 1;                                             /* return error */
+    }
+    res = a_ld3320_stop(handle);                              /* stop */
+    a_ld3320_unlock(handle);                                  /* unlock */
+    
+    return res;                                               /* return the result */
+}
+
+/**
+ * @brief     set the speaker volume
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] volume speaker volume
+ * @return    status code
+ *            - 0 success
+ *            - 1 set speaker volume
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 volume is invalid
+ * @note      volume <= 15
+ */
+uint8_t ld3320_set_speaker_volume(ld3320_handle_t *handle, uint8_t volume)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    if (volume > 15)                                                            /* check volume */
+    {
+        handle->debug_print("ld3320: volume is invalid.\n");                    /* volume is invalid */
+        
+        return 4;                                                               /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                                             /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                          /* lock failed */
+        
+        return 1;                                                               /* return error */
+    }
+    volume =((15 - volume) & 0x0F) << 2;                                        /* get register data */
+    res = a_ld3320_write_byte(handle, LD3320_REG_SPEAKER, volume | 0xC3);       /* set speaker volume */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("ld3320: set speaker volume failed.\n");            /* set speaker volume failed */
+        a_ld3320_unlock(handle);                                                /* unlock */
+        
+        return 1;                                                               /* return error */
+    }
+    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);        /* enable control1 */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("ld3320: set analog control1 failed.\n");           /* set analog control1 failed */
+        a_ld3320_unlock(handle);                                                /* unlock */
+        
+        return 1;                                                               /* return error */
+    }
+    a_ld3320_unlock(handle);                                                    /* unlock */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the speaker volume
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *volume pointer to a speaker volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get speaker volume
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_speaker_volume(ld3320_handle_t *handle, uint8_t *volume)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                     /* check handle */
     {
-        handle->running_status = LD3320_STATUS_NONE;                                              /* clear status */
-        handle->receive_callback(LD3320_STATUS_ASR_FOUND_ZERO, 0, NULL);                          /* run the callback */
+        return 2;                                                           /* return error */
     }
-    else if (handle->running_status == LD3320_STATUS_MP3_END)                                     /* mp3 end */
+    if (handle->inited != 1)                                                /* check handle initialization */
     {
-        handle->running_status = LD3320_STATUS_NONE;                                              /* clear status */
-        handle->receive_callback(LD3320_STATUS_MP3_END, 0, NULL);                                 /* run the callback */
+        return 3;                                                           /* return error */
     }
-    else if (handle->running_status == LD3320_STATUS_MP3_LOAD)                                    /* mp3 load */
+
+    if (a_ld3320_lock(handle) != 0)                                         /* lock */
     {
-        handle->running_status = LD3320_STATUS_ASR_RUNNING;                                       /* clear status */
-        handle->receive_callback(LD3320_STATUS_MP3_LOAD, 0, NULL);                                /* run the callback */
+        handle->debug_print("ld3320: lock failed.\n");                      /* lock failed */
+        
+        return 1;                                                           /* return error */
     }
-    else
+    res = a_ld3320_read_byte(handle, LD3320_REG_SPEAKER, volume);           /* get speaker volume */
+    if (res != 0)                                                           /* check result */
     {
-        handle->debug_print("ld3320: unknown status.\n");                                         /* unknown status failed */
-            
-        return 1;                                                                                 /* return error */
+        handle->debug_print("ld3320: get speaker volume failed.\n");        /* get speaker volume failed */
+        a_ld3320_unlock(handle);                                            /* unlock */
+        
+        return 1;                                                           /* return error */
     }
+    *volume = (*volume) >> 2;                                               /* set volume */
+    *volume = (*volume) & 0xF;                                              /* set volume */
+    *volume = 15 - (*volume);                                               /* set volume */
+    a_ld3320_unlock(handle);                                                /* unlock */
     
-    return 0;                                                                                     /* success return 0 */
+    return 0;                                                               /* success return 0 */
 }
 
 /**
- * @brief     start the process
+ * @brief     set the headset volume
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] volume_left left volume
+ * @param[in] volume_right right volume
  * @return    status code
  *            - 0 success
- *            - 1 start failed
+ *            - 1 set headset volume
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 volume is invalid
  * @note      none
  */
-uint8_t ld3320_start(ld3320_handle_t *handle)
+uint8_t ld3320_set_headset_volume(ld3320_handle_t *handle, uint8_t volume_left, uint8_t volume_right)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                          /* check handle */
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (volume_left > 15)                                                                   /* check volume_left */
     {
-        return 2;                                                                /* return error */
+        handle->debug_print("ld3320: volume left is invalid.\n");                           /* volume left is invalid */
+        
+        return 4;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                     /* check handle initialization */
+    if (volume_right > 15)                                                                  /* check volume_right */
     {
-        return 3;                                                                /* return error */
+        handle->debug_print("ld3320: volume right is invalid.\n");                          /* volume right is invalid */
+        
+        return 4;                                                                           /* return error */
     }
     
-    if (handle->mode == LD3320_MODE_ASR)                                         /* asr mode */
+    if (a_ld3320_lock(handle) != 0)                                                         /* lock */
     {
-        res = a_ld3320_run_asr(handle);                                          /* run asr */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: run adr failed.\n");                    /* run receive callback failed */
-            
-            return 1;                                                            /* return error */
-        }
-        handle->running_status = LD3320_STATUS_ASR_RUNNING;                      /* set running */
+        handle->debug_print("ld3320: lock failed.\n");                                      /* lock failed */
+        
+        return 1;                                                                           /* return error */
     }
-    else if(handle->mode == LD3320_MODE_MP3)                                     /* mp3 mode */
+    volume_left =((15 - volume_left) & 0x0F) << 2;                                          /* get register data */
+    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_LEFT, volume_left | 0xC3);         /* set headset left volume */
+    if (res != 0)                                                                           /* check result */
     {
-        uint8_t volume;
+        handle->debug_print("ld3320: set headset left failed.\n");                          /* set headset left failed */
+        a_ld3320_unlock(handle);                                                            /* unlock */
         
-        if (handle->point >= handle->size)                                       /* check point */
-        {
-            handle->debug_print("ld3320: point is the end.\n");                  /* point is the end */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_mp3_init(handle);                                         /* mp3 init */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: mp3 init failed.\n");                   /* mp3 init failed */
-            
-            return 1;                                                            /* return error */
-        }
-        volume = 5;
-        volume =((15 - volume) & 0x0F) << 2;                                     /* get register data */
-        res = a_ld3320_write_byte(handle, LD3320_REG_SPEAKER, volume | 0xC3);    /* set speaker volume */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set speaker volume failed.\n");         /* set speaker volume failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);     /* enable control1 */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set analog control1 failed.\n");        /* set analog control1 failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_mp3_load(handle);                                         /* load data */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: load data failed.\n");                  /* load data failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_INT_AUX, 0x00);             /* write int aux */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set int aux failed.\n");                /* set int aux failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_CMD, 0x48);                 /* write command */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set command failed.\n");                /* set command failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_MP3_CONF, 0x01);            /* set mp3 conf */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set mp3 conf failed.\n");               /* set mp3 conf failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_INT_CONF, 0x04);            /* set int conf */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set int conf failed.\n");               /* set int conf failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_FIFO_INT_CONF, 0x01);       /* set fifo int conf */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set fifo int conf failed.\n");          /* set fifo int conf failed */
-            
-            return 1;                                                            /* return error */
-        }
-        res = a_ld3320_write_byte(handle, LD3320_REG_FEEDBACK, 0x5A);            /* set feedback */
-        if (res != 0)                                                            /* check result */
-        {
-            handle->debug_print("ld3320: set feedback failed.\n");               /* set feedback failed */
-            
-            return 1;                                                            /* return error */
-        }
-        handle->running_status = LD3320_STATUS_MP3_RUNNING;                      /* set status */
+        return 1;                                                                           /* return error */
     }
-    else
+    volume_right =((15 - volume_right) & 0x0F) << 2;                                        /* get register data */
+    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_RIGHT, volume_right | 0xC3);       /* set headset right volume */
+    if (res != 0)                                                                           /* check result */
     {
-        handle->debug_print("ld3320: mode is invalid.\n");                       /* mode is invalid */
+        handle->debug_print("ld3320: set headset right failed.\n");                         /* set headset right failed */
+        a_ld3320_unlock(handle);                                                            /* unlock */
         
-        return 1;
+        return 1;                                                                           /* return error */
+    }
+    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);                    /* enable control1 */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("ld3320: set analog control1 failed.\n");                       /* set analog control1 failed */
+        a_ld3320_unlock(handle);                                                            /* unlock */
+        
+        return 1;                                                                           /* return error */
     }
+    a_ld3320_unlock(handle);                                                                /* unlock */
     
-    return 0;                                                                    /* success return 0 */
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief     deinit the chip
- * @param[in] *handle pointer to an ld3320 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 deinit failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 gpio deinit failed
- *            - 5 spi deinit failed
- *            - 6 mp3 deinit failed
- * @note      none
+ * @brief      get the headset volume
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *volume_left pointer to a left volume buffer
+ * @param[out] *volume_right pointer to a right volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get headset volume
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t ld3320_deinit(ld3320_handle_t *handle)
+uint8_t ld3320_get_headset_volume(ld3320_handle_t *handle, uint8_t *volume_left, uint8_t *volume_right)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                  /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                        /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                             /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                        /* return error */
+        return 3;                                                                   /* return error */
     }
     
-    if (handle->mode == LD3320_MODE_ASR)                                 /* asr mode */
+    if (a_ld3320_lock(handle) != 0)                                                 /* lock */
     {
-        res = a_ld3320_reset(handle);                                    /* reset handle */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: reset failed.\n");              /* reset failed */
-            
-            return 1;                                                    /* return error */
-        }
-        res = handle->reset_gpio_deinit();                               /* deinit */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: gpio deinit failed.\n");        /* gpio deinit failed */
-            
-            return 4;                                                    /* return error */
-        }
-        res = handle->spi_deinit();                                      /* spi deinit */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: spi deinit failed.\n");         /* spi deinit failed */
-            
-            return 5;                                                    /* return error */
-        }
+        handle->debug_print("ld3320: lock failed.\n");                              /* lock failed */
+        
+        return 1;                                                                   /* return error */
     }
-    else if (handle->mode == LD3320_MODE_MP3)                            /* mp3 mode */
+    res = a_ld3320_read_byte(handle, LD3320_REG_HEADSET_LEFT, volume_left);         /* get headset left volume */
+    if (res != 0)                                                                   /* check result */
     {
-        res = a_ld3320_reset(handle);                                    /* reset handle */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: reset failed.\n");              /* reset failed */
-            
-            return 1;                                                    /* return error */
-        }
-        res = handle->reset_gpio_deinit();                               /* deinit */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: gpio deinit failed.\n");        /* gpio deinit failed */
-            
-            return 4;                                                    /* return error */
-        }
-        res = handle->spi_deinit();                                      /* spi deinit */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: spi deinit failed.\n");         /* spi deinit failed */
-            
-            return 5;                                                    /* return error */
-        }
-        res = handle->mp3_read_deinit();                                 /* close */
-        if (res != 0)                                                    /* check result */
-        {
-            handle->debug_print("ld3320: mp3 deinit failed.\n");         /* deinit failed */
-            
-            return 6;                                                    /* return error */
-        }
+        handle->debug_print("ld3320: get headset left failed.\n");                  /* get headset left failed */
+        a_ld3320_unlock(handle);                                                    /* unlock */
+        
+        return 1;                                                                   /* return error */
     }
-    else                                                                 /* invalid mode */
+
+    res = a_ld3320_read_byte(handle, LD3320_REG_HEADSET_RIGHT, volume_right);       /* get headset right volume */
+    if (res != 0)                                                                   /* check result */
     {
-        handle->debug_print("ld3320: mode is invalid.\n");               /* mode is invalid */
+        handle->debug_print("ld3320: get headset right failed.\n");                 /* get headset right failed */
+        a_ld3320_unlock(handle);                                                    /* unlock */
         
-        return 1;                                                        /* return error */
+        return 1;                                                                   /* return error */
     }
+    *volume_left = (*volume_left) >> 2;                                             /* set left volume */
+    *volume_left = (*volume_left) & 0xF;                                            /* set left volume */
+    *volume_left = 15 - (*volume_left);                                             /* set left volume */
+    *volume_right = (*volume_right) >> 2;                                           /* set right volume */
+    *volume_right = (*volume_right) & 0xF;                                          /* set right volume */
+    *volume_right = 15 - (*volume_right);                                           /* set right volume */
+    a_ld3320_unlock(handle);                                                        /* unlock */
     
-    return 0;                                                            /* success return 0 */
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief     stop the process
+ * @brief     set the mp3 feed mode
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] mode mp3 feed mode
  * @return    status code
  *            - 0 success
- *            - 1 stop failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t ld3320_stop(ld3320_handle_t *handle)
+uint8_t ld3320_set_mp3_feed_mode(ld3320_handle_t *handle, ld3320_mp3_feed_mode_t mode)
 {
-    uint8_t res;
+    if (handle == NULL)                           /* check handle */
+    {
+        return 2;                                 /* return error */
+    }
+    if (handle->inited != 1)                      /* check handle initialization */
+    {
+        return 3;                                 /* return error */
+    }
+    
+    handle->mp3_feed_mode = (uint8_t)mode;        /* set mp3 feed mode */
     
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the mp3 feed mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *mode pointer to an mp3 feed mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_mp3_feed_mode(ld3320_handle_t *handle, ld3320_mp3_feed_mode_t *mode)
+{
     if (handle == NULL)                                             /* check handle */
     {
         return 2;                                                   /* return error */
@@ -1968,237 +5318,355 @@ uint8_t ld3320_stop(ld3320_handle_t *handle)
         return 3;                                                   /* return error */
     }
     
-    if (handle->mode == LD3320_MODE_ASR)                            /* asr mode */
-    {
-        res = a_ld3320_reset(handle);                               /* reset handle */
-        if (res != 0)                                               /* check result */
-        {
-            handle->debug_print("ld3320: reset failed.\n");         /* reset failed */
-            
-            return 1;                                               /* return error */
-        }
-    }
-    else if (handle->mode == LD3320_MODE_MP3)                       /* mp3 mode */
-    {
-        res = a_ld3320_reset(handle);                               /* reset handle */
-        if (res != 0)                                               /* check result */
-        {
-            handle->debug_print("ld3320: reset failed.\n");         /* reset failed */
-            
-            return 1;                                               /* return error */
-        }
-    }
-    else                                                            /* invalid mode */
+    *mode = (ld3320_mp3_feed_mode_t)(handle->mp3_feed_mode);        /* get mp3 feed mode */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the mp3 feed statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an mp3 statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       statistics are cleared by ld3320_start in the mp3 mode
+ */
+uint8_t ld3320_get_mp3_stats(ld3320_handle_t *handle, ld3320_mp3_stats_t *stats)
+{
+    if (handle == NULL)                                                                      /* check handle */
     {
-        handle->debug_print("ld3320: mode is invalid.\n");          /* mode is invalid */
-        
-        return 1;                                                   /* return error */
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
     }
     
-    return 0;                                                       /* success return 0 */
+    stats->irq_count = handle->mp3_irq_count;                                                /* get irq count */
+    stats->total_bytes = handle->mp3_total_bytes;                                            /* get total bytes */
+    stats->last_bytes = handle->mp3_last_bytes;                                              /* get last bytes */
+    stats->bytes_per_irq = (handle->mp3_irq_count != 0) ? 
+                           (handle->mp3_irq_bytes / handle->mp3_irq_count) : 0;             /* get average bytes */
+    stats->feed_us = handle->mp3_feed_us;                                                    /* get feeding time */
+    stats->kbps = (handle->mp3_feed_us != 0) ? 
+                  ((float)(handle->mp3_total_bytes) * 8000.0f / 
+                  (float)(handle->mp3_feed_us)) : 0.0f;                                      /* get kbit/s */
+    
+    return 0;                                                                                /* success return 0 */
 }
 
 /**
- * @brief     set the speaker volume
+ * @brief     enable or disable the register cache
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] volume speaker volume
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set speaker volume
+ *            - 1 lock failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 volume is invalid
- * @note      volume <= 15
+ *            - 4 register cache is not compiled in
+ * @note      the cache content and counters are cleared,
+ *            enabling needs LD3320_REGISTER_CACHE_ENABLE
  */
-uint8_t ld3320_set_speaker_volume(ld3320_handle_t *handle, uint8_t volume)
+uint8_t ld3320_set_register_cache(ld3320_handle_t *handle, ld3320_bool_t enable)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                         /* check handle */
-    {
-        return 2;                                                               /* return error */
-    }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 3;                                                               /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (volume > 15)                                                            /* check volume */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        handle->debug_print("ld3320: volume is invalid.\n");                    /* volume is invalid */
-        
-        return 4;                                                               /* return error */
+        return 3;                                                                   /* return error */
     }
     
-    volume =((15 - volume) & 0x0F) << 2;                                        /* get register data */
-    res = a_ld3320_write_byte(handle, LD3320_REG_SPEAKER, volume | 0xC3);       /* set speaker volume */
-    if (res != 0)                                                               /* check result */
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    if (a_ld3320_lock(handle) != 0)                                                 /* lock */
     {
-        handle->debug_print("ld3320: set speaker volume failed.\n");            /* set speaker volume failed */
-        
-        return 1;                                                               /* return error */
+        return 1;                                                                   /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);        /* enable control1 */
-    if (res != 0)                                                               /* check result */
+    a_ld3320_cache_invalidate(handle);                                              /* invalidate the cache */
+    handle->cache_hit = 0;                                                          /* clear cache hit */
+    handle->cache_miss = 0;                                                         /* clear cache miss */
+    handle->cache_enable = (uint8_t)enable;                                         /* set the cache */
+    a_ld3320_unlock(handle);                                                        /* unlock */
+#else
+    if (enable != LD3320_BOOL_FALSE)                                                /* check enable */
     {
-        handle->debug_print("ld3320: set analog control1 failed.\n");           /* set analog control1 failed */
+        handle->debug_print("ld3320: register cache is not compiled in.\n");        /* register cache is not compiled in */
         
-        return 1;                                                               /* return error */
+        return 4;                                                                   /* return error */
     }
+#endif
     
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief      get the speaker volume
+ * @brief      get the register cache status
  * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *volume pointer to a speaker volume buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get speaker volume
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       always false without LD3320_REGISTER_CACHE_ENABLE
  */
-uint8_t ld3320_get_speaker_volume(ld3320_handle_t *handle, uint8_t *volume)
+uint8_t ld3320_get_register_cache(ld3320_handle_t *handle, ld3320_bool_t *enable)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                                     /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                                           /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)                                /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                                           /* return error */
     }
+    
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    *enable = (ld3320_bool_t)(handle->cache_enable);        /* get the cache */
+#else
+    *enable = LD3320_BOOL_FALSE;                            /* no cache */
+#endif
+    
+    return 0;                                               /* success return 0 */
+}
 
-    res = a_ld3320_read_byte(handle, LD3320_REG_SPEAKER, volume);           /* get speaker volume */
-    if (res != 0)                                                           /* check result */
+/**
+ * @brief      get the register cache statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *hit pointer to a hit count buffer
+ * @param[out] *miss pointer to a miss count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a hit is a bus read or write that was saved by the cache,
+ *             both are 0 without LD3320_REGISTER_CACHE_ENABLE
+ */
+uint8_t ld3320_get_register_cache_stats(ld3320_handle_t *handle, uint32_t *hit, uint32_t *miss)
+{
+    if (handle == NULL)             /* check handle */
     {
-        handle->debug_print("ld3320: get speaker volume failed.\n");        /* get speaker volume failed */
-        
-        return 1;                                                           /* return error */
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
     }
-    *volume = (*volume) >> 2;                                               /* set volume */
-    *volume = (*volume) & 0xF;                                              /* set volume */
-    *volume = 15 - (*volume);                                               /* set volume */
     
-    return 0;                                                               /* success return 0 */
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    *hit = handle->cache_hit;       /* get hit count */
+    *miss = handle->cache_miss;     /* get miss count */
+#else
+    *hit = 0;                       /* no cache */
+    *miss = 0;                      /* no cache */
+#endif
+    
+    return 0;                       /* success return 0 */
 }
 
 /**
- * @brief     set the headset volume
- * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] volume_left left volume
- * @param[in] volume_right right volume
- * @return    status code
- *            - 0 success
- *            - 1 set headset volume
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 volume is invalid
- * @note      none
+ * @brief      calibrate the spi clock
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  min_hz min spi clock in hz
+ * @param[in]  max_hz max spi clock in hz
+ * @param[out] *clock_hz pointer to a calibrated spi clock buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 calibrate spi clock failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 spi_set_clock is null
+ *             - 5 chip is running
+ * @note       the clock is doubled from min_hz up to max_hz and every step is verified by
+ *             write and read back patterns on the asr string length register,
+ *             the applied clock is the highest stable clock scaled by LD3320_SPI_CLOCK_MARGIN,
+ *             if the calibration fails after the min clock is set, the bus is left at min_hz
  */
-uint8_t ld3320_set_headset_volume(ld3320_handle_t *handle, uint8_t volume_left, uint8_t volume_right)
+uint8_t ld3320_calibrate_spi_clock(ld3320_handle_t *handle, uint32_t min_hz, uint32_t max_hz, uint32_t *clock_hz)
 {
-    uint8_t res;
+    uint8_t len;
+    uint32_t hz;
+    uint32_t best;
     
-    if (handle == NULL)                                                                     /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                                                                           /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                                                                           /* return error */
+        return 3;                                                                         /* return error */
     }
-    if (volume_left > 15)                                                                   /* check volume_left */
+    if (handle->spi_set_clock == NULL)                                                    /* check spi_set_clock */
     {
-        handle->debug_print("ld3320: volume left is invalid.\n");                           /* volume left is invalid */
+        handle->debug_print("ld3320: spi_set_clock is null.\n");                          /* spi_set_clock is null */
         
-        return 4;                                                                           /* return error */
+        return 4;                                                                         /* return error */
     }
-    if (volume_right > 15)                                                                  /* check volume_right */
+    if ((min_hz == 0) || (min_hz > max_hz))                                               /* check the range */
     {
-        handle->debug_print("ld3320: volume right is invalid.\n");                          /* volume right is invalid */
+        handle->debug_print("ld3320: clock range is invalid.\n");                         /* clock range is invalid */
         
-        return 4;                                                                           /* return error */
+        return 1;                                                                         /* return error */
     }
     
-    volume_left =((15 - volume_left) & 0x0F) << 2;                                          /* get register data */
-    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_LEFT, volume_left | 0xC3);         /* set headset left volume */
-    if (res != 0)                                                                           /* check result */
+    if (a_ld3320_lock(handle) != 0)                                                       /* lock */
     {
-        handle->debug_print("ld3320: set headset left failed.\n");                          /* set headset left failed */
+        handle->debug_print("ld3320: lock failed.\n");                                    /* lock failed */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                         /* return error */
     }
-    volume_right =((15 - volume_right) & 0x0F) << 2;                                        /* get register data */
-    res = a_ld3320_write_byte(handle, LD3320_REG_HEADSET_RIGHT, volume_right | 0xC3);       /* set headset right volume */
-    if (res != 0)                                                                           /* check result */
+    if ((handle->running_status == LD3320_STATUS_ASR_RUNNING) || 
+        (handle->running_status == LD3320_STATUS_MP3_RUNNING))                            /* check running status */
     {
-        handle->debug_print("ld3320: set headset right failed.\n");                         /* set headset right failed */
+        handle->debug_print("ld3320: chip is running.\n");                                /* chip is running */
+        a_ld3320_unlock(handle);                                                          /* unlock */
         
-        return 1;                                                                           /* return error */
+        return 5;                                                                         /* return error */
     }
-    res = a_ld3320_write_byte(handle, LD3320_REG_ANALOG_CONTROL1, 0x78);                    /* enable control1 */
-    if (res != 0)                                                                           /* check result */
+    if (handle->spi_set_clock(handle->context, min_hz) != 0)                              /* set min clock */
     {
-        handle->debug_print("ld3320: set analog control1 failed.\n");                       /* set analog control1 failed */
+        handle->debug_print("ld3320: spi set clock failed.\n");                           /* spi set clock failed */
+        a_ld3320_unlock(handle);                                                          /* unlock */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                         /* return error */
+    }
+    handle->spi_clock_hz = min_hz;                                                        /* the bus runs at min clock */
+    if (a_ld3320_read_byte(handle, LD3320_REG_ASR_STR_LEN, &len) != 0)                    /* save the string length */
+    {
+        handle->debug_print("ld3320: read string length failed.\n");                      /* read string length failed */
+        a_ld3320_unlock(handle);                                                          /* unlock */
+        
+        return 1;                                                                         /* return error */
+    }
+    if (a_ld3320_verify_spi(handle) != 0)                                                 /* verify min clock */
+    {
+        handle->debug_print("ld3320: verify min clock failed.\n");                        /* verify min clock failed */
+        (void)a_ld3320_write_byte(handle, LD3320_REG_ASR_STR_LEN, len);                   /* restore the string length */
+        a_ld3320_unlock(handle);                                                          /* unlock */
+        
+        return 1;                                                                         /* return error */
+    }
+    best = min_hz;                                                                        /* min clock is stable */
+    hz = min_hz;                                                                          /* start from min clock */
+    while (hz < max_hz)                                                                   /* step up */
+    {
+        hz = (hz > max_hz / 2) ? max_hz : hz * 2;                                         /* double the clock */
+        if (handle->spi_set_clock(handle->context, hz) != 0)                              /* set the clock */
+        {
+            break;                                                                        /* break */
+        }
+        if (a_ld3320_verify_spi(handle) != 0)                                             /* verify the clock */
+        {
+            break;                                                                        /* break */
+        }
+        best = hz;                                                                        /* save the stable clock */
+    }
+    hz = (uint32_t)(((uint64_t)best * LD3320_SPI_CLOCK_MARGIN) / 100);                    /* apply the margin */
+    if (hz < min_hz)                                                                      /* check min clock */
+    {
+        hz = min_hz;                                                                      /* set min clock */
+    }
+    if ((handle->spi_set_clock(handle->context, hz) != 0) || 
+        (a_ld3320_verify_spi(handle) != 0))                                               /* set and verify */
+    {
+        hz = min_hz;                                                                      /* fall back to min clock */
+        if (handle->spi_set_clock(handle->context, hz) != 0)                              /* set min clock */
+        {
+            handle->debug_print("ld3320: spi set clock failed.\n");                       /* spi set clock failed */
+            a_ld3320_unlock(handle);                                                      /* unlock */
+            
+            return 1;                                                                     /* return error */
+        }
+    }
+    if (a_ld3320_write_byte(handle, LD3320_REG_ASR_STR_LEN, len) != 0)                    /* restore the string length */
+    {
+        handle->debug_print("ld3320: write string length failed.\n");                     /* write string length failed */
+        a_ld3320_unlock(handle);                                                          /* unlock */
+        
+        return 1;                                                                         /* return error */
     }
+    handle->spi_clock_hz = hz;                                                            /* save the clock */
+    *clock_hz = hz;                                                                       /* output the clock */
+    a_ld3320_unlock(handle);                                                              /* unlock */
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief      get the headset volume
- * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *volume_left pointer to a left volume buffer
- * @param[out] *volume_right pointer to a right volume buffer
- * @return     status code
- *             - 0 success
- *             - 1 get headset volume
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     set the spi clock
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] hz spi clock in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 set spi clock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 spi_set_clock is null
+ * @note      used to restore a persisted calibration result
  */
-uint8_t ld3320_get_headset_volume(ld3320_handle_t *handle, uint8_t *volume_left, uint8_t *volume_right)
+uint8_t ld3320_set_spi_clock(ld3320_handle_t *handle, uint32_t hz)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                             /* check handle */
+    if (handle == NULL)                                                 /* check handle */
     {
-        return 2;                                                                   /* return error */
+        return 2;                                                       /* return error */
     }
-    if (handle->inited != 1)                                                        /* check handle initialization */
+    if (handle->inited != 1)                                            /* check handle initialization */
     {
-        return 3;                                                                   /* return error */
+        return 3;                                                       /* return error */
+    }
+    if (handle->spi_set_clock == NULL)                                  /* check spi_set_clock */
+    {
+        handle->debug_print("ld3320: spi_set_clock is null.\n");        /* spi_set_clock is null */
+        
+        return 4;                                                       /* return error */
     }
     
-    res = a_ld3320_read_byte(handle, LD3320_REG_HEADSET_LEFT, volume_left);         /* get headset left volume */
-    if (res != 0)                                                                   /* check result */
+    if (a_ld3320_lock(handle) != 0)                                     /* lock */
     {
-        handle->debug_print("ld3320: get headset left failed.\n");                  /* get headset left failed */
+        handle->debug_print("ld3320: lock failed.\n");                  /* lock failed */
         
-        return 1;                                                                   /* return error */
+        return 1;                                                       /* return error */
     }
-
-    res = a_ld3320_read_byte(handle, LD3320_REG_HEADSET_RIGHT, volume_right);       /* get headset right volume */
-    if (res != 0)                                                                   /* check result */
+    if (handle->spi_set_clock(handle->context, hz) != 0)                /* set the clock */
     {
-        handle->debug_print("ld3320: get headset right failed.\n");                 /* get headset right failed */
+        handle->debug_print("ld3320: spi set clock failed.\n");         /* spi set clock failed */
+        a_ld3320_unlock(handle);                                        /* unlock */
         
-        return 1;                                                                   /* return error */
+        return 1;                                                       /* return error */
     }
-    *volume_left = (*volume_left) >> 2;                                             /* set left volume */
-    *volume_left = (*volume_left) & 0xF;                                            /* set left volume */
-    *volume_left = 15 - (*volume_left);                                             /* set left volume */
-    *volume_right = (*volume_right) >> 2;                                           /* set right volume */
-    *volume_right = (*volume_right) & 0xF;                                          /* set right volume */
-    *volume_right = 15 - (*volume_right);                                           /* set right volume */
+    handle->spi_clock_hz = hz;                                          /* save the clock */
+    a_ld3320_unlock(handle);                                            /* unlock */
     
-    return 0;                                                                       /* success return 0 */
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the spi clock
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *hz pointer to a spi clock buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       0 means the interface default clock
+ */
+uint8_t ld3320_get_spi_clock(ld3320_handle_t *handle, uint32_t *hz)
+{
+    if (handle == NULL)                        /* check handle */
+    {
+        return 2;                              /* return error */
+    }
+    if (handle->inited != 1)                   /* check handle initialization */
+    {
+        return 3;                              /* return error */
+    }
+    
+    *hz = handle->spi_clock_hz;                /* get the clock */
+    
+    return 0;                                  /* success return 0 */
 }
 
 /**
@@ -2225,14 +5693,23 @@ uint8_t ld3320_configure_mp3(ld3320_handle_t *handle, char *name)
         return 3;                                                      /* return error */
     }
     
-    res = handle->mp3_read_init(name, &handle->size);                  /* mp3 read init */
+    if (a_ld3320_lock(handle) != 0)                                    /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");                 /* lock failed */
+        
+        return 1;                                                      /* return error */
+    }
+    res = handle->mp3_read_init(handle->context, 
+                                name, &handle->size);                  /* mp3 read init */
     if (res != 0)                                                      /* check result */
     {
         handle->debug_print("ld3320: mp3 read init failed.\n");        /* mp3 read init failed */
+        a_ld3320_unlock(handle);                                       /* unlock */
         
         return 1;                                                      /* return error */
     }
     handle->point = 0;                                                 /* set point 0 */
+    a_ld3320_unlock(handle);                                           /* unlock */
     
     return 0;                                                          /* success return 0 */
 }
@@ -2247,10 +5724,12 @@ uint8_t ld3320_configure_mp3(ld3320_handle_t *handle, char *name)
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the next asr start runs the full path
  */
 uint8_t ld3320_set_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t data)
 {
+    uint8_t res;
+    
     if (handle == NULL)                                  /* check handle */
     {
         return 2;                                        /* return error */
@@ -2260,7 +5739,17 @@ uint8_t ld3320_set_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t data)
         return 3;                                        /* return error */
     }
     
-    return a_ld3320_write_byte(handle, reg, data);       /* write data */
+    if (a_ld3320_lock(handle) != 0)                      /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");   /* lock failed */
+        
+        return 1;                                        /* return error */
+    }
+    handle->asr_configured = 0;                          /* full start next */
+    res = a_ld3320_write_byte(handle, reg, data);        /* write data */
+    a_ld3320_unlock(handle);                             /* unlock */
+    
+    return res;                                          /* return the result */
 }
 
 /**
@@ -2277,6 +5766,8 @@ uint8_t ld3320_set_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t data)
  */
 uint8_t ld3320_get_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t *data)
 {
+    uint8_t res;
+    
     if (handle == NULL)                                 /* check handle */
     {
         return 2;                                       /* return error */
@@ -2286,7 +5777,55 @@ uint8_t ld3320_get_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t *data)
         return 3;                                       /* return error */
     }
     
-    return a_ld3320_read_byte(handle, reg, data);       /* read data */
+    if (a_ld3320_lock(handle) != 0)                     /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");  /* lock failed */
+        
+        return 1;                                       /* return error */
+    }
+    res = a_ld3320_read_byte(handle, reg, data);        /* read data */
+    a_ld3320_unlock(handle);                            /* unlock */
+    
+    return res;                                         /* return the result */
+}
+
+/**
+ * @brief     write a register sequence
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *seq pointer to a sequence table
+ * @param[in] len sequence table length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      writes between two delays are sent in one batch if spi_write_batch is linked,
+ *            the next asr start runs the full path
+ */
+uint8_t ld3320_write_sequence(ld3320_handle_t *handle, const ld3320_sequence_t *seq, uint16_t len)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    
+    if (a_ld3320_lock(handle) != 0)                             /* lock */
+    {
+        handle->debug_print("ld3320: lock failed.\n");          /* lock failed */
+        
+        return 1;                                               /* return error */
+    }
+    handle->asr_configured = 0;                                 /* full start next */
+    res = a_ld3320_write_sequence(handle, seq, len);            /* write sequence */
+    a_ld3320_unlock(handle);                                    /* unlock */
+    
+    return res;                                                 /* return the result */
 }
 
 /**
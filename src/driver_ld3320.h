@@ -63,6 +63,132 @@ extern "C"{
     #define LD3320_CYSTAL_MHZ        22.1184f        /* 22.1184 MHz */
 #endif
 
+/**
+ * @brief ld3320 batch max length definition
+ */
+#ifndef LD3320_BATCH_MAX_LEN
+    #define LD3320_BATCH_MAX_LEN        32        /* 32 commands */
+#endif
+
+/**
+ * @brief ld3320 spi clock margin definition
+ */
+#ifndef LD3320_SPI_CLOCK_MARGIN
+    #define LD3320_SPI_CLOCK_MARGIN        75        /* 75% of the highest stable clock */
+#endif
+
+/**
+ * @brief ld3320 spi clock verify rounds definition
+ */
+#ifndef LD3320_SPI_CLOCK_VERIFY_ROUNDS
+    #define LD3320_SPI_CLOCK_VERIFY_ROUNDS        16        /* 16 rounds of patterns */
+#endif
+
+/**
+ * @brief ld3320 register cache enable definition
+ * @note  1 adds a shadow of the configuration registers to the handle for ld3320_set_register_cache
+ */
+#ifndef LD3320_REGISTER_CACHE_ENABLE
+    #define LD3320_REGISTER_CACHE_ENABLE        0        /* disable */
+#endif
+
+/**
+ * @brief ld3320 event queue size definition
+ * @note  must be a power of 2
+ */
+#ifndef LD3320_EVENT_QUEUE_SIZE
+    #define LD3320_EVENT_QUEUE_SIZE        8        /* 8 events */
+#endif
+
+#if (LD3320_EVENT_QUEUE_SIZE == 0) || ((LD3320_EVENT_QUEUE_SIZE & (LD3320_EVENT_QUEUE_SIZE - 1)) != 0) || (LD3320_EVENT_QUEUE_SIZE > 32768)
+    #error "ld3320 event queue size must be a power of 2 up to 32768"
+#endif
+
+/**
+ * @brief ld3320 asr ready histogram size definition
+ * @note  bucket n counts the ready times below 250 us << n, the last one the rest
+ */
+#ifndef LD3320_ASR_READY_HIST_SIZE
+    #define LD3320_ASR_READY_HIST_SIZE        8        /* 8 buckets */
+#endif
+
+/**
+ * @brief ld3320 key word max definition
+ * @note  the chip recognizes at most 50 key words
+ */
+#ifndef LD3320_KEY_WORD_MAX
+    #define LD3320_KEY_WORD_MAX        50        /* 50 key words */
+#endif
+
+/**
+ * @brief ld3320 key word length definition
+ * @note  with the terminating null, at most 50
+ */
+#ifndef LD3320_KEY_WORD_LEN
+    #define LD3320_KEY_WORD_LEN        50        /* 50 bytes */
+#endif
+
+/**
+ * @brief ld3320 key word pool size definition
+ * @note  0 keeps every key word in a fixed LD3320_KEY_WORD_LEN bytes row,
+ *        n packs the key words with their terminating nulls into an n bytes pool with an offset table
+ */
+#ifndef LD3320_KEY_WORD_POOL_SIZE
+    #define LD3320_KEY_WORD_POOL_SIZE        0        /* fixed rows */
+#endif
+
+#if (LD3320_KEY_WORD_MAX > 50) || (LD3320_KEY_WORD_LEN > 50) || (LD3320_KEY_WORD_POOL_SIZE > 65535)
+    #error "ld3320 key word storage is out of range"
+#endif
+
+/**
+ * @brief ld3320 key word clear time definition
+ * @note  the datasheet key word upload flow holds and releases the fifo clear for 2 ms each,
+ *        a shorter time is only safe after checking it on the target board
+ */
+#ifndef LD3320_KEY_WORD_CLEAR_MS
+    #define LD3320_KEY_WORD_CLEAR_MS        2        /* 2 ms */
+#endif
+
+/**
+ * @brief ld3320 grammar page max definition
+ */
+#ifndef LD3320_GRAMMAR_PAGE_MAX
+    #define LD3320_GRAMMAR_PAGE_MAX        16        /* 16 pages */
+#endif
+
+/**
+ * @brief ld3320 memory barrier definition
+ */
+#ifndef LD3320_MEMORY_BARRIER
+    #if defined(__GNUC__)
+        #define LD3320_MEMORY_BARRIER()        __sync_synchronize()        /* full memory barrier */
+    #else
+        #define LD3320_MEMORY_BARRIER()                                    /* single core, no barrier */
+    #endif
+#endif
+
+/**
+ * @brief ld3320 atomic compare and swap definition
+ * @note  returns 1 if *ptr was old and is set to new, otherwise 0
+ */
+#ifndef LD3320_ATOMIC_CAS
+    #if defined(__GNUC__)
+        #define LD3320_ATOMIC_CAS(ptr, old, new)        __sync_bool_compare_and_swap((ptr), (old), (new))           /* atomic compare and swap */
+    #else
+        #define LD3320_ATOMIC_CAS(ptr, old, new)        ((*(ptr) == (old)) ? ((*(ptr) = (new)), 1) : 0)             /* single core compare and swap */
+    #endif
+#endif
+
+/**
+ * @brief ld3320 bool enumeration definition
+ */
+typedef enum
+{
+    LD3320_BOOL_FALSE = 0x00,        /**< false */
+    LD3320_BOOL_TRUE  = 0x01,        /**< true */
+} ld3320_bool_t;
+
 /**
  * @brief ld3320 mode enumeration definition
  */
@@ -106,35 +232,367 @@ typedef enum
     LD3320_STATUS_MP3_ERROR      = 0x08,        /**< mp3 error */
 } ld3320_status_t;
 
+/**
+ * @brief ld3320 status number definition
+ * @note  sizes the per type statistics, update it with ld3320_status_t
+ */
+#define LD3320_STATUS_NUM        (LD3320_STATUS_MP3_ERROR + 1)
+
+/**
+ * @brief ld3320 mp3 feed mode enumeration definition
+ */
+typedef enum
+{
+    LD3320_MP3_FEED_MODE_BYTE  = 0x00,        /**< byte by byte with fifo status polling */
+    LD3320_MP3_FEED_MODE_BURST = 0x01,        /**< watermark sized burst with one status check */
+} ld3320_mp3_feed_mode_t;
+
+/**
+ * @brief ld3320 start phase enumeration definition
+ */
+typedef enum
+{
+    LD3320_START_PHASE_INIT      = 0x00,        /**< soft reset and init sequences */
+    LD3320_START_PHASE_KEY_WORDS = 0x01,        /**< key words upload */
+    LD3320_START_PHASE_ASR       = 0x02,        /**< asr prepare and start */
+    LD3320_START_PHASE_RESET     = 0x03,        /**< chip reset before a retry */
+} ld3320_start_phase_t;
+
+/**
+ * @brief ld3320 asr rearm enumeration definition
+ */
+typedef enum
+{
+    LD3320_ASR_REARM_FULL = 0x00,        /**< soft reset, init sequences and key words upload on every start */
+    LD3320_ASR_REARM_WARM = 0x01,        /**< restart the recognition only while the chip keeps the key words */
+} ld3320_asr_rearm_t;
+
+/**
+ * @brief ld3320 sequence structure definition
+ */
+typedef struct ld3320_sequence_s
+{
+    uint8_t reg;              /**< register address */
+    uint8_t data;             /**< written data */
+    uint16_t delay_ms;        /**< delay after writing in ms */
+} ld3320_sequence_t;
+
+/**
+ * @brief ld3320 mp3 statistics structure definition
+ */
+typedef struct ld3320_mp3_stats_s
+{
+    uint32_t irq_count;            /**< refill irq count */
+    uint32_t total_bytes;          /**< total fed bytes */
+    uint32_t last_bytes;           /**< last refill bytes */
+    uint32_t bytes_per_irq;        /**< average bytes per irq */
+    uint32_t feed_us;              /**< time spent in feeding */
+    float kbps;                    /**< effective feed rate in kbit/s */
+} ld3320_mp3_stats_t;
+
+/**
+ * @brief ld3320 irq statistics structure definition
+ */
+typedef struct ld3320_irq_stats_s
+{
+    uint32_t latch_count;           /**< latched irq edges */
+    uint32_t service_count;         /**< service routine runs */
+    uint32_t coalesced;             /**< edges merged into an earlier service run */
+    uint32_t latency_avg_us;        /**< average latch to service latency */
+    uint32_t latency_max_us;        /**< max latch to service latency */
+    uint32_t service_avg_us;        /**< average service time */
+    uint32_t service_max_us;        /**< max service time */
+} ld3320_irq_stats_t;
+
+/**
+ * @brief ld3320 poll statistics structure definition
+ */
+typedef struct ld3320_poll_stats_s
+{
+    uint32_t poll_count;              /**< ld3320_poll calls */
+    uint32_t event_count;             /**< polls that found a pending interrupt */
+    uint32_t wasted_count;            /**< polls that found nothing */
+    float wasted_per_event;           /**< wasted polls per real event */
+    uint32_t interval_ms;             /**< last suggested poll interval */
+    uint32_t period_ms;               /**< estimated mp3 refill period */
+} ld3320_poll_stats_t;
+
+/**
+ * @brief ld3320 event structure definition
+ */
+typedef struct ld3320_event_s
+{
+    uint8_t type;                      /**< event type, ld3320_status_t */
+    uint8_t index;                     /**< asr result index */
+    uint8_t flag;                      /**< int flag register */
+    uint8_t status;                    /**< asr status register in the asr mode, int aux register in the mp3 mode */
+    uint8_t page;                      /**< grammar page of the result */
+    uint16_t id;                       /**< global command id of the result, the index without a grammar */
+    uint32_t timestamp_us;             /**< event time, the callback or queue time */
+    uint32_t edge_us;                  /**< irq edge time, the service start time if unknown */
+    uint32_t service_us;               /**< service start time */
+    char text[LD3320_KEY_WORD_LEN];    /**< copy of the asr result text, empty without a result */
+} ld3320_event_t;
+
+/**
+ * @brief ld3320 event latency structure definition
+ */
+typedef struct ld3320_event_latency_s
+{
+    uint32_t count;                  /**< events of the type */
+    uint32_t service_min_us;         /**< min edge to service latency */
+    uint32_t service_avg_us;         /**< average edge to service latency */
+    uint32_t service_max_us;         /**< max edge to service latency */
+    uint32_t callback_min_us;        /**< min edge to callback latency */
+    uint32_t callback_avg_us;        /**< average edge to callback latency */
+    uint32_t callback_max_us;        /**< max edge to callback latency */
+} ld3320_event_latency_t;
+
+/**
+ * @brief ld3320 lock statistics structure definition
+ */
+typedef struct ld3320_lock_stats_s
+{
+    uint32_t lock_count;             /**< lock count */
+    uint32_t contention;             /**< lock found held by another thread */
+    uint32_t status_conflict;        /**< status transition lost to a concurrent writer */
+    uint32_t deferred_start;         /**< start called in the receive callback and deferred */
+} ld3320_lock_stats_t;
+
+/**
+ * @brief ld3320 start statistics structure definition
+ */
+typedef struct ld3320_start_stats_s
+{
+    uint32_t phase_us[4];        /**< time spent in every ld3320_start_phase_t */
+    uint32_t total_us;           /**< start to running time */
+    uint32_t steps;              /**< step count */
+    uint32_t step_max_us;        /**< longest step, the time the caller is blocked */
+    uint8_t attempts;            /**< start attempts */
+} ld3320_start_stats_t;
+
+/**
+ * @brief ld3320 asr ready statistics structure definition
+ */
+typedef struct ld3320_asr_ready_stats_s
+{
+    uint32_t ready_count;                              /**< waits that saw the asr ready */
+    uint32_t timeout_count;                            /**< waits that hit the deadline */
+    uint32_t spin_count;                               /**< waits that ended without sleeping */
+    uint32_t hist[LD3320_ASR_READY_HIST_SIZE];         /**< ready time histogram */
+    uint32_t total_us;                                 /**< total ready time */
+    uint32_t max_us;                                   /**< max ready time */
+    uint32_t slack_us;                                 /**< upper bound of the sleep after the chip was ready */
+} ld3320_asr_ready_stats_t;
+
+/**
+ * @brief ld3320 rearm statistics structure definition
+ */
+typedef struct ld3320_rearm_stats_s
+{
+    uint32_t warm_count;            /**< warm rearms after an asr result */
+    uint32_t warm_avg_us;           /**< average result edge to running dead time of the warm rearms */
+    uint32_t warm_max_us;           /**< max dead time of the warm rearms */
+    uint32_t full_count;            /**< full rearms after an asr result */
+    uint32_t full_avg_us;           /**< average result edge to running dead time of the full rearms */
+    uint32_t full_max_us;           /**< max dead time of the full rearms */
+    uint32_t fallback;              /**< warm rearms that failed and ran the full start */
+} ld3320_rearm_stats_t;
+
+/**
+ * @brief ld3320 key word statistics structure definition
+ */
+typedef struct ld3320_key_word_stats_s
+{
+    uint8_t count;                                /**< uploaded key words */
+    uint32_t total_us;                            /**< total upload time */
+    uint32_t word_us[LD3320_KEY_WORD_MAX];        /**< upload time of every key word with its asr ready wait */
+} ld3320_key_word_stats_t;
+
+/**
+ * @brief ld3320 grammar page structure definition
+ */
+typedef struct ld3320_grammar_page_s
+{
+    const char *const *text;        /**< key words of the page */
+    const uint16_t *id;             /**< global command id of every key word, NULL uses the index */
+    const uint8_t *next;            /**< next page after every key word, NULL keeps the page */
+    uint8_t len;                    /**< key word count, 1 to LD3320_KEY_WORD_MAX */
+    uint8_t zero_next;              /**< next page after a result without a key word */
+} ld3320_grammar_page_t;
+
+/**
+ * @brief ld3320 grammar structure definition
+ */
+typedef struct ld3320_grammar_s
+{
+    const ld3320_grammar_page_t *page[LD3320_GRAMMAR_PAGE_MAX];        /**< key word pages */
+    uint8_t page_num;                                                  /**< page count */
+    uint8_t active;                                                    /**< page on the chip */
+    uint8_t pending;                                                   /**< switched page is not running yet */
+    uint32_t switch_begin_us;                                          /**< page switch begin time */
+    uint32_t switch_count;                                             /**< page switch count */
+    uint32_t stay_count;                                               /**< results that kept the page */
+    uint32_t switch_us;                                                /**< total page switch latency */
+    uint32_t switch_max_us;                                            /**< max page switch latency */
+} ld3320_grammar_t;
+
+/**
+ * @brief ld3320 grammar statistics structure definition
+ */
+typedef struct ld3320_grammar_stats_s
+{
+    uint8_t page;                 /**< active page */
+    uint32_t switch_count;        /**< page switches */
+    uint32_t stay_count;          /**< results that kept the page */
+    uint32_t switch_avg_us;       /**< average result edge to running latency of a page switch */
+    uint32_t switch_max_us;       /**< max page switch latency */
+} ld3320_grammar_stats_t;
+
 /**
  * @brief ld3320 handle structure definition
  */
 typedef struct ld3320_handle_s
 {
-    uint8_t (*spi_init)(void);                                                       /**< point to a spi_init function address */
-    uint8_t (*spi_deinit)(void);                                                     /**< point to a spi_deinit function address */
-    uint8_t (*spi_read_address16)(uint16_t addr, uint8_t *buf, uint16_t len);        /**< point to a spi_read_address16 function address */
-    uint8_t (*spi_write_cmd)(uint8_t *buf, uint16_t len);                            /**< point to a spi_write_cmd function address */
-    uint8_t (*reset_gpio_init)(void);                                                /**< point to a reset_gpio_init function address */
-    uint8_t (*reset_gpio_deinit)(void);                                              /**< point to a reset_gpio_deinit function address */
-    uint8_t (*reset_gpio_write)(uint8_t data);                                       /**< point to a reset_gpio_write function address */
+    void *context;                                                                   /**< user context passed to the device callbacks */
+    uint8_t (*spi_init)(void *context);                                              /**< point to a spi_init function address */
+    uint8_t (*spi_deinit)(void *context);                                            /**< point to a spi_deinit function address */
+    uint8_t (*spi_read_address16)(void *context, uint16_t addr, 
+                                  uint8_t *buf, uint16_t len);                       /**< point to a spi_read_address16 function address */
+    uint8_t (*spi_write_cmd)(void *context, uint8_t *buf, uint16_t len);             /**< point to a spi_write_cmd function address */
+    uint8_t (*spi_write_batch)(void *context, uint8_t *buf, uint16_t len);           /**< point to a spi_write_batch function address */
+    uint8_t (*spi_write_batch_start)(void *context, uint8_t *buf, uint16_t len);     /**< point to a spi_write_batch_start function address */
+    uint8_t (*spi_write_batch_wait)(void *context);                                  /**< point to a spi_write_batch_wait function address */
+    uint8_t (*spi_set_clock)(void *context, uint32_t hz);                            /**< point to a spi_set_clock function address */
+    uint8_t (*reset_gpio_init)(void *context);                                       /**< point to a reset_gpio_init function address */
+    uint8_t (*reset_gpio_deinit)(void *context);                                     /**< point to a reset_gpio_deinit function address */
+    uint8_t (*reset_gpio_write)(void *context, uint8_t data);                        /**< point to a reset_gpio_write function address */
     void (*delay_ms)(uint32_t ms);                                                   /**< point to a delay_ms function address */
     void (*delay_us)(uint32_t us);                                                   /**< point to a delay_us function address */
     void (*debug_print)(const char *const fmt, ...);                                 /**< point to a debug_print function address */
-    void (*receive_callback)(uint8_t type, uint8_t index, char *text);               /**< point to a receive_callback function address */
-    uint8_t (*mp3_read_init)(char *name, uint32_t *size);                            /**< point to an mp3_read_init function address */
-    uint8_t (*mp3_read)(uint32_t addr, uint16_t size, uint8_t *buffer);              /**< point to an mp3_read function address */
-    uint8_t (*mp3_read_deinit)(void);                                                /**< point to an mp3_read_deinit function address */
+    uint32_t (*timestamp_us)(void);                                                  /**< point to a timestamp_us function address */
+    void (*receive_callback)(void *context, uint8_t type, 
+                             uint8_t index, char *text);                             /**< point to a receive_callback function address */
+    uint8_t (*mp3_read_init)(void *context, char *name, uint32_t *size);             /**< point to an mp3_read_init function address */
+    uint8_t (*mp3_read)(void *context, uint32_t addr, 
+                        uint16_t size, uint8_t *buffer);                             /**< point to an mp3_read function address */
+    uint8_t (*mp3_read_deinit)(void *context);                                       /**< point to an mp3_read_deinit function address */
+    uint8_t (*mp3_acquire)(void *context, uint32_t addr, uint32_t size, 
+                           uint8_t **buffer, uint32_t *len);                         /**< point to an mp3_acquire function address */
+    uint8_t (*mp3_release)(void *context, uint32_t addr, uint32_t len);              /**< point to an mp3_release function address */
+    uint8_t (*mutex_lock)(void *context);                                            /**< point to a mutex_lock function address */
+    uint8_t (*mutex_trylock)(void *context);                                         /**< point to a mutex_trylock function address */
+    uint8_t (*mutex_unlock)(void *context);                                          /**< point to a mutex_unlock function address */
     uint8_t inited;                                                                  /**< inited flag */
     uint8_t mode;                                                                    /**< running mode */
-    uint8_t running_status;                                                          /**< running status */
+    volatile uint8_t running_status;                                                 /**< running status */
     uint8_t mic_gain;                                                                /**< mic gain */
     uint8_t vad;                                                                     /**< vad */
-    char text[50][50];                                                               /**< inner text */
+#if (LD3320_KEY_WORD_POOL_SIZE > 0)
+    char text_pool[LD3320_KEY_WORD_POOL_SIZE];                                       /**< packed inner text */
+    uint16_t text_offset[LD3320_KEY_WORD_MAX];                                       /**< inner text offsets in the pool */
+#else
+    char text[LD3320_KEY_WORD_MAX][LD3320_KEY_WORD_LEN];                             /**< inner text */
+#endif
     uint8_t len;                                                                     /**< inner text length */
     uint32_t point;                                                                  /**< mp3 play point */
     uint32_t size;                                                                   /**< mp3 size */
     uint8_t buf[512];                                                                /**< buffer */
+    uint8_t mp3_feed_mode;                                                           /**< mp3 feed mode */
+    uint32_t mp3_irq_count;                                                          /**< mp3 refill irq count */
+    uint32_t mp3_irq_bytes;                                                          /**< mp3 bytes fed in irq */
+    uint32_t mp3_last_bytes;                                                         /**< mp3 last refill bytes */
+    uint32_t mp3_total_bytes;                                                        /**< mp3 total fed bytes */
+    uint32_t mp3_feed_us;                                                            /**< mp3 feeding time */
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    uint8_t cache_enable;                                                            /**< register cache enable */
+    uint8_t cache_valid[32];                                                         /**< register cache valid bitmap */
+    uint8_t cache[256];                                                              /**< register shadow cache */
+    uint32_t cache_hit;                                                              /**< register cache hit count */
+    uint32_t cache_miss;                                                             /**< register cache miss count */
+#endif
+    uint32_t spi_clock_hz;                                                           /**< spi clock */
+    volatile uint32_t irq_latch_count;                                               /**< latched irq count */
+    volatile uint32_t irq_latch_us;                                                  /**< last irq latch time */
+    volatile uint32_t irq_edge_us;                                                   /**< irq edge time from the interface */
+    volatile uint8_t irq_edge_valid;                                                 /**< irq edge time is set */
+    uint32_t event_edge_us;                                                          /**< current event edge time */
+    uint32_t event_service_us;                                                       /**< current event service time */
+    ld3320_event_t event_last;                                                       /**< last reported event */
+    uint32_t latency_count[LD3320_STATUS_NUM];                                       /**< event count per type */
+    uint32_t latency_service_min_us[LD3320_STATUS_NUM];                              /**< min edge to service latency per type */
+    uint32_t latency_service_us[LD3320_STATUS_NUM];                                  /**< total edge to service latency per type */
+    uint32_t latency_service_max_us[LD3320_STATUS_NUM];                              /**< max edge to service latency per type */
+    uint32_t latency_callback_min_us[LD3320_STATUS_NUM];                             /**< min edge to callback latency per type */
+    uint32_t latency_callback_us[LD3320_STATUS_NUM];                                 /**< total edge to callback latency per type */
+    uint32_t latency_callback_max_us[LD3320_STATUS_NUM];                             /**< max edge to callback latency per type */
+    uint32_t irq_serviced;                                                           /**< serviced latch count */
+    uint32_t irq_service_count;                                                      /**< service run count */
+    uint32_t irq_latency_us;                                                         /**< total latch to service latency */
+    uint32_t irq_latency_max_us;                                                     /**< max latch to service latency */
+    uint32_t irq_service_us;                                                         /**< total service time */
+    uint32_t irq_service_max_us;                                                     /**< max service time */
+    uint8_t event_enable;                                                            /**< event queue enable */
+    ld3320_event_t event[LD3320_EVENT_QUEUE_SIZE];                                   /**< event queue */
+    volatile uint16_t event_head;                                                    /**< event queue head */
+    volatile uint16_t event_tail;                                                    /**< event queue tail */
+    volatile uint32_t event_overflow;                                                /**< event queue overflow count */
+    volatile uint8_t callback_guard;                                                 /**< receive callback guard */
+    uint8_t start_deferred;                                                          /**< deferred start flag */
+    uint32_t lock_count;                                                             /**< lock count */
+    uint32_t lock_contention;                                                        /**< lock contention count */
+    uint32_t status_conflict;                                                        /**< status conflict count */
+    uint32_t deferred_start;                                                         /**< deferred start count */
+    uint8_t start_state;                                                             /**< async start state */
+    uint8_t start_phase;                                                             /**< start phase */
+    uint8_t start_attempt;                                                           /**< start attempt */
+    uint8_t start_fatal;                                                             /**< start gives up after the reset */
+    uint8_t start_index;                                                             /**< start key word index */
+    uint8_t start_poll;                                                              /**< start asr ready wait armed */
+    uint8_t start_seq;                                                               /**< start sequence id */
+    uint16_t start_seq_index;                                                        /**< start sequence position */
+    uint32_t start_deadline_us;                                                      /**< next step deadline */
+    uint32_t start_begin_us;                                                         /**< start begin time */
+    uint32_t start_last_us;                                                          /**< start phase time */
+    uint32_t start_phase_us[4];                                                      /**< start time per phase */
+    uint32_t start_total_us;                                                         /**< start total time */
+    uint32_t start_steps;                                                            /**< start step count */
+    uint32_t start_step_max_us;                                                      /**< start longest step */
+    uint32_t asr_ready_timeout_ms;                                                   /**< asr ready deadline */
+    uint32_t asr_ready_begin_us;                                                     /**< asr ready wait begin time */
+    uint32_t asr_ready_waited_us;                                                    /**< asr ready slept time */
+    uint32_t asr_ready_backoff_us;                                                   /**< asr ready next sleep */
+    uint32_t asr_ready_sleep_us;                                                     /**< asr ready last sleep */
+    uint32_t asr_ready_count;                                                        /**< asr ready count */
+    uint32_t asr_ready_timeout;                                                      /**< asr ready timeout count */
+    uint32_t asr_ready_spin;                                                         /**< asr ready without sleeping count */
+    uint32_t asr_ready_hist[LD3320_ASR_READY_HIST_SIZE];                             /**< asr ready time histogram */
+    uint32_t asr_ready_total_us;                                                     /**< asr ready total time */
+    uint32_t asr_ready_max_us;                                                       /**< asr ready max time */
+    uint32_t asr_ready_slack_us;                                                     /**< asr ready sleep slack */
+    uint8_t asr_rearm;                                                               /**< asr rearm mode */
+    uint8_t asr_configured;                                                          /**< chip keeps the asr setup and key words */
+    uint8_t asr_result_valid;                                                        /**< asr result time is set */
+    uint8_t start_warm;                                                              /**< current start is a warm rearm */
+    uint32_t asr_result_us;                                                          /**< last asr result edge time */
+    uint32_t rearm_warm_count;                                                       /**< warm rearm count */
+    uint32_t rearm_warm_us;                                                          /**< warm rearm total dead time */
+    uint32_t rearm_warm_max_us;                                                      /**< warm rearm max dead time */
+    uint32_t rearm_full_count;                                                       /**< full rearm count */
+    uint32_t rearm_full_us;                                                          /**< full rearm total dead time */
+    uint32_t rearm_full_max_us;                                                      /**< full rearm max dead time */
+    uint32_t rearm_fallback;                                                         /**< warm rearm fallback count */
+    uint8_t key_word_count;                                                          /**< uploaded key word count */
+    uint32_t key_word_begin_us;                                                      /**< key word upload begin time */
+    uint32_t key_word_total_us;                                                      /**< key word total upload time */
+    uint32_t key_word_us[LD3320_KEY_WORD_MAX];                                       /**< key word upload time */
+    ld3320_grammar_t *grammar;                                                       /**< attached grammar */
+    uint32_t poll_count;                                                             /**< poll count */
+    uint32_t poll_event_count;                                                       /**< poll event count */
+    uint32_t poll_interval_ms;                                                       /**< last poll interval */
+    uint32_t poll_period_ms;                                                         /**< estimated event period */
+    uint32_t poll_elapsed_ms;                                                        /**< suggested time since the last event */
+    uint32_t poll_last_us;                                                           /**< last event time */
 } ld3320_handle_t;
 
 /**
@@ -172,6 +630,15 @@ typedef struct ld3320_info_s
  */
 #define DRIVER_LD3320_LINK_INIT(HANDLE, STRUCTURE)                    memset(HANDLE, 0, sizeof(STRUCTURE))
 
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] CONTEXT pointer to a user context
+ * @note      passed as the first argument of the spi, reset gpio, mp3, mutex and receive callbacks,
+ *            link it after DRIVER_LD3320_LINK_INIT to run several chips in one process
+ */
+#define DRIVER_LD3320_LINK_CONTEXT(HANDLE, CONTEXT)                   (HANDLE)->context = CONTEXT
+
 /**
  * @brief     link spi_init function
  * @param[in] HANDLE pointer to an ld3320 handle structure
@@ -204,6 +671,39 @@ typedef struct ld3320_info_s
  */
 #define DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(HANDLE, FUC)             (HANDLE)->spi_write_cmd = FUC
 
+/**
+ * @brief     link spi_write_batch function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a spi_write_batch function address
+ * @note      optional, per command writes are used if not linked
+ */
+#define DRIVER_LD3320_LINK_SPI_WRITE_BATCH(HANDLE, FUC)               (HANDLE)->spi_write_batch = FUC
+
+/**
+ * @brief     link spi_write_batch_start function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a spi_write_batch_start function address
+ * @note      optional, fifo writes overlap the next batch packing with the running one if linked
+ *            together with spi_write_batch_wait
+ */
+#define DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(HANDLE, FUC)         (HANDLE)->spi_write_batch_start = FUC
+
+/**
+ * @brief     link spi_write_batch_wait function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a spi_write_batch_wait function address
+ * @note      optional, see spi_write_batch_start
+ */
+#define DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(HANDLE, FUC)          (HANDLE)->spi_write_batch_wait = FUC
+
+/**
+ * @brief     link spi_set_clock function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a spi_set_clock function address
+ * @note      optional, only needed by the spi clock calibration
+ */
+#define DRIVER_LD3320_LINK_SPI_SET_CLOCK(HANDLE, FUC)                 (HANDLE)->spi_set_clock = FUC
+
 /**
  * @brief     link reset_gpio_init function
  * @param[in] HANDLE pointer to an ld3320 handle structure
@@ -252,6 +752,14 @@ typedef struct ld3320_info_s
  */
 #define DRIVER_LD3320_LINK_DEBUG_PRINT(HANDLE, FUC)                   (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, timing statistics are zero if not linked
+ */
+#define DRIVER_LD3320_LINK_TIMESTAMP_US(HANDLE, FUC)                  (HANDLE)->timestamp_us = FUC
+
 /**
  * @brief     link receive_callback function
  * @param[in] HANDLE pointer to an ld3320 handle structure
@@ -284,6 +792,48 @@ typedef struct ld3320_info_s
  */
 #define DRIVER_LD3320_LINK_MP3_READ(HANDLE, FUC)                      (HANDLE)->mp3_read = FUC
 
+/**
+ * @brief     link mp3_acquire function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to an mp3_acquire function address
+ * @note      optional, the source lends its own buffer and mp3_read is the fallback if not linked
+ */
+#define DRIVER_LD3320_LINK_MP3_ACQUIRE(HANDLE, FUC)                   (HANDLE)->mp3_acquire = FUC
+
+/**
+ * @brief     link mp3_release function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to an mp3_release function address
+ * @note      optional, must be linked together with mp3_acquire
+ */
+#define DRIVER_LD3320_LINK_MP3_RELEASE(HANDLE, FUC)                   (HANDLE)->mp3_release = FUC
+
+/**
+ * @brief     link mutex_lock function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a mutex_lock function address
+ * @note      optional, must be linked together with mutex_unlock to serialize the handle,
+ *            receive_callback runs with the lock held, so the mutex must be recursive
+ *            for the callback to call the driver api
+ */
+#define DRIVER_LD3320_LINK_MUTEX_LOCK(HANDLE, FUC)                    (HANDLE)->mutex_lock = FUC
+
+/**
+ * @brief     link mutex_trylock function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a mutex_trylock function address
+ * @note      optional, only used to count the lock contention
+ */
+#define DRIVER_LD3320_LINK_MUTEX_TRYLOCK(HANDLE, FUC)                 (HANDLE)->mutex_trylock = FUC
+
+/**
+ * @brief     link mutex_unlock function
+ * @param[in] HANDLE pointer to an ld3320 handle structure
+ * @param[in] FUC pointer to a mutex_unlock function address
+ * @note      optional, must be linked together with mutex_lock
+ */
+#define DRIVER_LD3320_LINK_MUTEX_UNLOCK(HANDLE, FUC)                  (HANDLE)->mutex_unlock = FUC
+
 /**
  * @}
  */
@@ -319,124 +869,533 @@ uint8_t ld3320_info(ld3320_info_t *info);
 uint8_t ld3320_irq_handler(ld3320_handle_t *handle);
 
 /**
- * @brief     initialize the chip
- * @param[in] *handle pointer to an ld3320 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 spi initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 reset failed
- * @note      none
- */
-uint8_t ld3320_init(ld3320_handle_t *handle);
-
-/**
- * @brief     deinit the chip
+ * @brief     latch the irq without any bus access
  * @param[in] *handle pointer to an ld3320 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 gpio deinit failed
- *            - 5 spi deinit failed
- *            - 6 mp3 deinit failed
- * @note      none
+ * @note      call it in the interrupt context and run ld3320_service later
  */
-uint8_t ld3320_deinit(ld3320_handle_t *handle);
+uint8_t ld3320_irq_latch(ld3320_handle_t *handle);
 
 /**
- * @brief     start the process
+ * @brief     set the irq edge time
  * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] edge_us edge time in the timestamp_us clock
  * @return    status code
  *            - 0 success
- *            - 1 start failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      call it before ld3320_irq_handler or ld3320_irq_latch when the interface knows the edge time,
+ *            otherwise the latch time or the service start is used
  */
-uint8_t ld3320_start(ld3320_handle_t *handle);
+uint8_t ld3320_irq_timestamp(ld3320_handle_t *handle, uint32_t edge_us);
 
 /**
- * @brief     stop the process
+ * @brief     service the latched irq
  * @param[in] *handle pointer to an ld3320 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 stop failed
+ *            - 1 run failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 mode is invalid
+ * @note      call it in the thread or main loop context, returns 0 if nothing is latched
  */
-uint8_t ld3320_stop(ld3320_handle_t *handle);
+uint8_t ld3320_service(ld3320_handle_t *handle);
 
 /**
- * @brief     configure the mp3
- * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] *name pointer to a name buffer
- * @return    status code
- *            - 0 success
- *            - 1 configure mp3 failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get the irq statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an irq statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       statistics are cleared by ld3320_start
  */
-uint8_t ld3320_configure_mp3(ld3320_handle_t *handle, char *name);
+uint8_t ld3320_get_irq_stats(ld3320_handle_t *handle, ld3320_irq_stats_t *stats);
 
 /**
- * @brief     set the chip mode
- * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] mode chip mode
- * @return    status code
- *            - 0 success
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      poll the interrupt flags instead of the irq line
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *interval_ms pointer to a next poll interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mode is invalid
+ * @note       for boards without the intb line, call it again after *interval_ms,
+ *             a pending interrupt runs the same path as ld3320_irq_handler
  */
-uint8_t ld3320_set_mode(ld3320_handle_t *handle, ld3320_mode_t mode);
+uint8_t ld3320_poll(ld3320_handle_t *handle, uint32_t *interval_ms);
 
 /**
- * @brief      get the chip mode
+ * @brief      get the poll statistics
  * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] *mode pointer to a chip mode buffer
+ * @param[out] *stats pointer to a poll statistics structure
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       statistics are cleared by ld3320_start
  */
-uint8_t ld3320_get_mode(ld3320_handle_t *handle, ld3320_mode_t *mode);
+uint8_t ld3320_get_poll_stats(ld3320_handle_t *handle, ld3320_poll_stats_t *stats);
 
 /**
- * @brief     set the key words
+ * @brief     enable or disable the event queue
  * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] **text pointer to a text buffer
- * @param[in] len key words length
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      when enabled, events are queued instead of running receive_callback,
+ *            the queue and the overflow count are cleared
  */
-uint8_t ld3320_set_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t len);
+uint8_t ld3320_set_event_queue(ld3320_handle_t *handle, ld3320_bool_t enable);
 
 /**
- * @brief      get the key words
+ * @brief      get the event queue status
  * @param[in]  *handle pointer to an ld3320 handle structure
- * @param[out] **text pointer to a text buffer
- * @param[out] *len pointer to a key words length buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t ld3320_get_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t *len);
+uint8_t ld3320_get_event_queue(ld3320_handle_t *handle, ld3320_bool_t *enable);
 
 /**
- * @brief     set the microphone gain
- * @param[in] *handle pointer to an ld3320 handle structure
- * @param[in] gain microphone gain
+ * @brief      poll one event from the event queue
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is empty
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the queue has one producer (the irq handler) and one consumer (this function)
+ */
+uint8_t ld3320_poll_event(ld3320_handle_t *handle, ld3320_event_t *event);
+
+/**
+ * @brief      get the event queue overflow count
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       events are dropped and counted when the queue is full
+ */
+uint8_t ld3320_get_event_overflow(ld3320_handle_t *handle, uint32_t *count);
+
+/**
+ * @brief      get the last reported event
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it in receive_callback to get the timestamps of the current event
+ */
+uint8_t ld3320_get_last_event(ld3320_handle_t *handle, ld3320_event_t *event);
+
+/**
+ * @brief      get the event latency
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  type event type
+ * @param[out] *latency pointer to an event latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 type is invalid
+ * @note       running since ld3320_init, needs timestamp_us
+ */
+uint8_t ld3320_get_event_latency(ld3320_handle_t *handle, ld3320_status_t type, ld3320_event_latency_t *latency);
+
+/**
+ * @brief      get the lock statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a lock statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_lock_stats(ld3320_handle_t *handle, ld3320_lock_stats_t *stats);
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      none
+ */
+uint8_t ld3320_init(ld3320_handle_t *handle);
+
+/**
+ * @brief     deinit the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 gpio deinit failed
+ *            - 5 spi deinit failed
+ *            - 6 mp3 deinit failed
+ * @note      none
+ */
+uint8_t ld3320_deinit(ld3320_handle_t *handle);
+
+/**
+ * @brief     start the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      called in receive_callback, the start is deferred until the callback returns,
+ *            the guard is checked under the lock, so only the thread running the callback is deferred
+ */
+uint8_t ld3320_start(ld3320_handle_t *handle);
+
+/**
+ * @brief     start the asr without blocking
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start async failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is not asr
+ * @note      only arms the start, ld3320_step runs it, don't call it in receive_callback
+ */
+uint8_t ld3320_start_async(ld3320_handle_t *handle);
+
+/**
+ * @brief      run the async start until the next sleep
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *delay_ms pointer to a next deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no start in progress
+ * @note       never calls delay_ms, call again after *delay_ms, 0 means the asr is running,
+ *             with timestamp_us linked an early call returns the time left without a bus access
+ */
+uint8_t ld3320_step(ld3320_handle_t *handle, uint32_t *delay_ms);
+
+/**
+ * @brief      get the start statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a start statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       filled by the last asr start, blocking or async, the times need timestamp_us
+ */
+uint8_t ld3320_get_start_stats(ld3320_handle_t *handle, ld3320_start_stats_t *stats);
+
+/**
+ * @brief     set the asr ready deadline
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] ms deadline in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ms is 0
+ * @note      the start fails when the asr status is not ready before the deadline
+ */
+uint8_t ld3320_set_asr_ready_timeout(ld3320_handle_t *handle, uint32_t ms);
+
+/**
+ * @brief      get the asr ready deadline
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *ms pointer to a deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_asr_ready_timeout(ld3320_handle_t *handle, uint32_t *ms);
+
+/**
+ * @brief      get the asr ready statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an asr ready statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       cleared by every asr start, without timestamp_us the times only count the sleeps
+ */
+uint8_t ld3320_get_asr_ready_stats(ld3320_handle_t *handle, ld3320_asr_ready_stats_t *stats);
+
+/**
+ * @brief     set the asr rearm mode
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] rearm asr rearm mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the warm rearm falls back to the full start after a mode or key words change,
+ *            a stop, an error or a failed warm start
+ */
+uint8_t ld3320_set_asr_rearm(ld3320_handle_t *handle, ld3320_asr_rearm_t rearm);
+
+/**
+ * @brief      get the asr rearm mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *rearm pointer to an asr rearm mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_asr_rearm(ld3320_handle_t *handle, ld3320_asr_rearm_t *rearm);
+
+/**
+ * @brief      get the rearm statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a rearm statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the dead time runs from the edge of the asr result irq to the next asr running,
+ *             it needs timestamp_us and is cleared by ld3320_init
+ */
+uint8_t ld3320_get_rearm_stats(ld3320_handle_t *handle, ld3320_rearm_stats_t *stats);
+
+/**
+ * @brief      get the key word upload statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a key word statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       filled by the last full asr start, the times need timestamp_us
+ */
+uint8_t ld3320_get_key_word_stats(ld3320_handle_t *handle, ld3320_key_word_stats_t *stats);
+
+/**
+ * @brief     init a grammar
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 grammar is NULL
+ * @note      none
+ */
+uint8_t ld3320_grammar_init(ld3320_grammar_t *grammar);
+
+/**
+ * @brief      add a key word page to the grammar
+ * @param[in]  *grammar pointer to an ld3320 grammar structure
+ * @param[in]  *page pointer to a grammar page structure
+ * @param[out] *index pointer to a page index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 grammar is NULL
+ *             - 4 page is invalid
+ *             - 5 grammar is full
+ * @note       the page is checked once here and kept by reference, every key word must be shorter than LD3320_KEY_WORD_LEN
+ *             and all key words of a page must fit the key word pool
+ */
+uint8_t ld3320_grammar_add_page(ld3320_grammar_t *grammar, const ld3320_grammar_page_t *page, uint8_t *index);
+
+/**
+ * @brief      get the global command id of a result
+ * @param[in]  *grammar pointer to an ld3320 grammar structure
+ * @param[in]  page grammar page
+ * @param[in]  index chip result index
+ * @param[out] *id pointer to a command id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 grammar is NULL
+ *             - 4 page or index is invalid
+ * @note       none
+ */
+uint8_t ld3320_grammar_get_id(ld3320_grammar_t *grammar, uint8_t page, uint8_t index, uint16_t *id);
+
+/**
+ * @brief     attach a grammar to the chip
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *grammar pointer to an ld3320 grammar structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 grammar is invalid
+ * @note      page 0 is loaded, every result switches to the next page before the next start,
+ *            NULL detaches the grammar, ld3320_set_key_words detaches it too
+ */
+uint8_t ld3320_set_grammar(ld3320_handle_t *handle, ld3320_grammar_t *grammar);
+
+/**
+ * @brief     select the grammar page
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] page grammar page
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 no grammar
+ *            - 5 page is invalid
+ *            - 6 asr is running
+ * @note      the page runs from the next start,
+ *            the key words can't change while the asr is running, so stop the asr first
+ */
+uint8_t ld3320_grammar_select(ld3320_handle_t *handle, uint8_t page);
+
+/**
+ * @brief      get the grammar statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to a grammar statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no grammar
+ * @note       the switch latency runs from the edge of the result irq to the asr running on the new page
+ */
+uint8_t ld3320_get_grammar_stats(ld3320_handle_t *handle, ld3320_grammar_stats_t *stats);
+
+/**
+ * @brief     stop the process
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_stop(ld3320_handle_t *handle);
+
+/**
+ * @brief     configure the mp3
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *name pointer to a name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 configure mp3 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_configure_mp3(ld3320_handle_t *handle, char *name);
+
+/**
+ * @brief     set the chip mode
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] mode chip mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_set_mode(ld3320_handle_t *handle, ld3320_mode_t mode);
+
+/**
+ * @brief      get the chip mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *mode pointer to a chip mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_mode(ld3320_handle_t *handle, ld3320_mode_t *mode);
+
+/**
+ * @brief     set the key words
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a text buffer
+ * @param[in] len key words length
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 key words are invalid
+ * @note      none
+ */
+uint8_t ld3320_set_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t len);
+
+/**
+ * @brief     set the key words from a pointer list
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a key word pointer list
+ * @param[in] len key words length
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 key words are invalid
+ * @note      every key word must be shorter than LD3320_KEY_WORD_LEN and all of them must fit the key word pool,
+ *            the key words are copied and may not point into the handle
+ */
+uint8_t ld3320_set_key_word_list(ld3320_handle_t *handle, const char *const *text, uint8_t len);
+
+/**
+ * @brief      get the key words
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] **text pointer to a text buffer
+ * @param[out] *len pointer to a key words length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_key_words(ld3320_handle_t *handle, char text[50][50], uint8_t *len);
+
+/**
+ * @brief      get one key word
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  index key word index
+ * @param[out] **text pointer to a key word pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 index is invalid
+ * @note       the key word stays valid until the key words change
+ */
+uint8_t ld3320_get_key_word(ld3320_handle_t *handle, uint8_t index, const char **text);
+
+/**
+ * @brief     set the microphone gain
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] gain microphone gain
  * @return    status code
  *            - 0 success
  *            - 2 handle is NULL
@@ -549,6 +1508,129 @@ uint8_t ld3320_set_headset_volume(ld3320_handle_t *handle, uint8_t volume_left,
  */
 uint8_t ld3320_get_headset_volume(ld3320_handle_t *handle, uint8_t *volume_left, uint8_t *volume_right);
 
+/**
+ * @brief     set the mp3 feed mode
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] mode mp3 feed mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ld3320_set_mp3_feed_mode(ld3320_handle_t *handle, ld3320_mp3_feed_mode_t mode);
+
+/**
+ * @brief      get the mp3 feed mode
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *mode pointer to an mp3 feed mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ld3320_get_mp3_feed_mode(ld3320_handle_t *handle, ld3320_mp3_feed_mode_t *mode);
+
+/**
+ * @brief      get the mp3 feed statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *stats pointer to an mp3 statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       statistics are cleared by ld3320_start in the mp3 mode
+ */
+uint8_t ld3320_get_mp3_stats(ld3320_handle_t *handle, ld3320_mp3_stats_t *stats);
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 register cache is not compiled in
+ * @note      the cache content and counters are cleared,
+ *            enabling needs LD3320_REGISTER_CACHE_ENABLE
+ */
+uint8_t ld3320_set_register_cache(ld3320_handle_t *handle, ld3320_bool_t enable);
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       always false without LD3320_REGISTER_CACHE_ENABLE
+ */
+uint8_t ld3320_get_register_cache(ld3320_handle_t *handle, ld3320_bool_t *enable);
+
+/**
+ * @brief      get the register cache statistics
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *hit pointer to a hit count buffer
+ * @param[out] *miss pointer to a miss count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a hit is a bus read or write that was saved by the cache,
+ *             both are 0 without LD3320_REGISTER_CACHE_ENABLE
+ */
+uint8_t ld3320_get_register_cache_stats(ld3320_handle_t *handle, uint32_t *hit, uint32_t *miss);
+
+/**
+ * @brief      calibrate the spi clock
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[in]  min_hz min spi clock in hz
+ * @param[in]  max_hz max spi clock in hz
+ * @param[out] *clock_hz pointer to a calibrated spi clock buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 calibrate spi clock failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 spi_set_clock is null
+ *             - 5 chip is running
+ * @note       the clock is doubled from min_hz up to max_hz and every step is verified by
+ *             write and read back patterns on the asr string length register,
+ *             the applied clock is the highest stable clock scaled by LD3320_SPI_CLOCK_MARGIN,
+ *             if the calibration fails after the min clock is set, the bus is left at min_hz
+ */
+uint8_t ld3320_calibrate_spi_clock(ld3320_handle_t *handle, uint32_t min_hz, uint32_t max_hz, uint32_t *clock_hz);
+
+/**
+ * @brief     set the spi clock
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] hz spi clock in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 set spi clock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 spi_set_clock is null
+ * @note      used to restore a persisted calibration result
+ */
+uint8_t ld3320_set_spi_clock(ld3320_handle_t *handle, uint32_t hz);
+
+/**
+ * @brief      get the spi clock
+ * @param[in]  *handle pointer to an ld3320 handle structure
+ * @param[out] *hz pointer to a spi clock buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       0 means the interface default clock
+ */
+uint8_t ld3320_get_spi_clock(ld3320_handle_t *handle, uint32_t *hz);
+
 /**
  * @}
  */
@@ -588,6 +1670,20 @@ uint8_t ld3320_set_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t data);
  */
 uint8_t ld3320_get_reg(ld3320_handle_t *handle, uint8_t reg, uint8_t *data);
 
+/**
+ * @brief     write a register sequence
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] *seq pointer to a sequence table
+ * @param[in] len sequence table length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      writes between two delays are sent in one batch if spi_write_batch is linked
+ */
+uint8_t ld3320_write_sequence(ld3320_handle_t *handle, const ld3320_sequence_t *seq, uint16_t len);
+
 /**
  * @}
  */
@@ -0,0 +1,1478 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ld3320_pinyin.c
+ * @brief     driver ld3320 pinyin source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2021-05-12
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2021/05/12  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ld3320_pinyin.h"
+#include <string.h>
+
+/**
+ * @brief pinyin table definition
+ * @note  the tables are generated from the ICU Han-Latin transliteration of the gb2312 hanzi,
+ *        a minimal perfect hash maps every code point to one slot, all tables are const and stay in flash
+ */
+#define LD3320_PINYIN_CODE_NUM          6763          /**< hanzi in the table */
+#define LD3320_PINYIN_BUCKET_NUM        1691          /**< hash buckets */
+#define LD3320_PINYIN_CODE_MIN          0x4E00        /**< first code point */
+#define LD3320_PINYIN_CODE_MAX          0x9FA5        /**< last code point */
+
+/**
+ * @brief pinyin syllable offsets in the syllable pool
+ */
+static const uint16_t gs_pinyin_offset[401] =
+{
+    0, 2, 5, 8, 12, 15, 18, 22, 26, 31, 35, 39, 43, 48, 51, 56,
+    61, 65, 69, 74, 77, 80, 83, 87, 91, 96, 100, 103, 107, 112, 116, 121,
+    126, 132, 137, 141, 146, 152, 156, 162, 167, 171, 177, 183, 190, 195, 200, 205,
+    208, 213, 217, 220, 225, 229, 233, 237, 240, 244, 248, 253, 257, 260, 265, 268,
+    273, 278, 282, 287, 291, 296, 300, 303, 308, 312, 316, 320, 322, 325, 328, 331,
+    334, 338, 343, 347, 351, 356, 360, 363, 366, 370, 374, 379, 383, 386, 390, 394,
+    399, 404, 408, 411, 415, 420, 425, 431, 435, 439, 443, 446, 450, 454, 459, 463,
+    466, 470, 474, 479, 484, 488, 491, 495, 500, 505, 511, 515, 519, 523, 526, 530,
+    535, 541, 546, 550, 554, 559, 565, 569, 572, 577, 581, 585, 588, 592, 596, 601,
+    605, 608, 612, 617, 622, 626, 629, 633, 638, 643, 649, 653, 657, 661, 664, 668,
+    672, 677, 681, 684, 688, 693, 696, 700, 705, 711, 716, 720, 724, 729, 733, 738,
+    742, 745, 750, 754, 758, 761, 765, 768, 772, 776, 781, 785, 788, 792, 796, 801,
+    804, 809, 814, 818, 822, 827, 831, 834, 838, 841, 843, 846, 850, 854, 859, 863,
+    866, 870, 874, 879, 882, 887, 893, 898, 902, 906, 911, 915, 920, 924, 927, 932,
+    936, 939, 943, 945, 948, 951, 955, 959, 964, 968, 972, 976, 981, 984, 989, 994,
+    998, 1002, 1007, 1010, 1014, 1017, 1020, 1024, 1029, 1035, 1040, 1044, 1048, 1053, 1059, 1063,
+    1066, 1071, 1075, 1079, 1083, 1088, 1092, 1095, 1099, 1104, 1107, 1112, 1116, 1119, 1124, 1128,
+    1132, 1136, 1139, 1143, 1147, 1152, 1156, 1159, 1163, 1168, 1172, 1177, 1182, 1188, 1193, 1197,
+    1202, 1207, 1213, 1217, 1222, 1226, 1231, 1237, 1243, 1250, 1255, 1260, 1265, 1268, 1273, 1277,
+    1280, 1285, 1289, 1293, 1297, 1300, 1304, 1308, 1313, 1317, 1320, 1325, 1328, 1333, 1338, 1342,
+    1347, 1352, 1356, 1359, 1364, 1368, 1372, 1376, 1379, 1383, 1387, 1392, 1396, 1400, 1405, 1408,
+    1411, 1414, 1418, 1423, 1429, 1434, 1438, 1442, 1447, 1453, 1457, 1460, 1465, 1469, 1473, 1476,
+    1480, 1485, 1489, 1492, 1495, 1499, 1504, 1507, 1512, 1516, 1519, 1524, 1528, 1532, 1535, 1539,
+    1543, 1548, 1552, 1555, 1559, 1563, 1568, 1572, 1577, 1582, 1588, 1593, 1597, 1602, 1608, 1612,
+    1618, 1623, 1627, 1632, 1638, 1644, 1651, 1656, 1661, 1666, 1669, 1674, 1678, 1681, 1686, 1690,
+    1694
+};
+
+/**
+ * @brief pinyin syllable pool, every syllable ends with a null
+ */
+static const char gs_pinyin_pool[1698] =
+    "a\0ai\0an\0ang\0ao\0ba\0bai\0ban\0bang\0bao\0bei\0ben\0beng\0bi\0bian\0biao\0bie\0bin\0bing\0"
+    "bo\0bu\0ca\0cai\0can\0cang\0cao\0ce\0cen\0ceng\0cha\0chai\0chan\0chang\0chao\0che\0chen\0"
+    "cheng\0chi\0chong\0chou\0chu\0chuai\0chuan\0chuang\0chui\0chun\0chuo\0ci\0cong\0cou\0cu\0cuan\0"
+    "cui\0cun\0cuo\0da\0dai\0dan\0dang\0dao\0de\0deng\0di\0dian\0diao\0die\0ding\0diu\0dong\0dou\0"
+    "du\0duan\0dui\0dun\0duo\0e\0ei\0en\0er\0fa\0fan\0fang\0fei\0fen\0feng\0fou\0fu\0ga\0gai\0gan\0"
+    "gang\0gao\0ge\0gei\0gen\0geng\0gong\0gou\0gu\0gua\0guai\0guan\0guang\0gui\0gun\0guo\0ha\0hai\0"
+    "han\0hang\0hao\0he\0hei\0hen\0heng\0hong\0hou\0hu\0hua\0huai\0huan\0huang\0hui\0hun\0huo\0ji\0"
+    "jia\0jian\0jiang\0jiao\0jie\0jin\0jing\0jiong\0jiu\0ju\0juan\0jue\0jun\0ka\0kai\0kan\0kang\0"
+    "kao\0ke\0ken\0keng\0kong\0kou\0ku\0kua\0kuai\0kuan\0kuang\0kui\0kun\0kuo\0la\0lai\0lan\0lang\0"
+    "lao\0le\0lei\0leng\0li\0lia\0lian\0liang\0liao\0lie\0lin\0ling\0liu\0long\0lou\0lu\0luan\0lun\0"
+    "luo\0lv\0lve\0ma\0mai\0man\0mang\0mao\0me\0mei\0men\0meng\0mi\0mian\0miao\0mie\0min\0ming\0"
+    "miu\0mo\0mou\0mu\0n\0na\0nai\0nan\0nang\0nao\0ne\0nei\0nen\0neng\0ni\0nian\0niang\0niao\0nie\0"
+    "nin\0ning\0niu\0nong\0nou\0nu\0nuan\0nuo\0nv\0nve\0o\0ou\0pa\0pai\0pan\0pang\0pao\0pei\0pen\0"
+    "peng\0pi\0pian\0piao\0pie\0pin\0ping\0po\0pou\0pu\0qi\0qia\0qian\0qiang\0qiao\0qie\0qin\0qing\0"
+    "qiong\0qiu\0qu\0quan\0que\0qun\0ran\0rang\0rao\0re\0ren\0reng\0ri\0rong\0rou\0ru\0ruan\0rui\0"
+    "run\0ruo\0sa\0sai\0san\0sang\0sao\0se\0sen\0seng\0sha\0shai\0shan\0shang\0shao\0she\0shei\0"
+    "shen\0sheng\0shi\0shou\0shu\0shua\0shuai\0shuan\0shuang\0shui\0shun\0shuo\0si\0song\0sou\0su\0"
+    "suan\0sui\0sun\0suo\0ta\0tai\0tan\0tang\0tao\0te\0teng\0ti\0tian\0tiao\0tie\0ting\0tong\0tou\0"
+    "tu\0tuan\0tui\0tun\0tuo\0wa\0wai\0wan\0wang\0wei\0wen\0weng\0wo\0wu\0xi\0xia\0xian\0xiang\0"
+    "xiao\0xie\0xin\0xing\0xiong\0xiu\0xu\0xuan\0xue\0xun\0ya\0yan\0yang\0yao\0ye\0yi\0yin\0ying\0"
+    "yo\0yong\0you\0yu\0yuan\0yue\0yun\0za\0zai\0zan\0zang\0zao\0ze\0zei\0zen\0zeng\0zha\0zhai\0"
+    "zhan\0zhang\0zhao\0zhe\0zhen\0zheng\0zhi\0zhong\0zhou\0zhu\0zhua\0zhuai\0zhuan\0zhuang\0zhui\0"
+    "zhun\0zhuo\0zi\0zong\0zou\0zu\0zuan\0zui\0zun\0zuo";
+
+/**
+ * @brief pinyin hash displacements of every bucket
+ */
+static const uint16_t gs_pinyin_disp[LD3320_PINYIN_BUCKET_NUM] =
+{
+    0x0000, 0x0046, 0x0004, 0x0006, 0x0001, 0x0000, 0x00D5, 0x0003, 0x0009, 0x0144, 0x0025, 0x0002,
+    0x0003, 0x006E, 0x0004, 0x0000, 0x001C, 0x0007, 0x0030, 0x009D, 0x0001, 0x0031, 0x00A2, 0x007C,
+    0x00AF, 0x0000, 0x0002, 0x0024, 0x002E, 0x0002, 0x0003, 0x0039, 0x001B, 0x0000, 0x0004, 0x0012,
+    0x0000, 0x0000, 0x0008, 0x0005, 0x00F6, 0x0000, 0x0015, 0x0047, 0x0007, 0x000B, 0x005B, 0x001C,
+    0x0001, 0x0005, 0x000E, 0x0000, 0x0000, 0x0023, 0x0004, 0x00ED, 0x005D, 0x000C, 0x0018, 0x0007,
+    0x009F, 0x000A, 0x0008, 0x0190, 0x008C, 0x0000, 0x0001, 0x00BB, 0x0000, 0x00AB, 0x00D0, 0x0010,
+    0x0004, 0x0014, 0x020F, 0x0012, 0x000E, 0x0000, 0x0002, 0x0007, 0x002A, 0x000A, 0x00BD, 0x000D,
+    0x006B, 0x000D, 0x0004, 0x0000, 0x0005, 0x0000, 0x000F, 0x0030, 0x0002, 0x000C, 0x002C, 0x002C,
+    0x003E, 0x0003, 0x0004, 0x0014, 0x0057, 0x0000, 0x0003, 0x00B4, 0x0003, 0x0017, 0x0000, 0x0058,
+    0x0156, 0x0002, 0x0010, 0x000B, 0x0001, 0x0000, 0x0006, 0x0000, 0x0006, 0x0010, 0x000B, 0x0055,
+    0x0010, 0x001B, 0x0000, 0x00B6, 0x000D, 0x000E, 0x008D, 0x0035, 0x0048, 0x004A, 0x0019, 0x0011,
+    0x012A, 0x0014, 0x0054, 0x0001, 0x013D, 0x002B, 0x0001, 0x010A, 0x001F, 0x0017, 0x0003, 0x009F,
+    0x0046, 0x0054, 0x000D, 0x0000, 0x0000, 0x002F, 0x0000, 0x0012, 0x0071, 0x0008, 0x0039, 0x0013,
+    0x001B, 0x0069, 0x001D, 0x0000, 0x0002, 0x0003, 0x0003, 0x0003, 0x003A, 0x000C, 0x0004, 0x002B,
+    0x0002, 0x0003, 0x0006, 0x0003, 0x0002, 0x0024, 0x000A, 0x0106, 0x0034, 0x000F, 0x00D7, 0x001C,
+    0x0008, 0x00EF, 0x000B, 0x0000, 0x00AC, 0x0048, 0x0002, 0x0008, 0x0001, 0x0007, 0x0006, 0x0001,
+    0x0005, 0x0000, 0x000D, 0x0002, 0x00C2, 0x0030, 0x0013, 0x0004, 0x006E, 0x00AB, 0x0000, 0x0034,
+    0x0003, 0x0015, 0x0024, 0x002A, 0x0001, 0x00B3, 0x0000, 0x00E4, 0x000B, 0x006B, 0x006C, 0x001C,
+    0x000D, 0x0003, 0x0021, 0x0010, 0x0006, 0x001F, 0x00F0, 0x001C, 0x0079, 0x00B9, 0x0055, 0x0000,
+    0x000E, 0x0015, 0x0108, 0x0000, 0x0035, 0x0069, 0x0000, 0x001F, 0x0008, 0x0074, 0x0010, 0x000A,
+    0x006E, 0x0088, 0x009E, 0x0028, 0x000E, 0x0000, 0x0005, 0x002E, 0x0077, 0x000D, 0x0004, 0x0001,
+    0x0029, 0x000C, 0x003B, 0x0000, 0x0047, 0x0112, 0x0003, 0x0015, 0x0034, 0x00A3, 0x016E, 0x0002,
+    0x0012, 0x0015, 0x007C, 0x0015, 0x0086, 0x002D, 0x0000, 0x0002, 0x008D, 0x0016, 0x0055, 0x0000,
+    0x0002, 0x0006, 0x0057, 0x001D, 0x000C, 0x0001, 0x0004, 0x0003, 0x0069, 0x0005, 0x001B, 0x0000,
+    0x0006, 0x0092, 0x0125, 0x0062, 0x0054, 0x000E, 0x0001, 0x0011, 0x0009, 0x0005, 0x00D9, 0x0000,
+    0x0004, 0x0045, 0x02CA, 0x0003, 0x0013, 0x0018, 0x0002, 0x009B, 0x002E, 0x0025, 0x0020, 0x00A9,
+    0x0003, 0x0016, 0x0004, 0x000E, 0x0039, 0x0035, 0x0004, 0x000D, 0x0014, 0x0001, 0x0002, 0x00F0,
+    0x0065, 0x0019, 0x001B, 0x008E, 0x005B, 0x003D, 0x000B, 0x00D5, 0x002C, 0x0006, 0x00BF, 0x0000,
+    0x0040, 0x0004, 0x0028, 0x0008, 0x000D, 0x0002, 0x0003, 0x0014, 0x000F, 0x0007, 0x0002, 0x0001,
+    0x0006, 0x0048, 0x000B, 0x0002, 0x000F, 0x0012, 0x0000, 0x0001, 0x006B, 0x00C8, 0x0022, 0x01A0,
+    0x0098, 0x0053, 0x0005, 0x0005, 0x000D, 0x008B, 0x000D, 0x0010, 0x006A, 0x0000, 0x00B7, 0x000C,
+    0x000D, 0x0004, 0x0033, 0x0002, 0x0000, 0x0009, 0x0001, 0x0043, 0x0019, 0x018E, 0x0032, 0x010A,
+    0x028F, 0x00A9, 0x001E, 0x0007, 0x000C, 0x0000, 0x0003, 0x001F, 0x002E, 0x0003, 0x005C, 0x0000,
+    0x001A, 0x0001, 0x0003, 0x0073, 0x002E, 0x0003, 0x001A, 0x000C, 0x00BA, 0x000A, 0x007A, 0x0001,
+    0x0022, 0x002F, 0x0011, 0x0000, 0x00AC, 0x0000, 0x0045, 0x004E, 0x027A, 0x0002, 0x0004, 0x0002,
+    0x000E, 0x0049, 0x005A, 0x000E, 0x0000, 0x0025, 0x0019, 0x0037, 0x0019, 0x025C, 0x0006, 0x0013,
+    0x0000, 0x0005, 0x006D, 0x0000, 0x0025, 0x0103, 0x0026, 0x0005, 0x0005, 0x000A, 0x0000, 0x0008,
+    0x015C, 0x0002, 0x0043, 0x0024, 0x0027, 0x0089, 0x002C, 0x0002, 0x0105, 0x002E, 0x0008, 0x005A,
+    0x026F, 0x0002, 0x000A, 0x0002, 0x0001, 0x0000, 0x0006, 0x0000, 0x0002, 0x0000, 0x0002, 0x0001,
+    0x0000, 0x00B4, 0x005D, 0x0033, 0x0000, 0x002A, 0x0021, 0x00E2, 0x0099, 0x0002, 0x0075, 0x0031,
+    0x0008, 0x0017, 0x0057, 0x001F, 0x0015, 0x0039, 0x0004, 0x0028, 0x0007, 0x0019, 0x0000, 0x0006,
+    0x0038, 0x0021, 0x0010, 0x000B, 0x0016, 0x003A, 0x0000, 0x0057, 0x001B, 0x00C2, 0x003F, 0x001C,
+    0x0000, 0x0006, 0x001F, 0x0009, 0x0007, 0x0011, 0x0001, 0x00E3, 0x0064, 0x0032, 0x0016, 0x0122,
+    0x0000, 0x002C, 0x006F, 0x0000, 0x007B, 0x00A4, 0x016D, 0x0000, 0x0073, 0x0008, 0x007A, 0x0003,
+    0x0000, 0x000F, 0x0000, 0x0420, 0x0014, 0x0013, 0x0019, 0x0000, 0x0005, 0x0003, 0x002B, 0x0098,
+    0x0035, 0x009C, 0x003F, 0x00BB, 0x0003, 0x0008, 0x0022, 0x0001, 0x0037, 0x0000, 0x003F, 0x0055,
+    0x001D, 0x000B, 0x0095, 0x007A, 0x0002, 0x00CE, 0x0020, 0x005C, 0x0000, 0x0000, 0x00DA, 0x0020,
+    0x0005, 0x0005, 0x001A, 0x0002, 0x0000, 0x0008, 0x0035, 0x0019, 0x0005, 0x0095, 0x0000, 0x0097,
+    0x0000, 0x000B, 0x0126, 0x0003, 0x0009, 0x0008, 0x0032, 0x0009, 0x0000, 0x0026, 0x0000, 0x0013,
+    0x0000, 0x0008, 0x006E, 0x0008, 0x03A5, 0x0006, 0x00E1, 0x00DD, 0x0125, 0x00C5, 0x001B, 0x0010,
+    0x0052, 0x002C, 0x000D, 0x0000, 0x0002, 0x004C, 0x00A0, 0x000C, 0x0000, 0x0072, 0x0019, 0x00C2,
+    0x002B, 0x0022, 0x000D, 0x0000, 0x009B, 0x0008, 0x002A, 0x0004, 0x000B, 0x003A, 0x00BB, 0x0167,
+    0x00A4, 0x0009, 0x0003, 0x0039, 0x0000, 0x000D, 0x000A, 0x003D, 0x004F, 0x0001, 0x003E, 0x00BD,
+    0x000B, 0x0331, 0x0116, 0x0243, 0x0000, 0x000C, 0x0006, 0x000A, 0x0003, 0x0000, 0x0087, 0x0000,
+    0x0000, 0x000C, 0x001C, 0x001F, 0x0097, 0x00F5, 0x0000, 0x0000, 0x01EC, 0x0020, 0x0028, 0x000A,
+    0x0029, 0x0189, 0x0017, 0x00AF, 0x0009, 0x0010, 0x0000, 0x009B, 0x0088, 0x0010, 0x002A, 0x0116,
+    0x000D, 0x0055, 0x0008, 0x002E, 0x0295, 0x004D, 0x005F, 0x0040, 0x0006, 0x0005, 0x0000, 0x0194,
+    0x000E, 0x0021, 0x006A, 0x0000, 0x0004, 0x0001, 0x0000, 0x000C, 0x0011, 0x001B, 0x0004, 0x001C,
+    0x01CC, 0x0002, 0x0002, 0x00BE, 0x0035, 0x0023, 0x01CD, 0x0005, 0x006F, 0x0000, 0x0003, 0x004D,
+    0x0026, 0x001C, 0x0039, 0x00EE, 0x0003, 0x000E, 0x000A, 0x0041, 0x0044, 0x003E, 0x00A2, 0x0000,
+    0x000B, 0x000C, 0x0316, 0x0000, 0x0004, 0x002B, 0x0043, 0x0031, 0x006C, 0x0047, 0x0000, 0x000B,
+    0x0000, 0x0019, 0x0048, 0x0442, 0x0001, 0x0030, 0x0003, 0x000F, 0x0089, 0x0000, 0x0002, 0x008B,
+    0x0004, 0x003B, 0x020F, 0x0083, 0x0215, 0x0007, 0x0189, 0x006D, 0x0000, 0x001B, 0x003E, 0x00FB,
+    0x0001, 0x000D, 0x0034, 0x0039, 0x0001, 0x002F, 0x0004, 0x002B, 0x0021, 0x0022, 0x0051, 0x005A,
+    0x0109, 0x01FF, 0x006B, 0x0006, 0x00AA, 0x0096, 0x009B, 0x0020, 0x0003, 0x01F5, 0x000A, 0x007D,
+    0x0012, 0x001A, 0x0023, 0x0033, 0x0005, 0x0012, 0x0000, 0x0049, 0x0016, 0x00E3, 0x0018, 0x0057,
+    0x0153, 0x0039, 0x003D, 0x0011, 0x0027, 0x0000, 0x018C, 0x001C, 0x0002, 0x019F, 0x0013, 0x000C,
+    0x0016, 0x00FE, 0x00FA, 0x0109, 0x01F2, 0x002E, 0x0088, 0x00D4, 0x0003, 0x041C, 0x01D4, 0x0297,
+    0x006E, 0x001F, 0x0021, 0x0006, 0x0002, 0x0036, 0x0003, 0x004A, 0x00D6, 0x0009, 0x0008, 0x0078,
+    0x008D, 0x0137, 0x000D, 0x00E0, 0x0005, 0x0002, 0x0027, 0x0003, 0x0006, 0x0133, 0x00C2, 0x0011,
+    0x004C, 0x000C, 0x005D, 0x0029, 0x0028, 0x0000, 0x002D, 0x0008, 0x0068, 0x0036, 0x0046, 0x0336,
+    0x0055, 0x00B2, 0x0035, 0x02E0, 0x0004, 0x004B, 0x00BF, 0x0002, 0x0000, 0x000C, 0x0000, 0x012C,
+    0x0001, 0x0008, 0x00B8, 0x000F, 0x0002, 0x0159, 0x0000, 0x0463, 0x0005, 0x0000, 0x005A, 0x0056,
+    0x0000, 0x0017, 0x0000, 0x02DB, 0x0120, 0x00EA, 0x0008, 0x000B, 0x0047, 0x031B, 0x0001, 0x001C,
+    0x0011, 0x0005, 0x009A, 0x0482, 0x0000, 0x02C4, 0x0000, 0x006E, 0x03B8, 0x0004, 0x0000, 0x0000,
+    0x0001, 0x0087, 0x0150, 0x0007, 0x0002, 0x0000, 0x0005, 0x0000, 0x001D, 0x000C, 0x00CD, 0x0002,
+    0x0085, 0x0000, 0x0145, 0x0007, 0x0046, 0x03AD, 0x0A16, 0x002C, 0x013E, 0x0000, 0x0004, 0x0014,
+    0x00BE, 0x026D, 0x0621, 0x000A, 0x0000, 0x033F, 0x0007, 0x0045, 0x0073, 0x01DA, 0x0055, 0x0055,
+    0x0007, 0x013F, 0x0016, 0x0000, 0x00A1, 0x005D, 0x0222, 0x002C, 0x0005, 0x0015, 0x002D, 0x0016,
+    0x0000, 0x000C, 0x000C, 0x0002, 0x0044, 0x000A, 0x0034, 0x02E7, 0x00EE, 0x0000, 0x002F, 0x00C1,
+    0x0000, 0x00B4, 0x0000, 0x0034, 0x0000, 0x0031, 0x01F8, 0x000E, 0x0122, 0x000B, 0x0147, 0x0066,
+    0x0006, 0x00B4, 0x0014, 0x006A, 0x001C, 0x0027, 0x0001, 0x009F, 0x000F, 0x0004, 0x01C1, 0x0001,
+    0x0001, 0x01AC, 0x0007, 0x0080, 0x02F0, 0x0001, 0x0008, 0x0051, 0x01E9, 0x0085, 0x0103, 0x0168,
+    0x0044, 0x0277, 0x0007, 0x00E5, 0x0148, 0x0087, 0x0041, 0x01BD, 0x0002, 0x0003, 0x0001, 0x002E,
+    0x03E3, 0x0026, 0x02D5, 0x00F2, 0x0170, 0x0159, 0x0008, 0x018D, 0x00A5, 0x0067, 0x000A, 0x0003,
+    0x0074, 0x0277, 0x0003, 0x00EB, 0x0008, 0x0001, 0x002B, 0x0109, 0x00C4, 0x0167, 0x0010, 0x0000,
+    0x005E, 0x0017, 0x0000, 0x0202, 0x00E0, 0x0042, 0x001B, 0x0060, 0x001D, 0x004C, 0x0004, 0x000F,
+    0x01AE, 0x0000, 0x00B4, 0x0025, 0x000E, 0x0020, 0x0020, 0x0000, 0x0013, 0x0006, 0x0027, 0x0120,
+    0x0003, 0x0071, 0x0022, 0x0000, 0x0023, 0x0000, 0x0022, 0x0338, 0x0037, 0x00E3, 0x003F, 0x00BE,
+    0x0019, 0x00A9, 0x0036, 0x0118, 0x001C, 0x0000, 0x0003, 0x0149, 0x034D, 0x0007, 0x013E, 0x0018,
+    0x0018, 0x000B, 0x0012, 0x012A, 0x002A, 0x0003, 0x0004, 0x0025, 0x0011, 0x000B, 0x0049, 0x0000,
+    0x005F, 0x0094, 0x0013, 0x000B, 0x0000, 0x0018, 0x001A, 0x000F, 0x0104, 0x0002, 0x005B, 0x000B,
+    0x0077, 0x0004, 0x0000, 0x0101, 0x0007, 0x01F4, 0x0011, 0x0078, 0x0006, 0x0123, 0x0004, 0x057F,
+    0x007D, 0x0001, 0x0002, 0x0040, 0x0011, 0x01B0, 0x0073, 0x0003, 0x00DF, 0x0193, 0x0009, 0x000A,
+    0x0096, 0x0009, 0x0000, 0x000C, 0x002D, 0x0006, 0x004A, 0x000C, 0x0092, 0x0000, 0x0011, 0x0043,
+    0x0015, 0x0010, 0x0332, 0x0019, 0x0012, 0x0085, 0x0064, 0x0072, 0x0043, 0x01E8, 0x026E, 0x0003,
+    0x0001, 0x00DF, 0x0019, 0x0373, 0x0055, 0x015A, 0x0052, 0x01CE, 0x01C9, 0x0000, 0x0000, 0x0235,
+    0x0014, 0x0302, 0x0000, 0x006C, 0x0032, 0x0005, 0x00B6, 0x0305, 0x0039, 0x009E, 0x00F5, 0x0016,
+    0x02DB, 0x00A1, 0x0007, 0x0000, 0x00FF, 0x0030, 0x0093, 0x0001, 0x000C, 0x0062, 0x0009, 0x013C,
+    0x0020, 0x001A, 0x0000, 0x0015, 0x01F6, 0x00C2, 0x00DE, 0x00C1, 0x0542, 0x0002, 0x0026, 0x0426,
+    0x0489, 0x0001, 0x0083, 0x01BF, 0x003D, 0x00C9, 0x0532, 0x000A, 0x001A, 0x0002, 0x00C4, 0x0017,
+    0x00C1, 0x03B2, 0x07C7, 0x001F, 0x003A, 0x004E, 0x0031, 0x0019, 0x002D, 0x0080, 0x00DD, 0x0000,
+    0x0005, 0x0027, 0x0295, 0x005A, 0x000F, 0x01DF, 0x0004, 0x0015, 0x0001, 0x0008, 0x0052, 0x00C9,
+    0x014F, 0x005F, 0x004F, 0x027D, 0x0129, 0x0074, 0x0009, 0x0022, 0x0025, 0x000D, 0x02C9, 0x0000,
+    0x0001, 0x0001, 0x002A, 0x0004, 0x0036, 0x0451, 0x00D7, 0x007E, 0x06CA, 0x010D, 0x0005, 0x0001,
+    0x011D, 0x0031, 0x004C, 0x0079, 0x0027, 0x00AC, 0x000C, 0x0027, 0x003F, 0x0050, 0x0018, 0x00B9,
+    0x0002, 0x004F, 0x0000, 0x00A8, 0x0020, 0x02B3, 0x00DB, 0x0000, 0x0069, 0x002A, 0x000E, 0x0396,
+    0x0303, 0x0018, 0x0002, 0x0004, 0x0004, 0x0001, 0x000E, 0x000C, 0x009C, 0x0124, 0x0451, 0x0000,
+    0x07F7, 0x000E, 0x0011, 0x03D1, 0x0051, 0x0014, 0x0026, 0x0000, 0x00E0, 0x0260, 0x01F0, 0x003B,
+    0x0008, 0x0016, 0x0012, 0x01E8, 0x0021, 0x002F, 0x000C, 0x0132, 0x0183, 0x002B, 0x046E, 0x0002,
+    0x022C, 0x000D, 0x025E, 0x05CF, 0x008B, 0x0000, 0x0033, 0x007B, 0x0072, 0x00E0, 0x01A2, 0x0000,
+    0x0018, 0x01BD, 0x0177, 0x0002, 0x004E, 0x00A1, 0x058C, 0x0158, 0x000F, 0x051D, 0x0008, 0x0056,
+    0x0057, 0x0052, 0x012C, 0x000D, 0x0036, 0x01D3, 0x0199, 0x00EF, 0x0423, 0x0002, 0x001A, 0x0066,
+    0x008A, 0x03C8, 0x0049, 0x00D6, 0x0030, 0x0020, 0x0000, 0x0160, 0x012B, 0x0006, 0x0771, 0x0082,
+    0x00BA, 0x0001, 0x00D1, 0x0563, 0x0136, 0x00B8, 0x0003, 0x00B6, 0x01DB, 0x0045, 0x0119, 0x0002,
+    0x0001, 0x027F, 0x0002, 0x07C7, 0x0016, 0x0002, 0x0076, 0x01C2, 0x0405, 0x0080, 0x01A6, 0x0029,
+    0x0017, 0x007F, 0x000D, 0x015F, 0x018E, 0x0000, 0x00FB, 0x000D, 0x0017, 0x0065, 0x0001, 0x022C,
+    0x0139, 0x0237, 0x0001, 0x00F1, 0x000A, 0x007B, 0x0316, 0x0001, 0x0038, 0x0007, 0x003A, 0x0007,
+    0x0149, 0x0E50, 0x0524, 0x01F1, 0x018C, 0x01C7, 0x0230, 0x001E, 0x0002, 0x0020, 0x0025, 0x005E,
+    0x01A9, 0x0001, 0x006B, 0x0000, 0x0056, 0x00C0, 0x0039, 0x007B, 0x0020, 0x0700, 0x00F1, 0x06A1,
+    0x030F, 0x0013, 0x03C2, 0x005D, 0x0025, 0x003C, 0x008D, 0x0075, 0x00E6, 0x0012, 0x0036, 0x0009,
+    0x0001, 0x0005, 0x0474, 0x0283, 0x02D1, 0x0863, 0x02E3, 0x000C, 0x03C2, 0x0011, 0x0000, 0x0006,
+    0x0000, 0x010D, 0x0070, 0x0007, 0x0009, 0x0034, 0x0168, 0x00B9, 0x0188, 0x0032, 0x0000, 0x00E9,
+    0x0088, 0x0385, 0x01C8, 0x04A3, 0x0000, 0x047C, 0x0010, 0x000D, 0x0062, 0x0654, 0x0008, 0x0092,
+    0x019C, 0x0026, 0x0017, 0x07B1, 0x0000, 0x0028, 0x015F, 0x00AB, 0x0067, 0x00B9, 0x00BA, 0x06FA,
+    0x0000, 0x00D8, 0x003C, 0x017D, 0x0176, 0x0071, 0x0114, 0x0000, 0x0040, 0x05E8, 0x02ED, 0x0081,
+    0x001B, 0x013F, 0x00BE, 0x0438, 0x010B, 0x01AC, 0x0432, 0x0000, 0x0005, 0x009F, 0x0163, 0x0015,
+    0x0001, 0x0000, 0x00A7, 0x004A, 0x0000, 0x0010, 0x00BA, 0x0140, 0x01CA, 0x056F, 0x0179, 0x0009,
+    0x0003, 0x0002, 0x01C6, 0x0000, 0x0007, 0x079D, 0x0924, 0x0785, 0x00AF, 0x001D, 0x00B6, 0x0010,
+    0x0016, 0x0074, 0x0131, 0x06AE, 0x000B, 0x0041, 0x0501, 0x007F, 0x0010, 0x01BC, 0x001A, 0x0384,
+    0x0001, 0x0025, 0x009F, 0x0000, 0x00A4, 0x0008, 0x01FA, 0x0000, 0x0E4A, 0x0A8C, 0x003F, 0x002C,
+    0x00FF, 0x0291, 0x0003, 0x0045, 0x0051, 0x0041, 0x0820, 0x0003, 0x038D, 0x047C, 0x01B9, 0x00A9,
+    0x0006, 0x0000, 0x0004, 0x184E, 0x0175, 0x0001, 0x013C, 0x0100, 0x003C, 0x0000, 0x0002, 0x0001,
+    0x0000, 0x037C, 0x05A6, 0x0008, 0x04F4, 0x0003, 0x00EB, 0x0086, 0x0002, 0x01FD, 0x0004, 0x005B,
+    0x0555, 0x0040, 0x00F2, 0x0020, 0x03CB, 0x01C6, 0x0518, 0x02AD, 0x04E5, 0x0003, 0x0004, 0x0007,
+    0x002E, 0x0086, 0x00C8, 0x1018, 0x0004, 0x0000, 0x08C8, 0x0694, 0x0000, 0x0091, 0x0000, 0x010B,
+    0x1682, 0x03CE, 0x001E, 0x0023, 0x0006, 0x0000, 0x0D86, 0x0006, 0x0000, 0x0068, 0x050F, 0x01BD,
+    0x0207, 0x0078, 0x0002, 0x005C, 0x0004, 0x0000, 0x0970, 0x2115, 0x0000, 0x0089, 0x0000, 0x03BB,
+    0x035A, 0x0092, 0x020D, 0x01FD, 0x0002, 0x034E, 0x0444, 0x1E5A, 0x00CE, 0x39BC, 0x05B6, 0x2634,
+    0x0037, 0x0023, 0x0585, 0x0029, 0x00A1, 0x009C, 0x060B, 0x013E, 0x01F6, 0x049B, 0x0027, 0x25A4,
+    0x1261, 0x0000, 0x007C, 0x0001, 0x0001, 0x000D, 0x0049, 0x01A8, 0x16EB, 0x014B, 0x0002
+};
+
+/**
+ * @brief pinyin hash keys, code point - 0x4E00 in bit 0 - 14, syllable bit 8 in bit 15
+ */
+static const uint16_t gs_pinyin_key[LD3320_PINYIN_CODE_NUM] =
+{
+    0x288B, 0x312A, 0x1F2A, 0xC361, 0x817F, 0xB563, 0x1E60, 0x85C8, 0xA090, 0x30E0, 0x48C7, 0xC280,
+    0x29F8, 0x0DE1, 0xBE11, 0x03E4, 0x1406, 0x3851, 0x02A8, 0x97AB, 0x175B, 0x4C97, 0x1A85, 0xB318,
+    0xAA6C, 0x2AC5, 0x0BF9, 0x8F16, 0x30EE, 0x2D9D, 0x1A3C, 0x4B6C, 0x9989, 0x08BC, 0x8027, 0x01A5,
+    0xD048, 0x3FEC, 0xAE0C, 0x00CA, 0x29ED, 0x3611, 0x35F1, 0x1074, 0xA017, 0x9931, 0xA086, 0x32E7,
+    0x8B86, 0xC283, 0xA896, 0x29BD, 0xC250, 0x944E, 0x8E49, 0x4C9C, 0xA2BB, 0x9AAD, 0xB3B3, 0x9FFB,
+    0x295B, 0x1A48, 0x9DF5, 0xB87E, 0x245F, 0x1E1A, 0x102E, 0x11E1, 0x202F, 0xB3C3, 0x2908, 0x30A5,
+    0xC3A3, 0x234E, 0x366D, 0x34C1, 0x473E, 0x2B80, 0x48F3, 0x97C3, 0x06DA, 0xC8A7, 0x15FF, 0x0C09,
+    0x94F3, 0x4362, 0x28D7, 0xC374, 0x0032, 0x0D93, 0x9D43, 0x0BAB, 0x9C28, 0xA82B, 0x068E, 0x0B1A,
+    0x0E34, 0x873E, 0x11FE, 0x093A, 0xB4B8, 0x9E6A, 0x504E, 0x1935, 0x11FF, 0x0D71, 0x8346, 0x95CE,
+    0x8E38, 0x18AE, 0x27E2, 0xB410, 0x30DC, 0x01FE, 0x3F42, 0x9EBB, 0x08F0, 0x503E, 0x9852, 0x116A,
+    0x32DE, 0x4A81, 0xA06E, 0x1582, 0x8BCA, 0xC849, 0x3592, 0x122B, 0x116C, 0x3DB0, 0x423B, 0x15AE,
+    0x427D, 0x1118, 0xB39B, 0x927D, 0x8834, 0x245B, 0x18F9, 0x01A8, 0x1B6E, 0x2596, 0xA730, 0x14C6,
+    0xB871, 0x1E16, 0x95E0, 0x20B1, 0xBDFC, 0x0DBE, 0xC8C0, 0xA2AB, 0x16D0, 0x4188, 0xB1A7, 0x2591,
+    0x901A, 0x06E7, 0x14CD, 0x38FE, 0xA12A, 0x3772, 0xBC89, 0xC75B, 0xB6B4, 0x0871, 0x8C32, 0x3162,
+    0x41BE, 0x4685, 0x20A5, 0x9F27, 0x11CC, 0x3227, 0x0775, 0x043D, 0x2326, 0x85D7, 0x95A8, 0x1555,
+    0x8B58, 0x3BC1, 0xC2AE, 0xB66C, 0x2BBB, 0x17C6, 0x9320, 0xB0B9, 0x14EE, 0x33EC, 0x94BC, 0x94FD,
+    0x5082, 0xB49D, 0x0798, 0x0214, 0xC322, 0x8706, 0x3F81, 0x34A4, 0x46FC, 0x2980, 0x0FEE, 0x2275,
+    0x11B7, 0xC6CA, 0x4EDC, 0x02A9, 0x30D7, 0x2D04, 0x11F1, 0x493E, 0x46A0, 0x360D, 0x356D, 0x25CF,
+    0x3479, 0x49A0, 0x8138, 0xB12B, 0x2AD0, 0x1437, 0x0B39, 0x076E, 0xAB5A, 0x3682, 0xB3F3, 0x9EBE,
+    0x9166, 0x981F, 0x3130, 0x2296, 0x0BB2, 0x2893, 0xAEC1, 0x3AC9, 0xA7EB, 0x0D95, 0x074A, 0x35F0,
+    0x162C, 0xB540, 0x1827, 0x3435, 0xA779, 0xB0FC, 0x10B3, 0x9523, 0x4ED4, 0x3DA3, 0x2D1E, 0x1273,
+    0x03F9, 0x4C6C, 0x38EE, 0x2EAE, 0x403D, 0x25DE, 0x3AF1, 0x8403, 0x44AE, 0x962A, 0x3F36, 0x1FAB,
+    0x3603, 0x21D1, 0xAC33, 0xC90E, 0x4804, 0x2D4B, 0xAD0A, 0x425B, 0x35C1, 0x3586, 0x8755, 0x2438,
+    0x4938, 0x17C5, 0xA0E0, 0x061D, 0xB6C9, 0x071B, 0x438C, 0x272B, 0xA800, 0x1502, 0x4190, 0xA0AA,
+    0xA537, 0xB434, 0x1E46, 0xB40D, 0x2319, 0x1A67, 0xA5BA, 0x4765, 0xC00F, 0x3E24, 0x0CD4, 0x12ED,
+    0x1F25, 0xB1B2, 0x4206, 0x97E5, 0x10FE, 0x1A0A, 0x0628, 0xB047, 0xAE9F, 0x4379, 0x3258, 0xB676,
+    0x98B9, 0x0C4A, 0xA366, 0x1843, 0x243F, 0x0FF4, 0x4ECD, 0xA014, 0x50E5, 0x05C2, 0x0E97, 0x892C,
+    0x3F2F, 0x0787, 0x8E27, 0x85CB, 0xBA4C, 0xC757, 0x3BDA, 0xAF77, 0x323F, 0x0800, 0x3391, 0xA01D,
+    0xCEC3, 0x3546, 0x4ACE, 0x38DE, 0xA58B, 0x910B, 0xD117, 0x802D, 0x3DB9, 0x3310, 0x368E, 0x0E61,
+    0x38AF, 0x1DD9, 0xB4D5, 0x214B, 0x86EE, 0x1F9F, 0x05C9, 0x099B, 0x0603, 0x2A98, 0x94D3, 0x8D34,
+    0x09F9, 0xC389, 0x03FD, 0x0876, 0xB12F, 0x204E, 0x8341, 0xCCD3, 0x28FC, 0x2888, 0x9C84, 0xCB90,
+    0xCB68, 0x8BA4, 0x8744, 0x3697, 0xA854, 0xCE90, 0x8B82, 0x1F78, 0x43CF, 0x2F27, 0x0F1B, 0x07E5,
+    0x41A3, 0x1B12, 0x981D, 0x2830, 0x8419, 0x2102, 0x9A76, 0xCB6B, 0x8563, 0x862E, 0x037C, 0x2521,
+    0x36EC, 0x32AA, 0x2799, 0x1140, 0xA7F0, 0x2A12, 0xBE06, 0x9D47, 0x0D81, 0xA14D, 0x8AC5, 0x095F,
+    0x920D, 0x3F54, 0x4235, 0x2F2F, 0x1A81, 0x99B3, 0x0992, 0x1951, 0x2ACB, 0x11EB, 0x9F82, 0x8C31,
+    0x0093, 0x3217, 0x9644, 0x17E2, 0x3FBC, 0x01A7, 0x0839, 0x2A45, 0x484C, 0x3B02, 0xB6B8, 0x853B,
+    0x15BA, 0xA0AF, 0x2289, 0x421E, 0x1E74, 0x4A91, 0x1562, 0x28A4, 0x2AB1, 0x8B37, 0xA7CD, 0x9800,
+    0x951D, 0xCB80, 0x8C05, 0xB85E, 0x9725, 0x99DE, 0x49B4, 0x041B, 0x82A5, 0xB359, 0x0450, 0xAD97,
+    0xAEC8, 0x3FDB, 0xAD24, 0x216E, 0x2C46, 0x14D8, 0x48C6, 0x91AD, 0xAC00, 0x109C, 0x1096, 0x8B16,
+    0x0219, 0x3AB7, 0xBB2A, 0x1E4A, 0x176C, 0x0CC1, 0x1A32, 0x3179, 0x4814, 0x3109, 0x4772, 0x46AC,
+    0x2884, 0x282A, 0x9447, 0xBB44, 0x0CE0, 0xB37F, 0x2E27, 0xCC77, 0x06A3, 0x865C, 0x8765, 0x1FFC,
+    0x393B, 0x1734, 0x429D, 0xBDEF, 0x0022, 0x096F, 0xBFD6, 0x12E0, 0x30DE, 0x1868, 0x4810, 0x9516,
+    0x2043, 0x46BE, 0x1235, 0x9FE4, 0xAE2A, 0x14F1, 0x03B2, 0x4EB5, 0x46B5, 0x8AE4, 0x48F6, 0x8D8B,
+    0xCED9, 0x081B, 0x1BF2, 0x3964, 0x3BD6, 0x081E, 0x4D54, 0x2513, 0x3E1F, 0x34A1, 0x3711, 0x01F3,
+    0x3BC9, 0x4375, 0x142E, 0x4A80, 0x00EB, 0x5113, 0x0FE7, 0xC876, 0x2907, 0x3B12, 0x0FC5, 0x9511,
+    0x1EDB, 0x1F53, 0x094F, 0xBDA4, 0x2B62, 0x8D40, 0x85A3, 0x97E0, 0x5199, 0x9C3D, 0x2316, 0x05E6,
+    0x483D, 0x4D45, 0xB988, 0x03F0, 0x0F47, 0x46D0, 0x080F, 0x2B05, 0x1F1E, 0x9EF0, 0x4040, 0xC196,
+    0x3108, 0x3F29, 0x249F, 0x1EEE, 0x2235, 0x46F0, 0x26F7, 0xC1D0, 0xCC9F, 0x486A, 0xACF9, 0x5020,
+    0x80EA, 0xBBCB, 0x820F, 0xCB96, 0x50FC, 0x1646, 0x3DD9, 0xA309, 0x040D, 0xC835, 0x1B88, 0xBF91,
+    0x092D, 0x22C2, 0x32A1, 0x21EE, 0x35CA, 0x1D79, 0x286F, 0x1766, 0x384E, 0x8469, 0x3606, 0x80E5,
+    0x3E46, 0x1AF1, 0x4874, 0x163D, 0x05FC, 0x940C, 0xA929, 0x8150, 0xBE0A, 0x03CF, 0xAD2B, 0x1CAC,
+    0xA65E, 0xC6F8, 0x0862, 0x4211, 0x104C, 0x3116, 0x0A20, 0xB953, 0xCD48, 0xA71F, 0x06FF, 0x3505,
+    0x3862, 0x1DCD, 0x186E, 0x1C0A, 0x423C, 0x8A02, 0x00EC, 0x3474, 0x149A, 0x507F, 0x1667, 0xC201,
+    0x32BC, 0x1EA6, 0x1E94, 0x46D6, 0x0808, 0x41A8, 0x003E, 0x065B, 0x9C3E, 0xA8F4, 0x4268, 0x946B,
+    0x0101, 0x0589, 0xA676, 0x8091, 0x9EA9, 0x8DA4, 0x379C, 0x2968, 0xAD19, 0x0AC1, 0x4B8F, 0x2B48,
+    0x92FA, 0x1520, 0x1563, 0x5122, 0x401F, 0x0225, 0xA98D, 0x46AB, 0x9A11, 0x844A, 0x191F, 0x3BC8,
+    0x817E, 0x84AD, 0x4751, 0x8FE6, 0x1FE0, 0xBA4D, 0x1B20, 0x0A1E, 0xCB2E, 0x2484, 0x48B3, 0xAB3A,
+    0xB89C, 0x2D03, 0x128D, 0xA0CB, 0xBDD1, 0x9787, 0xC8C1, 0x8B96, 0xB0B1, 0xACE5, 0xB9EE, 0x38C9,
+    0x19E2, 0x27B2, 0x1B3F, 0x3FF5, 0x0F4B, 0x39B5, 0x28AE, 0x288E, 0xC6DF, 0x9C1F, 0x46EA, 0xB472,
+    0x2C37, 0x997E, 0x00A5, 0x03F5, 0x0E9B, 0x46A2, 0x4ED7, 0x2538, 0x241D, 0x0DB8, 0x24B8, 0x095D,
+    0x1B80, 0x86CD, 0x1790, 0xC7EE, 0x8A85, 0xC6D8, 0x05CA, 0x97ED, 0x0617, 0xB5BA, 0x3F46, 0x9A50,
+    0x16CD, 0x2833, 0x50E2, 0x475C, 0xBF43, 0x042B, 0x434D, 0xC68D, 0xD187, 0xB2AB, 0x0656, 0xA8DB,
+    0x98FF, 0x1877, 0x3369, 0xBF75, 0xBB25, 0x024F, 0x85D4, 0xA7DB, 0x3360, 0x12E7, 0xCEDD, 0x078B,
+    0x46AA, 0xA91A, 0xC9EB, 0xA731, 0xB11C, 0xC210, 0x895E, 0x19EC, 0x849D, 0x987A, 0x9887, 0x0D6A,
+    0xCCA4, 0x31E0, 0x92AC, 0xB2C1, 0x2CCB, 0x36E0, 0x406D, 0x320C, 0x01C3, 0xBDBE, 0x4766, 0x89F8,
+    0x2CA5, 0x0DAB, 0x1791, 0xA368, 0xBDDB, 0x2AE8, 0x9738, 0x8DBF, 0x4992, 0x9161, 0x43B5, 0x05F1,
+    0x3313, 0x8DA1, 0x9259, 0x0069, 0xC817, 0xAB9A, 0x2CA0, 0x2951, 0xBE1A, 0xC9EC, 0xA8CF, 0x482A,
+    0x2EB1, 0xC8CD, 0x5025, 0x1424, 0x35B2, 0x142C, 0xA42A, 0x0604, 0xBE4C, 0xC6BA, 0x157A, 0x1FA4,
+    0x9882, 0x424D, 0x484D, 0x34CD, 0xB551, 0x2461, 0x4E9B, 0x9C61, 0x0696, 0x1E69, 0x064A, 0x946C,
+    0xC907, 0xA9E5, 0x3A6C, 0x95E1, 0x0780, 0x0D75, 0x3511, 0xAD4C, 0x027E, 0x0DF0, 0xA819, 0x333E,
+    0x2DE5, 0x33A8, 0xB5B3, 0xB8DB, 0x3F49, 0x9131, 0x1B87, 0x0A4D, 0x067C, 0x2A93, 0x1026, 0x46F2,
+    0x325A, 0xAA11, 0x2A25, 0xB4B4, 0x30F7, 0x31FB, 0x22AC, 0x46E7, 0x079F, 0xA0B2, 0x19E9, 0xC262,
+    0x0CAA, 0x4D32, 0x19F4, 0x963A, 0x2635, 0xB71A, 0xABDF, 0xC98B, 0xC6C8, 0x02FB, 0x99AD, 0x4CE1,
+    0x081F, 0x8523, 0x3430, 0x9011, 0x46EB, 0x2766, 0x38C4, 0x30BA, 0x9831, 0x4894, 0x393E, 0xAA38,
+    0x3421, 0x1F41, 0x0646, 0x8255, 0xA589, 0x4956, 0x804D, 0x195E, 0x9F4A, 0xCE9F, 0x2516, 0x35B7,
+    0x1296, 0x08DA, 0x0E96, 0x3237, 0x81EE, 0x3DC4, 0xC09C, 0x2534, 0xC6AD, 0xCB74, 0x162D, 0x9F32,
+    0x4B8D, 0x3F31, 0x4474, 0x1B5D, 0x3E6A, 0x251C, 0x286B, 0x1BD4, 0x226C, 0x39CA, 0x48CE, 0xABC0,
+    0x0551, 0x07D4, 0x5057, 0x8BAA, 0x1A8F, 0x0D58, 0x0DD2, 0x2A6D, 0xA27C, 0x8009, 0x1613, 0x0086,
+    0xA02B, 0xBF5D, 0x0E01, 0x35DC, 0x4364, 0x19C4, 0x475D, 0x3492, 0xC736, 0x082D, 0x4CA2, 0x9658,
+    0xA0D5, 0x07D2, 0x837D, 0x2044, 0x4EA4, 0xCD4F, 0x1E8C, 0x80BA, 0xAAB3, 0x8606, 0xB535, 0xA0BB,
+    0x03F3, 0x1F1B, 0x0C5A, 0xC6BD, 0x87FD, 0x217A, 0x20E5, 0x1EA4, 0x1182, 0x4CC5, 0xA2C3, 0xA2E8,
+    0xC6E8, 0x38CF, 0x1425, 0x4A8C, 0x50BB, 0x4363, 0x1917, 0x348E, 0x05D1, 0xB39D, 0x1DBF, 0x0776,
+    0x12F0, 0xAA26, 0xAD45, 0xC80E, 0x46A9, 0x1F94, 0x824C, 0xCEBA, 0x3DCD, 0x077E, 0x0C08, 0x373C,
+    0x1E22, 0x29A0, 0x49AB, 0x39AC, 0x05FD, 0x0B51, 0xB2DC, 0x9FAE, 0x1448, 0x9EF3, 0xB0C8, 0x519A,
+    0x0983, 0x015E, 0x497C, 0x035C, 0x4723, 0x46C6, 0x143F, 0x11C5, 0x80F2, 0x1B24, 0x1D82, 0xC731,
+    0xB917, 0xA5CA, 0x1B63, 0x43A2, 0x938E, 0xC840, 0x419F, 0x8A19, 0x9B79, 0x3A8D, 0xC17E, 0x8710,
+    0xC31E, 0x30F5, 0x0F29, 0x14C8, 0x24D9, 0x8F58, 0x0A21, 0x0A44, 0x4762, 0x9094, 0x2DA9, 0xCCEB,
+    0x196D, 0x138B, 0x40B2, 0x3DFD, 0x5044, 0x2794, 0x0B92, 0x1BC1, 0x4090, 0x158A, 0x0D98, 0xB4D2,
+    0xC721, 0x0D37, 0x48D2, 0x470A, 0x3314, 0x46B4, 0x095C, 0xC7F2, 0x877C, 0x9111, 0xAEC5, 0x0189,
+    0xB9CB, 0x2AFA, 0x1ACD, 0x0E7A, 0x3AFE, 0x3106, 0x915D, 0x0467, 0xA687, 0xB85A, 0x4EBD, 0x2515,
+    0x13D2, 0xA65C, 0x4ECA, 0x05A9, 0x1015, 0x4253, 0x2EB9, 0x27AC, 0x46FE, 0xC868, 0x0930, 0x117B,
+    0x9037, 0x25B7, 0xA835, 0xC711, 0x2034, 0x332F, 0xBA45, 0x811F, 0x09A1, 0x8668, 0x863E, 0xB135,
+    0x27FC, 0x1709, 0xBF2A, 0xC34C, 0x1AE3, 0x0EBD, 0x21C0, 0x926F, 0x0671, 0x3F41, 0x210F, 0x9108,
+    0x23D4, 0xB0DA, 0x20D1, 0x8AEE, 0x8DB4, 0x8436, 0xC3CE, 0x310B, 0x9940, 0x9596, 0xC68A, 0x9E27,
+    0x1095, 0xBDA8, 0x9621, 0x5180, 0x08F9, 0xA8D0, 0x85F0, 0x0566, 0xB128, 0x3675, 0x4D42, 0x2DEA,
+    0x0B7D, 0x1127, 0x4173, 0xA51E, 0x0B4B, 0x0684, 0x35E0, 0x1B01, 0x1473, 0x90F7, 0x0228, 0x944B,
+    0x468C, 0x080C, 0x3E27, 0x1BDF, 0x09E0, 0x825A, 0xA6BA, 0x1561, 0xB70C, 0x519F, 0x2448, 0x20C7,
+    0x1421, 0xC73A, 0x3713, 0xA4ED, 0x4222, 0x049B, 0x17CC, 0xB107, 0x0003, 0xA791, 0xB748, 0x061B,
+    0xA437, 0xB94E, 0x884E, 0x0976, 0x27BD, 0x81DE, 0x88ED, 0x1876, 0xB118, 0x9B86, 0x8C77, 0x8184,
+    0x5045, 0x103C, 0x10FA, 0x1093, 0x3229, 0xA299, 0x0B48, 0x1678, 0xA83F, 0x1F4B, 0x373A, 0x509F,
+    0xAE98, 0x34BE, 0x9EFB, 0x2ECA, 0x1169, 0x1B7C, 0x1700, 0x8A92, 0x06D5, 0x282D, 0x03FC, 0x12AF,
+    0x472F, 0xC4C8, 0x0F1E, 0x336D, 0x8BD2, 0x3811, 0x0CBE, 0x15B8, 0x900F, 0x060D, 0x8B24, 0x08EB,
+    0x1300, 0x41B6, 0x0B83, 0x50BD, 0x11BC, 0x21A7, 0xC214, 0x224F, 0x80A0, 0xB5D8, 0x1220, 0x91EE,
+    0x2735, 0x31E1, 0xB112, 0x122F, 0x3436, 0x0709, 0x9FDE, 0x9F35, 0xC862, 0xA3A8, 0x371F, 0x1FCB,
+    0x27C5, 0x86A4, 0x3957, 0x2522, 0x3105, 0x250E, 0x1DDB, 0x1EDE, 0x9A09, 0x3A0A, 0xAC80, 0x040A,
+    0x1836, 0x88FF, 0x2EE8, 0x1A3E, 0x8073, 0xAAD4, 0xB47A, 0x97A9, 0xA919, 0x1B89, 0x88DB, 0x4166,
+    0xC747, 0x42DB, 0x923B, 0x9FC4, 0x0B27, 0xAEA4, 0x46B3, 0xBDF8, 0xB289, 0x2AC1, 0x2020, 0x1EF8,
+    0x804C, 0xC09E, 0xB2C3, 0x2024, 0x95D0, 0x2937, 0x4961, 0x3FCB, 0x4B7F, 0x25C8, 0x8C7F, 0x87B3,
+    0x4EAD, 0x0C46, 0xADB1, 0x323B, 0x2189, 0xA4E9, 0x41F8, 0x001C, 0x4EB1, 0x4847, 0x434A, 0x38E9,
+    0x260F, 0x9C18, 0xA65B, 0x25D1, 0x194E, 0x4713, 0x3699, 0xA79D, 0x0053, 0xC2D7, 0x1018, 0x2211,
+    0x2AF2, 0x4087, 0xA2EF, 0x2D77, 0x1969, 0x261B, 0x9620, 0xABBA, 0x13A7, 0xB473, 0x2D0F, 0x3507,
+    0x06E5, 0x9549, 0x2CEF, 0xB913, 0x995F, 0x8BDA, 0x47E8, 0x8158, 0x3DEB, 0x1B84, 0xBFBF, 0x145B,
+    0x01EA, 0x3E31, 0x0707, 0x1A0E, 0x80A6, 0x30CB, 0x4319, 0x4C85, 0xABE7, 0x3219, 0x38F2, 0x8348,
+    0xBF33, 0x12DD, 0x083F, 0x3909, 0xA2CA, 0x0569, 0x1284, 0x3155, 0x1101, 0x1C2F, 0x2278, 0x1C47,
+    0x9BAD, 0x07E8, 0x1377, 0x2EB2, 0xB2F8, 0xCE9E, 0xD022, 0x901C, 0x0B25, 0xC8EF, 0x4C70, 0x0ABC,
+    0x355F, 0x4EA3, 0x814F, 0x9F91, 0x4C8F, 0x25C0, 0x0D53, 0x3B5E, 0xAC14, 0xC247, 0x18A7, 0x1D81,
+    0x054E, 0x0285, 0xA07F, 0x2CA6, 0x4705, 0xA7E7, 0xBDB8, 0x3FEA, 0x8C11, 0xB9D3, 0x4759, 0x345F,
+    0x3A69, 0x8D5D, 0x20D7, 0x9E50, 0xA2F7, 0xB16E, 0xAEA5, 0x0F6F, 0x0756, 0x1A63, 0x0E82, 0x999D,
+    0x3AE5, 0x9539, 0x858C, 0x8BD7, 0x1866, 0xB2A2, 0x4244, 0x3316, 0xA4B9, 0xC8FE, 0x932B, 0x9E35,
+    0x4A97, 0xB2C4, 0xA68E, 0x3DA5, 0x34A8, 0x967A, 0x140B, 0x2295, 0x8904, 0xB5FD, 0x1B0E, 0xAE7C,
+    0xB673, 0x0E65, 0xB9D1, 0x84FA, 0x800A, 0x2109, 0xAA4E, 0x9AEE, 0xCC98, 0x90A7, 0x4746, 0x328B,
+    0x0623, 0x48F9, 0x06AA, 0x143E, 0x3E8C, 0x85BF, 0xB9C0, 0x0C1F, 0xB565, 0xBC3E, 0x1348, 0x331A,
+    0xABEB, 0x2D08, 0x0993, 0x2D15, 0x4217, 0xAF20, 0x2C96, 0x3A03, 0x03B0, 0x0695, 0xCADF, 0x18F2,
+    0x3508, 0x1A66, 0x9E83, 0x0030, 0x4CE6, 0x38A7, 0x00E3, 0x97D6, 0xA02D, 0xC16F, 0xB98B, 0x094C,
+    0x2083, 0xA0BD, 0x4186, 0x038C, 0x815C, 0x14C7, 0x3882, 0x0D5B, 0x50D4, 0x984F, 0x2E38, 0x00DF,
+    0x1139, 0x27DE, 0x8EE1, 0x98BE, 0xAB40, 0x2C83, 0xA7BC, 0x0E18, 0xB55B, 0x1F47, 0xAF6E, 0x14A1,
+    0xC275, 0x2B6D, 0xA52A, 0xCAD2, 0xA147, 0x9E5D, 0x8437, 0x3E0F, 0x0D7D, 0x2891, 0x9309, 0x122A,
+    0x81E1, 0x4734, 0x3923, 0x923F, 0x0BA3, 0x2E4D, 0x50E7, 0x506D, 0x1001, 0x319D, 0xA901, 0x1045,
+    0x4029, 0x46B6, 0xB72C, 0x4B95, 0x47FD, 0xC044, 0x3738, 0x4ED3, 0x1A0C, 0xAA56, 0x2466, 0x886B,
+    0x8B02, 0x4E8D, 0x1825, 0x8F3D, 0x8312, 0x094E, 0x053E, 0x112D, 0x0B87, 0x47F3, 0x4352, 0xA04D,
+    0x1953, 0x490F, 0xB5B8, 0x2085, 0xB985, 0x0A65, 0x4718, 0x05E4, 0xB8D9, 0x1B5E, 0x25F2, 0x283C,
+    0x0373, 0xC985, 0x9162, 0x09A9, 0xBE85, 0x92F3, 0xA00D, 0x3504, 0xC02C, 0x4CB7, 0x30D4, 0x3402,
+    0x0E25, 0x0E9C, 0xB908, 0x9A29, 0x1972, 0xB169, 0x2D38, 0xA93A, 0x2754, 0x29CD, 0xB422, 0x4288,
+    0x1C2A, 0xC16B, 0x0FE2, 0x4867, 0x4C80, 0x03FA, 0x8C7A, 0x3DA2, 0x4B84, 0x0BE5, 0xC8E8, 0x8EA9,
+    0x3721, 0x0095, 0x30C2, 0x3371, 0x085C, 0x347D, 0x34FB, 0x1E07, 0x3FFB, 0x0456, 0x518A, 0x502C,
+    0x8610, 0x3A7E, 0x0BE3, 0x8B84, 0xAD6E, 0x46A7, 0x3976, 0x1756, 0x8ED9, 0x24E0, 0x4735, 0x4052,
+    0x4EC6, 0x2292, 0xB154, 0xADB8, 0x33C1, 0x3983, 0x20E1, 0x2824, 0xA78F, 0x397C, 0x46D7, 0x25C2,
+    0x8066, 0x8061, 0x080E, 0x818D, 0x2DA7, 0x809B, 0x8277, 0x110A, 0x2106, 0x95A9, 0x0CD6, 0xBA77,
+    0x2979, 0x1394, 0x861E, 0x1897, 0xAC1A, 0x99D9, 0x81E3, 0x49AD, 0xA8C8, 0xBF4F, 0x0E99, 0x0247,
+    0x1496, 0x951A, 0x2BBE, 0x4EA9, 0x246F, 0xC6EF, 0xB0C4, 0x4953, 0x1EF7, 0x0575, 0x22EC, 0x4A77,
+    0xD026, 0x08F5, 0xAEDF, 0x35CC, 0xAAC9, 0x09DD, 0x4E8B, 0x8218, 0x9D87, 0x13F5, 0x1E86, 0x303B,
+    0x125A, 0x3206, 0x9961, 0x3E36, 0x8EEA, 0x37E9, 0x439A, 0x4806, 0xC73C, 0x0F5D, 0x4189, 0x055A,
+    0xB30F, 0x096D, 0x0306, 0x0539, 0x1C91, 0x858D, 0xAEBD, 0xBF24, 0x126D, 0xC37E, 0xC2AA, 0x9440,
+    0xB625, 0x29F6, 0x14D7, 0x927F, 0x3DE7, 0x470E, 0x3DCE, 0x929A, 0x24DE, 0x0556, 0xCB85, 0x80D9,
+    0xA97F, 0x193A, 0xB4B7, 0x098C, 0x09FA, 0x0188, 0xBFF9, 0x21DE, 0xBA15, 0xA838, 0x3DB3, 0x1751,
+    0x4715, 0x386C, 0x3566, 0xAE9E, 0x0B3C, 0x4754, 0xAD60, 0xBAD4, 0x149B, 0x5031, 0x3ABC, 0x8E04,
+    0x347F, 0x1509, 0x87C5, 0x18FC, 0x85CC, 0x2C8D, 0x0B4E, 0x42CF, 0x0A15, 0x2938, 0x03A5, 0x5042,
+    0x46E5, 0x2A8C, 0x4304, 0x3827, 0xB401, 0x2406, 0xA74F, 0x0BBB, 0xB12C, 0x24FC, 0x3A57, 0x5043,
+    0x1D8B, 0x10DB, 0x1BCC, 0xB880, 0x0620, 0x4B75, 0x0395, 0x355C, 0x88A3, 0x30F2, 0x281B, 0x0183,
+    0xB1B0, 0x30CC, 0x116D, 0x4686, 0x0657, 0xA74B, 0x4377, 0x32EF, 0x8E39, 0x26A7, 0xC1E4, 0x41E9,
+    0x28D4, 0x4CC1, 0x3F2C, 0x4C79, 0x822C, 0x143D, 0x3AE2, 0x2991, 0x9091, 0x9D83, 0x9B9B, 0x1D65,
+    0x3BD0, 0x0678, 0x9542, 0xBB66, 0x0B47, 0x85EC, 0x3F4D, 0xACFD, 0x36B9, 0x41BD, 0x262A, 0x324B,
+    0x0490, 0x1FC0, 0x836E, 0x32AF, 0x89FD, 0x91D7, 0x05E5, 0x47FA, 0xACB3, 0x2D94, 0x4848, 0x0440,
+    0x30A7, 0x9DAA, 0x501F, 0x1648, 0x8B5A, 0x200E, 0x31CE, 0x242C, 0xB100, 0x38CB, 0xBBEF, 0x36E6,
+    0x80C9, 0x27B8, 0x85C1, 0x09B2, 0x12BC, 0xBDFF, 0x41B0, 0xB0B5, 0x338F, 0x34A9, 0x46BC, 0x0229,
+    0x1FC7, 0x1E26, 0x41C7, 0x463E, 0x2481, 0x34D7, 0x86C7, 0x311D, 0x06FA, 0x17E6, 0xC1B1, 0x38DF,
+    0x84A9, 0x8508, 0x951F, 0x318C, 0xC9EA, 0xC00A, 0xA6D2, 0x4A8F, 0xA16D, 0x1117, 0x34C8, 0x2887,
+    0xB97E, 0x3B30, 0x2A1C, 0xC3AF, 0x89A3, 0x3B5F, 0x1524, 0x0D62, 0x04B3, 0x27C9, 0x8692, 0x0127,
+    0xACD9, 0x8613, 0x06EA, 0x318E, 0xA71A, 0x2EEF, 0x1965, 0x20BA, 0x436C, 0x0858, 0x9FC6, 0xA172,
+    0xBDAA, 0x0783, 0x934E, 0x20E6, 0xC1D5, 0x810A, 0xCEBB, 0x9B2D, 0x1FA3, 0x0014, 0x075C, 0x4CC0,
+    0x1489, 0x8DC5, 0x3438, 0x2719, 0x9242, 0x821C, 0xAC84, 0x8E88, 0x9016, 0xB4EB, 0xA3E0, 0x422F,
+    0x4976, 0x4709, 0x2D33, 0x9EB9, 0x04A0, 0x8DD3, 0x421B, 0x1463, 0xBE23, 0xB48D, 0x005E, 0x004F,
+    0xA9FD, 0xB34B, 0x05F5, 0x126B, 0x08AF, 0x01D8, 0x8F3E, 0x94ED, 0x0D69, 0x3E8A, 0x1031, 0x35A9,
+    0x26EF, 0x10FF, 0x0E3D, 0x2636, 0x00B3, 0xA9AC, 0x8552, 0x1EFE, 0x2C97, 0xCD03, 0x46AF, 0x0226,
+    0x8F5B, 0x1B77, 0xC1D3, 0xB1A4, 0x3AC2, 0xA459, 0x41F9, 0x0A9A, 0x8B8A, 0x469D, 0xCCF9, 0x4898,
+    0x8DFA, 0x908F, 0x0B14, 0xADC6, 0x45CA, 0x15C6, 0x9EAD, 0x2A09, 0xC23E, 0x4AA6, 0x8B44, 0x960C,
+    0x24EF, 0x940E, 0xCE9C, 0x814D, 0x4205, 0x3959, 0x9AF9, 0xB7AA, 0xB18A, 0x48F7, 0x2E7B, 0x0648,
+    0x4D51, 0x1ED6, 0xC69B, 0x0F99, 0x3F50, 0x8BA9, 0x3A13, 0x4741, 0x1590, 0xCE7F, 0x862C, 0x9E5C,
+    0x4939, 0x111F, 0x02A7, 0x46D9, 0xC02F, 0x1EC5, 0x1434, 0xC17A, 0x0010, 0x04A3, 0x4297, 0x19EF,
+    0x4831, 0x2D2C, 0x20F9, 0x3DC2, 0x3254, 0x4EB6, 0x3136, 0x9493, 0x24AF, 0xBDA0, 0x983E, 0x3BC4,
+    0x9227, 0x9815, 0xB3CA, 0x3242, 0x1E42, 0xB907, 0x9D39, 0x0CEB, 0xB0F4, 0x3902, 0x31D8, 0x859F,
+    0x404A, 0x232F, 0x0165, 0x0424, 0x2C76, 0xC92A, 0x00F3, 0x33E3, 0x8836, 0x16B8, 0x42CE, 0x8BD4,
+    0x5185, 0x27B1, 0x1569, 0xB0F1, 0x118B, 0xD0CD, 0x15CF, 0x97BC, 0x097B, 0x2AD5, 0xCEA8, 0xB6CD,
+    0x0893, 0x0345, 0x476B, 0xB367, 0xA016, 0x0039, 0x1F3E, 0x3F63, 0x42E6, 0xA73E, 0x003F, 0xBE2D,
+    0x46D2, 0x1225, 0x9120, 0x2950, 0x4094, 0x38F1, 0x8722, 0x309B, 0x8784, 0xA4F2, 0x014E, 0x0720,
+    0x0BAE, 0x020C, 0xBF62, 0x17C4, 0x34AC, 0xA62C, 0x27AF, 0xCB8A, 0x196F, 0x9F12, 0x8C49, 0x02A3,
+    0x07F2, 0xB13A, 0x22F9, 0x3921, 0xBDC9, 0x4CBC, 0x1294, 0x80DD, 0x92DC, 0xC725, 0x00E4, 0x3816,
+    0x32D6, 0x20C1, 0x427F, 0x0977, 0x1F85, 0x3DF3, 0x05A8, 0x9695, 0x3AA4, 0x5092, 0x1241, 0x43C7,
+    0x16C2, 0xBA40, 0x9973, 0xCC9A, 0x1687, 0xBBDC, 0xA47A, 0x06DC, 0x3560, 0x04AB, 0xB286, 0xAED6,
+    0x179B, 0xB604, 0x30A9, 0xC8C4, 0x14D0, 0xA725, 0x4C8B, 0x0400, 0x34DE, 0x004E, 0x0D64, 0x1BCE,
+    0x0549, 0xD046, 0x4E92, 0x1B10, 0x14C5, 0xBE35, 0x517F, 0x819D, 0x055C, 0x8D73, 0x278B, 0x0DC7,
+    0x30B3, 0xBC79, 0x0615, 0xABE9, 0xB61C, 0x3351, 0x1A0F, 0xC9F6, 0x1E9F, 0x86F2, 0x2315, 0x3646,
+    0x3F3A, 0x0609, 0x088E, 0x94C4, 0x1DD7, 0x23AC, 0xBE49, 0x2B3C, 0x1641, 0x3E0D, 0xBF70, 0x05E9,
+    0xC688, 0x46DB, 0xBC93, 0x1543, 0xBF48, 0x28BF, 0x1FE6, 0x2E16, 0x9FD1, 0x3174, 0x2CFF, 0x276A,
+    0xBC00, 0x03BD, 0x069A, 0x90F4, 0x15DE, 0x3FDF, 0x14CA, 0x192B, 0x46E4, 0x9278, 0x4A85, 0x858B,
+    0x01DC, 0x1003, 0x1E93, 0x3BF3, 0x02BA, 0x3DFB, 0x32A4, 0x8118, 0x4D1F, 0x1B3D, 0x1928, 0x1C17,
+    0x165E, 0x894D, 0x1A42, 0x36BF, 0x48E0, 0x473F, 0xB8B4, 0x3515, 0x19F0, 0x245D, 0x126A, 0x0011,
+    0x1598, 0x049E, 0x3E2B, 0xA28E, 0x898B, 0x4AA2, 0x1F31, 0x471B, 0x3DB7, 0x28F2, 0x8B15, 0xC869,
+    0x1198, 0x0823, 0x1F04, 0xBF23, 0x1AC2, 0xC022, 0x8D70, 0x37DC, 0x1469, 0x9D89, 0x5069, 0x355A,
+    0x09E4, 0xC6A8, 0x19AA, 0xCEB0, 0x0724, 0x80E8, 0xB6C4, 0x0BA8, 0xBE15, 0x92BB, 0xAA23, 0x18F7,
+    0xB0BF, 0x883B, 0x3DF6, 0x38B5, 0x8BFB, 0x474D, 0x384F, 0x04DF, 0xBF34, 0xA5CD, 0xB1A1, 0x344B,
+    0xCA84, 0x09DA, 0xD036, 0x87E3, 0x9370, 0x9D62, 0x88FE, 0x9D24, 0x199C, 0x9EF1, 0x2475, 0x377A,
+    0x99D4, 0x08FA, 0x4AD8, 0x3DE1, 0x14D2, 0x8CB3, 0x4B91, 0xC178, 0x1EFC, 0x472B, 0x9995, 0x1874,
+    0x3AE8, 0x9F8C, 0x3B19, 0x0A00, 0xB3BB, 0x2D62, 0xB69C, 0xAE40, 0x9C50, 0x12EE, 0x3A1B, 0x2EC7,
+    0x4C8A, 0x0869, 0x9B95, 0x99D3, 0x4C87, 0xC6B0, 0x15E9, 0x226F, 0x2985, 0x15A5, 0x97F6, 0xAA6E,
+    0x03B1, 0x50FE, 0x2364, 0x3B34, 0xA4FB, 0xCC93, 0xC728, 0x1DEB, 0x390D, 0x9F17, 0x09B4, 0x18F4,
+    0xBE6B, 0x19C3, 0x4EA2, 0x069B, 0xBF60, 0xB8F3, 0x2294, 0x484B, 0xC378, 0x2DC7, 0x3E98, 0x0788,
+    0x139D, 0x85EA, 0x979F, 0x2B01, 0x481C, 0x2774, 0xB287, 0x9736, 0x190D, 0xA60A, 0x0109, 0xD06C,
+    0x285C, 0x2A91, 0x2628, 0xC16C, 0xB4AF, 0xBA81, 0xA529, 0x196A, 0x0E9A, 0xA174, 0xBE16, 0xA810,
+    0x0832, 0x1A49, 0x02ED, 0xAB57, 0x1A53, 0x3BD2, 0xC167, 0x08DE, 0x8B2E, 0x8FF2, 0x01F8, 0x4932,
+    0x391C, 0x18E9, 0xB37E, 0x04F9, 0xCA75, 0x0675, 0x1997, 0x2A29, 0x31B8, 0x48B6, 0x3F53, 0x2D49,
+    0x1E9B, 0xB1C1, 0x8908, 0xB1FC, 0xABB9, 0xC7F0, 0x00F6, 0x4ADA, 0xC9E7, 0x979C, 0xC91E, 0xB0F3,
+    0x2EF8, 0x199A, 0xC6BB, 0xB484, 0xB4F1, 0x129D, 0x4724, 0x4343, 0xD189, 0xBFF3, 0x9D63, 0xBDE2,
+    0xD02D, 0x4168, 0x2115, 0xB9BD, 0x506B, 0x0375, 0x417B, 0x4C86, 0x33FC, 0x954E, 0x29DB, 0x2EB3,
+    0xA940, 0x8D55, 0x9DB3, 0x9027, 0x83A2, 0x4376, 0xB0A4, 0xA058, 0x1FD9, 0x3554, 0x8CC2, 0x3468,
+    0x50D1, 0x1006, 0x84D6, 0x0C9A, 0xA928, 0x46BF, 0x8E81, 0x8D9B, 0xBBC6, 0x1DD4, 0x144D, 0x04E4,
+    0xD05E, 0x38CA, 0x8658, 0x9FF9, 0x3A21, 0x9AA7, 0x06B3, 0x15D2, 0xAC51, 0xBAD5, 0xB2BF, 0x8CDC,
+    0x3982, 0x900C, 0x3A3C, 0x46FF, 0x872E, 0xA941, 0x2659, 0x8094, 0x480A, 0xC88B, 0x0986, 0x96DE,
+    0x1B1F, 0x80D5, 0x817B, 0x3F38, 0x1AD8, 0x951E, 0x96E2, 0x930F, 0x41DF, 0x92F4, 0x0627, 0xBAF3,
+    0xAD0B, 0xC904, 0x505B, 0x1327, 0x9199, 0x4842, 0x1D27, 0x1443, 0x3132, 0x9A13, 0x46C3, 0xD03A,
+    0xCA9C, 0x4AA4, 0xADB4, 0x0C18, 0x1F4D, 0x4C91, 0x3201, 0x0650, 0x4B97, 0xB20D, 0x391E, 0xB122,
+    0x8461, 0x8EC4, 0x1E90, 0x07D1, 0x0E1C, 0x416D, 0x0288, 0x1F77, 0x0608, 0x3FE8, 0x9255, 0x473B,
+    0x272D, 0x151B, 0x9C7C, 0x3768, 0x2C3B, 0xC6B2, 0x190B, 0x06FD, 0x036B, 0x940D, 0x3F4C, 0x89F4,
+    0x16B5, 0x0DA2, 0x28D8, 0x1323, 0x4A88, 0xC20D, 0x1D8D, 0x3FFD, 0x0DC4, 0x0C1C, 0x9F8E, 0xC35D,
+    0x429B, 0x2501, 0x5110, 0x16BC, 0x1466, 0x0F02, 0x12B8, 0x811B, 0xC7FC, 0x298C, 0xBDD5, 0x4861,
+    0x8578, 0xC877, 0x033F, 0x0766, 0x9A62, 0x34E3, 0x4066, 0x3561, 0x3661, 0x4258, 0x3119, 0xA711,
+    0x5071, 0x985A, 0x4C73, 0x152A, 0x06CE, 0xA56F, 0x1DA1, 0xAAB9, 0x17F0, 0x0B42, 0x84F0, 0x175E,
+    0xC89C, 0x3498, 0x9580, 0x0EB7, 0x38CE, 0x39C6, 0xA3F9, 0xC1C5, 0x060E, 0x8354, 0x30B0, 0x36A1,
+    0x33A6, 0x2677, 0x1DB4, 0xC9F3, 0x1B34, 0x4694, 0x1C44, 0x14A4, 0x38A8, 0x12E8, 0xA1C9, 0x06D7,
+    0xC265, 0xBF5C, 0x2A57, 0x2A3B, 0x1262, 0x90BE, 0xB082, 0x32F6, 0xD10D, 0x161B, 0x3F85, 0xB2BD,
+    0x00D8, 0x1B60, 0x06E6, 0x0019, 0x8909, 0x0A35, 0xA38A, 0xD1A0, 0x86A8, 0x8025, 0x95F8, 0xB764,
+    0x9470, 0x3E47, 0x277F, 0x3589, 0x9A43, 0x8EB3, 0x35AA, 0xC6E3, 0x504C, 0x0789, 0xD067, 0xB9B3,
+    0x2A7C, 0xC80C, 0x4194, 0x1E06, 0x27D8, 0xBA7D, 0xB284, 0x4908, 0x0F06, 0x1042, 0x156D, 0x3F55,
+    0x4C84, 0x1100, 0xAA8E, 0xA81F, 0x41C1, 0x0B2B, 0xB12E, 0x1522, 0xC708, 0x1C79, 0x01DD, 0xB6E5,
+    0x347E, 0x39DB, 0x42B8, 0xBA6B, 0x4B7D, 0x1EE2, 0x043A, 0xB918, 0x1453, 0xCC6D, 0x9454, 0xA3EE,
+    0x174C, 0x8EE5, 0x3E30, 0x3F84, 0x03C0, 0x488D, 0x9C80, 0x47F5, 0x36AF, 0x2124, 0x22BD, 0x91C6,
+    0x49ED, 0x8D17, 0x01A9, 0xB1F3, 0x1C59, 0x2D3A, 0x4A78, 0x9192, 0x9B54, 0xB8D8, 0x076A, 0x1F46,
+    0x86AC, 0xA9BB, 0x4719, 0x339C, 0x35CF, 0x0EAD, 0xAD25, 0x12AD, 0xB433, 0x9F6F, 0xB717, 0x42ED,
+    0xD033, 0x8A4C, 0x4716, 0x1306, 0x2DAA, 0x5038, 0x3517, 0xB0F6, 0x90AD, 0xA1EF, 0x3D26, 0xC7EB,
+    0x1755, 0x150E, 0x907D, 0x9F19, 0x8B1C, 0xB567, 0x3E03, 0x8737, 0xBFBE, 0x9A08, 0x0DB3, 0x0AD5,
+    0xB296, 0x3E0E, 0x2E92, 0x1103, 0x518B, 0x9FF1, 0x3E20, 0xBDF4, 0xC39B, 0x9914, 0x3379, 0x1BB4,
+    0xA4E8, 0x27F9, 0x0777, 0x2E26, 0xA52C, 0x41C4, 0x8791, 0x2E0B, 0x2D4F, 0x35E9, 0x4702, 0xB0EA,
+    0x2825, 0x1E21, 0x47EF, 0x468F, 0x9351, 0xA92D, 0x1E2E, 0x9B0D, 0x12DA, 0x0DF9, 0x042E, 0x2A40,
+    0x34A6, 0xA025, 0x3F1D, 0x8638, 0x3FB4, 0x9A4C, 0x3A82, 0x4051, 0x22B3, 0x3948, 0x05EB, 0x09D5,
+    0x94F6, 0xB3C6, 0x95C4, 0x8631, 0x2BE6, 0x3212, 0x4699, 0x2680, 0x25D0, 0x3121, 0x2E0F, 0x158E,
+    0x00D3, 0x1CA9, 0x2A30, 0x9F9B, 0x2792, 0x14E7, 0x41C8, 0xC36E, 0x983C, 0x90A5, 0x0B04, 0x2158,
+    0xB1BF, 0x285E, 0x0418, 0x12D1, 0x4740, 0x8D8C, 0xB912, 0xABA7, 0x10A6, 0x0942, 0x935D, 0x3960,
+    0x0E91, 0xBDC1, 0x9C65, 0x0018, 0x17A7, 0x2398, 0x19A7, 0x26FF, 0x85F8, 0x383C, 0xAB49, 0x0A11,
+    0x15A7, 0x1F69, 0x2C77, 0x2C79, 0x226B, 0x0392, 0x476A, 0xA13E, 0x0686, 0x2B13, 0x2B41, 0x3FDD,
+    0x27B5, 0x0F03, 0x3F22, 0x0028, 0x31E9, 0x2BF8, 0x27B3, 0x1449, 0x387F, 0x12EF, 0x1EBD, 0x9179,
+    0x895B, 0x9942, 0x188C, 0x8008, 0x041A, 0x3124, 0xCC6F, 0xB21C, 0x134C, 0x3220, 0x419A, 0x2D47,
+    0x2740, 0x2886, 0xB5B6, 0xAC74, 0x0543, 0x287E, 0x017C, 0xB5B9, 0x38AA, 0x813C, 0xC36F, 0x154C,
+    0x802B, 0xB3E7, 0x990A, 0x8E55, 0x48CC, 0xC822, 0x9855, 0x3E2F, 0xCB76, 0x3FF7, 0x092A, 0x96E4,
+    0xB657, 0x9545, 0xAD52, 0xA7D4, 0x2C06, 0xD0DD, 0x01AA, 0x3380, 0x388D, 0xBDED, 0x09D2, 0xC203,
+    0x30D0, 0x953A, 0x1AFA, 0x99F1, 0x2732, 0x9684, 0x46B1, 0x14DC, 0xA479, 0xC80B, 0x4EB7, 0x310F,
+    0x30D1, 0x127A, 0x124B, 0x4886, 0x06FC, 0xB497, 0xD04A, 0x131F, 0x2C3C, 0x50E9, 0xC193, 0x330D,
+    0xA74E, 0xAD5B, 0x851D, 0x48BE, 0x2A3E, 0x0B93, 0xD047, 0x32CD, 0x30CA, 0x2CDF, 0xBFCE, 0x13BE,
+    0xB2BE, 0xBA9C, 0x1A1D, 0x8E7F, 0x1508, 0xCD4D, 0xBE21, 0x3759, 0x2947, 0x810D, 0xB10C, 0x2373,
+    0x2AA7, 0x212B, 0xB56F, 0x4726, 0x4962, 0x3144, 0x25A2, 0x8DE8, 0x0EE8, 0xBA70, 0x3671, 0x2738,
+    0xCC81, 0x32FC, 0x062B, 0x3491, 0x9F07, 0xBA63, 0x2805, 0x4009, 0x1E47, 0x4E81, 0x0F4C, 0x03ED,
+    0x1417, 0xC88F, 0x448E, 0x215C, 0x3585, 0x035A, 0x19A8, 0xC199, 0x05A5, 0x0E2C, 0xB0ED, 0x4960,
+    0x26DE, 0x888F, 0x32C6, 0x174F, 0x8DB0, 0x4023, 0x8CB5, 0x0465, 0x0C3C, 0x2BCB, 0x0555, 0x0B97,
+    0x1571, 0x9F74, 0xA4FA, 0xB3A3, 0x2C3F, 0x1ED5, 0x8A54, 0xC7E9, 0x1FB8, 0x4B10, 0xA469, 0x0382,
+    0xA817, 0x876C, 0xB0E3, 0x1219, 0xBFE3, 0x16A4, 0x39EA, 0x06C1, 0x4263, 0x096B, 0x0985, 0xBF8A,
+    0xA2B1, 0x4371, 0x2011, 0x933F, 0xC392, 0xB0E8, 0x3F73, 0x88DF, 0x0197, 0x350C, 0x1F4E, 0x46CE,
+    0x07DD, 0x1975, 0x1EA7, 0x85B6, 0xC965, 0x0451, 0x15A3, 0x3DE5, 0x111B, 0x00A8, 0x1799, 0xBDE6,
+    0x3DA1, 0x34C4, 0xB1BD, 0x4AD3, 0xBFB1, 0x2E9D, 0x0482, 0x015D, 0x8D9C, 0xB514, 0x1D4C, 0x00FD,
+    0x8124, 0x045E, 0x3216, 0x09AE, 0xA610, 0xBF58, 0x03AB, 0x205F, 0x0DDF, 0x4B86, 0xCB94, 0x0351,
+    0x4811, 0x28DF, 0xABCD, 0x1E0D, 0x96C5, 0x3312, 0x9D23, 0x9180, 0x24F7, 0xB0E6, 0x1587, 0x1072,
+    0x2B1E, 0x0C04, 0x4812, 0x9264, 0x064B, 0x9EB2, 0x8548, 0x3111, 0x969E, 0x2E89, 0xB225, 0x3203,
+    0xB103, 0x3E1C, 0x4EC4, 0x87E6, 0x2492, 0x469C, 0x0749, 0x9D66, 0x3AA2, 0x06AD, 0x3DDE, 0x891F,
+    0x9E61, 0x3E62, 0xC771, 0xAA1A, 0x3157, 0x35C5, 0x3805, 0x91AA, 0x8C9B, 0xBDAE, 0xB74A, 0x8007,
+    0x8E63, 0xAC23, 0xA622, 0x35BD, 0xAEFB, 0x3663, 0x940A, 0x11ED, 0xCC75, 0xC8B0, 0x3F39, 0xA08F,
+    0x508B, 0x9243, 0x0EAC, 0xB1CC, 0xB2E4, 0x8778, 0xCA7A, 0xAF0A, 0x02DA, 0x29EE, 0x32AE, 0xB374,
+    0x0731, 0x9DEF, 0x12C5, 0x4770, 0x113A, 0x29AA, 0xC209, 0x0857, 0x81D1, 0x2A1D, 0x154F, 0xD05C,
+    0x03AF, 0x2A4C, 0x25AF, 0x209F, 0x89D9, 0x4916, 0x2B68, 0x8411, 0xCEA5, 0x47F9, 0x3A16, 0x9DB7,
+    0x3E41, 0x15FD, 0x9BAB, 0x30AA, 0x9813, 0x12F6, 0xBF3C, 0x4A7E, 0x0B3A, 0x42B6, 0x8A30, 0xC32F,
+    0xA456, 0x17F1, 0x012F, 0x4872, 0x270D, 0x1970, 0xA6E4, 0x280A, 0x0380, 0x389D, 0x1A86, 0x04B2,
+    0x1FEE, 0x8438, 0x31F0, 0x3F30, 0x8960, 0xB501, 0x4302, 0x9467, 0x0947, 0xB624, 0xAC88, 0x27A0,
+    0xA2AD, 0xA0D3, 0xB78F, 0x2D31, 0x0D6C, 0xB5DF, 0x4695, 0x03C4, 0x387A, 0xA83E, 0xA75B, 0x8443,
+    0xA36E, 0x2270, 0x130D, 0x50CE, 0x0050, 0x4845, 0x0E06, 0x3D66, 0x0EB1, 0x0E4A, 0x3A72, 0x8000,
+    0x4C74, 0x18FE, 0x41EA, 0xA9B3, 0xA0DE, 0x481D, 0x311A, 0x319F, 0x07F3, 0x0B56, 0x3F3E, 0x920E,
+    0x30AF, 0xCE94, 0x826C, 0xA2E7, 0xB37A, 0x982F, 0x387B, 0x1FF3, 0x1324, 0xCECB, 0x4EB3, 0x8DFB,
+    0x46CD, 0x1367, 0x20A7, 0x0378, 0x2801, 0x0052, 0x3A8B, 0x480F, 0xB4D4, 0x1A46, 0x3B21, 0x0280,
+    0x2DD1, 0x48BD, 0xCAE7, 0x8666, 0x92D8, 0x87E1, 0x26E0, 0x24B4, 0x152B, 0x3336, 0x0E15, 0x13CA,
+    0x4750, 0x3DEE, 0x22E6, 0x2BE3, 0x053A, 0xB0FB, 0x992F, 0x0A07, 0x9263, 0xC323, 0x0764, 0x2DCC,
+    0x1739, 0x279F, 0x2184, 0x90B6, 0x30E9, 0x0B60, 0xC18B, 0x84BF, 0x0A0B, 0x86D3, 0x3687, 0x00AC,
+    0x315A, 0x010E, 0x8570, 0x07EF, 0x0119, 0x141B, 0x4764, 0xA129, 0x3DBF, 0x9B39, 0x3601, 0xB0B8,
+    0x4897, 0xC77F, 0xB0DF, 0x8640, 0x1D9B, 0x422E, 0x0EA3, 0x822D, 0x4753, 0x0517, 0x0C62, 0x9289,
+    0xB92E, 0xC17C, 0x8BE8, 0xC184, 0xAB56, 0x9102, 0x476D, 0x8B55, 0x42EB, 0xB58E, 0x8060, 0x81A6,
+    0x2D58, 0x22E9, 0x4773, 0xADA6, 0x9D92, 0xBAD9, 0x3235, 0x0BB9, 0x1B9C, 0xB631, 0x3309, 0xA8B1,
+    0x24D7, 0x9588, 0x3FBA, 0xB0A3, 0xC855, 0xB151, 0x86B1, 0x9189, 0x125D, 0xD088, 0x09ED, 0xA0E9,
+    0x248B, 0x326A, 0x86F3, 0x3689, 0x343B, 0x1E81, 0x0412, 0xB2DD, 0x39AD, 0x4800, 0x481A, 0xB626,
+    0x20C2, 0x9774, 0x0130, 0x9949, 0x07EA, 0xC6DC, 0x90B8, 0x9FCC, 0xB0A6, 0x0A24, 0x346E, 0x5093,
+    0xC370, 0x8E98, 0x29FE, 0x2966, 0x03A0, 0xA7CA, 0x8089, 0x11FD, 0x4274, 0x9B05, 0x9FB2, 0x4A9F,
+    0x9956, 0x8723, 0x9DCB, 0x22C8, 0x1679, 0x9F88, 0x2A9B, 0x2C0B, 0x2963, 0x42CA, 0x98DC, 0x0961,
+    0x1605, 0x3FD7, 0xBF66, 0xA1E1, 0x342A, 0x502B, 0x097C, 0x4252, 0x00CB, 0x0167, 0x1DC2, 0xD120,
+    0x3BCC, 0x1D9A, 0x079D, 0x105E, 0x37D0, 0x809A, 0x0132, 0x80C4, 0x42E8, 0xA71C, 0xB538, 0x91B5,
+    0x1EE0, 0xA783, 0x16AC, 0x1C21, 0x9E34, 0x1856, 0xB0BE, 0x052A, 0x1DF3, 0xB5C0, 0xA07E, 0x2D2A,
+    0xAA16, 0x82BB, 0x06C8, 0x8159, 0x3A88, 0x0510, 0xA43B, 0x9201, 0x8A89, 0x949F, 0xADA2, 0x07EC,
+    0x803B, 0x20E4, 0x3A68, 0x2B8F, 0x2A2C, 0x2CDE, 0x0621, 0x368C, 0x9998, 0x3FCF, 0xC888, 0x0402,
+    0x8C13, 0x12C6, 0x1E5E, 0x2CAD, 0x250A, 0x952F, 0x1601, 0x4CC2, 0xA2DF, 0x8C20, 0x07F7, 0x42DC,
+    0xA7C3, 0x4C88, 0xA0A2, 0xCC8C, 0x253E, 0x1226, 0x2748, 0x3DD8, 0xC6EE, 0xB2B4, 0x001E, 0x3AC6,
+    0x1E13, 0x41F7, 0x32E1, 0x0FEF, 0x0048, 0xB0A1, 0x1F43, 0x1484, 0xBB36, 0x3AF9, 0xCA93, 0x97CB,
+    0x823A, 0x0951, 0xCAA7, 0x1205, 0x22AF, 0x4767, 0x41D8, 0xA276, 0x812B, 0xA826, 0x1A74, 0x227F,
+    0x142A, 0x345A, 0x06DD, 0x0E8C, 0xA7C7, 0xB65A, 0xCD47, 0x973F, 0x83B6, 0x2D3E, 0x3FFA, 0x1E30,
+    0x1772, 0x4ED6, 0x2010, 0x8545, 0x0868, 0x0699, 0xB0C9, 0xA280, 0x80BB, 0x07BE, 0x4B6F, 0x0EED,
+    0x08E4, 0x9E85, 0x2BE4, 0xA5B0, 0xCED0, 0x88D7, 0x1A41, 0xC8B9, 0xCB69, 0x1F52, 0x9214, 0x1602,
+    0xB8BA, 0x0406, 0x8013, 0xBDDC, 0xA5E0, 0x0E6E, 0x4CD8, 0x394C, 0x1EB3, 0x801D, 0x221A, 0x4CA8,
+    0xCB6E, 0x4014, 0x2778, 0x0001, 0x2670, 0x1216, 0x89B8, 0x4A83, 0x46DD, 0x112A, 0x018B, 0x32FD,
+    0x1D67, 0xACE6, 0xB2ED, 0xBE18, 0xBA92, 0x4A7F, 0xB205, 0x2936, 0x127C, 0x1AF0, 0x97A1, 0x24C4,
+    0x1841, 0x3311, 0xB280, 0xC35E, 0x1EEF, 0x34F9, 0x218E, 0x3A85, 0x2B78, 0x19D1, 0x4E82, 0xAA27,
+    0xBA64, 0x05EE, 0x06D2, 0xC26D, 0x263C, 0x8BFF, 0x4170, 0x2603, 0x41F3, 0x8653, 0x87D3, 0x2DDD,
+    0x91A1, 0x0626, 0x1589, 0x9BA8, 0x1DC1, 0x17AD, 0x2435, 0x8BD3, 0x9654, 0x16AE, 0x955F, 0x2829,
+    0x41E6, 0x97EC, 0x2DEE, 0x1DD5, 0xC035, 0x342C, 0x1E5F, 0x0A93, 0x8B31, 0x328C, 0x0CE9, 0xA65F,
+    0x8966, 0x1412, 0x1F39, 0x127B, 0x3204, 0x2C98, 0xA657, 0xB997, 0x015B, 0x2765, 0x0690, 0x14B1,
+    0xA7C8, 0x4204, 0x856E, 0x85A6, 0x24EC, 0x0AA9, 0x9DC5, 0x8DE4, 0x36DF, 0xABC3, 0x28D2, 0xA7FF,
+    0x3133, 0x4C7E, 0x22FD, 0x472A, 0xB24C, 0x04AC, 0x8C01, 0xA0B6, 0xB42F, 0x35C7, 0xC776, 0x1521,
+    0x4801, 0x0BD1, 0x0126, 0xC1DC, 0x0BD8, 0xBAC5, 0x80C1, 0x920F, 0x0170, 0x33AA, 0x9853, 0xB4CB,
+    0x002C, 0x290D, 0x3509, 0x0441, 0x0639, 0x81CE, 0x502A, 0x50A6, 0x0E16, 0xB29F, 0x2AD9, 0x1267,
+    0x3AAB, 0x50EA, 0x10CA, 0x2D5A, 0x993D, 0x0957, 0x8164, 0x1D3A, 0x8571, 0xBE22, 0x3E79, 0x3FF8,
+    0x0F74, 0x8D50, 0x4D44, 0x206B, 0xB7A4, 0x3E17, 0x1AF5, 0x247F, 0x4CFB, 0x2A17, 0x1C71, 0xB900,
+    0x30F8, 0x17EF, 0x0CC9, 0x9D7B, 0x0801, 0x1F01, 0x28D6, 0x00AE, 0x41ED, 0x43AA, 0x06DE, 0x2318,
+    0x8D99, 0x8EAB, 0xC2FE, 0xB57C, 0x00A4, 0xB4D1, 0x043B, 0xA882, 0x0110, 0xA4C1, 0x0DC2, 0xCCB0,
+    0x1441, 0x418F, 0x3E7A, 0x0265, 0x224C, 0x3102, 0x1B82, 0x180E, 0x91E0, 0xB6E3, 0x4B6D, 0xA72C,
+    0x86DF, 0x0CD8, 0xAECC, 0x25ED, 0x80F0, 0xA37D, 0x30EF, 0x10D1, 0xC291, 0xB2E5, 0x17D7, 0x3113,
+    0x503F, 0x470F, 0x2285, 0xB79B, 0x3784, 0x513D, 0x91D8, 0x19C1, 0xC391, 0xA95A, 0x007E, 0x3231,
+    0x4EA1, 0x2681, 0x2D85, 0x469E, 0xA630, 0xB659, 0x24B7, 0x21E0, 0xB903, 0x4226, 0xB6F0, 0x9E88,
+    0x97BD, 0x2005, 0x077B, 0x8BA5, 0xBE07, 0x929B, 0x013A, 0xAB3E, 0xD035, 0xB283, 0xB8C7, 0x1EFA,
+    0x3618, 0xBDD7, 0x3117, 0x2BD1, 0x0160, 0x876D, 0xB627, 0xAB5D, 0xA7D2, 0x10B7, 0xAD5D, 0x32F2,
+    0x195C, 0x8117, 0x80A1, 0xB88B, 0x815F, 0x3A62, 0xB0C1, 0x2DE1, 0x0E48, 0xAC39, 0x8F34, 0x4CB8,
+    0xC20F, 0xB200, 0xB29C, 0x8454, 0x3578, 0x0AA8, 0xA21B, 0x2D7E, 0xB5E5, 0xA239, 0x2313, 0x118A,
+    0x4B7C, 0x27A5, 0x2DA1, 0x0562, 0xBE10, 0x18B4, 0x0E1D, 0x4ADE, 0x86C9, 0x00CE, 0x1ACB, 0xA2EB,
+    0x1113, 0x4293, 0x08CA, 0x35D6, 0x3F47, 0x8E09, 0x109F, 0x342D, 0x27E4, 0x0727, 0xCC7F, 0xA133,
+    0x3E37, 0x35BC, 0xB56B, 0x269E, 0x044C, 0x85D9, 0xC357, 0xB4BD, 0x4994, 0x366B, 0x8E60, 0x46A1,
+    0xB129, 0xC339, 0x94D6, 0x0A06, 0x2DF7, 0x32F1, 0x870F, 0x9908, 0x821A, 0x35DD, 0x30B6, 0x4C92,
+    0xC1D9, 0x0B73, 0x46F3, 0x0652, 0xA43D, 0x0672, 0x1F6E, 0x3DBD, 0x388C, 0x022A, 0x35E1, 0x3DBA,
+    0x21C2, 0x1408, 0xA472, 0x063C, 0xC69F, 0xCA98, 0xCB54, 0x3BC5, 0x2878, 0x28CE, 0x1D7C, 0x19B6,
+    0x23CE, 0x1038, 0xB0CE, 0x039B, 0xC717, 0x4E95, 0x5041, 0xA962, 0x9699, 0x0DD0, 0x2D3C, 0x24C2,
+    0x8379, 0x03E1, 0x8D5C, 0x47F7, 0x8D87, 0x3879, 0x13AC, 0x0381, 0xAC0E, 0x2BBD, 0x27BE, 0x8DAA,
+    0x3DCB, 0x91AE, 0x2745, 0xC809, 0xB8B0, 0x0481, 0x225E, 0x05EF, 0x947E, 0x002A, 0x1451, 0x3DB2,
+    0x337B, 0x1B78, 0xA525, 0x003D, 0xC169, 0x2C7A, 0x16E6, 0x472E, 0x46B9, 0x0516, 0x0362, 0x0B74,
+    0xB87D, 0x348A, 0x32E8, 0x1896, 0xB7AF, 0x9308, 0x3AB1, 0x9EF6, 0xA8F8, 0x9495, 0x958C, 0xB298,
+    0x1577, 0x9F95, 0xB142, 0x092E, 0x284C, 0x9770, 0x887B, 0x46A6, 0x39AF, 0x95D6, 0xC86C, 0x360B,
+    0xC83B, 0x43AE, 0x3228, 0x248F, 0xBDCA, 0x808B, 0xC17D, 0x3E0B, 0xBF5B, 0x4AA0, 0x4369, 0x9B42,
+    0xA68B, 0x2BD8, 0x3BCF, 0x812A, 0x14FC, 0x18DD, 0x1326, 0x1283, 0x14EC, 0x290B, 0x14F7, 0x0B78,
+    0x1EAE, 0x07EB, 0x352C, 0xB5A0, 0x119C, 0x270F, 0x9E41, 0x00C7, 0x16BA, 0x02E6, 0x3895, 0x1090,
+    0x060F, 0x107B, 0xC6A5, 0x30A0, 0xCB6A, 0x175D, 0xAC91, 0x1696, 0x1E15, 0x38D4, 0x8F69, 0x406C,
+    0x4048, 0x1950, 0x8049, 0x01A3, 0x246E, 0xC6D5, 0xBF2E, 0x0C0C, 0x46C5, 0x34D3, 0x46CB, 0x0155,
+    0x0E41, 0x8A9F, 0x5023, 0xB238, 0x4ED8, 0x0C07, 0xD139, 0x0643, 0x435A, 0xB7D3, 0x0C25, 0x8340,
+    0x1EE3, 0x9A60, 0x8AF0, 0xA4CE, 0x22B9, 0x0DC6, 0x108A, 0x997C, 0x4CA5, 0x505A, 0x1AB5, 0x2820,
+    0x3785, 0x5055, 0x3E14, 0x2843, 0x8701, 0x01E6, 0x050F, 0x9492, 0xB449, 0x01B5, 0x095A, 0x34B0,
+    0x0859, 0x113C, 0x46F5, 0x2606, 0x1E28, 0x1946, 0x8059, 0xC257, 0x2A6B, 0x4A89, 0xA310, 0xB59B,
+    0x355E, 0xC8C9, 0x1E7E, 0xAD71, 0x3DC3, 0x24D0, 0xAA97, 0x29A5, 0x036C, 0xA39F, 0x13C2, 0x0248,
+    0x93C8, 0x0662, 0x1BED, 0x3210, 0x234C, 0x0E90, 0x338A, 0xBF44, 0x3293, 0xC85F, 0x961C, 0x873C,
+    0xCB99, 0x0034, 0x4B65, 0xC220, 0xBDB6, 0x8CCC, 0x059A, 0x9763, 0x03DB, 0x8111, 0x9EFD, 0x0407,
+    0x267E, 0x8818, 0x0120, 0x05D8, 0x055E, 0x38B6, 0x34D8, 0xC53E, 0x17B9, 0x99A2, 0x9D37, 0x0BEC,
+    0x4039, 0xB98D, 0x22BC, 0x0EE4, 0x2A50, 0x9170, 0xB4CF, 0x03B7, 0x95CD, 0x2089, 0x1E18, 0x09A2,
+    0x2D8D, 0x14FF, 0xB0FE, 0xD186, 0xB0AC, 0x8B4F, 0x010F, 0x471D, 0x2A89, 0x9AE0, 0xC900, 0xBE61,
+    0x1F93, 0xBB7F, 0xB7B7, 0x0DA0, 0x27EA, 0x35B1, 0x1610, 0x2439, 0x4C90, 0x10B5, 0xB54F, 0x4707,
+    0x8A7E, 0x0B88, 0xA9F3, 0xBDE9, 0xB8A4, 0x495E, 0x0680, 0x1D21, 0x902D, 0xC7F1, 0x06D9, 0xA834,
+    0x2A39, 0x2C86, 0x8BAF, 0xC174, 0x4864, 0x4B88, 0x118C, 0x4AD1, 0xB568, 0x1F0C, 0x00A2, 0x47ED,
+    0x5064, 0x0194, 0x123C, 0x1250, 0xC8C5, 0x5051, 0x49E9, 0x43D1, 0x2920, 0xC2C5, 0xB7FB, 0xB8F9,
+    0xAA55, 0x2A34, 0x912F, 0x1C8E, 0x3749, 0x8397, 0x01E9, 0x85F3, 0xC2B0, 0x0371, 0x4B71, 0x2D54,
+    0xC176, 0x9BE0, 0x067D, 0x50D8, 0x0984, 0x4901, 0xB2B2, 0xA178, 0x3348, 0x22AE, 0xADA8, 0x1A65,
+    0x248A, 0x805F, 0x4832, 0x16D2, 0x08D4, 0xBBDE, 0xBE25, 0x2BC9, 0xB302, 0x3DA6, 0x27B4, 0xA943,
+    0x3F35, 0x2B60, 0x0733, 0x8567, 0x0EB5, 0x4CB6, 0x226D, 0x8730, 0x9864, 0x93FF, 0xC75E, 0xBE02,
+    0x2467, 0x90F6, 0xA926, 0x2531, 0xB937, 0x2BEF, 0x27E8, 0xC808, 0x1F9D, 0x1A38, 0x8439, 0x1AD2,
+    0x3E34, 0x06CC, 0x24B0, 0x3D07, 0x8DFF, 0x8616, 0xC83C, 0x8D9E, 0x903B, 0x856B, 0x9002, 0x24CD,
+    0x8D85, 0x89A0, 0x1DFD, 0x1054, 0x1E72, 0x9F33, 0x929F, 0x053F, 0xB3FE, 0x13B7, 0x8ECB, 0x9FA1,
+    0xB531, 0x0C36, 0x3756, 0x0125, 0x33C2, 0xB75E, 0x982D, 0x391A, 0x027F, 0x471F, 0x0577, 0x94FE,
+    0x2BC6, 0x2796, 0xC805, 0x1157, 0x9D59, 0x0488, 0x359E, 0x91E4, 0x0CB2, 0xAB5E, 0x30D3, 0x9A51,
+    0x9FEB, 0x808E, 0x008C, 0xB406, 0x8A6C, 0x1410, 0x0CF1, 0xACD6, 0x4EA7, 0x3F77, 0x978B, 0x3F94,
+    0xBDC5, 0x9AB3, 0x91D0, 0x4756, 0x8612, 0x384D, 0xC0BA, 0x1D93, 0xA655, 0x186F, 0x1FB5, 0xB404,
+    0xA2DB, 0x892F, 0x2D1B, 0x4745, 0x20F4, 0x1197, 0x1FEC, 0x9FA0, 0x4EBC, 0x1AA8, 0xA98E, 0x99D8,
+    0xBF40, 0xABC1, 0x9F5E, 0x06C6, 0x88E0, 0x5119, 0x1DD2, 0xACE0, 0x0C23, 0x3243, 0x060A, 0x0C67,
+    0xB1D5, 0x97FA, 0x9A3D, 0x99A3, 0x38D1, 0x15E3, 0x4E91, 0xBDCF, 0x39BA, 0x0D32, 0x3E32, 0xA35C,
+    0xC899, 0x1D86, 0xA56C, 0x98F0, 0x2840, 0x047F, 0x3DF0, 0x1EE5, 0x08F1, 0x0FF1, 0x9A69, 0x26A9,
+    0x0276, 0x9203, 0xA38F, 0x0174, 0xAC81, 0x3F8B, 0x9221, 0x2C3D, 0xC6C9, 0x82D6, 0x8420, 0x1A07,
+    0x0DCC, 0xA729, 0x83A4, 0x287D, 0x35A8, 0xA7C4, 0x062F, 0x1F6A, 0xB0FD, 0x23B3, 0x37A8, 0x4387,
+    0x1497, 0x492D, 0x8399, 0x3DD6, 0x1ED4, 0x0827, 0x14CC, 0x992A, 0xA503, 0x11C9, 0x2BF0, 0x4729,
+    0x1691, 0x420B, 0x2DFC, 0x2EDC, 0x0635, 0x2560, 0x0E3A, 0x4350, 0x513E, 0x330A, 0x0982, 0x4A94,
+    0xC9F5, 0x05F7, 0x1315, 0x32A0, 0x0582, 0x2D9C, 0x1BB1, 0x3E1D, 0x9D8A, 0x1525, 0x9187, 0x0ED2,
+    0xC365, 0x37C1, 0xAC92, 0x056F, 0x3B1A, 0x15A0, 0x0FE8, 0x816F, 0xB423, 0x0C92, 0x0FFE, 0xB4E5,
+    0x4074, 0x1E68, 0x3E94, 0x424F, 0xC6F4, 0x01C4, 0x31B9, 0x4212, 0x419C, 0x028D, 0x5151, 0x50B8,
+    0xB60E, 0x80B5, 0x29B0, 0x06D0, 0x91DD, 0xCA90, 0x258E, 0x008D, 0x11A8, 0x180A, 0x46B7, 0x154B,
+    0x90B9, 0x8F2D, 0xC9A3, 0x8E0F, 0x9DE1, 0x30D9, 0xADAC, 0x2AF4, 0x3120, 0x8585, 0x1F63, 0x43B4,
+    0x8038, 0xC005, 0xC850, 0x495B, 0x27F1, 0x0677, 0x8088, 0x19E0, 0x8782, 0x29DC, 0xC042, 0x0886,
+    0x0854, 0x2AB4, 0x3134, 0x00C6, 0x180C, 0x108B, 0x0A2A, 0x8DA5, 0x1B0B, 0x109A, 0x32B7, 0x41EB,
+    0x1ADA, 0xAC95, 0x4846, 0x0D89, 0x80AD, 0x141A, 0x1DD6, 0x1E10, 0x3AF4, 0xC690, 0x07B9, 0xC6E1,
+    0x471E, 0x0D51, 0x3BE6, 0x1FE1, 0x8CE3, 0xB543, 0xAB6F, 0xA0B4, 0xA223, 0x000C, 0x3737, 0x43DC,
+    0xA114, 0x09CB, 0x36BA, 0x8885, 0x3BCA, 0x966D, 0x19DC, 0xA399, 0x2AB0, 0x30BD, 0x2DAD, 0x38E4,
+    0x9EC4, 0x1368, 0x4331, 0x4B7A, 0xA34A, 0xC04B, 0x372B, 0xC906, 0x408F, 0x2E97, 0x3161, 0x11F8,
+    0x1276, 0xB1CA, 0x3BE5, 0x248D, 0x9819, 0x3382, 0xB0CD, 0x15EA, 0x4299, 0x377E, 0x0B0D, 0x2815,
+    0x3431, 0x00A9, 0x41DE, 0x121B, 0xC833, 0x868B, 0x3269, 0x055F, 0x9968, 0x09A6, 0x0212, 0x31DF,
+    0x005D, 0x1270, 0xC75F, 0x9EC9, 0x95A2, 0x940F, 0x219C, 0xB3C0, 0x351C, 0x04AA, 0x510E, 0x00F7,
+    0x14C2, 0x1B5A, 0x06B4, 0x08DD, 0x35F9, 0x0903, 0x8A51, 0x42B4, 0x187E, 0xB370, 0xCAE8, 0x22C0,
+    0x504F, 0x3A22, 0x078A, 0x12EB, 0xB9F9, 0xB59C, 0x2609, 0x2ED9, 0x2AEC, 0x1685, 0x2436, 0xA5AE,
+    0x1ECC, 0x05D6, 0x14E2, 0x9FA9, 0x37CF, 0xABB3, 0xBFC6, 0xC2BE, 0x8E0A, 0x86AB, 0x272F, 0x0D5F,
+    0x2625, 0xA01A, 0x2D90, 0xA5A9, 0x0743, 0x287B, 0x0573, 0x840E, 0x3D6C, 0x8A9E, 0x8D88, 0x36FC,
+    0x8E1A, 0x1055, 0x2690, 0xA53F, 0x82E7, 0x2C17, 0x958F, 0x1433, 0x016C, 0x1A54, 0x3965, 0x9891,
+    0x94EF, 0xB1D4, 0x15B0, 0xAB5F, 0x838D, 0x1212, 0x0043, 0x03AC, 0x3A32, 0x377B, 0x156E, 0xB8F0,
+    0x0664, 0x2136, 0x209C, 0x3A44, 0x8E79, 0xB6D0, 0xB412, 0x474F, 0x91C4, 0x40AF, 0xA9E2, 0x8FF7,
+    0x402E, 0x9A61, 0x470D, 0x42DD, 0xCA7C, 0x25C9, 0x4730, 0xC6E9, 0x184B, 0x160F, 0x1AC0, 0xB7B9,
+    0xAD75, 0x4706, 0x00C3, 0x1B98, 0x8FE1, 0x1FD6, 0x4182, 0x9943, 0x3353, 0x9498, 0x000D, 0x12EC,
+    0x9803, 0xB9AB, 0xB34C, 0x4761, 0x1129, 0x0D80, 0x9FD8, 0x1E2A, 0x8C03, 0x0FDD, 0x4CDF, 0x197F,
+    0x1861, 0xA0DF, 0x2713, 0x8541, 0x85F9, 0x1177, 0xAA5D, 0x3271, 0x1E89, 0xA584, 0x9156, 0x0AF3,
+    0x2A0C, 0x1215, 0x244D, 0xBF3D, 0x4C7D, 0x5039, 0x83F6, 0xA131, 0x2A3A, 0x2A18, 0x17CE, 0x1567,
+    0xC6C4, 0x15B3, 0x320B, 0x964A, 0x323D, 0xBF6D, 0x146E, 0x8E71, 0x26E3, 0xB7E4, 0x0C75, 0x8F82,
+    0x02EC, 0x4D3C, 0x2021, 0x8B29, 0x0809, 0x9900, 0xA367, 0x3FDE, 0x4821, 0x0143, 0xC0CE, 0x3BE3,
+    0x17A5, 0xBE01, 0x9181, 0xA3E5, 0xA863, 0x1F3B, 0x8A5E, 0x4693, 0x03FB, 0xBE55, 0x3E04, 0xD02F,
+    0x3DE8, 0xC700, 0x3F32, 0x468E, 0x42E1, 0x360C, 0xC282, 0x9647, 0x1F1A, 0x0134, 0x1910, 0x0521,
+    0xB838, 0x4D23, 0x28FE, 0x0CE1, 0xBC8A, 0x42A6, 0x3F1F, 0xC7F8, 0x86BD, 0x9164, 0x4692, 0x9BBB,
+    0x42A1, 0x4B87, 0x1CA0, 0x48CF, 0x0024, 0xBDAD, 0x8574, 0xB963, 0x9A6B, 0xA336, 0xB447, 0x0E3F,
+    0x3503, 0x0B49, 0x42A3, 0xC2A2, 0x2DD9, 0xB925, 0x1086, 0x4076, 0x09AB, 0x9EB1, 0x0428, 0xC202,
+    0x134A, 0xAA6A, 0x334A, 0x30A2, 0xB0C5, 0x801A, 0x4973, 0x8500, 0x4A87, 0x07B5, 0x87DC, 0x0C55,
+    0x269C, 0x096A, 0x8E24, 0x034D, 0x82EE, 0x3127, 0x33CC, 0x090A, 0x470B, 0x13CB, 0xA35E, 0x2633,
+    0x992D, 0xB5B4, 0x88F4, 0xBF4A, 0x05BB, 0x2C02, 0x4385, 0xB11B, 0x259B, 0x14B9, 0x9614, 0xCD3B,
+    0x99DD, 0x05E3, 0x972F, 0x29A7, 0xAE7D, 0xD09D, 0x346F, 0xB44F, 0x422D, 0x8C06, 0x8D66, 0x009F,
+    0x01CA, 0x387C, 0x46DE, 0x3A65, 0x490D, 0x46C2, 0x3E19, 0x3BC2, 0xC175, 0x292F, 0xB346, 0x9854,
+    0x0E94, 0x1C58, 0x944C, 0x0676, 0xAF2B, 0x0176, 0x98F3, 0x01DA, 0x1A39, 0x4CCC, 0x0377, 0xCB72,
+    0x31F1, 0xA038, 0x3215, 0x81AE, 0x34DC, 0x3569, 0x2B53, 0x072A, 0x8F27, 0xD0DF, 0x32DA, 0x1252,
+    0x0D84, 0xA9E3, 0x4969, 0x436A, 0xBDE0, 0xBDC8, 0x4758, 0xC18E, 0x80D6, 0x07B7, 0x390A, 0x9044,
+    0x2759, 0x2909, 0x400C, 0x9748, 0xB5F8, 0x0BC6, 0x02B2, 0x342B, 0x3AF0, 0x1195, 0x0E14, 0x46ED,
+    0x2EAA, 0x0385, 0x103D, 0x24E1, 0x8344, 0xD049, 0x89A7, 0x4177, 0x14DA, 0xC2B9, 0x078F, 0x0598,
+    0x17D2, 0x8D59, 0x21B3, 0x824E, 0x2ABE, 0x356C, 0xC349, 0xB2D7, 0x2CBF, 0xC701, 0x9C90, 0x9D46,
+    0x14A2, 0xA728, 0x2CE3, 0xBF28, 0x2BD2, 0xB36E, 0x85DF, 0x0BBE, 0x80C0, 0x2098, 0x0FE5, 0x0864,
+    0x363C, 0x33ED, 0x2AA3, 0x87A7, 0x8122, 0x37D5, 0xB6C1, 0x12B4, 0x86E8, 0xA18D, 0xD144, 0x20CF,
+    0x3F6B, 0xCB93, 0x4171, 0x15AC, 0x1A64, 0xA3D5, 0xB0C6, 0x2D20, 0xA922, 0xAB67, 0x5058, 0xAD2E,
+    0x146D, 0x3226, 0x5068, 0x0939, 0x85F6, 0x1A4A, 0x9190, 0x1777, 0x068C, 0x34DB, 0x34DF, 0xC6F6,
+    0x1600, 0x310E, 0x8016, 0x14A5, 0x9078, 0x1EE1, 0xA37A, 0x17A4, 0x2447, 0x34E4, 0x4059, 0x43CC,
+    0x49B2, 0x3854, 0x212F, 0xC236, 0x094A, 0xB0D2, 0x2378, 0x1415, 0x2C20, 0xA733, 0xBDEC, 0x8FDE,
+    0x89DF, 0x15BC, 0x41E5, 0xB400, 0x1EA1, 0xB214, 0x0A99, 0x1416, 0x401E, 0x3AD8, 0x9A45, 0xC221,
+    0x4732, 0xB37D, 0x0169, 0x14BD, 0x3AF8, 0x9A21, 0x8A0D, 0x34E0, 0x280C, 0xC1C2, 0x94DB, 0x8493,
+    0x3E82, 0xC2C1, 0x2D56, 0x50FB, 0x96B7, 0xB101, 0x32AD, 0xC26E, 0x2EE0, 0x1984, 0x9BCA, 0xA9E7,
+    0x35EA, 0x023E, 0x14BB, 0x1097, 0x8FCD, 0xD066, 0x860C, 0x19B8, 0x921D, 0x94F4, 0x4714, 0x1BFF,
+    0x26F4, 0x2641, 0x1576, 0x4C82, 0x2E74, 0x3338, 0x4E87, 0xAD11, 0x9228, 0x0388, 0x1B57, 0xB0C7,
+    0x4959, 0x09CE, 0xC91C, 0x3739, 0x32F3, 0xA480, 0x3A84, 0x2113, 0xA7A1, 0x8831, 0x01BF, 0x4346,
+    0xBE2E, 0x4A8A, 0x0F0E, 0x32BA, 0x0505, 0x87C9, 0xC242, 0x9F54, 0xB355, 0x13A8, 0x0E59, 0x84C7,
+    0x107F, 0x399F, 0x148A, 0x3482, 0x2431, 0x4BA5, 0xB331, 0xA8C2, 0x0098, 0x818F, 0x9BB7, 0xAB3B,
+    0x4179, 0x4763, 0x353A, 0x8711, 0xA52E, 0x2A9C, 0x34B3, 0x3131, 0x418D, 0x0515, 0x4C9D, 0x9C31,
+    0x32A9, 0xA3B5, 0x0433, 0x867B, 0xA4AC, 0x1479, 0x049F, 0x92DF, 0x3E89, 0x2E73, 0x319A, 0x16D7,
+    0x3DF2, 0x4198, 0x275A, 0xA2C1, 0x1EB8, 0x357B, 0x85AE, 0x4C71, 0x14BF, 0x14E6, 0x3332, 0x0146,
+    0x38C6, 0xB1E5, 0x3499, 0x3688, 0x80BF, 0x1E49, 0x2634, 0x2797, 0x403A, 0x30B2, 0x3BC7, 0x229D,
+    0x32CC, 0x8DB9, 0x005C, 0x0092, 0x46EC, 0xC1DD, 0x46AE, 0xB2D9, 0x091C, 0x4803, 0x1D49, 0x1D3E,
+    0xCED5, 0x99FF, 0x4AD9, 0x2452, 0x01AC, 0x2A9F, 0xC238, 0x141F, 0x1AFC, 0x9A93, 0x230A, 0x29D7,
+    0x9FBF, 0x1A0B, 0x1ED3, 0x48D5, 0x2A0D, 0x2CED, 0x8A6B, 0x00B2, 0x3536, 0x0D54, 0xC21F, 0x3DF7,
+    0x34F7, 0x4ECF, 0x17E7, 0x434B, 0x438B, 0x4909, 0x04A2, 0x03DD, 0xB57D, 0x4E88, 0x19B0, 0x9158,
+    0x1E2F, 0xB6D1, 0x99DA, 0x886A, 0x9E55, 0x872F, 0x013D, 0x83FF, 0xC687, 0x3428, 0x06ED, 0x1A40,
+    0xAC78, 0x1229, 0x021F, 0xB218, 0x008F, 0x3123, 0xAA14, 0x39FE, 0x052E, 0x9FAF, 0x2EBE, 0x19F3,
+    0x0F07, 0x199E, 0xBA54, 0x2A00, 0xA73A, 0x0564, 0x00C5, 0x4372, 0xA56D, 0x0045, 0x21B6, 0x46B8,
+    0x2DFE, 0x036D, 0x24F8, 0x0E40, 0xBE78, 0x82F3, 0x261A, 0x30DB, 0x5183, 0x9126, 0x89D8, 0xC2D3,
+    0xBE5A, 0x082C, 0xBDF1, 0x1153, 0x16A9, 0x8191, 0x8DA3, 0x31C5, 0x00FF, 0x0DFC, 0x1926, 0x95B7,
+    0x40AC, 0x057F, 0x8243, 0xB41E, 0x0D9A, 0x4A9D, 0xCA8D, 0x3FA3, 0xCC9B, 0x0694, 0x9E3D, 0x42BB,
+    0xCC7C, 0x30B7, 0xB49C, 0x34A5, 0x0586, 0x147F, 0x1EA3, 0xB8ED, 0x3125, 0x3E2C, 0x46F9, 0x0D8F,
+    0x109E, 0x062D, 0x4769, 0x8634, 0xB414, 0x0C29, 0x11CF, 0x91CD, 0x869D, 0x231A, 0x3C48, 0x3FEB,
+    0x9AAF, 0xD0E0, 0x9171, 0x180F, 0x01D0, 0x1546, 0xA961, 0x28B2, 0xCEA6, 0xA331, 0x1EF5, 0x2718,
+    0x3126, 0x9E29, 0x3FB5, 0x3922, 0x2188, 0x03BB, 0x14A0, 0xBAAD, 0x50C9, 0x8151, 0x2737, 0x1E7D,
+    0xC885, 0x1F51, 0x1802, 0x0A83, 0x38D0, 0x8D09, 0x020D, 0x297D, 0xC216, 0x9E76, 0x46D1, 0xD12F,
+    0x1960, 0x087C, 0x10C9, 0x42B1, 0x041D, 0xB4C7, 0x0472, 0x046A, 0x0E42, 0x093E, 0x2E91, 0x8B19,
+    0x059D, 0x9F89, 0x9B71, 0x8741, 0x9E5B, 0x3138, 0xAD51, 0x43AD, 0x87CD, 0x4722, 0x2D28, 0x8408,
+    0x1793, 0x160B, 0x41D1, 0xC70C, 0x8E11, 0x800E, 0xC1FD, 0x329D, 0x1EA5, 0x0370, 0x2AF7, 0xB547,
+    0x98DB, 0x06A7, 0xBE13, 0xB458, 0xB0AD, 0xB17E, 0x2587, 0x3B41, 0x07B1, 0xAB46, 0xA8C5, 0x3F59,
+    0x9E64, 0x9712, 0xBDE3, 0x9375, 0xCAD5, 0x83BC, 0x2965, 0x480D, 0xC2EF, 0x8E5E, 0xB638, 0x3743,
+    0xBDF5, 0x3502, 0x4854, 0xAC70, 0x1188, 0x0EF0, 0x931A, 0x163F, 0x3533, 0x24C3, 0x12B1, 0x3970,
+    0xCA7B, 0x1422, 0x19CF, 0x0973, 0x9507, 0x8D97, 0x910F, 0xCC7B, 0x4738, 0x4CBA, 0x1E1B, 0xBDC6,
+    0x1268, 0x1FF7, 0x296B, 0x46CC, 0x299F, 0x124D, 0x24D2, 0xC3BA, 0x30C0, 0x00E1, 0x1F66, 0xCCEF,
+    0x25D9, 0x04C9, 0x2B84, 0x0964, 0x417F, 0x9E70, 0x1104, 0x863B, 0x2A8D, 0x03CC, 0xBB83, 0x46A3,
+    0x49AF, 0x3F76, 0x368B, 0x25B3, 0x15AA, 0x90E8, 0x051A, 0x8923, 0x1D64, 0x05DB, 0xA4AD, 0x8365,
+    0x2B77, 0x8AEB, 0x03CB, 0x4816, 0x4E8E, 0x360F, 0x81D7, 0x8682, 0x373D, 0x3F45, 0xB437, 0xAA37,
+    0x476C, 0xAF22, 0x9FA6, 0x9115, 0x14E8, 0x3ACE, 0xB56A, 0x9645, 0xC2E7, 0xB0AB, 0x42F8, 0xB3BA,
+    0x4A76, 0x2AA5, 0x8AF9, 0x06D4, 0x1E1F, 0x95AD, 0x8F6C, 0x4CCB, 0x8368, 0x06E9, 0x3593, 0xD070,
+    0x34AD, 0xCB77, 0x32F4, 0x2683, 0x09A4, 0x1F7C, 0x4802, 0x3354, 0xA384, 0x38A9, 0x3104, 0x9EBC,
+    0x1476, 0x1DEA, 0x8B62, 0x16C0, 0xA47E, 0x9B8D, 0x46A4, 0x0F14, 0x97AF, 0x0DBD, 0x13D1, 0xB8AC,
+    0x0655, 0x2856, 0xA4F3, 0x9292, 0x042D, 0x0071, 0x312D, 0x4E9A, 0x0442, 0xA8CA, 0x96B0, 0x519B,
+    0x324A, 0x8163, 0x37C9, 0xAC0D, 0x1D20, 0x084D, 0x20B7, 0x3F21, 0xC8BC, 0x8632, 0x252B, 0xCAA1,
+    0x1592, 0x0E50, 0x4172, 0x04D2, 0xA2ED, 0x9718, 0x8714, 0x8F6B, 0x47F4, 0x8673, 0x0EC1, 0x97E8,
+    0x03B3, 0x3DDA, 0x9814, 0x373B, 0x3974, 0x37FF, 0x38A3, 0x13A9, 0x8047, 0x8906, 0x3F37, 0x0561,
+    0x8C74, 0x1099, 0x3AD2, 0x04B1, 0x0FDB, 0x3550, 0x483F, 0x146A, 0xB8F8, 0x91D2, 0x050D, 0x879C,
+    0x86D1, 0x14A8, 0xC1F0, 0x3C07, 0xBDBC, 0x0DA6, 0x3E1B, 0x845C, 0x9AB0, 0x0173, 0x1AA6, 0x3DD4,
+    0x06C4, 0xCB55, 0x0584, 0x513B, 0x1550, 0x3A39, 0x84CB, 0x1AC9, 0x1948, 0xB236, 0xB27F, 0xB6CA,
+    0x94E9, 0x9532, 0x2056, 0x030B, 0x825C, 0x9F60, 0x19E5, 0xB779, 0x3AC1, 0xB93F, 0x80F5, 0x9FC5,
+    0x3F67, 0x26F6, 0x2E41, 0x1A17, 0x0070, 0x9DF9, 0x09C3, 0xBF9F, 0x8560, 0x1857, 0x30D8, 0x019B,
+    0x86A6, 0x10EA, 0x3388, 0x19D0, 0x42B3, 0x27AE, 0x4B8B, 0xBF26, 0x0969, 0x800B, 0x16CE, 0xB3EA,
+    0x34B1, 0x1528, 0xC081, 0x22D9, 0xC02A, 0x11D6, 0x2345, 0x9491, 0x4183, 0x0AD1, 0x0794, 0x3405,
+    0x5087, 0xA704, 0x3350, 0x9458, 0x27F4, 0x244C, 0x35F2, 0x2D14, 0xCC6E, 0xAA02, 0x8B57, 0xB628,
+    0x072C, 0x1987, 0x1934, 0x0DDD, 0x4EAE, 0x2626, 0xA517, 0xB53C, 0x9A4E, 0x80D7, 0x0C40, 0x3488,
+    0x0FE9, 0x1F45, 0x8416, 0x50DC, 0xBE2A, 0x324D, 0x468B, 0x0BDC, 0x3F3F, 0xC3CA, 0x1B6B, 0x92D5,
+    0x12A3, 0x10D6, 0x8FF3, 0x8FEB, 0x82CF, 0x4EB4, 0x2ED7, 0x3233, 0x0BD0, 0xB893, 0xC21D, 0xA2B7,
+    0x86C2, 0x1480, 0x2786, 0x31EE, 0x3252, 0x29EC, 0x3DC0, 0xCBA8, 0x46FA, 0x4A9E, 0x80AB, 0x03D1,
+    0x251B, 0x9084, 0x2A9A, 0xB51A, 0x4187, 0x9ED7, 0x4A9A, 0x0799, 0x4742, 0x4069, 0x3306, 0x9008,
+    0x2166, 0x215E, 0xC834, 0x815A, 0xA7D6, 0xB6FF, 0x1735, 0xC1E2, 0x34B9, 0xB3F4, 0x1076, 0xBA59,
+    0x0EB8, 0x0557, 0xC3CD, 0x837B, 0x1062, 0x28EF, 0xCA7D, 0x3552, 0x87FE, 0x498D, 0x034B, 0xA330,
+    0x99B5, 0xCB0D, 0x30C3, 0x054A, 0x0B99, 0xCB67, 0xAEA2, 0x01EF, 0x0A81, 0xCCA7, 0x28CD, 0x34AA,
+    0x8E6F, 0x407F, 0x2DD3, 0x2120, 0x4191, 0x1173, 0x2B81, 0x20DA, 0x2428, 0x86B8, 0x0321, 0x1977,
+    0x1806, 0x8D57, 0x81E8, 0xB16A, 0x19D2, 0xB787, 0x9E19, 0x8AEC, 0x4844, 0xA6EE, 0x41E8, 0x4C96,
+    0x130E, 0x2BD5, 0x3158, 0xBE00, 0x9A05, 0x95F6, 0x16AD, 0xD029, 0x1634, 0x9F3C, 0x39A8, 0x4D49,
+    0x337C, 0x178C, 0xC2BA, 0x0136, 0x8153, 0x0A80, 0x09D4, 0x8D7A, 0x3150, 0x29BF, 0x2E3F, 0x9010,
+    0x2AA1, 0xD18C, 0x4697, 0x3B1B, 0x1FAA, 0x4EAB, 0x4070, 0xA4B6, 0x2C03, 0x926C, 0xA550, 0x4B81,
+    0x093B, 0x8B81, 0x4185, 0x365B, 0x36D6, 0xA7B9, 0x32E9, 0x3470, 0x039C, 0x25E5, 0x154D, 0x315F,
+    0xA4F0, 0x83C6, 0xC890, 0xC930, 0x98E6, 0x8E4E, 0x19B7, 0x1184, 0x9F2E, 0x1362, 0x12A8, 0x1BD0,
+    0x456A, 0x0E3C, 0x2A77, 0x5073, 0xCC76, 0x4CA1, 0xAE9C, 0x507E, 0x0DDE, 0x1EEA, 0x34E6, 0xA023,
+    0xA9A9, 0xA2B8, 0x0EA2, 0x94D9, 0xB41F, 0x073F, 0x8950, 0x36BD, 0x2DF1, 0x2935, 0x2C1E, 0x2B34,
+    0x42C7, 0x8611, 0x1452, 0x90A0, 0x0E4F, 0x2DDA, 0x35B0, 0x04D8, 0x19AF, 0x2D80, 0x1749, 0xAC9D,
+    0x907C, 0x2162, 0x9FA8, 0x03EB, 0xACAC, 0x472D, 0x30CF, 0x9019, 0x30DD, 0x022E, 0x1834, 0x3A61,
+    0xC21A, 0x3F27, 0xA0D4, 0x29FF, 0xC6C1, 0xA3B9, 0x3931, 0xCEDF, 0x1150, 0x2B5B, 0x3BD1, 0x9E82,
+    0x9279, 0x4E85, 0x42AF, 0xC76F, 0x3181, 0x88B7, 0x4704, 0x4952, 0x34F4, 0x3577, 0x396E, 0x26DC,
+    0x1E8F, 0x0B07, 0x3A6E, 0x2E95, 0xC710, 0x3F74, 0x251D, 0x39E0, 0x2605, 0x3194, 0x0659, 0x0EFB,
+    0x4739, 0x05ED, 0x1FDD, 0x1E14, 0x0EE6, 0x8DB5, 0x8A58, 0xB168, 0x3534, 0xB2C2, 0x4ECC, 0x19AB,
+    0x47F6, 0x5063, 0x3E26, 0x4EDE, 0x85A2, 0xC085, 0xAC57, 0x05E0, 0x4D43, 0xC1CE, 0x474A, 0xB2F0,
+    0x350E, 0x361D, 0x4241, 0x1A44, 0x83F8, 0xA7A3, 0x1A97, 0x4251, 0x1E05, 0x3171, 0x348F, 0xACA8,
+    0x8746, 0xC2D1, 0xBAFC, 0x1F4F, 0xCA96, 0xC9E6, 0x31BC, 0x8553, 0xB0D5, 0x17F7, 0x4749, 0xA27E,
+    0x419E, 0x9AA2, 0x36D3, 0xA772, 0x80D4, 0x85F2, 0x0D65, 0x1073, 0x117C, 0x0526, 0x25BB, 0x9F59,
+    0x9EBF, 0xA17C, 0xBDE4, 0x0B1F, 0x984C, 0x35AB, 0xCA82, 0x91C3, 0x1152, 0x06A9, 0x503D, 0x8940,
+    0x3850, 0x4768, 0x3115, 0xAA3C, 0x0F2E, 0x907A, 0x47FE, 0x9E32, 0x03C9, 0xB49F, 0x08FD, 0x8BDD,
+    0x297E, 0x8FFD, 0xC19B, 0x1FA7, 0x4CB1, 0x011A, 0x0D63, 0xB88A, 0x001B, 0x1759, 0x9D32, 0x17EE,
+    0x335A, 0x8BCB, 0x437F, 0x80FB, 0x03B5, 0x02AC, 0x9005, 0xB7AE, 0x28C6, 0x42C4, 0x9D6A, 0x3F64,
+    0x1BFD, 0x3506, 0xD037, 0xBBCE, 0x15B4, 0x07DF, 0xB4CE, 0x8767, 0x13D4, 0x332C, 0x8389, 0x4EE2,
+    0x4D41, 0x4C78, 0xA029, 0x4CA3, 0xCECE, 0x20E8, 0x994F, 0x3A7F, 0x34CC, 0x30FA, 0x50C4, 0x9E24,
+    0x3DB4, 0x11BD, 0x9828, 0x043F, 0x3114, 0x8F4A, 0x1ED0, 0x19FD, 0x1A68, 0x8B79, 0x2ED5, 0x2462,
+    0x3F4B, 0xA93C, 0x1200, 0x2054, 0x0E31, 0x00C2, 0x32EA, 0x147C, 0xB539, 0x274C, 0x01CF, 0x8519,
+    0x9E0F, 0x87D6, 0x0595, 0xA5E7, 0x9411, 0x027B, 0x350F, 0xCD08, 0xBE12, 0x1F5A, 0x8928, 0x32EB,
+    0x06AF, 0x953D, 0xC7FB, 0x9820, 0x1A77, 0xC2E2, 0x92CB, 0xC20A, 0x4913, 0xC974, 0x4C9E, 0xBFDA,
+    0xBDCC, 0x120A, 0x04C3, 0xCC7A, 0x9DD3, 0x88E2, 0x146F, 0x0EBF, 0x3B86, 0xB881, 0x4D2F, 0x3DFA,
+    0x0401, 0x4E86, 0x32A5, 0x9E38, 0x101D, 0xBFB3, 0x95BE, 0x1ECA, 0xBB81, 0x10D3, 0x22D8, 0x428B,
+    0xB145, 0x50BE, 0x8F26, 0x3AE3, 0x416E, 0x45D6, 0x07BD, 0xAA1F, 0x2DC1, 0xD12C, 0x2A01, 0x92A6,
+    0x0221, 0x1B94, 0x5188, 0x504B, 0x2D7B, 0x3F25, 0x3FCC, 0x42D0, 0x2D79, 0x1355, 0xA66D, 0x27C2,
+    0x352F, 0x3B10, 0x4991, 0x95C9, 0x311F, 0x1269, 0x0AF6, 0xB4AE, 0xC200, 0x0B41, 0x14B5, 0x8F24,
+    0x1061, 0x1EAB, 0x3E05, 0x3549, 0xD0F9, 0x2EBC, 0x474E, 0x3DD3, 0x32FA, 0x18A8, 0x367A, 0x91E7,
+    0xB947, 0xBADF, 0x0D9D, 0x36DD, 0xB4AB, 0x0B38, 0xC181, 0x9E99, 0x09EF, 0x352B, 0x173B, 0x98D9,
+    0x3E28, 0xC703, 0x30E2, 0x1835, 0x19A5, 0x284D, 0x10D2, 0x1087, 0x9915, 0x861F, 0xA05B, 0x1DCF,
+    0xC8EA, 0x1C5B, 0x39E5, 0x0F9D, 0x42F4, 0x2992, 0xB774, 0x2FAE, 0x9A83, 0x4EC7, 0xA3E7, 0x3829,
+    0xBDF9, 0x12B2, 0x9202, 0x352D, 0x2B5C, 0x21B9, 0x05CD, 0x14E3, 0x0054, 0x91EA, 0x386B, 0x07C4,
+    0x9A37, 0x811E, 0x0376, 0xB678, 0xB09F, 0x994C, 0xBBEB, 0x3B2B, 0x886C, 0x0DB6, 0x28EE, 0x11F5,
+    0xAA52, 0x481F, 0x0520, 0x2C9C, 0x8355, 0x1DB5, 0x823C, 0x3DFE, 0x8929, 0xC8E9, 0x09C2, 0x2DE6,
+    0x8036, 0x3439, 0x0654, 0x41B9, 0xAB65, 0x8307, 0x12CA, 0x2ACA, 0x02F5, 0x0D5A, 0x0E3B, 0x8B2A,
+    0xB598, 0x1A33, 0x31E6, 0xC2B5, 0x2B7A, 0x4049, 0xB3FB, 0xB8B1, 0xC815, 0xB2CE, 0xB43E, 0x3F2D,
+    0xB0E1, 0x8B8D, 0x4689, 0x279A, 0x084C, 0xAD72, 0x2372, 0x1A55, 0x9909, 0xC72C, 0x25E9, 0x4072,
+    0x1204, 0xACFA, 0x3E73, 0x397B, 0x46E0, 0x87BB, 0x5021, 0x4D0F, 0x1F0E, 0x1CAB, 0x363D, 0x329B,
+    0x15ED, 0x1125, 0xA3A0, 0x14DF, 0x91D1, 0x29B5, 0x41DB, 0x2ECD, 0xB929, 0x5184, 0x28E5, 0x407C,
+    0x1762, 0x50EF, 0x8E3E, 0x8B34, 0x101B, 0x2053, 0xC2AC, 0x1155, 0x155E, 0x0B9E, 0x8343, 0x9692,
+    0xAB8A, 0x0015, 0x84A1, 0x254D, 0xC82E, 0x8B2D, 0x89AD, 0x418A, 0x0D16, 0x2C9F, 0x3993, 0x27A4,
+    0x92AB, 0xB2C0, 0x86BB, 0x94AC, 0xCCED, 0x0DE5, 0x5150, 0x27D5, 0x01FA, 0x29A2, 0x9EE8, 0x458F,
+    0x2FA6, 0x00D1, 0x32DB, 0x9AD5, 0x41AB, 0x4737, 0x34EF, 0x8547, 0x01AF, 0x1981, 0x12E9, 0x04D0,
+    0x4744, 0xBDD2, 0xADAB, 0x31AF, 0xC6F1, 0x228A, 0xBFC3, 0x04FE, 0xB48B, 0x8B0F, 0x803A, 0x1301,
+    0x3564, 0x25AB, 0xC34F, 0x0C6A, 0x0B54, 0x4EA0, 0x92A0, 0x4CD1, 0x121C, 0x3669, 0xA7E6, 0x14CE,
+    0x9A2A, 0xA4EE, 0x05E8, 0x2539, 0x17C1, 0x3FE4, 0x00A7, 0x0CE6, 0x2D06, 0x2B85, 0xA394, 0x2A87,
+    0xC295, 0x341B, 0x3398, 0x9870, 0x4836, 0xC3C9, 0x1F5C, 0xA7AB, 0xC37D, 0x01ED, 0x01DF, 0x469A,
+    0x4197, 0x0629, 0x0349, 0x97CF, 0x047D, 0xB365, 0x9990, 0xB8C0, 0x32EC, 0x474C, 0x0429, 0x275C,
+    0xB0E5, 0x3246, 0xC34E, 0x15F2, 0x8601, 0xA1A1, 0x2A2D, 0x1A16, 0xBA96, 0x50DB, 0x804B, 0xC6C0,
+    0x2822, 0x9F48, 0x0058, 0x0DF8, 0x1E57, 0x83C7, 0x1745, 0x04BE, 0x9A00, 0x1682, 0x0B76, 0xCB70,
+    0x4041, 0xBF61, 0x14AB, 0x0417, 0x8356, 0xB19E, 0xA8F1, 0x3F56, 0x4031, 0x94E5, 0x3AE4, 0x3DDF,
+    0xB30E, 0x30E7, 0x3E0C, 0x4B98, 0x046F, 0xBE33, 0x1669, 0x0E66, 0x9F0B, 0x26E2, 0x4A86, 0xB56E,
+    0x203A, 0xC0AB, 0x1014, 0x06CF, 0x4875, 0x28F9, 0x28D1, 0x91FB, 0x157B, 0x38F4, 0x4D13, 0x04A8,
+    0x506A, 0x310D, 0x95F4, 0x87F5, 0x1D22, 0x8157, 0x4EB8, 0x0CB8, 0x2BFD, 0x03E0, 0xC819, 0x1080,
+    0x2557, 0x1C97, 0xA4F1, 0xC38D, 0xA0E2, 0xC7EA, 0x30EB, 0x25B2, 0x296C, 0xA91F, 0x161E, 0x854F,
+    0x192C, 0xC6F7, 0x868F, 0x08E1, 0x1BDB, 0x92F9, 0xCB63, 0x2E1F, 0x0E45, 0x0DEE, 0x401D, 0xABFB,
+    0x5032, 0x329A, 0x200C, 0x14C9, 0x12E6, 0x8FB7, 0xB444, 0x84FF, 0x991B, 0xC6FD, 0x3DA7, 0x2B24,
+    0x9E40, 0x1E54, 0x3FEF, 0x3DDD, 0xA430, 0x0430, 0xA803, 0x3B7B, 0x3528, 0x8C76, 0x4EB2, 0x365C,
+    0x3FB8, 0x4CA0, 0x89CF, 0x86BF, 0x3651, 0x257E, 0xBDAF, 0x0B65, 0x331E, 0x044D, 0x3041, 0xC752,
+    0x06C0, 0x3B13, 0x9B66, 0x397D, 0x386E, 0x36B2, 0x35D4, 0x0056, 0x262E, 0x265A, 0x2C7F, 0xA3C3,
+    0x03EF, 0x0B2F, 0x2D50, 0x191D, 0xBDA9, 0x9B30, 0xABED, 0x185F, 0x0396, 0x172E, 0x50B4, 0x24F4,
+    0x8374, 0x28B4, 0x1501, 0x80CD, 0x1E11, 0xB934, 0x30F0, 0x8E4B, 0xA59F, 0x0E8D, 0x1C35, 0x2AB2,
+    0xA032, 0xD137, 0x2D95, 0x1626, 0x9418, 0xBF5A, 0x8E22, 0x01C5, 0x80DE, 0xA29C, 0x01F1, 0xA18C,
+    0x1652, 0x4998, 0x273B, 0x24C8, 0xB4E1, 0x4047, 0x8781, 0x471A, 0x8D83, 0x97B0, 0x3F2B, 0x0761,
+    0x2818, 0xA7E3, 0x9D84, 0x50CF, 0x14D4, 0x176B, 0x0CD2, 0x3222, 0x2D26, 0x07E4, 0xC1EE, 0xCAA5,
+    0x1206, 0x9F2B, 0xBF1E, 0x05FB, 0x905B, 0xD10B, 0x22E4, 0xCE7C, 0x8E51, 0x9EEB, 0xA7B0, 0x2984,
+    0xB7B0, 0x1797, 0x41D4, 0x485B, 0x41A9, 0x351B, 0xBF3B, 0xA6E6, 0x212D, 0x13E6, 0x3949, 0xB40C,
+    0x29EB, 0x9884, 0x8824, 0x8C34, 0xBE08, 0x3DAB, 0x26A8, 0x8968, 0xA00A, 0x3E29, 0x1185, 0x81A0,
+    0x173E, 0x406F, 0xCA9B, 0x21D2, 0x34CA, 0x1F3D, 0x97E9, 0x2E07, 0x3527, 0x4390, 0x1EAA, 0x8933,
+    0x39D2, 0x3B0A, 0x322A, 0x198B, 0x5028, 0x3FD1, 0xBF4E, 0xB0A8, 0x0506, 0x2A47, 0x928C, 0xB915,
+    0xA146, 0x4712, 0x3DB5, 0x42FD, 0xC6E2, 0x172B, 0x3FC4, 0x29E9, 0xBF5E, 0xCA79, 0x1F9E, 0xC195,
+    0xB172, 0x32B1, 0x4B92, 0x2552, 0x07CC, 0xA899, 0x9D96, 0x2904, 0x057A, 0xB41C, 0x30FF, 0x4EC5,
+    0x1BA7, 0x189D, 0xC66B, 0x11D9, 0x0750, 0x9E79, 0x16D8
+};
+
+/**
+ * @brief pinyin hash values, syllable bit 0 - 7
+ */
+static const uint8_t gs_pinyin_value[LD3320_PINYIN_CODE_NUM] =
+{
+    0x5B, 0xC7, 0x73, 0x46, 0x22, 0x0A, 0x25, 0x68, 0x6A, 0x5F, 0x62, 0x61, 0x59, 0x63, 0x5C, 0x54,
+    0x5A, 0xB4, 0x28, 0x88, 0xA7, 0xED, 0xBC, 0x49, 0x65, 0x08, 0x1D, 0x5E, 0xF5, 0xF7, 0x5C, 0x25,
+    0x4A, 0x89, 0x14, 0x81, 0x3B, 0x9A, 0x2F, 0x83, 0x47, 0x78, 0xAC, 0xD4, 0x20, 0x81, 0x5A, 0xAE,
+    0x85, 0x31, 0x49, 0x62, 0x51, 0x76, 0x3B, 0x04, 0x22, 0x33, 0x1B, 0x3C, 0x84, 0x02, 0x13, 0x51,
+    0xC7, 0x2A, 0x08, 0x26, 0x5A, 0x67, 0x39, 0x5C, 0x37, 0x7F, 0x7E, 0x30, 0x78, 0x12, 0xA5, 0x78,
+    0x4A, 0x31, 0xFB, 0xF1, 0x00, 0x32, 0x3B, 0x42, 0x2A, 0xBF, 0x19, 0x67, 0x50, 0x36, 0x86, 0x4A,
+    0x59, 0x46, 0x8C, 0x20, 0x6C, 0x4A, 0x0A, 0x4A, 0x53, 0x17, 0x7A, 0x5B, 0x22, 0xC8, 0xA5, 0x22,
+    0xB3, 0x0D, 0xB0, 0x7E, 0x9B, 0xB1, 0x1A, 0x0F, 0x09, 0x07, 0x5F, 0x3F, 0x89, 0x57, 0x87, 0x56,
+    0x11, 0x7D, 0xB3, 0xF7, 0x87, 0x73, 0x37, 0x6C, 0x8E, 0xDA, 0x19, 0xF9, 0x28, 0x86, 0x3C, 0x1E,
+    0x22, 0xCB, 0x5E, 0xFB, 0x88, 0x11, 0x01, 0x5B, 0x78, 0x0A, 0x33, 0x7D, 0x80, 0x25, 0xE5, 0x4B,
+    0x63, 0xF5, 0x69, 0x67, 0x2B, 0x89, 0x47, 0x05, 0x37, 0x83, 0xF4, 0x4B, 0x7D, 0xAF, 0x13, 0x67,
+    0x81, 0x23, 0x44, 0x14, 0x70, 0x7F, 0x68, 0x70, 0xA5, 0xE9, 0x6C, 0x4C, 0x82, 0xD7, 0x5E, 0x83,
+    0x7D, 0x7E, 0x2A, 0x89, 0x5F, 0x33, 0x23, 0x94, 0x9E, 0xBA, 0x1D, 0xAC, 0x3C, 0x34, 0x67, 0xDF,
+    0x6D, 0x7D, 0x23, 0xB7, 0xCA, 0xF1, 0x73, 0x89, 0x19, 0x87, 0x20, 0x15, 0xE6, 0x75, 0x7E, 0xD7,
+    0x90, 0x3E, 0x7E, 0x78, 0x5F, 0x57, 0x80, 0x49, 0x37, 0x6E, 0x13, 0x91, 0x52, 0x3A, 0x00, 0x62,
+    0x07, 0x5D, 0xBC, 0x4A, 0x49, 0x8A, 0x0D, 0x7D, 0x0F, 0x56, 0x25, 0x91, 0x04, 0xB6, 0xB8, 0xA8,
+    0x87, 0xB3, 0x0F, 0x07, 0xB1, 0x37, 0x99, 0x65, 0x34, 0x9E, 0x4C, 0x19, 0x86, 0x83, 0x7A, 0xAD,
+    0x84, 0xF4, 0x38, 0x05, 0x05, 0xB4, 0x1E, 0xAB, 0x0A, 0xB6, 0x9B, 0x56, 0x69, 0x63, 0x56, 0x50,
+    0x68, 0x72, 0x33, 0x1E, 0x0A, 0x67, 0x50, 0xB0, 0x34, 0x08, 0xF0, 0x17, 0x83, 0x50, 0xD3, 0x09,
+    0x60, 0xAE, 0x49, 0x61, 0x2F, 0xA3, 0xF0, 0x3F, 0x52, 0x0F, 0x5A, 0x79, 0xE6, 0x05, 0xF5, 0x69,
+    0xFC, 0x17, 0x5A, 0x4F, 0x65, 0x9D, 0x61, 0x68, 0x57, 0x37, 0x62, 0x7E, 0x5F, 0x3E, 0x11, 0x69,
+    0x12, 0x84, 0x54, 0x9C, 0x4A, 0x63, 0x38, 0x7F, 0x4B, 0xF5, 0xE5, 0xB4, 0xFE, 0x0D, 0x1D, 0xA7,
+    0x54, 0xA7, 0x1D, 0x4A, 0x25, 0x3F, 0x34, 0x65, 0xE9, 0x8E, 0x6C, 0x57, 0x75, 0xC0, 0x6C, 0x31,
+    0xE6, 0x67, 0x50, 0x59, 0x45, 0x69, 0x88, 0xA0, 0x63, 0x35, 0x0C, 0x83, 0xA8, 0x83, 0x89, 0x6E,
+    0x9D, 0x81, 0x6F, 0xB3, 0x72, 0xEE, 0x40, 0x69, 0x68, 0x2A, 0x7F, 0xB3, 0xEB, 0x51, 0x5C, 0x61,
+    0x36, 0xEC, 0x87, 0x55, 0xD9, 0x4B, 0x67, 0x53, 0x90, 0xE9, 0x9A, 0xA3, 0xA8, 0x7E, 0xA3, 0x35,
+    0x36, 0x97, 0x42, 0x69, 0xF5, 0x6E, 0x1E, 0x7D, 0x7F, 0x1A, 0xA9, 0x67, 0xC6, 0x63, 0x7D, 0x63,
+    0x17, 0x2F, 0xB0, 0x24, 0x0E, 0xF0, 0x78, 0xF2, 0x7F, 0x63, 0x63, 0x6C, 0x4E, 0x69, 0x5E, 0x69,
+    0x8D, 0x76, 0x0A, 0x2B, 0x37, 0x8A, 0x63, 0x30, 0x5A, 0x13, 0x3D, 0x21, 0xC8, 0x87, 0x7D, 0x61,
+    0x50, 0x56, 0xE8, 0x48, 0x74, 0xF6, 0x44, 0x1D, 0x84, 0x7E, 0x8F, 0xA5, 0x9C, 0x7D, 0x1D, 0x7C,
+    0x3C, 0x10, 0x1B, 0x53, 0xA5, 0x44, 0x79, 0x2C, 0x66, 0x4F, 0x19, 0xC1, 0xFC, 0xF4, 0x99, 0x4F,
+    0x43, 0xEC, 0x7E, 0x7A, 0x81, 0x23, 0x1F, 0x47, 0xE5, 0x7E, 0x28, 0x69, 0x6F, 0x60, 0x26, 0xD3,
+    0x13, 0x04, 0xAC, 0x2D, 0x67, 0xB6, 0x75, 0xFE, 0x89, 0xA3, 0xC6, 0x69, 0xC6, 0xF7, 0xC2, 0xE5,
+    0x89, 0x81, 0xB0, 0xF5, 0xC8, 0x62, 0xF9, 0x38, 0xC1, 0x09, 0x3F, 0x3D, 0x50, 0xDB, 0x77, 0x07,
+    0xBF, 0x28, 0x5F, 0x4F, 0xAE, 0x8F, 0xBD, 0xAC, 0x3F, 0xBC, 0x6A, 0x79, 0x7D, 0x8F, 0x62, 0x49,
+    0x44, 0x35, 0x41, 0x51, 0xC1, 0x50, 0x80, 0xE6, 0x53, 0x81, 0x2F, 0x6C, 0x1B, 0xE9, 0x81, 0x86,
+    0x63, 0x50, 0x24, 0x23, 0x56, 0x06, 0x7A, 0x5F, 0x28, 0x7C, 0xB4, 0x89, 0x67, 0x9F, 0x62, 0xF4,
+    0x87, 0x38, 0xFF, 0x49, 0x75, 0x21, 0x0D, 0x63, 0x45, 0xA4, 0xEC, 0x1D, 0x40, 0x5A, 0x5B, 0x90,
+    0x63, 0x7F, 0x89, 0xBE, 0x0E, 0x81, 0xE2, 0xFE, 0x79, 0x0E, 0x74, 0x69, 0x54, 0x21, 0x5C, 0xBA,
+    0x69, 0xC8, 0xF4, 0x50, 0x0D, 0x37, 0xBD, 0x56, 0x56, 0xB0, 0x34, 0x2D, 0x84, 0xB2, 0xC0, 0x24,
+    0x19, 0x0E, 0x87, 0xF8, 0x6B, 0x7E, 0x04, 0x15, 0xF5, 0xA5, 0x61, 0x6C, 0x4B, 0x22, 0x0D, 0xD3,
+    0x21, 0x0D, 0xAD, 0xF5, 0x57, 0xCE, 0x3B, 0x53, 0x25, 0x93, 0x2E, 0x51, 0x24, 0x5C, 0xF5, 0x9F,
+    0x63, 0x1D, 0x08, 0x90, 0xEC, 0x5F, 0xF7, 0x41, 0x3E, 0x7D, 0x7A, 0x22, 0x5E, 0x46, 0x6C, 0x89,
+    0x63, 0x4C, 0x5F, 0x61, 0x19, 0x40, 0x1B, 0xAC, 0x3E, 0xEC, 0x2D, 0x7F, 0xBC, 0xEE, 0xEC, 0x81,
+    0x64, 0x79, 0x6A, 0x16, 0x7D, 0x2D, 0x6B, 0xF7, 0x3B, 0x5A, 0xB8, 0xBC, 0x89, 0x23, 0xB6, 0x05,
+    0xF0, 0x53, 0x52, 0x4C, 0x24, 0x62, 0x7D, 0x5A, 0xB6, 0x65, 0x83, 0x40, 0x19, 0x27, 0xFF, 0x84,
+    0x70, 0x10, 0xE9, 0x42, 0x89, 0x87, 0xA5, 0x21, 0x3B, 0x67, 0xCC, 0x7A, 0x0C, 0xED, 0x24, 0x40,
+    0x31, 0x87, 0x1B, 0x41, 0x8E, 0x21, 0x6C, 0x68, 0x7C, 0x81, 0x4F, 0x7F, 0x00, 0x7E, 0x51, 0xB1,
+    0x80, 0x34, 0x5B, 0x55, 0xA5, 0xA5, 0x1C, 0x4E, 0x32, 0x1E, 0x48, 0x63, 0x9A, 0x60, 0x07, 0x4B,
+    0x81, 0xC6, 0x68, 0x2F, 0xF9, 0x1B, 0x87, 0x25, 0xDB, 0x20, 0x60, 0x7D, 0x3C, 0x88, 0x90, 0x7F,
+    0x5F, 0x38, 0x78, 0x07, 0xA8, 0x67, 0xE3, 0x58, 0xA7, 0x7F, 0x7A, 0x5C, 0x49, 0x6B, 0xCA, 0x3E,
+    0x6F, 0x0E, 0x80, 0x18, 0x3B, 0xC8, 0x81, 0x53, 0x8B, 0x62, 0x5B, 0x60, 0x7C, 0x7E, 0x23, 0x4E,
+    0x8B, 0x56, 0xD6, 0x00, 0x53, 0x78, 0x15, 0xEC, 0xA5, 0xEB, 0x22, 0x81, 0x9E, 0x10, 0x23, 0x24,
+    0x75, 0x48, 0x38, 0x1F, 0x87, 0x5E, 0x3E, 0x4F, 0x0C, 0x50, 0x87, 0x76, 0x9A, 0x2E, 0x86, 0x34,
+    0x04, 0x5C, 0x1E, 0x55, 0xEC, 0x4B, 0x8C, 0x55, 0x22, 0xEC, 0x54, 0x9B, 0x46, 0x51, 0x7F, 0x37,
+    0x40, 0xF5, 0x62, 0x51, 0x69, 0x5C, 0x69, 0x6D, 0x2A, 0xAD, 0x38, 0x55, 0x69, 0x84, 0x76, 0xF5,
+    0x88, 0x5D, 0x20, 0x7C, 0x0A, 0xFE, 0xFF, 0x37, 0x59, 0xF1, 0x8D, 0x74, 0x41, 0x63, 0x37, 0x80,
+    0xC6, 0x7F, 0x7F, 0xA7, 0x6E, 0x16, 0x3F, 0x5B, 0x0F, 0xBA, 0x87, 0x59, 0x0A, 0x23, 0x4B, 0x69,
+    0x62, 0x35, 0x6C, 0xB9, 0x88, 0x13, 0x36, 0xA2, 0x55, 0x5F, 0x54, 0x16, 0x62, 0x12, 0x3E, 0xB9,
+    0x2C, 0xEB, 0x30, 0x77, 0x3A, 0x37, 0x23, 0xBC, 0xA5, 0x4B, 0x49, 0x07, 0x36, 0x61, 0x64, 0x34,
+    0x3D, 0xB3, 0x7B, 0x36, 0x2E, 0x1F, 0x9F, 0xE3, 0x32, 0xAF, 0x3F, 0x62, 0x00, 0x24, 0x3D, 0x6F,
+    0xB6, 0x6C, 0xA0, 0xFD, 0x4F, 0x50, 0x3F, 0x42, 0x4A, 0x77, 0x52, 0x5F, 0x61, 0x1B, 0x10, 0x22,
+    0x2F, 0x86, 0xB1, 0x01, 0xFC, 0x24, 0x87, 0x19, 0x7D, 0xF5, 0x21, 0x27, 0x75, 0x67, 0x7F, 0x60,
+    0x9D, 0xD9, 0x37, 0x45, 0xB3, 0xBA, 0x51, 0x0D, 0x7F, 0xB3, 0x32, 0x89, 0x4E, 0x1B, 0xBC, 0x6B,
+    0x75, 0x46, 0xEC, 0x64, 0x65, 0xE8, 0x7E, 0x37, 0x64, 0xC0, 0x0C, 0xD4, 0x87, 0x0A, 0x09, 0xA4,
+    0x89, 0x65, 0xB3, 0x3D, 0x6D, 0x10, 0x4A, 0x52, 0x62, 0x42, 0x46, 0x5B, 0xAA, 0xF3, 0x65, 0x03,
+    0x50, 0xB6, 0xB3, 0xB5, 0xB1, 0x62, 0xA5, 0x52, 0x3B, 0x22, 0x0B, 0x96, 0x50, 0x79, 0x68, 0xF5,
+    0x87, 0x9F, 0x63, 0x87, 0x5B, 0x5A, 0x41, 0xBF, 0x9F, 0x69, 0x0E, 0x86, 0xE4, 0x3B, 0x34, 0xA5,
+    0xA7, 0x6C, 0x3C, 0x22, 0x4B, 0x3F, 0x77, 0x3B, 0x90, 0xF4, 0x56, 0x4B, 0x4F, 0x80, 0x4F, 0x8D,
+    0x62, 0x7C, 0x36, 0x88, 0x3E, 0x44, 0x7D, 0x50, 0x62, 0xAB, 0xAF, 0x63, 0x50, 0x5B, 0x76, 0x85,
+    0x5F, 0x7E, 0x62, 0x7A, 0x19, 0x62, 0x7A, 0x60, 0x3E, 0x38, 0x14, 0x23, 0xAC, 0x5F, 0x35, 0x63,
+    0x65, 0x9A, 0x7B, 0x25, 0x6E, 0x75, 0xB0, 0x1E, 0x53, 0x4A, 0x13, 0x69, 0x07, 0x3F, 0x87, 0x23,
+    0xA9, 0xEE, 0xBF, 0x11, 0x14, 0x90, 0x4C, 0x7F, 0x2F, 0x67, 0x07, 0x3F, 0x8D, 0x7F, 0xB8, 0x51,
+    0x54, 0xA5, 0x84, 0x3B, 0xF5, 0x63, 0x5D, 0x8A, 0x62, 0x55, 0x62, 0xC8, 0x87, 0x69, 0x6A, 0x84,
+    0x6A, 0x69, 0x3F, 0x7E, 0x4B, 0x69, 0x7F, 0x95, 0x80, 0x7E, 0xCB, 0xC6, 0x65, 0x1A, 0xAB, 0xAB,
+    0x78, 0x52, 0x55, 0x75, 0x16, 0xAF, 0xE6, 0x1C, 0x7A, 0x0F, 0x3A, 0xC3, 0x87, 0x4F, 0x69, 0x4B,
+    0x2C, 0xC6, 0x61, 0x39, 0x4B, 0xC4, 0x64, 0x75, 0xF9, 0x2E, 0x52, 0xC6, 0x81, 0xA5, 0x42, 0x6E,
+    0x41, 0x2D, 0x38, 0x7E, 0x3F, 0x52, 0x86, 0xFA, 0x13, 0x01, 0x2D, 0x5D, 0x6A, 0x6C, 0x32, 0xAB,
+    0x12, 0x76, 0x79, 0x75, 0xC0, 0xAA, 0xBA, 0xD9, 0x7E, 0xA7, 0x87, 0x8D, 0x20, 0x68, 0x80, 0xB1,
+    0x0C, 0x7B, 0x63, 0x78, 0x63, 0x87, 0x2C, 0x22, 0x7C, 0x56, 0x8A, 0x89, 0x37, 0x6B, 0xF7, 0x81,
+    0x0B, 0x2F, 0xFF, 0xB0, 0x4F, 0x55, 0x4B, 0x13, 0x3B, 0x88, 0xBF, 0x05, 0x4B, 0x7E, 0x5A, 0x76,
+    0xFC, 0xF2, 0x53, 0x25, 0x59, 0x23, 0x0C, 0x44, 0x52, 0xAE, 0x42, 0xFD, 0xA7, 0x37, 0x65, 0xAE,
+    0xA5, 0xFB, 0xBE, 0x1B, 0xE7, 0x50, 0xA7, 0xF4, 0xFF, 0x28, 0x50, 0x97, 0xB6, 0x23, 0x2B, 0x69,
+    0x26, 0x5F, 0x75, 0x05, 0x5C, 0x88, 0x47, 0x3F, 0x24, 0x61, 0xBD, 0x1E, 0x82, 0x9F, 0x34, 0x8E,
+    0xA5, 0xF4, 0x2D, 0xA5, 0x63, 0x56, 0x0D, 0x76, 0x60, 0x05, 0xCE, 0x52, 0x22, 0x20, 0x70, 0x56,
+    0x60, 0x82, 0xF9, 0x6C, 0x0E, 0xF8, 0x86, 0xF9, 0x55, 0x6B, 0x8E, 0x17, 0x58, 0x53, 0x6A, 0x7E,
+    0x7C, 0x4C, 0x25, 0x7D, 0x7A, 0x7F, 0x81, 0x2F, 0x8A, 0xF2, 0x89, 0x0D, 0x07, 0x69, 0x01, 0xC6,
+    0x76, 0x56, 0x22, 0x45, 0x69, 0x19, 0x5A, 0x67, 0x33, 0x53, 0xB3, 0x26, 0x1D, 0x54, 0x0D, 0x50,
+    0x49, 0x7E, 0x80, 0x36, 0x39, 0x3A, 0xF5, 0x7E, 0x7F, 0x63, 0x5F, 0x1B, 0x7A, 0x7E, 0x2A, 0x13,
+    0x68, 0x4F, 0x2F, 0x29, 0x90, 0x80, 0x65, 0x7D, 0x7D, 0x7B, 0x7F, 0x8E, 0x69, 0x24, 0x2C, 0x52,
+    0x4B, 0xB4, 0x79, 0x1D, 0x1C, 0xB0, 0x57, 0x17, 0x7E, 0x90, 0xC6, 0xA2, 0xFB, 0x09, 0xBF, 0xA5,
+    0xBA, 0x52, 0x26, 0x88, 0x57, 0x89, 0x2F, 0x81, 0x24, 0x7D, 0x58, 0x7F, 0x45, 0x2F, 0x81, 0xB3,
+    0x12, 0x62, 0x22, 0xFF, 0x2F, 0x76, 0x4E, 0x54, 0xBA, 0x82, 0x38, 0x63, 0x4B, 0x0D, 0x2E, 0x0B,
+    0x9A, 0x0C, 0xA8, 0x1A, 0x90, 0xC8, 0xB6, 0x0A, 0xF7, 0x5F, 0x13, 0xF7, 0x39, 0xEC, 0x51, 0x45,
+    0x2C, 0xFA, 0x3A, 0x23, 0x05, 0x81, 0x5A, 0xB2, 0x8F, 0x7D, 0x81, 0x11, 0x54, 0x0C, 0x25, 0x7F,
+    0xD7, 0x01, 0x69, 0x64, 0x56, 0x8C, 0xF8, 0x63, 0x0D, 0x7D, 0xA5, 0xB0, 0x0D, 0x3E, 0x21, 0x56,
+    0x16, 0x90, 0x24, 0xCD, 0xC3, 0x3B, 0x45, 0xA2, 0xB0, 0x51, 0xBA, 0x63, 0x7E, 0x09, 0x2D, 0x6E,
+    0x0C, 0x8D, 0x0E, 0xBF, 0x56, 0x73, 0x86, 0x43, 0x0F, 0x52, 0x68, 0x7F, 0x50, 0x5C, 0xDF, 0x62,
+    0x47, 0xA4, 0x7A, 0xC6, 0x65, 0x60, 0x57, 0x4B, 0x59, 0x53, 0x89, 0x7E, 0x7E, 0x95, 0x95, 0x26,
+    0xA9, 0x05, 0x4F, 0x5A, 0x5B, 0x7A, 0xF2, 0x3D, 0xE6, 0x89, 0x1B, 0xC1, 0x72, 0x07, 0x21, 0xD7,
+    0x38, 0x28, 0x4F, 0x42, 0x7B, 0xA1, 0x69, 0x5F, 0x16, 0x84, 0x56, 0x7F, 0xB0, 0x81, 0x56, 0xB0,
+    0x7D, 0xF3, 0x2E, 0xB0, 0x42, 0xFB, 0x81, 0x4A, 0x22, 0x8A, 0x41, 0x04, 0x7E, 0x71, 0xF8, 0xB8,
+    0x56, 0x21, 0x4A, 0x81, 0xA7, 0xE7, 0xB8, 0xAD, 0x24, 0xAF, 0x7E, 0x90, 0x24, 0x53, 0x57, 0x22,
+    0xFA, 0x55, 0x41, 0x0D, 0xF5, 0x5F, 0xEE, 0x7F, 0x46, 0xF9, 0x45, 0x02, 0x7E, 0x51, 0x69, 0x0E,
+    0x65, 0x1C, 0x04, 0x7E, 0x45, 0x7E, 0x6F, 0x78, 0x62, 0x16, 0x8C, 0x84, 0xAE, 0xB1, 0x83, 0xFC,
+    0x5E, 0xB2, 0x71, 0x8A, 0x14, 0xD4, 0x56, 0x37, 0x1C, 0xBE, 0x6D, 0xBF, 0x7A, 0xF5, 0x3D, 0x23,
+    0x69, 0x50, 0xBF, 0xA0, 0x2E, 0xAF, 0x7A, 0x13, 0x70, 0xD3, 0x84, 0xEC, 0xA3, 0x1E, 0x8A, 0x52,
+    0x60, 0x1A, 0x55, 0x33, 0x65, 0x7D, 0x04, 0x67, 0x1D, 0x8C, 0xFF, 0x2D, 0xD9, 0xB7, 0x52, 0x52,
+    0x0E, 0x7D, 0x7E, 0x44, 0x7D, 0x25, 0x52, 0x0D, 0x0C, 0x01, 0x7A, 0x86, 0x00, 0xFE, 0xB3, 0x50,
+    0x99, 0x11, 0x6C, 0x63, 0xE8, 0x25, 0x5C, 0x1E, 0xCB, 0x02, 0x59, 0xB8, 0x28, 0xF9, 0x9A, 0x7E,
+    0x4A, 0xC7, 0xC4, 0xA5, 0x43, 0xB0, 0x88, 0xFF, 0x69, 0x09, 0x4B, 0xF5, 0x55, 0xA0, 0x82, 0x88,
+    0x17, 0x1F, 0x2C, 0x22, 0x52, 0x4E, 0xC0, 0x0D, 0x54, 0x68, 0x25, 0x8D, 0x37, 0x28, 0xEB, 0x57,
+    0x0A, 0x3C, 0x95, 0x96, 0x64, 0x0D, 0x63, 0x4E, 0x9A, 0x90, 0x0E, 0x87, 0x88, 0x75, 0xA7, 0xC4,
+    0x4F, 0x60, 0x7C, 0x14, 0x83, 0xE9, 0x4F, 0x0C, 0xF5, 0x7A, 0x7D, 0x69, 0x7F, 0xA9, 0xF5, 0xAE,
+    0x7C, 0x3F, 0x50, 0x91, 0x15, 0x7E, 0x87, 0x67, 0x69, 0x13, 0x23, 0x8C, 0x7D, 0x63, 0xD6, 0x11,
+    0x50, 0x46, 0xAC, 0xE4, 0x86, 0x39, 0x7E, 0xC6, 0x79, 0x39, 0x13, 0x8C, 0x3B, 0x4B, 0x23, 0x8A,
+    0x5B, 0xFB, 0xC8, 0xF7, 0xF5, 0x6B, 0x69, 0x0A, 0xA5, 0xC1, 0x47, 0x54, 0x14, 0x39, 0x0C, 0x81,
+    0x81, 0x58, 0x55, 0xF8, 0x4B, 0x67, 0x6F, 0x90, 0x36, 0x56, 0xA5, 0x79, 0x0A, 0xF7, 0x54, 0x50,
+    0x6A, 0x83, 0x7D, 0x09, 0xA1, 0x84, 0x80, 0x18, 0x78, 0x51, 0xCA, 0xBC, 0x20, 0xDF, 0x9E, 0xD3,
+    0x27, 0x89, 0x54, 0x1D, 0x1B, 0xCC, 0x20, 0xB1, 0x4F, 0x63, 0x89, 0x46, 0x78, 0xFA, 0x29, 0x0D,
+    0x89, 0x64, 0x5C, 0x38, 0x5D, 0x3B, 0x77, 0x5E, 0x3E, 0x1B, 0x69, 0xB0, 0x05, 0x36, 0x7E, 0x68,
+    0x7E, 0x69, 0x66, 0x94, 0x61, 0x1D, 0xF5, 0x4F, 0x50, 0x62, 0xF2, 0x44, 0x7C, 0x56, 0x61, 0x22,
+    0x6B, 0xC6, 0x27, 0x56, 0xE3, 0xD4, 0x83, 0xE4, 0x13, 0x2A, 0x8C, 0x84, 0x2B, 0x8A, 0x05, 0x88,
+    0x69, 0x8C, 0x5E, 0x02, 0xAA, 0x5E, 0x7D, 0xA8, 0x07, 0x49, 0x59, 0x01, 0x2C, 0x5A, 0x9A, 0x84,
+    0x04, 0x9A, 0x24, 0x7C, 0x69, 0xF0, 0x5F, 0x78, 0x97, 0x0A, 0x52, 0x4B, 0x74, 0x0E, 0x7A, 0x56,
+    0x60, 0xA3, 0xA3, 0x24, 0x25, 0xBA, 0x35, 0xAB, 0x2F, 0x4F, 0xBE, 0xBC, 0xF6, 0x68, 0x3F, 0x2C,
+    0xEC, 0x3E, 0x11, 0xCE, 0x7E, 0xFE, 0x38, 0x61, 0x58, 0xAA, 0x6C, 0x90, 0x84, 0x3E, 0x75, 0x62,
+    0xA7, 0xD4, 0x55, 0x82, 0x50, 0x5F, 0x52, 0x67, 0x57, 0x56, 0x15, 0xD7, 0xFE, 0x7B, 0x63, 0xC6,
+    0x4B, 0x54, 0xF9, 0x6A, 0xF5, 0x21, 0xF7, 0xE6, 0x86, 0x64, 0xEC, 0x23, 0x2C, 0xB0, 0xA0, 0x4B,
+    0x09, 0xE8, 0xAA, 0x1C, 0xB4, 0x24, 0xC1, 0x69, 0x25, 0x90, 0x19, 0x22, 0x15, 0x26, 0x3D, 0x24,
+    0x20, 0x39, 0xE5, 0x59, 0xA5, 0x6E, 0xEF, 0x36, 0x4E, 0x7D, 0x79, 0x9E, 0x1F, 0x7E, 0x33, 0x3B,
+    0x1B, 0x32, 0x3E, 0xA1, 0xD3, 0x65, 0x65, 0xBA, 0x53, 0x49, 0x54, 0x2E, 0x0A, 0x11, 0x49, 0x38,
+    0x41, 0x01, 0xEB, 0x9D, 0x2F, 0x5C, 0x7A, 0x40, 0x50, 0x86, 0xAC, 0xD7, 0xE7, 0x28, 0x0D, 0x90,
+    0xD7, 0x99, 0x28, 0x2C, 0xBA, 0xF5, 0xD1, 0x16, 0xA3, 0x5C, 0x61, 0x15, 0xEF, 0x89, 0x50, 0x7D,
+    0x7D, 0x82, 0x2C, 0x37, 0x75, 0x38, 0x99, 0x58, 0x64, 0x21, 0x24, 0x3B, 0x09, 0x75, 0x62, 0x1D,
+    0x7A, 0x69, 0x82, 0x87, 0x39, 0x78, 0x25, 0x63, 0x13, 0x89, 0xEC, 0x94, 0xCA, 0x78, 0xB4, 0x7E,
+    0x3E, 0x56, 0x9F, 0x1D, 0x61, 0x7B, 0x78, 0x09, 0x6F, 0x7D, 0x6E, 0x81, 0xEC, 0x04, 0x22, 0xA5,
+    0x4D, 0x41, 0x8B, 0x94, 0x7C, 0x3A, 0x22, 0x8A, 0x7C, 0xC3, 0x59, 0x47, 0x24, 0xEC, 0x59, 0x50,
+    0x5F, 0xAA, 0x44, 0x64, 0x02, 0x5E, 0x56, 0xC6, 0x42, 0x40, 0xB0, 0x5E, 0xF1, 0x14, 0x37, 0x75,
+    0x25, 0x46, 0x56, 0x68, 0x78, 0x2A, 0xC8, 0x28, 0xB3, 0x36, 0x67, 0x6E, 0x27, 0x01, 0x68, 0xFD,
+    0xCB, 0xF0, 0x90, 0x27, 0x89, 0x07, 0x7F, 0x5F, 0x57, 0x6E, 0x4E, 0x0B, 0xCF, 0xB9, 0x50, 0x52,
+    0xE5, 0x0C, 0x7A, 0x72, 0xAC, 0x3B, 0x24, 0xA5, 0x9C, 0x5D, 0xA9, 0x7E, 0xEC, 0x4F, 0xF8, 0x8B,
+    0x78, 0x11, 0x5A, 0x51, 0x69, 0x57, 0x46, 0x6F, 0x52, 0x50, 0x4C, 0x6F, 0x64, 0xD7, 0xB0, 0xC8,
+    0x3E, 0x7C, 0x52, 0xBE, 0x69, 0x69, 0x2C, 0x2C, 0x4B, 0x7E, 0x42, 0x69, 0x69, 0x60, 0xF7, 0x7D,
+    0x0B, 0x62, 0xEE, 0x67, 0x87, 0x50, 0x83, 0x7C, 0xF2, 0xE9, 0x7C, 0xFC, 0x0D, 0x67, 0x0A, 0x95,
+    0x1B, 0xE4, 0x30, 0x80, 0x46, 0x39, 0xC2, 0x74, 0xA5, 0x4B, 0x0A, 0x03, 0x6B, 0x69, 0x8C, 0x3D,
+    0x27, 0x82, 0x22, 0x01, 0x75, 0xC0, 0xBC, 0x9F, 0x30, 0x86, 0x52, 0x6E, 0x28, 0x50, 0xCE, 0x5F,
+    0x69, 0xAC, 0xA7, 0xD9, 0x75, 0x2C, 0x67, 0xAF, 0x30, 0xED, 0xC6, 0x82, 0x48, 0x7E, 0x7C, 0x81,
+    0x56, 0x27, 0x7A, 0x23, 0x56, 0x5E, 0x8E, 0x69, 0x3F, 0x0A, 0x9B, 0x84, 0x56, 0x6A, 0x57, 0xC1,
+    0x9F, 0x81, 0x5B, 0x69, 0x21, 0x02, 0x7F, 0x7E, 0x78, 0x81, 0x5E, 0x7A, 0x60, 0x63, 0x54, 0xB0,
+    0xBF, 0xCD, 0x3A, 0x09, 0x62, 0x6F, 0xAB, 0x56, 0xA3, 0xA5, 0x5F, 0x3D, 0xE9, 0x4D, 0x00, 0x63,
+    0x69, 0x0F, 0x7F, 0x0F, 0x07, 0x55, 0x51, 0x21, 0xBF, 0xBC, 0x8D, 0x49, 0x65, 0x9A, 0x2C, 0xAC,
+    0x69, 0x3D, 0x7D, 0x5D, 0x5E, 0x67, 0x19, 0x7F, 0x86, 0x12, 0xFC, 0xB3, 0x86, 0x1D, 0xBA, 0x84,
+    0x7B, 0x6C, 0x24, 0x7D, 0x7F, 0xBC, 0x52, 0x53, 0x30, 0xA5, 0x15, 0xBE, 0x70, 0x50, 0x5A, 0xBC,
+    0x76, 0x3F, 0x31, 0x49, 0x22, 0x0D, 0x16, 0xFB, 0x61, 0x62, 0x6A, 0x5F, 0xA5, 0x4F, 0x6B, 0x1D,
+    0x16, 0x69, 0x7F, 0x79, 0xA0, 0x50, 0xFF, 0x92, 0x23, 0x7D, 0xCE, 0x4F, 0x20, 0x31, 0xB0, 0x2E,
+    0x46, 0x22, 0x3D, 0xBA, 0x7D, 0x34, 0x88, 0x63, 0x25, 0x86, 0x05, 0x1C, 0x32, 0x54, 0xBC, 0x9A,
+    0x50, 0x0A, 0xE3, 0x85, 0xF9, 0x27, 0xAC, 0x59, 0x5F, 0x1F, 0x7C, 0xD5, 0x7A, 0xF5, 0xA1, 0xCA,
+    0x9A, 0x25, 0xF5, 0x63, 0x1B, 0x63, 0xC8, 0x90, 0x57, 0x4B, 0xA5, 0x6B, 0x6F, 0x96, 0x24, 0x47,
+    0x0C, 0xB1, 0x6A, 0x89, 0x3B, 0x7D, 0xEB, 0x5F, 0x05, 0x24, 0x46, 0x7E, 0xD4, 0x90, 0xE6, 0xA4,
+    0x84, 0x54, 0xEE, 0x7D, 0x7D, 0xCA, 0x52, 0x6C, 0xFD, 0xA5, 0xCB, 0x6C, 0xF7, 0xA1, 0x7D, 0x69,
+    0x34, 0x90, 0x22, 0x45, 0x55, 0x52, 0x4E, 0x9D, 0x7C, 0x87, 0x0C, 0x3A, 0xF4, 0x61, 0x83, 0x75,
+    0x75, 0x49, 0x13, 0xDF, 0x01, 0x5D, 0x11, 0x5B, 0x59, 0x78, 0x55, 0x20, 0x79, 0xEC, 0x52, 0xC3,
+    0xA5, 0xB6, 0x52, 0x5D, 0x74, 0x42, 0xEC, 0x08, 0xAB, 0x01, 0xE3, 0x64, 0x47, 0xBD, 0x59, 0x75,
+    0x56, 0x17, 0x31, 0x76, 0x61, 0x72, 0xF9, 0xAE, 0x7A, 0x69, 0x8D, 0x81, 0x46, 0x7F, 0x21, 0x35,
+    0x56, 0xCC, 0xE2, 0x12, 0x69, 0x46, 0x58, 0x6B, 0x89, 0x5F, 0x76, 0x0E, 0x05, 0x80, 0x7D, 0xA5,
+    0x38, 0x6B, 0x4B, 0x50, 0x02, 0x74, 0x7B, 0x37, 0xEB, 0x4C, 0xE9, 0xF4, 0x45, 0x07, 0x63, 0xE9,
+    0x93, 0xBF, 0x06, 0x39, 0x81, 0x8C, 0x31, 0x4C, 0xF7, 0x56, 0x1B, 0x81, 0x59, 0xB0, 0x09, 0x65,
+    0x01, 0xEB, 0x3E, 0x1B, 0x13, 0x13, 0x2F, 0x7E, 0x37, 0x69, 0x08, 0x55, 0x3E, 0x7D, 0x9F, 0x87,
+    0x84, 0x79, 0x36, 0xC3, 0x97, 0x9F, 0x25, 0x63, 0x86, 0x1B, 0x97, 0x63, 0x24, 0x7F, 0x6C, 0x42,
+    0x55, 0x60, 0xE4, 0x80, 0x61, 0x78, 0x36, 0xC6, 0x6F, 0xAC, 0x2C, 0xF7, 0x81, 0x4F, 0x7B, 0x69,
+    0x6A, 0x34, 0xF8, 0xF7, 0x39, 0x4E, 0xC4, 0x23, 0x3F, 0x88, 0xFC, 0x5F, 0x25, 0x96, 0x68, 0x81,
+    0x62, 0x65, 0x40, 0x66, 0x7E, 0x78, 0x6B, 0x6E, 0x54, 0x79, 0xA5, 0xF5, 0xFF, 0x20, 0x3A, 0x2B,
+    0x00, 0x2B, 0x56, 0xAD, 0x0A, 0x0D, 0xA0, 0x3D, 0x4B, 0xF5, 0x64, 0x67, 0x4F, 0xF4, 0xA5, 0x5A,
+    0x1E, 0x44, 0x2B, 0x2A, 0x1E, 0x31, 0x39, 0x7E, 0x75, 0x48, 0x63, 0x28, 0xB0, 0x4E, 0x0A, 0x50,
+    0xE4, 0x88, 0xBC, 0xD7, 0x12, 0x69, 0x81, 0x24, 0x6D, 0x63, 0x69, 0x7E, 0xFB, 0xA3, 0x58, 0x34,
+    0x4F, 0xA5, 0xB0, 0x7D, 0x18, 0xAB, 0xEB, 0x38, 0xCF, 0xD9, 0xB7, 0x40, 0x80, 0x59, 0x28, 0xE6,
+    0x63, 0x9E, 0xAD, 0x7C, 0x46, 0x49, 0x5F, 0x50, 0x46, 0x07, 0x39, 0x56, 0x1B, 0x7D, 0x81, 0xFE,
+    0x56, 0xAD, 0x7F, 0x14, 0x2C, 0xBF, 0x7E, 0xF7, 0x93, 0x6E, 0xFD, 0xFD, 0x7C, 0xBA, 0xF8, 0x60,
+    0xE8, 0x80, 0xF5, 0x87, 0x2F, 0x9E, 0x16, 0x68, 0xED, 0x82, 0x59, 0x52, 0x1E, 0x65, 0x62, 0x63,
+    0x36, 0x6D, 0x9A, 0x79, 0x5A, 0x11, 0x5D, 0x2C, 0x79, 0x7C, 0xAB, 0xFD, 0x0D, 0x82, 0x52, 0x5C,
+    0xF7, 0x06, 0x81, 0x65, 0x45, 0x22, 0x7E, 0x05, 0x5E, 0x70, 0x0D, 0x78, 0x2F, 0x4F, 0x6C, 0xF9,
+    0x05, 0xF9, 0x5C, 0x57, 0x7B, 0x40, 0x40, 0x7E, 0xB4, 0x68, 0x1E, 0x08, 0xEC, 0x69, 0xAA, 0x38,
+    0x38, 0x3F, 0x65, 0x81, 0x7E, 0x65, 0xF7, 0x06, 0x39, 0x50, 0x40, 0x0E, 0x08, 0x8C, 0xA7, 0xAE,
+    0x72, 0x53, 0x01, 0x59, 0x7E, 0x46, 0x24, 0x97, 0x00, 0x1A, 0x6D, 0xCC, 0xA5, 0x7D, 0x52, 0x63,
+    0x07, 0x84, 0x46, 0x6C, 0x20, 0x47, 0x63, 0x69, 0xFA, 0x4A, 0x2F, 0x7A, 0x3E, 0x4F, 0x2C, 0x75,
+    0x0D, 0xB8, 0x61, 0x83, 0xC0, 0xFC, 0x11, 0x77, 0x4B, 0x26, 0x30, 0x3F, 0x54, 0xED, 0x6C, 0xF5,
+    0x64, 0x63, 0x39, 0xA8, 0x7A, 0xB0, 0xF7, 0xF1, 0xF8, 0x31, 0xFD, 0xF7, 0xA5, 0x3A, 0x24, 0x7B,
+    0x89, 0x57, 0x5A, 0x8F, 0x41, 0x3B, 0x39, 0xC3, 0x6E, 0x13, 0x65, 0x13, 0x20, 0xFE, 0x39, 0x83,
+    0x01, 0x69, 0x64, 0x7E, 0x5B, 0x4F, 0x34, 0x27, 0x6F, 0x17, 0x4F, 0x85, 0x63, 0x16, 0x59, 0x75,
+    0x52, 0x22, 0x7A, 0xF0, 0xF7, 0x3F, 0xAE, 0x6B, 0x35, 0x80, 0xC0, 0x6A, 0x57, 0x3B, 0x86, 0x56,
+    0x44, 0x25, 0x7D, 0x4A, 0x5C, 0x28, 0x18, 0x2C, 0x62, 0x7F, 0x22, 0x58, 0x25, 0x72, 0xA9, 0x53,
+    0x7D, 0x0E, 0x69, 0x87, 0x6F, 0xA5, 0x89, 0x61, 0x63, 0x65, 0x5C, 0x53, 0x1C, 0x7D, 0x21, 0x96,
+    0x33, 0x86, 0x12, 0x79, 0x1D, 0x65, 0x84, 0x48, 0x9F, 0xBE, 0x7F, 0xFF, 0x1B, 0xBF, 0x56, 0x4A,
+    0x88, 0x38, 0x4A, 0x59, 0xBE, 0xAF, 0xFF, 0x5A, 0x56, 0x46, 0x4F, 0x61, 0x85, 0x53, 0x37, 0x8F,
+    0x53, 0xBF, 0x4B, 0x33, 0x8F, 0x87, 0xAB, 0x4F, 0xE6, 0x7D, 0x39, 0x42, 0x4F, 0x78, 0x63, 0x5F,
+    0xB3, 0x7F, 0x72, 0x5D, 0x6A, 0x63, 0x0E, 0x49, 0x50, 0x2F, 0x90, 0xB9, 0x50, 0x44, 0x4F, 0x0E,
+    0x70, 0x50, 0x52, 0x37, 0xBF, 0x22, 0x7E, 0x63, 0x64, 0x54, 0x2A, 0x4C, 0xA9, 0x01, 0x03, 0x69,
+    0x20, 0x36, 0xFC, 0xA7, 0xF8, 0x3D, 0x5B, 0xF4, 0x67, 0x4F, 0xD7, 0x4F, 0x54, 0x5C, 0x78, 0xC4,
+    0x5D, 0xAB, 0xEE, 0x57, 0x22, 0xCE, 0x7C, 0x64, 0x7C, 0x9F, 0x32, 0x7D, 0x63, 0x79, 0x73, 0x62,
+    0x4A, 0x0A, 0x5F, 0x1B, 0x68, 0x6C, 0x13, 0x2C, 0xBE, 0x82, 0x04, 0x74, 0x7D, 0x6E, 0x08, 0x83,
+    0x77, 0x00, 0x6C, 0x4E, 0x86, 0x88, 0x4B, 0x7E, 0x8A, 0x65, 0x61, 0xA5, 0x36, 0x89, 0x63, 0x61,
+    0xCE, 0x42, 0xE0, 0xF5, 0x7A, 0x64, 0x7C, 0x3B, 0x81, 0x7A, 0xC3, 0xA5, 0xA2, 0x7D, 0x80, 0x84,
+    0x38, 0x82, 0xCA, 0x63, 0xB4, 0x1C, 0x3E, 0x40, 0x7E, 0x56, 0x56, 0xF8, 0x01, 0x80, 0x7E, 0x74,
+    0x2D, 0x4B, 0x8A, 0x1D, 0x52, 0x22, 0xBE, 0x2D, 0x53, 0x15, 0x20, 0x5D, 0xEC, 0x7A, 0xA5, 0x3F,
+    0x34, 0xF1, 0x38, 0x4B, 0x35, 0x99, 0x37, 0x67, 0x9A, 0x88, 0x32, 0x68, 0x4A, 0x4D, 0x75, 0x02,
+    0x36, 0xB3, 0x57, 0x04, 0x5B, 0xF9, 0x50, 0xC6, 0xFF, 0x00, 0x24, 0x83, 0x89, 0x79, 0xEC, 0x74,
+    0x58, 0xE1, 0x24, 0x24, 0x7D, 0x3F, 0x4A, 0x22, 0xEB, 0x54, 0x1F, 0x84, 0x4F, 0x7D, 0x64, 0xC9,
+    0x7C, 0x7E, 0xF4, 0x5B, 0x51, 0x20, 0xF5, 0x7E, 0x9A, 0x79, 0x40, 0x5E, 0x7D, 0x38, 0x61, 0x4E,
+    0x7E, 0x0A, 0x0D, 0x50, 0x69, 0x22, 0x63, 0x7B, 0x8C, 0x63, 0xA3, 0x63, 0xEC, 0x19, 0x50, 0x7C,
+    0x94, 0x7A, 0x0F, 0x72, 0x6C, 0x02, 0x42, 0xBC, 0x08, 0x5B, 0xB7, 0x80, 0x61, 0x23, 0x56, 0x80,
+    0x1B, 0x4A, 0x6F, 0x60, 0x7E, 0x81, 0x38, 0x36, 0x87, 0x30, 0x76, 0x9A, 0xB0, 0xFB, 0x76, 0x7E,
+    0x25, 0x4F, 0x6C, 0x65, 0xE7, 0x7D, 0x62, 0x1B, 0xFB, 0x40, 0x67, 0x37, 0x6B, 0x3E, 0x5E, 0xB0,
+    0x52, 0x52, 0x50, 0xC8, 0x65, 0x00, 0x7D, 0x75, 0xAB, 0x63, 0x62, 0xB8, 0x79, 0x71, 0x4F, 0xAA,
+    0xC6, 0x54, 0xF5, 0x24, 0x46, 0x81, 0x61, 0xF2, 0x81, 0x56, 0x1E, 0x0C, 0x6D, 0x44, 0x22, 0xFE,
+    0x82, 0x8B, 0x62, 0x24, 0x3E, 0x39, 0x6F, 0x56, 0xC1, 0x5E, 0xD3, 0x72, 0x14, 0x3C, 0x0A, 0x7E,
+    0xAC, 0x43, 0xF9, 0xC6, 0x29, 0x7A, 0x24, 0x52, 0x34, 0x49, 0x49, 0x37, 0x84, 0x19, 0x6A, 0x69,
+    0x7E, 0x56, 0x61, 0x35, 0x67, 0x43, 0x6A, 0x6F, 0x81, 0xB4, 0x0F, 0x56, 0x9D, 0x84, 0x0D, 0xAF,
+    0x0E, 0x7E, 0x4B, 0x3B, 0x4B, 0x27, 0x60, 0x87, 0xD3, 0x7C, 0x5C, 0xF6, 0x5F, 0x20, 0x04, 0x5B,
+    0x5B, 0xED, 0x63, 0x5F, 0x76, 0xEB, 0x50, 0x7D, 0x7D, 0x61, 0x24, 0x3A, 0xB9, 0xBF, 0x75, 0xFE,
+    0xBB, 0x69, 0x7E, 0x21, 0x7B, 0x69, 0x44, 0x5B, 0x77, 0x92, 0x00, 0x20, 0x85, 0x9F, 0x6B, 0x71,
+    0x81, 0x23, 0x56, 0x17, 0x82, 0x19, 0xDB, 0x7D, 0x7D, 0x07, 0x5F, 0x7D, 0x62, 0x0E, 0x4A, 0xFC,
+    0xF9, 0x10, 0x7F, 0x11, 0xF5, 0xAE, 0x80, 0x60, 0x07, 0x95, 0x7F, 0xF9, 0x49, 0x6A, 0x24, 0x52,
+    0x61, 0x4B, 0x72, 0x86, 0x50, 0x75, 0x7D, 0xAF, 0x03, 0x53, 0x84, 0x20, 0x81, 0x22, 0x5B, 0x90,
+    0x6F, 0x2C, 0x6C, 0x62, 0x64, 0x2E, 0x7D, 0x42, 0x67, 0x14, 0x6A, 0x6D, 0xB4, 0x84, 0xA5, 0xD2,
+    0xF5, 0x2D, 0x5F, 0x89, 0x36, 0x49, 0x7B, 0x99, 0xCE, 0x2C, 0x4E, 0x3E, 0x21, 0xCE, 0x69, 0x35,
+    0xC3, 0xF1, 0xEB, 0xD6, 0x7C, 0x59, 0x51, 0x7C, 0x63, 0x42, 0x37, 0x71, 0xFD, 0x89, 0x73, 0xFE,
+    0x84, 0x63, 0x14, 0x61, 0x69, 0x55, 0x40, 0x76, 0x7A, 0x47, 0x89, 0x57, 0x26, 0x36, 0x32, 0x37,
+    0x7E, 0x5D, 0x9F, 0x0D, 0x7F, 0x07, 0x80, 0xC8, 0x22, 0x7D, 0xD1, 0x16, 0x36, 0x82, 0x78, 0x1A,
+    0xBA, 0x85, 0x6A, 0x37, 0x56, 0xB5, 0x56, 0x09, 0x67, 0xE7, 0x7E, 0x19, 0x46, 0x49, 0x63, 0x4F,
+    0x7D, 0x42, 0x6F, 0x4B, 0x78, 0x7E, 0x54, 0x7C, 0x7E, 0xFF, 0x4B, 0x0A, 0x7F, 0x62, 0x53, 0x3A,
+    0x5C, 0x62, 0xB2, 0x6A, 0xF0, 0x85, 0x07, 0x60, 0x06, 0x29, 0x54, 0x52, 0xF8, 0x94, 0xC6, 0x4A,
+    0x2C, 0x8C, 0x62, 0xB7, 0x7F, 0x4E, 0x68, 0xE0, 0x0A, 0x17, 0xA0, 0x0D, 0x59, 0x97, 0x47, 0xF5,
+    0x4B, 0x55, 0x09, 0x0D, 0x7D, 0x89, 0xF2, 0x81, 0x55, 0x1F, 0x90, 0x62, 0x7D, 0x22, 0x28, 0x24,
+    0x27, 0x9D, 0x7D, 0x2C, 0xF5, 0x82, 0x58, 0xA8, 0x41, 0xA1, 0xC7, 0x3B, 0x80, 0x59, 0x5F, 0x42,
+    0x81, 0x6A, 0x90, 0x71, 0x4F, 0x6C, 0x7D, 0x41, 0x0E, 0x31, 0x1E, 0x7F, 0x65, 0x90, 0x58, 0xC4,
+    0x7F, 0x69, 0x50, 0x67, 0x66, 0xA3, 0x6F, 0x07, 0x60, 0x1B, 0x52, 0x83, 0x63, 0x5A, 0xF5, 0x78,
+    0x73, 0x7F, 0x85, 0x5C, 0x09, 0xFE, 0x4A, 0x4A, 0x5A, 0x5E, 0xF7, 0xC6, 0xA5, 0x30, 0x0D, 0x21,
+    0x5F, 0x53, 0x66, 0x6E, 0x20, 0xA5, 0x50, 0x20, 0x22, 0xFC, 0x25, 0x46, 0x31, 0x00, 0x2F, 0x1E,
+    0x46, 0x2F, 0x1E, 0xB3, 0xCB, 0x22, 0xC3, 0x90, 0xD3, 0x84, 0x54, 0x81, 0x60, 0x8E, 0x7D, 0x6B,
+    0x46, 0x7F, 0x4A, 0x0E, 0x40, 0xFF, 0x55, 0x33, 0xFF, 0x7C, 0x48, 0x6B, 0x41, 0x61, 0x0A, 0x3B,
+    0x0D, 0xC6, 0x65, 0xF7, 0x50, 0x6B, 0x6C, 0x77, 0x12, 0x82, 0x65, 0xB0, 0x55, 0x09, 0x20, 0x52,
+    0x6E, 0x30, 0xF5, 0x37, 0x60, 0x3D, 0xCD, 0x20, 0xFE, 0x4B, 0x52, 0x0D, 0x36, 0x7D, 0x63, 0x79,
+    0x62, 0x2D, 0x64, 0xF4, 0x9D, 0x5A, 0x5A, 0x5E, 0xB8, 0x75, 0x42, 0x0A, 0x33, 0x8B, 0x46, 0x48,
+    0xEB, 0x66, 0x50, 0x6B, 0x63, 0x05, 0xB2, 0x90, 0x7B, 0xE0, 0x26, 0x56, 0x28, 0x2F, 0x56, 0x54,
+    0x08, 0xD3, 0x6C, 0xB2, 0xA7, 0x5C, 0x21, 0x74, 0x7F, 0x3B, 0x67, 0xBF, 0x67, 0x03, 0x7F, 0x7E,
+    0xA9, 0x20, 0x63, 0x8A, 0x7B, 0x4E, 0x13, 0x31, 0x8F, 0xBC, 0xAE, 0x99, 0x89, 0x50, 0x89, 0xBD,
+    0x69, 0x73, 0x84, 0x1F, 0x29, 0xFB, 0x7D, 0x52, 0x3E, 0x4B, 0x20, 0x5F, 0x68, 0xF9, 0x05, 0x90,
+    0x7A, 0x5C, 0xF4, 0x80, 0xD3, 0xFE, 0x4B, 0xA5, 0x5B, 0x93, 0x15, 0x7F, 0x13, 0x76, 0x84, 0xDD,
+    0x31, 0xF7, 0x44, 0xDE, 0x24, 0x69, 0x56, 0x5C, 0x53, 0x41, 0x79, 0x80, 0x82, 0x3B, 0x65, 0xEC,
+    0x01, 0x24, 0x12, 0xFB, 0x04, 0x63, 0x8B, 0xF5, 0x8C, 0x81, 0xDC, 0xED, 0x7C, 0x22, 0x6E, 0xC7,
+    0x12, 0x3F, 0xC4, 0x76, 0x79, 0xBF, 0x61, 0x4B, 0xF0, 0xF4, 0x9A, 0x9B, 0x9C, 0x8D, 0x8F, 0x7F,
+    0x87, 0xD7, 0x1D, 0x68, 0x20, 0x0C, 0x7E, 0x27, 0x33, 0x86, 0x17, 0xB0, 0xA5, 0x78, 0x61, 0x86,
+    0x07, 0x0D, 0x61, 0x6C, 0xEF, 0x7A, 0x2D, 0x3D, 0x3B, 0x16, 0x63, 0xB4, 0x7F, 0x68, 0x81, 0xA5,
+    0xF7, 0xAC, 0x0D, 0x6F, 0xEC, 0x5A, 0xC4, 0x2D, 0xC3, 0x81, 0x5F, 0x4B, 0x53, 0x52, 0x4B, 0x4F,
+    0xF5, 0x5E, 0x21, 0x51, 0x3F, 0xBF, 0x2B, 0x81, 0x7D, 0x2F, 0x50, 0x7D, 0x6E, 0x75, 0x4B, 0xAE,
+    0x5F, 0x27, 0xE8, 0x24, 0x4B, 0xFB, 0x7F, 0x7D, 0xFB, 0x0D, 0x02, 0xA5, 0x02, 0x59, 0x63, 0x63,
+    0xAD, 0x82, 0x4F, 0x3F, 0xF9, 0x7E, 0x53, 0x54, 0x6F, 0x75, 0x49, 0xEF, 0x60, 0x24, 0x44, 0x7D,
+    0x55, 0xCF, 0xF5, 0xCB, 0x79, 0xF5, 0x13, 0x89, 0x79, 0x7E, 0x2E, 0x19, 0x53, 0xAB, 0x7D, 0x71,
+    0x5E, 0x52, 0x74, 0x13, 0xAB, 0x59, 0x72, 0xFA, 0x83, 0x5A, 0x2A, 0x0E, 0x0E, 0x6C, 0xFC, 0x6F,
+    0x51, 0x24, 0x50, 0x7D, 0x29, 0x0A, 0xA7, 0x81, 0x44, 0x79, 0x2F, 0xA4, 0x8B, 0x58, 0x3B, 0x61,
+    0x62, 0xCA, 0x49, 0x3D, 0x4B, 0x8B, 0x56, 0x3C, 0x40, 0x37, 0x5A, 0x53, 0x88, 0x50, 0x0C, 0x26,
+    0x78, 0x9E, 0x28, 0x41, 0xF5, 0x02, 0x07, 0x4B, 0x24, 0xB6, 0x22, 0x5A, 0x71, 0x52, 0x87, 0x2F,
+    0x50, 0x4B, 0x97, 0x79, 0x01, 0x0E, 0x80, 0x80, 0x28, 0x9A, 0x74, 0x0F, 0x5D, 0xAA, 0x8E, 0x0D,
+    0x6F, 0xC7, 0x48, 0x93, 0x5E, 0x2D, 0x6C, 0x83, 0xC0, 0x7E, 0x71, 0x67, 0x2B, 0xF2, 0x49, 0xFB,
+    0x81, 0x0A, 0xA6, 0x68, 0x35, 0x60, 0x09, 0x37, 0x63, 0x81, 0xC4, 0xC6, 0xAE, 0x7D, 0x69, 0x1B,
+    0x84, 0xE8, 0x46, 0xF9, 0x46, 0x62, 0x51, 0xFB, 0xCD, 0x1C, 0x22, 0x12, 0x7E, 0x82, 0x90, 0x33,
+    0x67, 0x2F, 0xA5, 0x4E, 0x75, 0x3E, 0xC2, 0x25, 0x4F, 0x63, 0x8C, 0x20, 0xC8, 0x5F, 0x89, 0xCE,
+    0x00, 0x7D, 0xA1, 0x69, 0xA1, 0x6F, 0x19, 0x08, 0xF7, 0xE5, 0xFE, 0x7F, 0x23, 0x5E, 0x90, 0x22,
+    0x72, 0x4B, 0x22, 0xE8, 0x77, 0x64, 0x7F, 0xB8, 0x7D, 0x0C, 0x4F, 0xD3, 0x69, 0x28, 0x5D, 0x4E,
+    0x81, 0xFF, 0xFF, 0x20, 0x0D, 0x8E, 0x7A, 0x52, 0x20, 0x9B, 0x88, 0x22, 0x59, 0x82, 0x6B, 0x7A,
+    0x1E, 0xEC, 0x65, 0x4F, 0xEC, 0x20, 0x82, 0x14, 0x64, 0x69, 0x4E, 0x69, 0x6A, 0x24, 0xF8, 0x24,
+    0x68, 0xF5, 0x77, 0xAA, 0x8C, 0x24, 0x36, 0x0F, 0x76, 0x75, 0x37, 0xA7, 0x51, 0x84, 0x6C, 0x50,
+    0x81, 0x63, 0x3E, 0xBC, 0x3E, 0x3C, 0x34, 0x4B, 0x53, 0xA5, 0x51, 0x7B, 0x89, 0x2C, 0x88, 0x4A,
+    0x64, 0xEC, 0x46, 0x79, 0x3E, 0x39, 0x40, 0x84, 0x50, 0x4A, 0x6E, 0x71, 0xC7, 0x29, 0x67, 0x7A,
+    0xB3, 0xD6, 0x89, 0x69, 0x50, 0x38, 0x55, 0x6B, 0x79, 0x81, 0x5B, 0xD3, 0x30, 0x7D, 0x85, 0xFF,
+    0xE3, 0x4F, 0x5D, 0x4E, 0x42, 0xFF, 0x63, 0x7D, 0x5B, 0x50, 0x1B, 0x0F, 0x56, 0x26, 0x6A, 0x06,
+    0xA0, 0x76, 0xF5, 0xA0, 0x78, 0xB8, 0x73, 0x2D, 0x8E, 0x01, 0x55, 0x63, 0x59, 0xBF, 0x07, 0x4B,
+    0x52, 0x3B, 0x24, 0x88, 0x24, 0x14, 0x45, 0xBF, 0x21, 0xA9, 0x25, 0x59, 0x6C, 0x7D, 0x2C, 0x6C,
+    0x6C, 0x6E, 0x4B, 0x20, 0x20, 0x93, 0x34, 0xED, 0x24, 0x7A, 0x5D, 0x44, 0x2F, 0x5B, 0x7E, 0xBA,
+    0x28, 0xB5, 0x87, 0x60, 0x63, 0xBC, 0x83, 0x10, 0x32, 0xBF, 0xEC, 0x4B, 0x37, 0x4B, 0x5F, 0x3E,
+    0x62, 0x08, 0x7D, 0x56, 0x4B, 0x55, 0x8D, 0x99, 0x3C, 0x63, 0x42, 0x28, 0x79, 0x6E, 0xF2, 0xB4,
+    0x46, 0x78, 0x0B, 0x54, 0x78, 0x5D, 0x10, 0x3D, 0x1F, 0x3F, 0x78, 0xA5, 0x49, 0x5C, 0x52, 0x3F,
+    0x52, 0x57, 0x69, 0xD9, 0x4B, 0x83, 0x0B, 0x6E, 0x3D, 0x1D, 0x81, 0xF4, 0x20, 0x67, 0x8D, 0x68,
+    0xA8, 0x5F, 0xF7, 0xF2, 0xEB, 0x3D, 0xB0, 0x02, 0x3F, 0xF5, 0x0D, 0x3E, 0xE9, 0x1B, 0x9A, 0x76,
+    0x90, 0x82, 0x28, 0x39, 0x5F, 0x00, 0x7C, 0x59, 0x55, 0x7D, 0xF8, 0x56, 0x5F, 0xB7, 0x7D, 0x0C,
+    0x7D, 0x7E, 0x67, 0x50, 0xEB, 0xDA, 0x7F, 0x6A, 0x55, 0x8C, 0xF2, 0x81, 0x5B, 0x34, 0xD4, 0x3F,
+    0xAB, 0x32, 0x5A, 0xDA, 0x4B, 0x63, 0x60, 0x7F, 0x36, 0xB4, 0x1D, 0x86, 0xB9, 0xA3, 0x56, 0x7E,
+    0x18, 0xC8, 0xA7, 0x37, 0x60, 0x6D, 0x9A, 0x14, 0x60, 0x91, 0x3B, 0x3E, 0x86, 0xF6, 0x5B, 0x00,
+    0x36, 0x50, 0x9F, 0x45, 0xF7, 0xDD, 0x42, 0x7E, 0x56, 0x28, 0x7A, 0x7F, 0x87, 0xF4, 0x2F, 0x12,
+    0xA8, 0x61, 0x53, 0x75, 0xEB, 0x2D, 0x6C, 0x0A, 0x55, 0x68, 0xAD, 0x19, 0xFC, 0x89, 0x56, 0x4B,
+    0xBF, 0xFF, 0xAE, 0x16, 0x18, 0x04, 0x35, 0x81, 0x8F, 0x7E, 0xD9, 0xBE, 0x75, 0x81, 0xFC, 0x49,
+    0x91, 0x3D, 0x7D, 0x4C, 0xEC, 0x75, 0x23, 0xA9, 0x1C, 0xC8, 0xB0, 0x6A, 0x18, 0x06, 0x38, 0x2E,
+    0xA1, 0x87, 0xBA, 0x24, 0x7D, 0x53, 0x06, 0x31, 0x6E, 0xDD, 0xCB, 0x44, 0x88, 0x73, 0x87, 0x7B,
+    0xAC, 0x78, 0xAD, 0xE0, 0x63, 0x0C, 0x24, 0xAD, 0x56, 0xFF, 0x22, 0x53, 0x3F, 0x05, 0xAD, 0x6E,
+    0x5A, 0xC3, 0xBE, 0x19, 0x83, 0x13, 0x7F, 0x35, 0x5F, 0x5B, 0x42, 0x87, 0x5D, 0xCE, 0xB0, 0x00,
+    0x52, 0x7B, 0x14, 0xFA, 0x72, 0x22, 0x5F, 0x1F, 0xDD, 0xC0, 0x38, 0x90, 0x47, 0x2A, 0x0F, 0x07,
+    0x14, 0x5F, 0xEC, 0x22, 0x36, 0x51, 0x54, 0x04, 0x23, 0x5B, 0x43, 0x90, 0xF5, 0xE4, 0x46, 0x7E,
+    0xDD, 0x63, 0x58, 0x24, 0xA5, 0x49, 0xD3, 0xEB, 0x2B, 0xB0, 0x41, 0x36, 0x39, 0x7B, 0x07, 0x1B,
+    0x07, 0x3A, 0x1F, 0x79, 0x81, 0x67, 0x46, 0x3C, 0x7E, 0x8E, 0x7A, 0xA5, 0xF7, 0x3F, 0x4B, 0x82,
+    0x25, 0x1F, 0x7D, 0x71, 0x5B, 0x7C, 0x12, 0x40, 0x7D, 0x22, 0x1F, 0x60, 0x7B, 0x54, 0x0B, 0xF7,
+    0x8A, 0xBE, 0x55, 0x61, 0x80, 0x07, 0xFF, 0x99, 0x78, 0xAA, 0x49, 0x3E, 0x3A, 0x08, 0x56, 0x76,
+    0x5F, 0x40, 0x50, 0x34, 0x51, 0x1D, 0xFC, 0x28, 0xA8, 0x5D, 0x01, 0x68, 0x33, 0x03, 0x3F, 0xD6,
+    0x50, 0x54, 0xCA, 0x57, 0x5B, 0x50, 0xFC, 0x89, 0x3F, 0x46, 0xE8, 0x22, 0xF7, 0x4E, 0x9D, 0x73,
+    0x20, 0x62, 0x83, 0x6C, 0xF2, 0xC1, 0x22, 0x82, 0x79, 0xF1, 0x68, 0xC0, 0x40, 0xA3, 0x62, 0xFC,
+    0x54, 0xBA, 0x19, 0xAB, 0x76, 0x4E, 0x4B, 0x1E, 0xFF, 0xA0, 0xE9, 0x0C, 0xB6, 0xC6, 0x15, 0x69,
+    0x46, 0x94, 0x7E, 0xF9, 0x89, 0x1E, 0xA8, 0x23, 0x78, 0x05, 0x5C, 0x7D, 0x8A, 0x5C, 0x40, 0x14,
+    0x7C, 0x13, 0x02, 0x65, 0x7E, 0xBF, 0x3C, 0x62, 0x1D, 0x87, 0x23, 0xCE, 0x89, 0x7D, 0x62, 0xA5,
+    0x5E, 0x11, 0x87, 0x2C, 0x04, 0x68, 0x5F, 0x4F, 0xC8, 0x83, 0x56, 0x54, 0x2D, 0x63, 0xE9, 0x72,
+    0x67, 0x63, 0x5C, 0xA1, 0x00, 0x76, 0xB8, 0x89, 0x34, 0xEA, 0xA5, 0x4E, 0xAD, 0xBC, 0x27, 0x54,
+    0x5F, 0xC8, 0x04, 0x51, 0x4A, 0x9E, 0x4E, 0xC4, 0x53, 0xD0, 0xBA, 0x81, 0x58, 0x4F, 0x1C, 0x75,
+    0xE6, 0x8B, 0xDF, 0xA5, 0xAD, 0x32, 0x04, 0x4B, 0xD4, 0xB7, 0x68, 0x7C, 0xAE, 0x33, 0x5F, 0x56,
+    0xF8, 0x67, 0x8A, 0x7E, 0xC1, 0x12, 0x2E, 0xFA, 0x20, 0x90, 0x60, 0x83, 0x4B, 0x27, 0x82, 0x5B,
+    0x5E, 0xE3, 0x7C, 0x34, 0x1D, 0x24, 0x76, 0x56, 0x6F, 0x13, 0x62, 0x87, 0xF5, 0x5F, 0x50, 0xA5,
+    0x6A, 0x3D, 0x62, 0x72, 0xDA, 0xE3, 0xAD, 0x99, 0x62, 0x88, 0x5A, 0x56, 0x6F, 0x90, 0x61, 0x64,
+    0x1F, 0x47, 0x22, 0x09, 0x57, 0xE8, 0x44, 0x83, 0xED, 0xEF, 0x32, 0xA5, 0x61, 0xF7, 0xB3, 0x4B,
+    0x51, 0x0A, 0x0E, 0xF8, 0x27, 0x20, 0x4F, 0x80, 0x69, 0x65, 0x85, 0x61, 0xBC, 0x89, 0xF8, 0x7C,
+    0x87, 0xFE, 0x4B, 0x02, 0xFA, 0x47, 0xE9, 0x27, 0xB3, 0x54, 0x42, 0xC3, 0x9D, 0x69, 0x7A, 0x63,
+    0x40, 0x69, 0x1A, 0x56, 0x55, 0x89, 0xCA, 0x7B, 0x8E, 0x61, 0x2B, 0x20, 0x3A, 0xFC, 0x23, 0x3F,
+    0x4B, 0x65, 0x40, 0x61, 0x2C, 0x27, 0x87, 0x83, 0xAC, 0xBA, 0x2C, 0xB6, 0x3E, 0xA7, 0xD4, 0x54,
+    0x6A, 0x5A, 0x7F, 0x7E, 0x84, 0x24, 0x28, 0xA7, 0x5C, 0x50, 0x04, 0xA5, 0x60, 0x81, 0x0E, 0x54,
+    0x74, 0x7E, 0xF5, 0x52, 0x09, 0x2F, 0x31, 0x5D, 0x49, 0x6C, 0x4B, 0x67, 0x66, 0xC4, 0x05, 0x82,
+    0x01, 0x56, 0x46, 0x69, 0x5E, 0x81, 0x01, 0x22, 0xA5, 0xA9, 0x26, 0x90, 0x52, 0x23, 0x51, 0xF7,
+    0x2E, 0x0D, 0xAD, 0x65, 0x7F, 0x1C, 0x95, 0x20, 0x00, 0xEC, 0x60, 0x4B, 0x6E, 0xBF, 0xAC, 0xEC,
+    0x7A, 0xB0, 0x0B, 0x2B, 0x52, 0x3E, 0x2C, 0xFF, 0xC3, 0x9F, 0xD6, 0x39, 0xFF, 0x81, 0x56, 0x8C,
+    0x63, 0x6C, 0xFB, 0xA9, 0x7F, 0x5A, 0x1F, 0xF8, 0x0A, 0x0A, 0xC2, 0x75, 0x5C, 0x4B, 0xDA, 0x90,
+    0x78, 0x9B, 0xF7, 0x98, 0x5C, 0x22, 0x0F, 0x41, 0xDB, 0x41, 0x63, 0x7D, 0x53, 0x89, 0x6C, 0x28,
+    0x88, 0x44, 0x73, 0x40, 0x8D, 0x82, 0x3C, 0xFB, 0x1D, 0x93, 0x2F, 0xFC, 0x59, 0x65, 0x86, 0xFE,
+    0x32, 0xBC, 0xB7, 0xD9, 0x31, 0xB0, 0xF1, 0x7E, 0xB4, 0x33, 0x68, 0x71, 0x1B, 0x4B, 0x7E, 0x71,
+    0x63, 0x07, 0x95, 0x82, 0x50, 0xD3, 0x82, 0x6C, 0x9A, 0x7F, 0x5F, 0x1F, 0x9A, 0x5E, 0x84, 0xAD,
+    0x26, 0x30, 0x52, 0x3A, 0x3F, 0xB0, 0x83, 0x24, 0x34, 0x86, 0x1F, 0x14, 0xC2, 0xAD, 0xA5, 0x87,
+    0x7E, 0x2F, 0x87, 0x80, 0x87, 0x52, 0x22, 0x6C, 0x45, 0x29, 0x68, 0x3A, 0xA9, 0x68, 0x5B, 0x25,
+    0x51, 0x3B, 0xBE, 0x7E, 0x60, 0xFC, 0x5F, 0x4F, 0x42, 0x4B, 0x65, 0xFF, 0x4F, 0x8B, 0x45, 0xAB,
+    0x46, 0x53, 0x4F, 0x82, 0xA5, 0x24, 0x54, 0x7E, 0xEE, 0xC5, 0xA1, 0x73, 0xE7, 0x92, 0x33, 0x4F,
+    0x3C, 0xC0, 0x1F, 0x07, 0x2C, 0x53, 0xA5, 0xFD, 0x3B, 0x51, 0x65, 0x7B, 0xA5, 0x9B, 0x29, 0x8A,
+    0x3D, 0x5F, 0x0C, 0x59, 0xB8, 0x5E, 0x09, 0xBE, 0x22, 0x44, 0x94, 0x50, 0x73, 0x68, 0xCC, 0xF5,
+    0x69, 0x7B, 0x03, 0x84, 0xFF, 0x50, 0x0A, 0x9A, 0x3B, 0x4C, 0xA1, 0x4F, 0x5A, 0xEC, 0xA7, 0xFE,
+    0x28, 0x4B, 0x5C, 0x7F, 0x1C, 0x7D, 0x05, 0x2F, 0x36, 0x1E, 0x8B, 0x7A, 0x5D, 0x5A, 0x81, 0x14,
+    0x33, 0x62, 0x0B, 0x63, 0x9F, 0x29, 0x83, 0x56, 0x1D, 0x69, 0x86, 0x59, 0xA5, 0x9F, 0xAB, 0x57,
+    0x5D, 0xAA, 0x4B, 0x2E, 0x6C, 0x75, 0xB4, 0xF8, 0xA5, 0x52, 0x7F, 0x56, 0x37, 0x6F, 0x63, 0x67,
+    0x2E, 0x52, 0xEC, 0x7B, 0x36, 0x24, 0x69, 0x50, 0x2D, 0xBA, 0x58, 0x04, 0x71, 0x54, 0x69, 0x5C,
+    0x80, 0xDA, 0x52, 0x9A, 0x5A, 0x7D, 0x06, 0x04, 0x7E, 0x8A, 0x22, 0x81, 0x1D, 0x74, 0x53, 0x22,
+    0x71, 0x7B, 0x82, 0xD3, 0xEE, 0x79, 0x52, 0x5D, 0x59, 0x5C, 0xF4, 0x03, 0x60, 0xC0, 0xB0, 0x9B,
+    0x81, 0x35, 0xDB, 0x4C, 0x01, 0xAC, 0x36, 0x07, 0x7F, 0x59, 0x80, 0x38, 0x36, 0x55, 0x51, 0x21,
+    0x2F, 0xE6, 0x00, 0x0C, 0x3B, 0x22, 0x40, 0x6F, 0x74, 0x39, 0x2F, 0x6D, 0x0D, 0x58, 0x52, 0x20,
+    0x7C, 0x33, 0x0F, 0x64, 0x13, 0x24, 0x32, 0x24, 0x6C, 0x07, 0x39, 0x65, 0x42, 0x0E, 0x63, 0x0D,
+    0x56, 0x3C, 0x4B, 0x98, 0x00, 0xA5, 0xBC, 0x65, 0x05, 0x53, 0x44, 0xA5, 0x41, 0xBC, 0x6F, 0xF8,
+    0x50, 0x25, 0x7F, 0x7A, 0x56, 0xC8, 0x1E, 0x59, 0x4F, 0x55, 0xF7, 0x34, 0x2C, 0x98, 0xBD, 0x52,
+    0xE3, 0xEC, 0x69, 0x63, 0x84, 0xB1, 0xA9, 0x7D, 0x7D, 0x63, 0x84, 0x8D, 0xA9, 0x67, 0x7D, 0x1D,
+    0xF7, 0x81, 0x7B, 0x60, 0x32, 0x64, 0xBA, 0x14, 0xE5, 0x7D, 0x90, 0xA3, 0x06, 0x04, 0x4F, 0x89,
+    0x7F, 0x4B, 0xBA, 0x7E, 0x89, 0x24, 0x50, 0x94, 0x75, 0x7C, 0x60, 0xF5, 0x46, 0x6A, 0x38, 0x8B,
+    0x65, 0xC1, 0xF3, 0xA5, 0x2A, 0x7F, 0x00, 0xBD, 0x1D, 0x39, 0xF4, 0x50, 0x5E, 0xEB, 0x24, 0x73,
+    0x2D, 0x78, 0x3E, 0x49, 0x55, 0x7E, 0xBE, 0xA3, 0x73, 0x38, 0x4B, 0x0D, 0x88, 0x46, 0x5D, 0xC0,
+    0x1D, 0x62, 0x69, 0x4D, 0x72, 0x11, 0x75, 0x39, 0x3F, 0x50, 0x1D, 0x4D, 0x16, 0x49, 0x4F, 0x50,
+    0xCC, 0xF1, 0x9E, 0xA5, 0xB7, 0x24, 0x01, 0x37, 0x78, 0x6C, 0x7A, 0x60, 0x63, 0xAB, 0x5C, 0xC7,
+    0xEC, 0x2B, 0x1F, 0x79, 0x59, 0x51, 0xFC, 0x89, 0x76, 0x01, 0x71, 0xA1, 0x8A, 0x35, 0x47, 0x63,
+    0x81, 0x6F, 0xE2, 0x86, 0x8A, 0x7C, 0x56, 0x46, 0x25, 0xE5, 0x52, 0x0D, 0x46, 0x19, 0x38, 0x11,
+    0x75, 0xEC, 0xF4, 0xFB, 0xAC, 0xF5, 0x63, 0x40, 0x7E, 0x79, 0x4B, 0xBF, 0x60, 0xF7, 0x6B, 0x28,
+    0x7B, 0xD9, 0xF2, 0x80, 0x7A, 0x22, 0x7D, 0x3B, 0x78, 0xA9, 0x2C, 0x4F, 0x53, 0x62, 0xFE, 0x4E,
+    0x82, 0x64, 0x22, 0x81, 0x20, 0x7D, 0x80, 0x6F, 0x63, 0x36, 0x89, 0x56, 0xF4, 0xD7, 0x53, 0x31,
+    0xBE, 0x85, 0x0A, 0x64, 0xD4, 0x2C, 0x4B, 0x7A, 0xAF, 0x10, 0x34, 0x22, 0xA1, 0xB0, 0x64, 0x63,
+    0x5E, 0x5A, 0xF4, 0x3D, 0xFB, 0x7E, 0x12, 0x5E, 0x02, 0xCC, 0x7F, 0x60, 0x2B, 0x42, 0x49, 0x79,
+    0x2E, 0x02, 0x90, 0x5F, 0x54, 0x5F, 0xA7, 0x07, 0xC1, 0x37, 0x89, 0x56, 0xB8, 0x53, 0x6F, 0xF5,
+    0x45, 0x33, 0xAF, 0xC6, 0x7D, 0x25, 0x83, 0x68, 0x33, 0x52, 0xA3, 0xE4, 0x9B, 0x89, 0x5F, 0x8E,
+    0xF5, 0x4B, 0x52, 0x07, 0x56, 0x4D, 0x38, 0x17, 0x0D, 0x0D, 0x56, 0x69, 0x76, 0x62, 0x13, 0x7C,
+    0xF7, 0x47, 0xB8, 0xA8, 0xC0, 0x11, 0x62, 0xAC, 0x3B, 0x25, 0x14, 0x0C, 0x65, 0xFF, 0x14, 0x79,
+    0x46, 0x4E, 0x1E, 0xB4, 0x56, 0x7D, 0x28, 0x85, 0x56, 0x3C, 0x79, 0xD0, 0xF5, 0x2B, 0x56, 0x5C,
+    0x0D, 0x7C, 0x8B, 0x7F, 0xDB, 0x4E, 0x6C, 0x62, 0x7D, 0x87, 0x64, 0x52, 0x50, 0x22, 0x7E, 0x84,
+    0x38, 0xB8, 0xD8, 0x77, 0xC7, 0xD3, 0x7F, 0x65, 0x22, 0xB3, 0x3D, 0x36, 0xC6, 0xA3, 0x95, 0x76,
+    0x81, 0x76, 0x90, 0x88, 0x80, 0x75, 0x90, 0x4D, 0xA5, 0x25, 0x90, 0x13, 0x78, 0x53, 0x05, 0x53,
+    0xF1, 0x52, 0x8D, 0x8D, 0x95, 0x7F, 0xBF, 0x4E, 0x68, 0x79, 0x79, 0x56, 0x69, 0x42, 0x84, 0x7E,
+    0x89, 0xB3, 0xBA, 0x72, 0x40, 0x7C, 0x38, 0x99, 0x3E, 0x50, 0xEC, 0x8F, 0x7D, 0xFF, 0xFF, 0x63,
+    0x5F, 0x05, 0x6C, 0x88, 0x7D, 0x04, 0x28, 0xFC, 0x87, 0x6F, 0x56, 0x63, 0xF5, 0x0A, 0x68, 0xF2,
+    0x0E, 0x56, 0x32, 0xE6, 0xA0, 0x5B, 0x69, 0x8A, 0xF9, 0x05, 0x52, 0xF5, 0xB1, 0x54, 0x37, 0x5F,
+    0x7A, 0x20, 0x04, 0x54, 0x8E, 0x7F, 0xF7, 0xAB, 0x53, 0x81, 0x31, 0x41, 0x05, 0x65, 0xD7, 0x63,
+    0x84, 0xB3, 0x49, 0x66, 0x42, 0x68, 0x5F, 0x79, 0x20, 0x9F, 0x46, 0x5D, 0x1C, 0x7D, 0x3B, 0xAD,
+    0x65, 0x4B, 0x1F, 0x88, 0x05, 0x99, 0x5C, 0x6E, 0x2F, 0x1D, 0x0A, 0x1E, 0x89, 0x22, 0xDD, 0xF1,
+    0x0D, 0x67, 0x13, 0x7B, 0x5F, 0x40, 0x7D, 0x61, 0x1C, 0xC6, 0x2D, 0x56, 0x67, 0xC2, 0x5C, 0x7E,
+    0xE1, 0xF4, 0xB4, 0x40, 0x62, 0x61, 0xB4, 0x6C, 0xA8, 0x1B, 0x69, 0x24, 0x5B, 0x5D, 0x56, 0x7F,
+    0x82, 0x7A, 0x7D, 0x4C, 0x30, 0x81, 0x69, 0x57, 0x42, 0x22, 0xD5, 0x07, 0x99, 0x34, 0x26, 0x2E,
+    0xEA, 0xFA, 0x48, 0x25, 0x19, 0xBA, 0x7E, 0x69, 0x64, 0x82, 0x81, 0x72, 0xAB, 0xE8, 0x03, 0xA5,
+    0x9A, 0x56, 0x4C, 0x1F, 0x34, 0x11, 0x57, 0x83, 0x20, 0xAD, 0x79, 0x64, 0xE3, 0x7A, 0x90, 0x67,
+    0x3E, 0x21, 0xA2, 0x24, 0x80, 0x34, 0x5B, 0xA1, 0x56, 0x5F, 0x77, 0x7F, 0x86, 0xA2, 0xB0, 0x4B,
+    0x0C, 0x82, 0xF9, 0x22, 0x22, 0x2E, 0x1A, 0x61, 0x4E, 0xAF, 0xAE, 0x00, 0x62, 0x8A, 0x6E, 0x84,
+    0x5C, 0x49, 0x4C, 0x65, 0x89, 0x65, 0x49, 0x5D, 0xD3, 0x5C, 0xF7, 0x1B, 0x80, 0x21, 0x13, 0x8B,
+    0x69, 0x43, 0x22, 0x9A, 0x56, 0x63, 0x20, 0xDF, 0x40, 0xF1, 0x52, 0x67, 0x3E, 0x8C, 0x6A, 0xF2,
+    0x61, 0x9C, 0x73, 0x9D, 0x51, 0x7A, 0x5F, 0xA7, 0xB2, 0x04, 0xAF, 0x76, 0x79, 0x68, 0xB6, 0x6B,
+    0x20, 0xA0, 0x91, 0xC1, 0x5A, 0x06, 0x41, 0x97, 0x27, 0xC8, 0x37, 0x7E, 0x56, 0x6F, 0x37, 0x0B,
+    0x5B, 0x4D, 0x75, 0x0E, 0x44, 0xA7, 0x3E, 0x54, 0x50, 0xC6, 0xA8, 0x19, 0x7E, 0xAB, 0xCA, 0x99,
+    0x02, 0x7D, 0xF5, 0x68, 0x65, 0x19, 0x09, 0x9F, 0x5F, 0x96, 0x00, 0x19, 0x02, 0xB9, 0x60, 0x24,
+    0x83, 0x75, 0x88, 0xD3, 0xA5, 0x07, 0x04, 0x0D, 0x7C, 0x64, 0x78, 0xBC, 0x5C, 0x89, 0x79, 0x3D,
+    0x23, 0xB8, 0x6C, 0xF5, 0x3F, 0x79, 0x31, 0x50, 0x8B, 0x0A, 0x2D, 0x81, 0x75, 0x39, 0x50, 0x7F,
+    0xF9, 0x2D, 0x26, 0x00, 0x60, 0x13, 0xF5, 0x50, 0x2C, 0x4F, 0x2F, 0x25, 0x22, 0x7E, 0xC8, 0xD4,
+    0x50, 0x48, 0x80, 0x33, 0x2C, 0x47, 0x7E, 0x90, 0x4B, 0x69, 0x5F, 0x0D, 0x81, 0x2A, 0x38, 0x0E,
+    0x53, 0x5B, 0x84, 0xA3, 0x80, 0x56, 0x8F, 0x35, 0x20, 0xA1, 0x7F, 0x1D, 0xF5, 0x36, 0x7C, 0x76,
+    0x01, 0x35, 0x50, 0x61, 0x54, 0x5F, 0x42, 0x86, 0x1C, 0x1D, 0x09, 0x86, 0x68, 0x36, 0x6D, 0x49,
+    0xE3, 0x81, 0x11, 0xCC, 0x8C, 0x69, 0x7D, 0x86, 0x7D, 0x1D, 0xB3, 0x5A, 0x82, 0xBF, 0x63, 0xD3,
+    0x39, 0xAB, 0x83, 0x2F, 0x3D, 0xAC, 0x65, 0xF4, 0x59, 0x02, 0x4B, 0x41, 0x13, 0xEA, 0x4F, 0xB0,
+    0xA1, 0xDA, 0x6A, 0x11, 0x50, 0xEC, 0x4F, 0x84, 0x0D, 0x61, 0x5E, 0x68, 0x0D, 0x95, 0xFB, 0x05,
+    0x01, 0x79, 0x59, 0x35, 0x89, 0xA9, 0xF5, 0x71, 0x02, 0xBE, 0x81, 0xAD, 0xF5, 0xB2, 0x7E, 0x8A,
+    0x0E, 0x4B, 0x0B, 0x21, 0x74, 0x7D, 0x24, 0xBE, 0x52, 0x63, 0x54, 0x82, 0x63, 0x2C, 0x6B, 0x61,
+    0x69, 0x51, 0x4B, 0x27, 0x7B, 0xBC, 0x63, 0x9F, 0x0B, 0x5F, 0x68, 0x46, 0xA7, 0xE4, 0x4F, 0xAB,
+    0x81, 0x22, 0x3B, 0x1D, 0xE7, 0x81, 0x1F, 0x20, 0x05, 0x1F, 0x0A, 0x42, 0x67, 0x2A, 0x0F, 0x50,
+    0x82, 0x68, 0x08, 0x63, 0x5F, 0x7F, 0xF5, 0x14, 0xD4, 0x53, 0x66, 0x8C, 0xEE, 0x57, 0x50, 0x81,
+    0xDD, 0x88, 0xA5, 0x28, 0x31, 0xAC, 0x80, 0x41, 0x5A, 0x71, 0x0E, 0xF5, 0x59, 0x38, 0x7E, 0x68,
+    0x07, 0x7C, 0x24, 0x35, 0x6C, 0x2D, 0x62, 0x6F, 0x7E, 0xA9, 0xCB, 0x22, 0xED, 0x1B, 0xEC, 0xAA,
+    0x5F, 0x59, 0x5A, 0x9E, 0x4A, 0x67, 0x95, 0x61, 0x11, 0x7D, 0x23, 0x69, 0x56, 0x5F, 0xC6, 0x87,
+    0x60, 0xEE, 0xAC, 0x80, 0xC1, 0x20, 0xE9, 0x5E, 0xAC, 0x49, 0x7F, 0x56, 0xD4, 0xF5, 0x11, 0x44,
+    0x81, 0x4A, 0x6A, 0x40, 0x78, 0x46, 0x84, 0x25, 0x7A, 0x7D, 0x01, 0xEC, 0x89, 0x13, 0x69, 0x3B,
+    0x65, 0x1B, 0xAC, 0xAC, 0x16, 0x7C, 0x5B, 0x55, 0x0B, 0x0C, 0x67, 0xCC, 0x8D, 0x06, 0x22, 0x3F,
+    0x87, 0xA9, 0x77, 0x63, 0xFF, 0x46, 0xB0, 0x9D, 0x3F, 0x63, 0x1D, 0x4F, 0x4A, 0x39, 0x73, 0x15,
+    0x3F, 0xF5, 0xB0, 0x76, 0x6A, 0x3B, 0x81, 0xE6, 0x2F, 0x20, 0x9B, 0xF6, 0x49, 0x0F, 0x1B, 0x63,
+    0x54, 0x78, 0x5D, 0x04, 0x36, 0xF7, 0x50, 0x63, 0x01, 0x09, 0x5B, 0x2D, 0x7D, 0xF4, 0x56, 0x64,
+    0x30, 0x75, 0x2A, 0x03, 0x8C, 0x6D, 0x99, 0x21, 0x04, 0x62, 0x89, 0x24, 0xBF, 0xCD, 0xFF, 0x0D,
+    0x57, 0x35, 0x25, 0x08, 0xC3, 0x63, 0x2E, 0x4F, 0x4C, 0xF7, 0xF9, 0x3E, 0x5B, 0x50, 0x7D, 0xDF,
+    0x78, 0x84, 0x68, 0xFE, 0x07, 0x4B, 0x87, 0x2C, 0x12, 0xF9, 0x76, 0x0A, 0x63, 0x7F, 0x67, 0xBA,
+    0x34, 0x56, 0xF0, 0x52, 0xAF, 0x7E, 0x3C, 0xD4, 0x05, 0x81, 0x01, 0xA1, 0x56, 0x25, 0x72, 0x0C,
+    0x2B, 0x5A, 0x7C, 0xA2, 0x79, 0x6A, 0x8F, 0x69, 0x55, 0x5B, 0x81, 0xC1, 0x5D, 0x45, 0x50, 0x0D,
+    0x0E, 0x5E, 0x63, 0x47, 0xB9, 0xDF, 0x1F, 0x1E, 0x81, 0x5B, 0x65, 0x52, 0x36, 0xF5, 0x17, 0x46,
+    0x6A, 0xB8, 0x38, 0x51, 0x51, 0x50, 0x84, 0x11, 0x4B, 0xF6, 0x71, 0x32, 0x7F, 0x75, 0x75, 0x7C,
+    0xB9, 0x0E, 0xE7, 0x51, 0x09, 0xE8, 0x24, 0x49, 0x30, 0xCE, 0x3B, 0x44, 0x65, 0xA0, 0x87, 0x45,
+    0x81, 0x89, 0xF8, 0x87, 0x6F, 0x53, 0x9E, 0x6A, 0x24, 0x60, 0xB8, 0x04, 0x01, 0x50, 0x7E, 0xC0,
+    0x83, 0x2A, 0xB4, 0xFE, 0x52, 0xC4, 0x56, 0xB9, 0x34, 0x58, 0x06
+};
+
+/**
+ * @brief     pinyin hash
+ * @param[in] x hash input
+ * @return    hash value
+ * @note      none
+ */
+static uint32_t a_ld3320_pinyin_hash(uint32_t x)
+{
+    x *= 0x9E3779B1U;        /* mix */
+    x ^= x >> 15;            /* fold */
+    x *= 0x85EBCA6BU;        /* mix */
+    x ^= x >> 13;            /* fold */
+    
+    return x;                /* return the hash */
+}
+
+/**
+ * @brief      decode one utf-8 character
+ * @param[in]  *s pointer to a utf-8 text
+ * @param[out] *code pointer to a code point buffer
+ * @return     character bytes, 0 if invalid
+ * @note       none
+ */
+static uint8_t a_ld3320_pinyin_utf8(const char *s, uint32_t *code)
+{
+    const uint8_t *p = (const uint8_t *)s;
+    uint8_t n;
+    uint8_t i;
+    uint32_t c;
+    
+    if (p[0] < 0x80)                                 /* ascii */
+    {
+        *code = p[0];                                /* code point */
+        
+        return 1;                                    /* 1 byte */
+    }
+    else if ((p[0] & 0xE0) == 0xC0)                  /* 2 bytes */
+    {
+        n = 2;                                       /* set 2 */
+        c = p[0] & 0x1F;                             /* lead bits */
+    }
+    else if ((p[0] & 0xF0) == 0xE0)                  /* 3 bytes */
+    {
+        n = 3;                                       /* set 3 */
+        c = p[0] & 0x0F;                             /* lead bits */
+    }
+    else if ((p[0] & 0xF8) == 0xF0)                  /* 4 bytes */
+    {
+        n = 4;                                       /* set 4 */
+        c = p[0] & 0x07;                             /* lead bits */
+    }
+    else
+    {
+        return 0;                                    /* invalid lead byte */
+    }
+    for (i = 1; i < n; i++)                          /* continuation bytes */
+    {
+        if ((p[i] & 0xC0) != 0x80)                   /* check the byte, a null stops here too */
+        {
+            return 0;                                /* invalid */
+        }
+        c = (c << 6) | (p[i] & 0x3F);                /* add the bits */
+    }
+    *code = c;                                       /* code point */
+    
+    return n;                                        /* return the bytes */
+}
+
+/**
+ * @brief      look up the pinyin of a hanzi
+ * @param[in]  code unicode code point
+ * @param[out] **pinyin pointer to a pinyin pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pinyin is NULL
+ *             - 4 code has no pinyin
+ * @note       covers the 6763 hanzi of gb2312 with their most common reading, without tones and with v for u umlaut
+ */
+uint8_t ld3320_pinyin_lookup(uint32_t code, const char **pinyin)
+{
+    uint32_t bucket;
+    uint32_t slot;
+    uint16_t key;
+    uint16_t syllable;
+    
+    if (pinyin == NULL)                                                                       /* check pinyin */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((code < LD3320_PINYIN_CODE_MIN) || (code > LD3320_PINYIN_CODE_MAX))                   /* check the range */
+    {
+        return 4;                                                                             /* return error */
+    }
+    
+    bucket = a_ld3320_pinyin_hash(code) % LD3320_PINYIN_BUCKET_NUM;                           /* get the bucket */
+    slot = a_ld3320_pinyin_hash(code + (((uint32_t)gs_pinyin_disp[bucket] + 1) << 16)) % 
+           LD3320_PINYIN_CODE_NUM;                                                            /* get the slot */
+    key = gs_pinyin_key[slot];                                                                /* get the key */
+    if ((key & 0x7FFF) != (code - LD3320_PINYIN_CODE_MIN))                                    /* check the code */
+    {
+        return 4;                                                                             /* not in the table */
+    }
+    syllable = (uint16_t)(((key >> 15) << 8) | gs_pinyin_value[slot]);                        /* get the syllable */
+    *pinyin = &gs_pinyin_pool[gs_pinyin_offset[syllable]];                                    /* get the pinyin */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      convert a utf-8 text to the ld3320 pinyin key word format
+ * @param[in]  *utf8 pointer to a utf-8 text
+ * @param[in]  *override pointer to an override list
+ * @param[in]  override_len override list length
+ * @param[out] *buf pointer to a pinyin buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 utf8 or buf is NULL
+ *             - 4 text is invalid utf-8 or has a character without pinyin
+ *             - 5 buffer is too small
+ * @note       the longest override word that matches wins over the table, so polyphonic characters are set by a word,
+ *             ascii letters are kept in lower case and spaces and '-' only separate the syllables
+ */
+uint8_t ld3320_pinyin_convert(const char *utf8, const ld3320_pinyin_override_t *override, uint16_t override_len,
+                              char *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t pos;
+    size_t n;
+    size_t match;
+    size_t token_len;
+    uint32_t code;
+    const char *token;
+    
+    if ((utf8 == NULL) || (buf == NULL))                                                /* check the buffers */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (len == 0)                                                                       /* check length */
+    {
+        return 5;                                                                       /* return error */
+    }
+    
+    buf[0] = '\0';                                                                      /* empty */
+    pos = 0;                                                                            /* init 0 */
+    while (*utf8 != '\0')                                                               /* every character */
+    {
+        match = 0;                                                                      /* no override */
+        token = NULL;                                                                   /* no token */
+        for (j = 0; (override != NULL) && (j < override_len); j++)                      /* check the overrides */
+        {
+            if ((override[j].utf8 == NULL) || (override[j].pinyin == NULL) || 
+                (override[j].utf8[0] != *utf8))                                         /* skip empty and other words */
+            {
+                continue;                                                               /* next */
+            }
+            n = strlen(override[j].utf8);                                               /* word length */
+            if ((n > match) && (strncmp(utf8, override[j].utf8, n) == 0))               /* longer match */
+            {
+                match = n;                                                              /* save the match */
+                token = override[j].pinyin;                                             /* use the override */
+            }
+        }
+        if (token != NULL)                                                              /* override found */
+        {
+            token_len = strlen(token);                                                  /* token length */
+            utf8 += match;                                                              /* skip the word */
+        }
+        else if ((*utf8 == ' ') || (*utf8 == '\t') || (*utf8 == '-'))                   /* separator */
+        {
+            utf8++;                                                                     /* skip it */
+            
+            continue;                                                                   /* next */
+        }
+        else if (((*utf8 >= 'a') && (*utf8 <= 'z')) || 
+                 ((*utf8 >= 'A') && (*utf8 <= 'Z')))                                    /* ascii letters */
+        {
+            token = utf8;                                                               /* letters as they are */
+            token_len = 0;                                                              /* init 0 */
+            while (((utf8[token_len] >= 'a') && (utf8[token_len] <= 'z')) || 
+                   ((utf8[token_len] >= 'A') && (utf8[token_len] <= 'Z')))              /* the whole run */
+            {
+                token_len++;                                                            /* length++ */
+            }
+            utf8 += token_len;                                                          /* skip the run */
+        }
+        else
+        {
+            n = a_ld3320_pinyin_utf8(utf8, &code);                                      /* decode */
+            if ((n == 0) || (ld3320_pinyin_lookup(code, &token) != 0))                  /* look up the pinyin */
+            {
+                return 4;                                                               /* return error */
+            }
+            token_len = strlen(token);                                                  /* token length */
+            utf8 += n;                                                                  /* next character */
+        }
+        if (token_len == 0)                                                             /* nothing to add */
+        {
+            continue;                                                                   /* next */
+        }
+        if ((size_t)pos + (pos != 0) + token_len + 1 > len)                             /* check the space */
+        {
+            return 5;                                                                   /* return error */
+        }
+        if (pos != 0)                                                                   /* not the first */
+        {
+            buf[pos++] = ' ';                                                           /* separate the syllables */
+        }
+        for (i = 0; i < token_len; i++)                                                 /* copy the token */
+        {
+            buf[pos++] = ((token[i] >= 'A') && (token[i] <= 'Z')) ? 
+                         (char)(token[i] - 'A' + 'a') : token[i];                       /* lower case */
+        }
+        buf[pos] = '\0';                                                                /* end */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
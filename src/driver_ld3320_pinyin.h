@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ld3320_pinyin.h
+ * @brief     driver ld3320 pinyin header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2021-05-12
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2021/05/12  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_LD3320_PINYIN_H
+#define DRIVER_LD3320_PINYIN_H
+
+#include "driver_ld3320.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ld3320_pinyin_driver ld3320 pinyin driver function
+ * @brief    ld3320 pinyin driver modules
+ * @ingroup  ld3320_driver
+ * @{
+ */
+
+/**
+ * @brief ld3320 pinyin override structure definition
+ */
+typedef struct ld3320_pinyin_override_s
+{
+    const char *utf8;          /**< utf-8 word */
+    const char *pinyin;        /**< space separated pinyin of the word */
+} ld3320_pinyin_override_t;
+
+/**
+ * @brief      look up the pinyin of a hanzi
+ * @param[in]  code unicode code point
+ * @param[out] **pinyin pointer to a pinyin pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pinyin is NULL
+ *             - 4 code has no pinyin
+ * @note       covers the 6763 hanzi of gb2312 with their most common reading, without tones and with v for u umlaut
+ */
+uint8_t ld3320_pinyin_lookup(uint32_t code, const char **pinyin);
+
+/**
+ * @brief      convert a utf-8 text to the ld3320 pinyin key word format
+ * @param[in]  *utf8 pointer to a utf-8 text
+ * @param[in]  *override pointer to an override list
+ * @param[in]  override_len override list length
+ * @param[out] *buf pointer to a pinyin buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 utf8 or buf is NULL
+ *             - 4 text is invalid utf-8 or has a character without pinyin
+ *             - 5 buffer is too small
+ * @note       the longest override word that matches wins over the table, so polyphonic characters are set by a word,
+ *             ascii letters are kept in lower case and spaces and '-' only separate the syllables
+ */
+uint8_t ld3320_pinyin_convert(const char *utf8, const ld3320_pinyin_override_t *override, uint16_t override_len,
+                              char *buf, uint16_t len);
+
+/**
+ * @brief     set the key words from utf-8 texts
+ * @param[in] *handle pointer to an ld3320 handle structure
+ * @param[in] **text pointer to a utf-8 text pointer list
+ * @param[in] len key words length
+ * @param[in] *override pointer to a pinyin override list
+ * @param[in] override_len override list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 key words are invalid
+ * @note      every text is converted once by ld3320_pinyin_convert into a LD3320_KEY_WORD_MAX * LD3320_KEY_WORD_LEN bytes stack buffer,
+ *            the pinyin must be shorter than LD3320_KEY_WORD_LEN and all of them must fit the key word pool
+ */
+uint8_t ld3320_set_key_words_utf8(ld3320_handle_t *handle, const char *const *text, uint8_t len, 
+                                  const ld3320_pinyin_override_t *override, uint16_t override_len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -60,15 +60,17 @@ uint8_t ld3320_asr_test_irq_handler(void)
 
 /**
  * @brief     asr callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] i asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_callback(uint8_t type, uint8_t i, char *text)
+static void a_callback(void *context, uint8_t type, uint8_t i, char *text)
 {
     uint8_t res;
     
+    (void)context;
     if (type == LD3320_STATUS_ASR_FOUND_OK)
     {
         ld3320_interface_debug_print("ld3320: detect index %d %s.\n", i, text);
@@ -113,16 +115,26 @@ uint8_t ld3320_asr_test(void)
     DRIVER_LD3320_LINK_SPI_DEINIT(&gs_handle, ld3320_interface_spi_deinit);
     DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(&gs_handle, ld3320_interface_spi_read_address16);
     DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(&gs_handle, ld3320_interface_spi_write_cmd);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH(&gs_handle, ld3320_interface_spi_write_batch);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(&gs_handle, ld3320_interface_spi_write_batch_start);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(&gs_handle, ld3320_interface_spi_write_batch_wait);
+    DRIVER_LD3320_LINK_SPI_SET_CLOCK(&gs_handle, ld3320_interface_spi_set_clock);
     DRIVER_LD3320_LINK_RESET_GPIO_INIT(&gs_handle, ld3320_interface_reset_gpio_init);
     DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(&gs_handle, ld3320_interface_reset_gpio_deinit);
     DRIVER_LD3320_LINK_RESET_GPIO_WRITE(&gs_handle, ld3320_interface_reset_gpio_write);
     DRIVER_LD3320_LINK_DELAY_MS(&gs_handle, ld3320_interface_delay_ms);
     DRIVER_LD3320_LINK_DELAY_US(&gs_handle, ld3320_interface_delay_us);
     DRIVER_LD3320_LINK_DEBUG_PRINT(&gs_handle, ld3320_interface_debug_print);
+    DRIVER_LD3320_LINK_TIMESTAMP_US(&gs_handle, ld3320_interface_timestamp_us);
     DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(&gs_handle, a_callback);
     DRIVER_LD3320_LINK_MP3_READ_INT(&gs_handle, ld3320_interface_mp3_init);
     DRIVER_LD3320_LINK_MP3_READ_DEINT(&gs_handle, ld3320_interface_mp3_deinit);
     DRIVER_LD3320_LINK_MP3_READ(&gs_handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_MP3_ACQUIRE(&gs_handle, ld3320_interface_mp3_acquire);
+    DRIVER_LD3320_LINK_MP3_RELEASE(&gs_handle, ld3320_interface_mp3_release);
+    DRIVER_LD3320_LINK_MUTEX_LOCK(&gs_handle, ld3320_interface_mutex_lock);
+    DRIVER_LD3320_LINK_MUTEX_TRYLOCK(&gs_handle, ld3320_interface_mutex_trylock);
+    DRIVER_LD3320_LINK_MUTEX_UNLOCK(&gs_handle, ld3320_interface_mutex_unlock);
     
     /* get information */
     res = ld3320_info(&info);
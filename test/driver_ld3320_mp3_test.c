@@ -60,13 +60,16 @@ uint8_t ld3320_mp3_test_irq_handler(void)
 
 /**
  * @brief     mp3 callback
+ * @param[in] *context pointer to the device context
  * @param[in] type irq type
  * @param[in] i asr index
  * @param[in] *text pointer to a asr result buffer
  * @note      none
  */
-static void a_callback(uint8_t type, uint8_t i, char *text)
+static void a_callback(void *context, uint8_t type, uint8_t i, char *text)
 {
+    (void)context;
+    
     if (type == LD3320_STATUS_MP3_LOAD)
     {
         /* do nothing */
@@ -96,6 +99,7 @@ uint8_t ld3320_mp3_test(char *name)
     uint8_t res;
     uint32_t timeout;
     ld3320_info_t info;
+    ld3320_mp3_stats_t stats;
     
     /* link driver */
     DRIVER_LD3320_LINK_INIT(&gs_handle, ld3320_handle_t);
@@ -103,16 +107,26 @@ uint8_t ld3320_mp3_test(char *name)
     DRIVER_LD3320_LINK_SPI_DEINIT(&gs_handle, ld3320_interface_spi_deinit);
     DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(&gs_handle, ld3320_interface_spi_read_address16);
     DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(&gs_handle, ld3320_interface_spi_write_cmd);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH(&gs_handle, ld3320_interface_spi_write_batch);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(&gs_handle, ld3320_interface_spi_write_batch_start);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(&gs_handle, ld3320_interface_spi_write_batch_wait);
+    DRIVER_LD3320_LINK_SPI_SET_CLOCK(&gs_handle, ld3320_interface_spi_set_clock);
     DRIVER_LD3320_LINK_RESET_GPIO_INIT(&gs_handle, ld3320_interface_reset_gpio_init);
     DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(&gs_handle, ld3320_interface_reset_gpio_deinit);
     DRIVER_LD3320_LINK_RESET_GPIO_WRITE(&gs_handle, ld3320_interface_reset_gpio_write);
     DRIVER_LD3320_LINK_DELAY_MS(&gs_handle, ld3320_interface_delay_ms);
     DRIVER_LD3320_LINK_DELAY_US(&gs_handle, ld3320_interface_delay_us);
     DRIVER_LD3320_LINK_DEBUG_PRINT(&gs_handle, ld3320_interface_debug_print);
+    DRIVER_LD3320_LINK_TIMESTAMP_US(&gs_handle, ld3320_interface_timestamp_us);
     DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(&gs_handle, a_callback);
     DRIVER_LD3320_LINK_MP3_READ_INT(&gs_handle, ld3320_interface_mp3_init);
     DRIVER_LD3320_LINK_MP3_READ_DEINT(&gs_handle, ld3320_interface_mp3_deinit);
     DRIVER_LD3320_LINK_MP3_READ(&gs_handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_MP3_ACQUIRE(&gs_handle, ld3320_interface_mp3_acquire);
+    DRIVER_LD3320_LINK_MP3_RELEASE(&gs_handle, ld3320_interface_mp3_release);
+    DRIVER_LD3320_LINK_MUTEX_LOCK(&gs_handle, ld3320_interface_mutex_lock);
+    DRIVER_LD3320_LINK_MUTEX_TRYLOCK(&gs_handle, ld3320_interface_mutex_trylock);
+    DRIVER_LD3320_LINK_MUTEX_UNLOCK(&gs_handle, ld3320_interface_mutex_unlock);
     
     /* get information */
     res = ld3320_info(&info);
@@ -158,6 +172,16 @@ uint8_t ld3320_mp3_test(char *name)
         return 1;
     }
     
+    /* set burst feed mode */
+    res = ld3320_set_mp3_feed_mode(&gs_handle, LD3320_MP3_FEED_MODE_BURST);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set mp3 feed mode failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* configure the mp3 */
     ld3320_interface_debug_print("ld3320: play %s.\n", name);
     res = ld3320_configure_mp3(&gs_handle, name);
@@ -211,6 +235,19 @@ uint8_t ld3320_mp3_test(char *name)
         return 1;
     }
     
+    /* print the feed statistics */
+    res = ld3320_get_mp3_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get mp3 stats failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: fed %d bytes in %d irqs.\n", stats.total_bytes, stats.irq_count);
+    ld3320_interface_debug_print("ld3320: %d bytes per irq.\n", stats.bytes_per_irq);
+    ld3320_interface_debug_print("ld3320: effective feed rate is %0.1fkbit/s.\n", stats.kbps);
+    
     /* finish mp3 test */
     ld3320_interface_debug_print("ld3320: finish mp3 test.\n");
     (void)ld3320_deinit(&gs_handle);
@@ -35,9 +35,15 @@
  */
 
 #include "driver_ld3320_register_test.h"
+#include "driver_ld3320_pinyin.h"
 #include <stdlib.h>
+#include <string.h>
 
 static ld3320_handle_t gs_handle;        /**< ld3320 handle */
+static const ld3320_pinyin_override_t gs_pinyin_override[1] =        /**< polyphonic word */
+{
+    {"重庆", "chong qing"},
+};
 
 /**
  * @brief  register test
@@ -59,6 +65,14 @@ uint8_t ld3320_register_test(void)
     ld3320_mic_gain_t gain;
     ld3320_vad_t vad;
     ld3320_status_t status;
+    ld3320_sequence_t seq[3];
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    ld3320_bool_t enable;
+    uint32_t hit, miss;
+#endif
+    uint32_t clock_hz, clock_hz_check;
+    const char *pinyin, *pinyin_check;
+    char pinyin_buf[32];
     
     /* link driver */
     DRIVER_LD3320_LINK_INIT(&gs_handle, ld3320_handle_t);
@@ -66,16 +80,26 @@ uint8_t ld3320_register_test(void)
     DRIVER_LD3320_LINK_SPI_DEINIT(&gs_handle, ld3320_interface_spi_deinit);
     DRIVER_LD3320_LINK_SPI_READ_ADDRESS16(&gs_handle, ld3320_interface_spi_read_address16);
     DRIVER_LD3320_LINK_SPI_WRITE_COMMAND(&gs_handle, ld3320_interface_spi_write_cmd);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH(&gs_handle, ld3320_interface_spi_write_batch);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_START(&gs_handle, ld3320_interface_spi_write_batch_start);
+    DRIVER_LD3320_LINK_SPI_WRITE_BATCH_WAIT(&gs_handle, ld3320_interface_spi_write_batch_wait);
+    DRIVER_LD3320_LINK_SPI_SET_CLOCK(&gs_handle, ld3320_interface_spi_set_clock);
     DRIVER_LD3320_LINK_RESET_GPIO_INIT(&gs_handle, ld3320_interface_reset_gpio_init);
     DRIVER_LD3320_LINK_RESET_GPIO_DEINIT(&gs_handle, ld3320_interface_reset_gpio_deinit);
     DRIVER_LD3320_LINK_RESET_GPIO_WRITE(&gs_handle, ld3320_interface_reset_gpio_write);
     DRIVER_LD3320_LINK_DELAY_MS(&gs_handle, ld3320_interface_delay_ms);
     DRIVER_LD3320_LINK_DELAY_US(&gs_handle, ld3320_interface_delay_us);
     DRIVER_LD3320_LINK_DEBUG_PRINT(&gs_handle, ld3320_interface_debug_print);
+    DRIVER_LD3320_LINK_TIMESTAMP_US(&gs_handle, ld3320_interface_timestamp_us);
     DRIVER_LD3320_LINK_DEBUG_RECEIVE_CALLBACK(&gs_handle, ld3320_interface_receive_callback);
     DRIVER_LD3320_LINK_MP3_READ_INT(&gs_handle, ld3320_interface_mp3_init);
     DRIVER_LD3320_LINK_MP3_READ_DEINT(&gs_handle, ld3320_interface_mp3_deinit);
     DRIVER_LD3320_LINK_MP3_READ(&gs_handle, ld3320_interface_mp3_read);
+    DRIVER_LD3320_LINK_MP3_ACQUIRE(&gs_handle, ld3320_interface_mp3_acquire);
+    DRIVER_LD3320_LINK_MP3_RELEASE(&gs_handle, ld3320_interface_mp3_release);
+    DRIVER_LD3320_LINK_MUTEX_LOCK(&gs_handle, ld3320_interface_mutex_lock);
+    DRIVER_LD3320_LINK_MUTEX_TRYLOCK(&gs_handle, ld3320_interface_mutex_trylock);
+    DRIVER_LD3320_LINK_MUTEX_UNLOCK(&gs_handle, ld3320_interface_mutex_unlock);
     
     /* get information */
     res = ld3320_info(&info);
@@ -311,6 +335,128 @@ uint8_t ld3320_register_test(void)
     ld3320_interface_debug_print("ld3320: check left volume %s.\n", volume_left_check == volume_left ? "ok" : "error");
     ld3320_interface_debug_print("ld3320: check right volume %s.\n", volume_right_check == volume_right ? "ok" : "error");
     
+    /* ld3320_write_sequence test */
+    ld3320_interface_debug_print("ld3320: ld3320_write_sequence test.\n");
+    volume_left = rand() % 16;
+    volume_right = rand() % 16;
+    seq[0].reg = 0x81;
+    seq[0].data = (uint8_t)((((15 - volume_left) & 0x0F) << 2) | 0xC3);
+    seq[0].delay_ms = 0;
+    seq[1].reg = 0x83;
+    seq[1].data = (uint8_t)((((15 - volume_right) & 0x0F) << 2) | 0xC3);
+    seq[1].delay_ms = 0;
+    seq[2].reg = 0x87;
+    seq[2].data = 0x78;
+    seq[2].delay_ms = 1;
+    res = ld3320_write_sequence(&gs_handle, seq, 3);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: write sequence failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: write sequence with left volume 0x%02X and right volume 0x%02X.\n", volume_left, volume_right);
+    res = ld3320_get_headset_volume(&gs_handle, (uint8_t *)&volume_left_check, (uint8_t *)&volume_right_check);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get headset volume failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check sequence %s.\n", 
+                                 (volume_left_check == volume_left) && (volume_right_check == volume_right) ? "ok" : "error");
+    
+#if (LD3320_REGISTER_CACHE_ENABLE != 0)
+    /* ld3320_set_register_cache/ld3320_get_register_cache test */
+    ld3320_interface_debug_print("ld3320: ld3320_set_register_cache/ld3320_get_register_cache test.\n");
+    res = ld3320_set_register_cache(&gs_handle, LD3320_BOOL_TRUE);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set register cache failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: enable register cache.\n");
+    res = ld3320_get_register_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get register cache failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check register cache %s.\n", enable == LD3320_BOOL_TRUE ? "ok" : "error");
+    volume_left = rand() % 16;
+    res = ld3320_set_speaker_volume(&gs_handle, volume_left);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set speaker volume failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: set volume 0x%02X twice.\n", volume_left);
+    res = ld3320_set_speaker_volume(&gs_handle, volume_left);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set speaker volume failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ld3320_get_speaker_volume(&gs_handle, (uint8_t *)&volume_left_check);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get speaker volume failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check cached volume %s.\n", volume_left_check == volume_left ? "ok" : "error");
+    res = ld3320_get_register_cache_stats(&gs_handle, &hit, &miss);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get register cache stats failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: register cache hit %d miss %d.\n", hit, miss);
+    res = ld3320_set_register_cache(&gs_handle, LD3320_BOOL_FALSE);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: set register cache failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: disable register cache.\n");
+#endif
+    
+    /* ld3320_calibrate_spi_clock/ld3320_get_spi_clock test */
+    ld3320_interface_debug_print("ld3320: ld3320_calibrate_spi_clock/ld3320_get_spi_clock test.\n");
+    res = ld3320_calibrate_spi_clock(&gs_handle, 1000 * 1000, 16 * 1000 * 1000, (uint32_t *)&clock_hz);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: calibrate spi clock failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: calibrated spi clock is %d hz.\n", clock_hz);
+    res = ld3320_get_spi_clock(&gs_handle, (uint32_t *)&clock_hz_check);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: get spi clock failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check spi clock %s.\n", clock_hz_check == clock_hz ? "ok" : "error");
+    
     /* ld3320_get_status test */
     ld3320_interface_debug_print("ld3320: ld3320_get_status test.\n");
     res = ld3320_get_status(&gs_handle, &status);
@@ -323,6 +469,40 @@ uint8_t ld3320_register_test(void)
     }
     ld3320_interface_debug_print("ld3320: status is 0x%02X.\n", status);
     
+    /* ld3320_pinyin_lookup/ld3320_pinyin_convert test */
+    ld3320_interface_debug_print("ld3320: ld3320_pinyin_lookup/ld3320_pinyin_convert test.\n");
+    res = ld3320_pinyin_lookup(0x4E2D, &pinyin);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: pinyin lookup failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ld3320_pinyin_lookup(0x7EFF, &pinyin_check);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: pinyin lookup failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check pinyin lookup %s.\n",
+                                 (strcmp(pinyin, "zhong") == 0) && (strcmp(pinyin_check, "lv") == 0) ? "ok" : "error");
+    res = ld3320_pinyin_convert("打开重庆", gs_pinyin_override, 1, pinyin_buf, 32);
+    if (res != 0)
+    {
+        ld3320_interface_debug_print("ld3320: pinyin convert failed.\n");
+        (void)ld3320_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ld3320_interface_debug_print("ld3320: check pinyin override %s.\n", strcmp(pinyin_buf, "da kai chong qing") == 0 ? "ok" : "error");
+    res = ld3320_pinyin_convert("\xE4\xB8", NULL, 0, pinyin_buf, 32);
+    ld3320_interface_debug_print("ld3320: check pinyin invalid utf-8 %s.\n", res == 4 ? "ok" : "error");
+    res = ld3320_pinyin_convert("中", NULL, 0, pinyin_buf, 3);
+    ld3320_interface_debug_print("ld3320: check pinyin short buffer %s.\n", res == 5 ? "ok" : "error");
+    
     /* finish register test */
     ld3320_interface_debug_print("ld3320: finish register test.\n");
     (void)ld3320_deinit(&gs_handle);